@@ -8,17 +8,23 @@
 #include <MD_MAX72xx.h>
 #include <SPI.h>
 #include <ESPAsyncWebServer.h>
+#include <AsyncJson.h>
 #include <DNSServer.h>
 #include <sntp.h>
 #include <time.h>
 #include <WiFiClientSecure.h>
 #include <ESPmDNS.h>
 
-#include "mfactoryfont.h"   // Custom font
-#include "tz_lookup.h"      // Timezone lookup, do not duplicate mapping here!
-#include "days_lookup.h"    // Languages for the Days of the Week
-#include "months_lookup.h"  // Languages for the Months of the Year
-#include "index_html.h"     // Web UI
+#include "mfactoryfont.h"     // Custom font
+#include "tz_lookup.h"        // Timezone lookup, do not duplicate mapping here!
+#include "days_lookup.h"      // Languages for the Days of the Week
+#include "months_lookup.h"    // Languages for the Months of the Year
+#include "translit_lookup.h"  // Weather description transliteration
+#include "index_html.h"       // Web UI
+#include "index_html_gz.h"    // Web UI, gzipped by tools/gen_index_html_gz.py
+
+static_assert(INDEX_HTML_GZ_SOURCE_HASH == INDEX_HTML_HASH,
+              "index_html_gz.h is out of date, run tools/gen_index_html_gz.py");
 
 // ============================
 // Board-specific MAX7219 pin mapping
@@ -62,7 +68,88 @@ WiFiEventHandler mGotIpHandler;
 #endif
 
 MD_Parola P = MD_Parola(HARDWARE_TYPE, DATA_PIN, CLK_PIN, CS_PIN, MAX_DEVICES);
+
+// --- Render cache (see renderPrint) ---
+#define RENDER_ZONES 1
+struct ZoneRenderState {
+  char text[64];        // last text printed to the zone
+  bool textValid;       // false after a scroll, clear, flip or spacing change
+  int charSpacing;      // -1 = unknown
+  int alignment;        // textPosition_t, -1 = unknown
+  int intensity;        // -1 = unknown
+};
+ZoneRenderState renderCache[RENDER_ZONES] = { { "", false, -1, -1, -1 } };
+unsigned long displaySpiTransactions = 0;  // prints, clears, intensity/shutdown writes sent to the MAX7219
+unsigned long displaySpiSkipped = 0;       // prints/intensity writes dropped because nothing changed
 AsyncWebServer server(80);
+AsyncEventSource events("/events");  // live state for the web UI, see tickEvents()
+
+// Last state pushed over /events; tickEvents() only sends what changed
+const unsigned long EVENTS_UPTIME_INTERVAL = 60000;  // the UI counts seconds locally in between
+const size_t EVENTS_MAX_CLIENTS = 3;
+int eventsSentMode = -1;
+int eventsSentBrightness = -2;
+bool eventsSentDisplayOff = false;
+int eventsSentNtpState = -1;
+unsigned long eventsSentWeatherSeq = 0;
+unsigned long eventsUptimeSentAt = 0;
+
+// WiFi scan results are cached for WIFI_SCAN_TTL so refreshing the UI does
+// not start another radio scan; only the WIFI_SCAN_MAX strongest are kept,
+// sorted by RSSI
+const unsigned long WIFI_SCAN_TTL = 30000;
+const uint8_t WIFI_SCAN_MAX = 24;
+struct ScanEntry {
+  char ssid[33];
+  int8_t rssi;
+};
+ScanEntry wifiScanResults[WIFI_SCAN_MAX];
+uint8_t wifiScanCount = 0;
+unsigned long wifiScanAt = 0;  // millis() of the cached scan, 0 = none yet
+// One chunked /scan response. It owns a copy of the entries it lists, so a
+// scan cached while it is still being sent cannot change them underneath.
+struct ScanStream {
+  ScanEntry entries[WIFI_SCAN_MAX];
+  uint8_t count;
+  uint8_t next;
+  bool opened;
+  bool done;
+  char line[232];  // one entry, SSID escaped
+  size_t lineLen;
+  size_t lineOff;
+};
+
+// Prometheus text for /metrics, rendered into one static buffer per scrape.
+// Only one scrape is served at a time; the buffer is held until the response
+// has gone out (or METRICS_BUSY_TIMEOUT passed).
+const size_t METRICS_BUFFER_SIZE = 4096;
+const unsigned long METRICS_BUSY_TIMEOUT = 10000;
+char metricsBuffer[METRICS_BUFFER_SIZE];
+unsigned long metricsBusySince = 0;  // 0 = buffer free
+struct MetricsWriter {
+  size_t len;
+  size_t familyStart;  // where the family being written began
+  uint8_t dropped;     // families left out because they did not fit
+};
+
+// Request admission for the /set_* and /settings endpoints: a token bucket
+// per client IP plus a cap on responses still being sent. Both answer 429
+// before the handler allocates anything.
+const uint8_t RATE_LIMIT_CLIENTS = 8;
+const uint8_t RATE_LIMIT_BURST = 10;               // requests a client may send back to back
+const unsigned long RATE_LIMIT_REFILL_MS = 200;    // then one every 200 ms (5 per second)
+const uint8_t REQUESTS_IN_FLIGHT_MAX = 4;
+struct RateBucket {
+  uint32_t ip;  // 0 = free slot
+  uint8_t tokens;
+  unsigned long refilledAt;
+};
+RateBucket rateBuckets[RATE_LIMIT_CLIENTS];
+// Admitted requests whose connection is still open, nullptr = free slot.
+// Keyed by request so a release can never free someone else's slot.
+AsyncWebServerRequest *requestsInFlight[REQUESTS_IN_FLIGHT_MAX];
+unsigned long requestsRejectedRate = 0;  // client over its bucket
+unsigned long requestsRejectedBusy = 0;  // too many responses in flight
 
 // --- Global Scroll Speed Settings ---
 const int GENERAL_SCROLL_SPEED = 85;  // Default: Adjust this for Weather Description and Countdown Label (e.g., 50 for faster, 200 for slower)
@@ -88,8 +175,7 @@ char weatherUnits[12] = "metric";
 char timeZone[64] = "";
 char language[8] = "en";
 unsigned long lastWifiConnectTime = 0;
-String mainDesc = "";
-String detailedDesc = "";
+unsigned long wifiDisconnects = 0;  // station disconnect events since boot
 
 // Timing and display settings
 unsigned long clockDuration = 10000;
@@ -140,6 +226,20 @@ unsigned long lastUptimeLog = 0;                   // Timer for hourly logging
 const unsigned long uptimeLogInterval = 600000UL;  // 10 minutes in ms
 unsigned long totalUptimeSeconds = 0;              // Persistent accumulated uptime in seconds
 
+// Uptime is persisted as a ring of fixed-size records in a preallocated file:
+// each save overwrites the oldest slot in place, and boot takes the valid
+// record with the highest sequence number. A torn write loses one save, not
+// the whole total.
+#define UPTIME_RING_PATH "/uptime.log"
+const uint8_t UPTIME_RING_SLOTS = 16;
+struct UptimeRecord {
+  uint32_t seq;  // 0 = empty slot
+  uint32_t seconds;
+  uint32_t crc;  // crc32 of seq and seconds
+};
+uint32_t uptimeRingSeq = 0;  // seq of the newest record, 0 = nothing saved yet
+uint8_t uptimeRingNext = 0;  // slot the next save goes to
+
 // State management
 bool weatherCycleStarted = false;
 WiFiClient client;
@@ -156,10 +256,147 @@ bool isAPMode = false;
 char tempSymbol = '[';
 bool shouldFetchWeatherNow = false;
 
+// Weather snapshot, double-buffered between the fetcher and the main loop.
+// ESP32 fetches on its own FreeRTOS task, ESP8266 runs a non-blocking state
+// machine from the weather loop task. Either way the fetcher fills the back
+// buffer and flips weatherFrontIndex; the main loop only copies the front one.
+enum WeatherFetchStatus {
+  WEATHER_FETCH_OK,
+  WEATHER_FETCH_PARSE_FAILED,
+  WEATHER_FETCH_HTTP_FAILED
+};
+
+struct WeatherSnapshot {
+  WeatherFetchStatus status;
+  char temp[12];            // e.g. "23°"
+  int humidity;             // -1 if not in the payload
+  char description[128];    // normalized, empty if not in the payload
+  bool hasSunTimes;
+  int sunriseHour, sunriseMinute, sunsetHour, sunsetMinute;
+  unsigned long fetchedAt;  // millis() when the response was parsed
+  uint32_t seq;             // bumped on every publish, 0 = nothing yet
+};
+
+WeatherSnapshot weatherSnapshots[2];
+volatile uint8_t weatherFrontIndex = 0;
+uint32_t weatherSeqApplied = 0;  // last snapshot copied into currentTemp etc.
+char weatherRequestUrl[320];     // built by the main loop, read by the fetcher
+
+// OWM responses are parsed with a filter straight into this fixed document,
+// only the fields parseWeatherDoc() reads are kept. Used by the fetcher only.
+StaticJsonDocument<512> weatherDoc;
+StaticJsonDocument<256> weatherFilter;
+uint32_t weatherHeapStart = 0;  // free heap when the current fetch began
+uint32_t weatherHeapLow = 0;    // lowest free heap seen during it
+
+// Last Nightscout reading, kept fresh by the background poller and drawn by
+// display mode 4 without any network I/O
+struct NightscoutReading {
+  int glucose;               // mg/dL, -1 = no reading yet
+  char direction[16];        // "Flat", "SingleUp", ...
+  time_t timestamp;          // reading time (UTC) from dateString, 0 if unknown
+  unsigned long fetchedAt;   // millis() of the last successful poll
+};
+NightscoutReading nightscoutReading = { -1, "?", 0, 0 };
+char nightscoutRequestUrl[256];  // copy of ntpServer2 for the fetcher
+unsigned long lastNightscoutPoll = 0;
+const unsigned long NIGHTSCOUT_FETCH_INTERVAL = 150000;  // 2.5 minutes
+const unsigned long NIGHTSCOUT_RETRY_INTERVAL = 30000;   // until the first reading arrives
+const unsigned long NIGHTSCOUT_FETCH_TIMEOUT = 5000;
+
+// Request counters per remote service, for /metrics. On ESP32 the fetch task
+// updates them, readers just see slightly stale values.
+struct FetchStats {
+  uint32_t count;     // completed fetches
+  uint32_t failures;  // of those, the ones that produced no data
+  unsigned long startedAt;
+  unsigned long lastMs;  // duration of the last completed fetch
+};
+FetchStats weatherFetchStats;
+FetchStats nightscoutFetchStats;
+
+#if defined(ESP32)
+// One fetch task serves both weather and Nightscout; the main loop sets a
+// notification bit per job
+const uint32_t FETCH_WEATHER = 1 << 0;
+const uint32_t FETCH_NIGHTSCOUT = 1 << 1;
+portMUX_TYPE fetchMux = portMUX_INITIALIZER_UNLOCKED;
+TaskHandle_t fetchTaskHandle = nullptr;
+volatile bool weatherFetchBusy = false;
+volatile bool nightscoutFetchBusy = false;
+#define FETCH_LOCK() portENTER_CRITICAL(&fetchMux)
+#define FETCH_UNLOCK() portEXIT_CRITICAL(&fetchMux)
+#else
+enum WeatherFetchState {
+  WEATHER_FETCH_IDLE,
+  WEATHER_FETCH_READING  // request sent, collecting the response
+};
+WeatherFetchState weatherFetchState = WEATHER_FETCH_IDLE;
+WiFiClient weatherClient;
+const size_t WEATHER_RESPONSE_MAX = 2048;
+char weatherResponse[WEATHER_RESPONSE_MAX];  // headers until the blank line, then the body only
+size_t weatherResponseLen = 0;
+int weatherHttpCode = 0;  // 0 until the response headers are complete
+unsigned long weatherFetchStartTime = 0;
+const unsigned long WEATHER_FETCH_TIMEOUT = 10000;  // same budget as the old http.setTimeout()
+// Nightscout: the same shape over HTTPS (see startNightscoutFetch)
+bool nightscoutFetchRunning = false;  // request sent, collecting the response
+const size_t NIGHTSCOUT_RESPONSE_MAX = 1024;
+char nightscoutResponse[NIGHTSCOUT_RESPONSE_MAX];
+size_t nightscoutResponseLen = 0;
+int nightscoutHttpCode = 0;
+unsigned long nightscoutFetchStartTime = 0;
+#define FETCH_LOCK()
+#define FETCH_UNLOCK()
+#endif
+
+// Long-lived HTTPS connection to one server. The client and HTTPClient outlive
+// each request so the socket can be kept alive between fetches (ESP32), and
+// on ESP8266 the BearSSL session is cached so reconnects resume it.
+struct TlsConnection {
+  const char *label;
+  WiFiClientSecure client;
+  HTTPClient http;
+  char host[64];  // server the client is (or was last) connected to
+  uint16_t port;
+#if defined(ESP8266)
+  BearSSL::Session session;
+#endif
+  uint32_t handshakes;  // full connects since boot
+  uint32_t reuses;      // requests sent over an already open connection
+  unsigned long lastHandshakeMs;
+  unsigned long totalHandshakeMs;
+};
+#if defined(ESP32)
+const bool TLS_KEEP_ALIVE = true;
+#else
+const bool TLS_KEEP_ALIVE = false;  // an idle BearSSL context costs too much heap, rely on session resumption
+#endif
+#if defined(ESP32) && !defined(CONFIG_IDF_TARGET_ESP32S2)
+TlsConnection weatherTls = { "weather" };
+#endif
+TlsConnection nightscoutTls = { "nightscout" };
+
 unsigned long lastSwitch = 0;
 unsigned long lastColonBlink = 0;
 int displayMode = 0;  // 0: Clock, 1: Weather, 2: Weather Description, 3: Countdown
 int prevDisplayMode = -1;
+
+// Display-mode rotation (see Display Mode Rotation)
+const int DISPLAY_MODE_COUNT = 7;
+unsigned long modeDwellMs[DISPLAY_MODE_COUNT];  // time spent in each mode since boot
+const char DEFAULT_DISPLAY_ORDER[] = "clock,date,weather,description,countdown,nightscout,message";
+struct DisplayModeInfo {
+  const char *key;   // name used in the displayOrder setting
+  const char *name;  // name used in the log
+  bool (*eligible)();
+};
+char displayOrder[96] = "";                 // user rotation order, empty = default
+int displayModeOrder[DISPLAY_MODE_COUNT];   // modes in rotation order
+int displayModeOrderLen = 0;
+int nextDisplayMode[DISPLAY_MODE_COUNT];    // precomputed successor of each mode
+uint8_t displayModeMask = 0;                // bit n set = mode n can be shown now
+volatile bool displayModeMaskDirty = true;
 bool clockScrollDone = false;
 int currentHumidity = -1;
 bool ntpSyncSuccessful = false;
@@ -172,6 +409,7 @@ enum NtpState {
   NTP_FAILED
 };
 NtpState ntpState = NTP_IDLE;
+volatile unsigned long ntpLastSyncAt = 0;  // millis() of the last SNTP time update, 0 = never
 unsigned long ntpStartTime = 0;
 const int ntpTimeout = 30000;  // 30 seconds
 const int maxNtpRetries = 30;
@@ -197,6 +435,21 @@ unsigned long countdownFinishedMessageStartTime = 0;  // Timer for the 10-second
 unsigned long lastFlashToggleTime = 0;                // For controlling the flashing speed
 bool currentInvertState = false;                      // Current state of display inversion for flashing
 static bool hourglassPlayed = false;
+int hourglassFrame = 0;                 // Next hourglass frame to draw (0..HOURGLASS_FRAME_COUNT)
+unsigned long hourglassFrameTime = 0;   // When the last hourglass frame was drawn
+const int HOURGLASS_FRAME_COUNT = 12;   // 3 turns of 4 frames
+const unsigned long HOURGLASS_FRAME_MS = 350;
+
+// Dramatic countdown "seconds + label" segment, stepped one phase per tick
+enum CountdownLabelPhase {
+  CD_LABEL_IDLE,
+  CD_LABEL_SECONDS,   // first seconds frame shown
+  CD_LABEL_ADJUSTED,  // seconds re-drawn just before the label
+  CD_LABEL_SCROLLING  // label scrolling
+};
+CountdownLabelPhase countdownLabelPhase = CD_LABEL_IDLE;
+unsigned long countdownLabelPhaseTime = 0;
+static char countdownScrollBuffer[128];  // MD_Parola keeps a pointer to scrolled text
 
 // Weather Description Mode handling
 unsigned long descStartTime = 0;  // For static description
@@ -205,6 +458,339 @@ const unsigned long descriptionDuration = 3000;    // 3s for short text
 static unsigned long descScrollEndTime = 0;        // for post-scroll delay (re-used for scroll timing)
 const unsigned long descriptionScrollPause = 300;  // 300ms pause after scroll
 
+// Non-blocking display state (reset whenever the display mode changes)
+bool colonVisible = true;
+unsigned long ntpAnimTimer = 0;
+int ntpAnimFrame = 0;
+bool clockScrolling = false;
+static char clockScrollBuffer[48];
+unsigned long ipClearStartTime = 0;       // IP finished scrolling, display held blank until +500ms
+bool nightscoutShown = false;             // Nightscout reading (or error) is on the display
+unsigned long nightscoutShownAt = 0;
+unsigned long nightscoutHoldMs = 0;
+bool messageShowing = false;              // short custom message is on the display
+unsigned long messageShownAt = 0;
+unsigned long messageHoldMs = 0;
+bool messageScrolling = false;            // long custom message is scrolling
+static char messageScrollBuffer[136];
+
+// Loop latency histograms, one per instrumented section (served on /loop_stats)
+enum LoopSection {
+  SECTION_LOOP_PASS,
+  SECTION_DIMMING,
+  SECTION_COUNTDOWN_TRIGGER,
+  SECTION_NTP,
+  SECTION_WEATHER_FETCH,
+  SECTION_NIGHTSCOUT_POLL,
+  SECTION_DISPLAY,
+  SECTION_UPTIME,
+  SECTION_CLOCK_RENDER,
+  SECTION_WEATHER_RENDER,
+  SECTION_DESCRIPTION_RENDER,
+  SECTION_COUNTDOWN_RENDER,
+  SECTION_NIGHTSCOUT_RENDER,
+  SECTION_DATE_RENDER,
+  SECTION_MESSAGE_RENDER,
+  SECTION_UPTIME_SAVE,
+  SECTION_CONFIG_FLUSH,
+  SECTION_CONFIG_APPLY,
+  SECTION_EVENTS,
+  LOOP_SECTION_COUNT
+};
+const char *const LOOP_SECTION_NAMES[LOOP_SECTION_COUNT] = {
+  "loop_pass", "dimming", "countdown_trigger", "ntp", "weather_fetch", "nightscout_poll",
+  "display", "uptime", "clock_render", "weather_render", "description_render",
+  "countdown_render", "nightscout_render", "date_render", "message_render", "uptime_save",
+  "config_flush", "config_apply", "events"
+};
+#define LOOP_HIST_BUCKETS 10
+// Upper bound (exclusive) of each bucket in microseconds, the last one is open
+const uint32_t LOOP_HIST_BOUNDS_US[LOOP_HIST_BUCKETS - 1] = { 50, 100, 250, 500, 1000, 2500, 5000, 10000, 50000 };
+struct LoopSectionStats {
+  uint32_t count;
+  uint32_t maxUs;
+  uint64_t totalUs;
+  uint32_t buckets[LOOP_HIST_BUCKETS];
+};
+LoopSectionStats loopSectionStats[LOOP_SECTION_COUNT];  // static arena, nothing allocated at runtime
+// Whole loop() passes against their own budget: several ticks that each fit
+// LOOP_TICK_BUDGET_US can still add up to a stalled display
+const unsigned long LOOP_PASS_BUDGET_US = 5000;
+struct LoopPassStats {
+  uint32_t overruns;
+  uint32_t worstUs;
+  const char *worstTask;  // heaviest tick of the worst pass
+  uint32_t worstTaskUs;
+};
+LoopPassStats loopPassStats = { 0, 0, "", 0 };
+
+// Persisted configuration, stored on flash as a binary snapshot of this struct
+// (see saveConfig()) and only turned into JSON for /config.json and /export:
+// changes go through configSet*(), which track a dirty bit per field, and
+// saveConfig() is the only snapshot writer. The runtime globals above are filled from
+// it by applyConfig() at boot.
+struct Config {
+  char ssid[32];
+  char password[64];
+  char openWeatherApiKey[64];
+  char openWeatherCity[64];
+  char openWeatherCountry[64];
+  char weatherUnits[12];
+  int clockDuration;
+  int weatherDuration;
+  char timeZone[64];
+  char language[8];
+  int brightness;
+  bool flipDisplay;
+  bool twelveHourToggle;
+  bool showDayOfWeek;
+  bool showDate;
+  bool showHumidity;
+  bool colonBlinkEnabled;
+  char ntpServer1[64];
+  char ntpServer2[256];
+  bool dimmingEnabled;
+  int dimStartHour;
+  int dimStartMinute;
+  int dimEndHour;
+  int dimEndMinute;
+  int dimBrightness;  // -1 = off
+  bool showWeatherDescription;
+  bool autoDimmingEnabled;
+  int sunriseHour;
+  int sunriseMinute;
+  int sunsetHour;
+  int sunsetMinute;
+  bool clockOnlyDuringDimming;
+  char displayOrder[96];
+  char customMessage[121];
+  bool countdownEnabled;
+  time_t countdownTargetTimestamp;
+  char countdownLabel[64];
+  bool isDramaticCountdown;
+};
+
+enum ConfigFieldType {
+  CFG_TYPE_STR,
+  CFG_TYPE_BOOL,
+  CFG_TYPE_INT,
+  CFG_TYPE_TIME
+};
+
+struct ConfigField {
+  const char *key;
+  ConfigFieldType type;
+  uint16_t offset;    // into Config
+  uint16_t size;      // buffer size for strings
+  const char *group;  // nested JSON object, nullptr = top level
+};
+
+// Same order as configFields[]
+enum ConfigFieldId {
+  CFG_SSID,
+  CFG_PASSWORD,
+  CFG_OPENWEATHER_API_KEY,
+  CFG_OPENWEATHER_CITY,
+  CFG_OPENWEATHER_COUNTRY,
+  CFG_WEATHER_UNITS,
+  CFG_CLOCK_DURATION,
+  CFG_WEATHER_DURATION,
+  CFG_TIME_ZONE,
+  CFG_LANGUAGE,
+  CFG_BRIGHTNESS,
+  CFG_FLIP_DISPLAY,
+  CFG_TWELVE_HOUR,
+  CFG_SHOW_DAY_OF_WEEK,
+  CFG_SHOW_DATE,
+  CFG_SHOW_HUMIDITY,
+  CFG_COLON_BLINK,
+  CFG_NTP_SERVER1,
+  CFG_NTP_SERVER2,
+  CFG_DIMMING_ENABLED,
+  CFG_DIM_START_HOUR,
+  CFG_DIM_START_MINUTE,
+  CFG_DIM_END_HOUR,
+  CFG_DIM_END_MINUTE,
+  CFG_DIM_BRIGHTNESS,
+  CFG_SHOW_WEATHER_DESCRIPTION,
+  CFG_AUTO_DIMMING,
+  CFG_SUNRISE_HOUR,
+  CFG_SUNRISE_MINUTE,
+  CFG_SUNSET_HOUR,
+  CFG_SUNSET_MINUTE,
+  CFG_CLOCK_ONLY_DURING_DIMMING,
+  CFG_DISPLAY_ORDER,
+  CFG_CUSTOM_MESSAGE,
+  CFG_COUNTDOWN_ENABLED,
+  CFG_COUNTDOWN_TARGET,
+  CFG_COUNTDOWN_LABEL,
+  CFG_COUNTDOWN_DRAMATIC,
+  CONFIG_FIELD_COUNT
+};
+
+#define CFG_BIT(id) (1ULL << (id))
+
+// Fields whose change /save cannot apply without a restart
+const uint64_t CONFIG_RESTART_FIELDS = CFG_BIT(CFG_SSID) | CFG_BIT(CFG_PASSWORD);
+// Fields that make the current weather stale
+const uint64_t CONFIG_WEATHER_FIELDS = CFG_BIT(CFG_OPENWEATHER_API_KEY) | CFG_BIT(CFG_OPENWEATHER_CITY)
+                                       | CFG_BIT(CFG_OPENWEATHER_COUNTRY) | CFG_BIT(CFG_WEATHER_UNITS)
+                                       | CFG_BIT(CFG_LANGUAGE);
+const uint64_t CONFIG_COUNTDOWN_FIELDS = CFG_BIT(CFG_COUNTDOWN_ENABLED) | CFG_BIT(CFG_COUNTDOWN_TARGET)
+                                         | CFG_BIT(CFG_COUNTDOWN_LABEL) | CFG_BIT(CFG_COUNTDOWN_DRAMATIC);
+
+#define CONFIG_FIELD(key, type, member, group) \
+  { key, type, offsetof(Config, member), sizeof(((Config *)0)->member), group }
+
+const ConfigField configFields[CONFIG_FIELD_COUNT] = {
+  CONFIG_FIELD("ssid", CFG_TYPE_STR, ssid, nullptr),
+  CONFIG_FIELD("password", CFG_TYPE_STR, password, nullptr),
+  CONFIG_FIELD("openWeatherApiKey", CFG_TYPE_STR, openWeatherApiKey, nullptr),
+  CONFIG_FIELD("openWeatherCity", CFG_TYPE_STR, openWeatherCity, nullptr),
+  CONFIG_FIELD("openWeatherCountry", CFG_TYPE_STR, openWeatherCountry, nullptr),
+  CONFIG_FIELD("weatherUnits", CFG_TYPE_STR, weatherUnits, nullptr),
+  CONFIG_FIELD("clockDuration", CFG_TYPE_INT, clockDuration, nullptr),
+  CONFIG_FIELD("weatherDuration", CFG_TYPE_INT, weatherDuration, nullptr),
+  CONFIG_FIELD("timeZone", CFG_TYPE_STR, timeZone, nullptr),
+  CONFIG_FIELD("language", CFG_TYPE_STR, language, nullptr),
+  CONFIG_FIELD("brightness", CFG_TYPE_INT, brightness, nullptr),
+  CONFIG_FIELD("flipDisplay", CFG_TYPE_BOOL, flipDisplay, nullptr),
+  CONFIG_FIELD("twelveHourToggle", CFG_TYPE_BOOL, twelveHourToggle, nullptr),
+  CONFIG_FIELD("showDayOfWeek", CFG_TYPE_BOOL, showDayOfWeek, nullptr),
+  CONFIG_FIELD("showDate", CFG_TYPE_BOOL, showDate, nullptr),
+  CONFIG_FIELD("showHumidity", CFG_TYPE_BOOL, showHumidity, nullptr),
+  CONFIG_FIELD("colonBlinkEnabled", CFG_TYPE_BOOL, colonBlinkEnabled, nullptr),
+  CONFIG_FIELD("ntpServer1", CFG_TYPE_STR, ntpServer1, nullptr),
+  CONFIG_FIELD("ntpServer2", CFG_TYPE_STR, ntpServer2, nullptr),
+  CONFIG_FIELD("dimmingEnabled", CFG_TYPE_BOOL, dimmingEnabled, nullptr),
+  CONFIG_FIELD("dimStartHour", CFG_TYPE_INT, dimStartHour, nullptr),
+  CONFIG_FIELD("dimStartMinute", CFG_TYPE_INT, dimStartMinute, nullptr),
+  CONFIG_FIELD("dimEndHour", CFG_TYPE_INT, dimEndHour, nullptr),
+  CONFIG_FIELD("dimEndMinute", CFG_TYPE_INT, dimEndMinute, nullptr),
+  CONFIG_FIELD("dimBrightness", CFG_TYPE_INT, dimBrightness, nullptr),
+  CONFIG_FIELD("showWeatherDescription", CFG_TYPE_BOOL, showWeatherDescription, nullptr),
+  CONFIG_FIELD("autoDimmingEnabled", CFG_TYPE_BOOL, autoDimmingEnabled, nullptr),
+  CONFIG_FIELD("sunriseHour", CFG_TYPE_INT, sunriseHour, nullptr),
+  CONFIG_FIELD("sunriseMinute", CFG_TYPE_INT, sunriseMinute, nullptr),
+  CONFIG_FIELD("sunsetHour", CFG_TYPE_INT, sunsetHour, nullptr),
+  CONFIG_FIELD("sunsetMinute", CFG_TYPE_INT, sunsetMinute, nullptr),
+  CONFIG_FIELD("clockOnlyDuringDimming", CFG_TYPE_BOOL, clockOnlyDuringDimming, nullptr),
+  CONFIG_FIELD("displayOrder", CFG_TYPE_STR, displayOrder, nullptr),
+  CONFIG_FIELD("customMessage", CFG_TYPE_STR, customMessage, nullptr),
+  CONFIG_FIELD("enabled", CFG_TYPE_BOOL, countdownEnabled, "countdown"),
+  CONFIG_FIELD("targetTimestamp", CFG_TYPE_TIME, countdownTargetTimestamp, "countdown"),
+  CONFIG_FIELD("label", CFG_TYPE_STR, countdownLabel, "countdown"),
+  CONFIG_FIELD("isDramaticCountdown", CFG_TYPE_BOOL, isDramaticCountdown, "countdown"),
+};
+static_assert(CONFIG_FIELD_COUNT <= 64, "configDirty has one bit per field");
+
+Config config;
+uint64_t configDirty = 0;  // bit n set = configFields[n] changed since the last save
+uint32_t configRevision = 0;  // bumped on every change to config, see refreshConfigView()
+
+// Deferred config writes: bursts of /set_* calls are coalesced into one
+// flash write at most every CONFIG_FLUSH_DELAY ms
+const unsigned long CONFIG_FLUSH_DELAY = 5000;
+bool configFlushPending = false;
+unsigned long configFlushRequestedAt = 0;
+unsigned long configWrites = 0;         // journal appends and snapshots since boot
+unsigned long configWritesAvoided = 0;  // save requests folded into a pending write
+unsigned long fsBytesWritten = 0;       // bytes written to LittleFS since boot
+
+// Changes queued by web handlers (see commitConfigEdit), moved into config,
+// applied and persisted by tickConfigApply() on the main loop. CONFIG_LOCK
+// covers these and every write to config.
+Config configEditBase;             // config as the handler found it
+Config configEdit;                 // the handler's edited copy
+Config configQueued;               // values of the queued fields
+uint64_t configQueuedFields = 0;   // bit n set = configFields[n] queued
+bool configQueuedFlush = false;    // write them out now instead of deferred
+bool configQueuedSnapshot = false; // write a whole snapshot (config replaced)
+volatile bool configRestartRequested = false;  // restart once the queue is on flash
+#if defined(ESP32)
+portMUX_TYPE configMux = portMUX_INITIALIZER_UNLOCKED;
+#define CONFIG_LOCK() portENTER_CRITICAL(&configMux)
+#define CONFIG_UNLOCK() portEXIT_CRITICAL(&configMux)
+#else
+#define CONFIG_LOCK()
+#define CONFIG_UNLOCK()
+#endif
+
+// Settings changes are appended to a journal of CRC-checked key/value records
+// and folded back into the /config.bin snapshot once the journal grows past
+// CONFIG_JOURNAL_COMPACT_BYTES. Record: header, key, value (as text), crc32.
+#define CONFIG_JOURNAL_PATH "/config.log"
+const uint8_t CONFIG_JOURNAL_MAGIC = 0xC5;
+const size_t CONFIG_JOURNAL_COMPACT_BYTES = 2048;
+struct ConfigJournalHeader {
+  uint8_t magic;
+  uint8_t keyLen;
+  uint16_t valueLen;
+};
+
+// Snapshot: header followed by the raw Config. New fields go at the end of
+// Config so an older, shorter snapshot still loads; bump the version for any
+// other layout change (an incompatible snapshot is ignored at boot).
+#define CONFIG_SNAPSHOT_PATH "/config.bin"
+const uint32_t CONFIG_SNAPSHOT_MAGIC = 0x47464354;  // "TCFG"
+const uint16_t CONFIG_SNAPSHOT_VERSION = 1;
+struct ConfigSnapshotHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;  // sizeof(Config) when written
+  uint32_t crc;   // crc32 of the Config bytes
+};
+static_assert(sizeof(Config) <= 0xFFFF, "Config too large for the snapshot header");
+
+// /upload streams into CONFIG_UPLOAD_TMP while a byte-at-a-time validator
+// checks the structure; only a complete, valid file is merged onto the
+// current config, which is then saved and the clock restarted
+#define CONFIG_UPLOAD_TMP "/config.upload"
+const size_t CONFIG_UPLOAD_MAX = 4096;
+// Parsed through a filter of the known keys, so the document holds at most
+// one member per field plus the strings, which cannot outgrow the file
+const size_t CONFIG_UPLOAD_DOC_SIZE = 2 * JSON_OBJECT_SIZE(CONFIG_FIELD_COUNT + 1) + CONFIG_UPLOAD_MAX;
+const uint16_t CONFIG_UPLOAD_MAX_STRING = 300;
+const uint8_t CONFIG_UPLOAD_MAX_DEPTH = 4;
+const unsigned long CONFIG_UPLOAD_STALE_MS = 30000;  // abandoned uploads give way after this
+struct JsonStreamValidator {
+  size_t bytes;
+  uint8_t depth;
+  uint8_t objectLevels;  // bit n set: level n+1 is an object, clear: an array
+  uint16_t stringLen;
+  bool started;
+  bool inString;
+  bool escape;
+  bool done;
+  const char *error;  // first problem found, nullptr while valid
+};
+struct ConfigUpload {
+  AsyncWebServerRequest *owner;
+  unsigned long startedAt;
+  File file;
+  JsonStreamValidator json;
+};
+ConfigUpload configUpload;
+
+// Serialized, already-masked config as served by /config.json and /export.
+// Rebuilt by the main loop when configRevision or the WiFi mode moved on.
+// Each response holds a reference to the body it is sending, so a rebuild
+// never frees one still in flight.
+struct ConfigViewBody {
+  uint16_t refs;  // the view itself plus each response still sending it
+  char etag[12];
+  size_t len;
+  char text[1];   // len + 1 bytes allocated
+};
+struct ConfigView {
+  bool apMode;
+  bool buildFailed;
+  uint32_t revision;
+  ConfigViewBody *body;  // swapped under CONFIG_LOCK
+};
+ConfigView configView;
+ConfigView exportView;
+
 // --- Safe WiFi credential and API getters ---
 const char *getSafeSsid() {
   if (isAPMode && strlen(ssid) == 0) {
@@ -245,382 +831,1215 @@ textEffect_t getEffectiveScrollDirection(textEffect_t desiredDirection, bool isF
 
 
 // -----------------------------------------------------------------------------
-// Configuration Load & Save
+// Render Cache
 // -----------------------------------------------------------------------------
-void loadConfig() {
-  Serial.println(F("[CONFIG] Loading configuration..."));
-
-  // Check if config.json exists, if not, create default
-  if (!LittleFS.exists("/config.json")) {
-    Serial.println(F("[CONFIG] config.json not found, creating with defaults..."));
-    DynamicJsonDocument doc(1024);
-    doc[F("ssid")] = "";
-    doc[F("password")] = "";
-    doc[F("openWeatherApiKey")] = "";
-    doc[F("openWeatherCity")] = "";
-    doc[F("openWeatherCountry")] = "";
-    doc[F("weatherUnits")] = "metric";
-    doc[F("clockDuration")] = 10000;
-    doc[F("weatherDuration")] = 5000;
-    doc[F("timeZone")] = "";
-    doc[F("language")] = "en";
-    doc[F("brightness")] = brightness;
-    doc[F("flipDisplay")] = flipDisplay;
-    doc[F("twelveHourToggle")] = twelveHourToggle;
-    doc[F("showDayOfWeek")] = showDayOfWeek;
-    doc[F("showDate")] = false;
-    doc[F("showHumidity")] = showHumidity;
-    doc[F("colonBlinkEnabled")] = colonBlinkEnabled;
-    doc[F("ntpServer1")] = ntpServer1;
-    doc[F("ntpServer2")] = ntpServer2;
-    doc[F("dimmingEnabled")] = dimmingEnabled;
-    doc[F("dimStartHour")] = dimStartHour;
-    doc[F("dimStartMinute")] = dimStartMinute;
-    doc[F("dimEndHour")] = dimEndHour;
-    doc[F("dimEndMinute")] = dimEndMinute;
-    doc[F("dimBrightness")] = dimBrightness;
-    doc[F("showWeatherDescription")] = showWeatherDescription;
-
-    // --- Automatic dimming defaults ---
-    doc[F("autoDimmingEnabled")] = autoDimmingEnabled;
-    doc[F("sunriseHour")] = sunriseHour;
-    doc[F("sunriseMinute")] = sunriseMinute;
-    doc[F("sunsetHour")] = sunsetHour;
-    doc[F("sunsetMinute")] = sunsetMinute;
-    doc[F("clockOnlyDuringDimming")] = false;
-
-    // Add countdown defaults when creating a new config.json
-    JsonObject countdownObj = doc.createNestedObject("countdown");
-    countdownObj["enabled"] = false;
-    countdownObj["targetTimestamp"] = 0;
-    countdownObj["label"] = "";
-    countdownObj["isDramaticCountdown"] = true;
-
-    File f = LittleFS.open("/config.json", "w");
-    if (f) {
-      serializeJsonPretty(doc, f);
-      f.close();
-      Serial.println(F("[CONFIG] Default config.json created."));
-    } else {
-      Serial.println(F("[ERROR] Failed to create default config.json"));
-    }
-  }
-
-  Serial.println(F("[CONFIG] Attempting to open config.json for reading."));
-  File configFile = LittleFS.open("/config.json", "r");
-  if (!configFile) {
-    Serial.println(F("[ERROR] Failed to open config.json for reading. Cannot load config."));
-    return;
+// All static drawing goes through these helpers. They remember what each zone
+// shows and only call into MD_Parola (and so the SPI bus) when the text,
+// spacing, alignment or intensity actually changed. Anything that draws
+// behind their back (scrolls, clears, flips) must invalidate the cache.
+void invalidateRenderCache() {
+  for (uint8_t z = 0; z < RENDER_ZONES; z++) {
+    renderCache[z].textValid = false;
   }
+}
 
-  DynamicJsonDocument doc(1024);  // Size based on ArduinoJson Assistant + buffer
-  DeserializationError error = deserializeJson(doc, configFile);
-  configFile.close();
 
-  if (error) {
-    Serial.print(F("[ERROR] JSON parse failed during load: "));
-    Serial.println(error.f_str());
+void renderSetIntensity(uint8_t intensity) {
+  ZoneRenderState &zone = renderCache[0];
+  if (zone.intensity == intensity) {
+    displaySpiSkipped++;
     return;
   }
+  P.setIntensity(intensity);
+  zone.intensity = intensity;
+  displaySpiTransactions++;
+}
 
-  bool configChanged = false;
-
-  strlcpy(ssid, doc["ssid"] | "", sizeof(ssid));
-  strlcpy(password, doc["password"] | "", sizeof(password));
-  strlcpy(openWeatherApiKey, doc["openWeatherApiKey"] | "", sizeof(openWeatherApiKey));
-  strlcpy(openWeatherCity, doc["openWeatherCity"] | "", sizeof(openWeatherCity));
-  strlcpy(openWeatherCountry, doc["openWeatherCountry"] | "", sizeof(openWeatherCountry));
-  strlcpy(weatherUnits, doc["weatherUnits"] | "metric", sizeof(weatherUnits));
-  strlcpy(customMessage, doc["customMessage"] | "", sizeof(customMessage));
-  strlcpy(lastPersistentMessage, customMessage, sizeof(lastPersistentMessage));
-  clockDuration = doc["clockDuration"] | 10000;
-  weatherDuration = doc["weatherDuration"] | 5000;
-  strlcpy(timeZone, doc["timeZone"] | "Etc/UTC", sizeof(timeZone));
-  if (doc.containsKey("language")) {
-    strlcpy(language, doc["language"], sizeof(language));
-  } else {
-    strlcpy(language, "en", sizeof(language));
-    Serial.println(F("[CONFIG] 'language' key not found in config.json, defaulting to 'en'."));
-  }
-
-  brightness = doc["brightness"] | 7;
-  flipDisplay = doc["flipDisplay"] | false;
-  twelveHourToggle = doc["twelveHourToggle"] | false;
-  showDayOfWeek = doc["showDayOfWeek"] | true;
-  showDate = doc["showDate"] | false;
-  showHumidity = doc["showHumidity"] | false;
-  colonBlinkEnabled = doc.containsKey("colonBlinkEnabled") ? doc["colonBlinkEnabled"].as<bool>() : true;
-  showWeatherDescription = doc["showWeatherDescription"] | false;
-
-  // --- Dimming settings ---
-  if (doc["dimmingEnabled"].is<bool>()) {
-    dimmingEnabled = doc["dimmingEnabled"].as<bool>();
-  } else {
-    String de = doc["dimmingEnabled"].as<String>();
-    dimmingEnabled = (de == "true" || de == "1" || de == "on");
-  }
-
-  String de = doc["dimmingEnabled"].as<String>();
-  dimmingEnabled = (de == "true" || de == "on" || de == "1");
-
-  dimStartHour = doc["dimStartHour"] | 18;
-  dimStartMinute = doc["dimStartMinute"] | 0;
-  dimEndHour = doc["dimEndHour"] | 8;
-  dimEndMinute = doc["dimEndMinute"] | 0;
-  dimBrightness = doc["dimBrightness"] | 0;
 
-  // safely handle both numeric or string "Off" for dimBrightness
-  if (doc["dimBrightness"].is<int>()) {
-    dimBrightness = doc["dimBrightness"].as<int>();
-  } else {
-    String val = doc["dimBrightness"].as<String>();
-    if (val.equalsIgnoreCase("off")) dimBrightness = -1;
-    else dimBrightness = val.toInt();
-  }
+void renderSetCharSpacing(uint8_t spacing) {
+  ZoneRenderState &zone = renderCache[0];
+  if (zone.charSpacing == spacing) return;
+  P.setCharSpacing(spacing);
+  zone.charSpacing = spacing;
+  zone.textValid = false;  // takes effect on the next print
+}
 
-  // --- Automatic dimming ---
-  if (doc.containsKey("autoDimmingEnabled")) {
-    if (doc["autoDimmingEnabled"].is<bool>()) {
-      autoDimmingEnabled = doc["autoDimmingEnabled"].as<bool>();
-    } else {
-      String val = doc["autoDimmingEnabled"].as<String>();
-      autoDimmingEnabled = (val == "true" || val == "1" || val == "on");
-    }
-  } else {
-    autoDimmingEnabled = false;  // default if key missing
-  }
 
-  sunriseHour = doc["sunriseHour"] | 6;
-  sunriseMinute = doc["sunriseMinute"] | 0;
-  sunsetHour = doc["sunsetHour"] | 18;
-  sunsetMinute = doc["sunsetMinute"] | 0;
+void renderSetTextAlignment(textPosition_t alignment) {
+  ZoneRenderState &zone = renderCache[0];
+  if (zone.alignment == alignment) return;
+  P.setTextAlignment(alignment);
+  zone.alignment = alignment;
+  zone.textValid = false;  // takes effect on the next print
+}
 
-  strlcpy(ntpServer1, doc["ntpServer1"] | "pool.ntp.org", sizeof(ntpServer1));
-  strlcpy(ntpServer2, doc["ntpServer2"] | "time.nist.gov", sizeof(ntpServer2));
 
-  if (strcmp(weatherUnits, "imperial") == 0)
-    tempSymbol = ']';
-  else
-    tempSymbol = '[';
+void renderPrint(const char *text) {
+  ZoneRenderState &zone = renderCache[0];
+  if (zone.textValid && strcmp(zone.text, text) == 0) {
+    displaySpiSkipped++;
+    return;
+  }
+  P.print(text);
+  strlcpy(zone.text, text, sizeof(zone.text));
+  // Text too long for the cache can't be compared, so it is always redrawn
+  zone.textValid = strlen(text) < sizeof(zone.text);
+  displaySpiTransactions++;
+}
 
 
-  // --- COUNTDOWN CONFIG LOADING ---
-  if (doc.containsKey("countdown")) {
-    JsonObject countdownObj = doc["countdown"];
+void renderPrint(const String &text) {
+  renderPrint(text.c_str());
+}
 
-    countdownEnabled = countdownObj["enabled"] | false;
-    countdownTargetTimestamp = countdownObj["targetTimestamp"] | 0;
-    isDramaticCountdown = countdownObj["isDramaticCountdown"] | true;
 
-    JsonVariant labelVariant = countdownObj["label"];
-    if (labelVariant.isNull() || !labelVariant.is<const char *>()) {
-      strcpy(countdownLabel, "");
-    } else {
-      const char *labelTemp = labelVariant.as<const char *>();
-      size_t labelLen = strlen(labelTemp);
-      if (labelLen >= sizeof(countdownLabel)) {
-        Serial.println(F("[CONFIG] label from JSON too long, truncating."));
-      }
-      strlcpy(countdownLabel, labelTemp, sizeof(countdownLabel));
-    }
-    countdownFinished = false;
-  } else {
-    countdownEnabled = false;
-    countdownTargetTimestamp = 0;
-    strcpy(countdownLabel, "");
-    isDramaticCountdown = true;
-    Serial.println(F("[CONFIG] Countdown object not found, defaulting to disabled."));
-    countdownFinished = false;
-  }
+void renderPrint(const __FlashStringHelper *text) {
+  char buf[sizeof(renderCache[0].text)];
+  strncpy_P(buf, (PGM_P)text, sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = '\0';
+  renderPrint(buf);
+}
 
-  // --- CLOCK-ONLY-DURING-DIMMING LOADING ---
-  if (doc.containsKey("clockOnlyDuringDimming")) {
-    clockOnlyDuringDimming = doc["clockOnlyDuringDimming"].as<bool>();
-  } else {
-    clockOnlyDuringDimming = false;
-    doc["clockOnlyDuringDimming"] = clockOnlyDuringDimming;
-    configChanged = true;
-    Serial.println(F("[CONFIG] Migrated: added clockOnlyDuringDimming default."));
-  }
 
-  // --- Save migrated config if needed ---
-  if (configChanged) {
-    Serial.println(F("[CONFIG] Saving migrated config.json"));
+void renderClear() {
+  P.displayClear();
+  invalidateRenderCache();
+  displaySpiTransactions++;
+}
 
-    File f = LittleFS.open("/config.json", "w");
-    if (f) {
-      serializeJsonPretty(doc, f);
-      f.close();
-      Serial.println(F("[CONFIG] Migration saved successfully."));
-    } else {
-      Serial.println(F("[ERROR] Failed to save migrated config.json"));
-    }
-  }
 
-  Serial.println(F("[CONFIG] Configuration loaded."));
+void renderShutdown(bool off) {
+  P.displayShutdown(off);
+  invalidateRenderCache();
+  displaySpiTransactions++;
 }
 
 
 // -----------------------------------------------------------------------------
-// Network Identity
+// Configuration Load & Save
 // -----------------------------------------------------------------------------
-void setupHostname() {
-#if defined(ESP8266)
-  WiFi.hostname(deviceHostname);
-#elif defined(ESP32)
-  WiFi.setHostname(deviceHostname.c_str());
-#endif
+// Values a fresh install starts with, and what a key missing from an
+// uploaded config.json falls back to
+void configSetDefaults(Config &c) {
+  memset(&c, 0, sizeof(c));
+  strlcpy(c.weatherUnits, "metric", sizeof(c.weatherUnits));
+  c.clockDuration = 10000;
+  c.weatherDuration = 5000;
+  strlcpy(c.language, "en", sizeof(c.language));
+  c.brightness = 7;
+  c.showDayOfWeek = true;
+  c.colonBlinkEnabled = true;
+  strlcpy(c.ntpServer1, "pool.ntp.org", sizeof(c.ntpServer1));
+  strlcpy(c.ntpServer2, "time.nist.gov", sizeof(c.ntpServer2));
+  c.dimStartHour = 18;
+  c.dimEndHour = 8;
+  c.dimBrightness = 2;
+  c.sunriseHour = 6;
+  c.sunsetHour = 18;
+  strlcpy(c.displayOrder, DEFAULT_DISPLAY_ORDER, sizeof(c.displayOrder));
+  c.isDramaticCountdown = true;
 }
 
 
-// -----------------------------------------------------------------------------
-// WiFi Setup
-// -----------------------------------------------------------------------------
-void connectWiFi() {
-  Serial.println(F("[WIFI] Connecting to WiFi..."));
+// Older files (and /save before this model) stored some flags and numbers
+// as strings, so both are accepted
+bool configJsonBool(JsonVariantConst v) {
+  if (v.is<bool>()) return v.as<bool>();
+  if (v.is<long>()) return v.as<long>() != 0;
+  const char *s = v.as<const char *>();
+  return s && (strcmp(s, "true") == 0 || strcmp(s, "on") == 0 || strcmp(s, "1") == 0);
+}
 
-  bool credentialsExist = (strlen(ssid) > 0);
 
-  if (!credentialsExist) {
-    Serial.println(F("[WIFI] No saved credentials. Starting AP mode directly."));
-    WiFi.mode(WIFI_AP);
-    WiFi.disconnect(true);
-    delay(100);
+long configJsonInt(JsonVariantConst v) {
+  if (v.is<long>()) return v.as<long>();
+  if (v.is<float>()) return (long)v.as<float>();
+  const char *s = v.as<const char *>();
+  if (!s) return 0;
+  if (strcasecmp(s, "off") == 0) return -1;  // dimBrightness "Off"
+  return atol(s);
+}
 
-    setupHostname();
 
-    if (strlen(DEFAULT_AP_PASSWORD) < 8) {
-      WiFi.softAP(DEFAULT_AP_SSID);
-      Serial.println(F("[WIFI] AP Mode started (no password, too short)."));
-    } else {
-      WiFi.softAP(DEFAULT_AP_SSID, DEFAULT_AP_PASSWORD);
-      Serial.println(F("[WIFI] AP Mode started."));
+// Reads every known field from a parsed config.json into c. Fields missing
+// from the JSON keep their current value; returns how many were missing.
+int configFromJson(JsonObjectConst root, Config &c) {
+  int missing = 0;
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    const ConfigField &field = configFields[i];
+    JsonVariantConst v = field.group ? root[field.group][field.key] : root[field.key];
+    if (v.isNull()) {
+      missing++;
+      continue;
     }
+    uint8_t *p = (uint8_t *)&c + field.offset;
+    switch (field.type) {
+      case CFG_TYPE_STR:
+        strlcpy((char *)p, v.is<const char *>() ? v.as<const char *>() : "", field.size);
+        break;
+      case CFG_TYPE_BOOL:
+        *(bool *)p = configJsonBool(v);
+        break;
+      case CFG_TYPE_INT:
+        *(int *)p = configJsonInt(v);
+        break;
+      case CFG_TYPE_TIME:
+        *(time_t *)p = v.as<time_t>();
+        break;
+    }
+  }
+  return missing;
+}
 
-    IPAddress apIP(192, 168, 4, 1);
-    WiFi.softAPConfig(apIP, apIP, IPAddress(255, 255, 255, 0));
-    dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
-    Serial.print(F("[WIFI] AP IP address: "));
-    Serial.println(WiFi.softAPIP());
-    isAPMode = true;
-
-    WiFiMode_t mode = WiFi.getMode();
-    Serial.printf("[WIFI] WiFi mode after setting AP: %s\n",
-                  mode == WIFI_OFF ? "OFF" : mode == WIFI_STA    ? "STA ONLY"
-                                           : mode == WIFI_AP     ? "AP ONLY"
-                                           : mode == WIFI_AP_STA ? "AP + STA (Error!)"
-                                                                 : "UNKNOWN");
 
-    Serial.println(F("[WIFI] AP Mode Started"));
-    return;
+// The one serializer: /config.json and /export both come from here
+void configToJson(const Config &c, JsonDocument &doc) {
+  JsonObject root = doc.to<JsonObject>();
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    const ConfigField &field = configFields[i];
+    JsonObject obj = root;
+    if (field.group) {
+      obj = root[field.group];
+      if (obj.isNull()) obj = root.createNestedObject(field.group);
+    }
+    const uint8_t *p = (const uint8_t *)&c + field.offset;
+    switch (field.type) {
+      case CFG_TYPE_STR:
+        obj[field.key] = (const char *)p;
+        break;
+      case CFG_TYPE_BOOL:
+        obj[field.key] = *(const bool *)p;
+        break;
+      case CFG_TYPE_INT:
+        obj[field.key] = *(const int *)p;
+        break;
+      case CFG_TYPE_TIME:
+        obj[field.key] = *(const time_t *)p;
+        break;
+    }
   }
+}
 
-  // If credentials exist, attempt STA connection
-  WiFi.persistent(false);
-  WiFi.mode(WIFI_STA);
-  WiFi.disconnect(true);
-  delay(100);
-  setupHostname();
-  WiFi.begin(ssid, password);
-  unsigned long startAttemptTime = millis();
 
-  const unsigned long timeout = 30000;
-  unsigned long animTimer = 0;
-  int animFrame = 0;
-  bool animating = true;
+// Top-level field by JSON key (nested fields are set by id), -1 if unknown
+int configFindField(const char *key) {
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    if (!configFields[i].group && strcmp(configFields[i].key, key) == 0) return i;
+  }
+  return -1;
+}
 
-  while (animating) {
-    unsigned long now = millis();
-    if (WiFi.status() == WL_CONNECTED) {
-      Serial.println("[WIFI] Connected: " + WiFi.localIP().toString());
-      isAPMode = false;
 
-      WiFiMode_t mode = WiFi.getMode();
-      Serial.printf("[WIFI] WiFi mode after STA connection: %s\n",
-                    mode == WIFI_OFF ? "OFF" : mode == WIFI_STA    ? "STA ONLY"
-                                             : mode == WIFI_AP     ? "AP ONLY"
-                                             : mode == WIFI_AP_STA ? "AP + STA (Error!)"
-                                                                   : "UNKNOWN");
+// Fields whose value differs between a and b, as a mask of CFG_BIT()s
+uint64_t configDiff(const Config &a, const Config &b) {
+  uint64_t changed = 0;
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    const uint8_t *pa = (const uint8_t *)&a + configFields[i].offset;
+    const uint8_t *pb = (const uint8_t *)&b + configFields[i].offset;
+    bool differs = configFields[i].type == CFG_TYPE_STR
+                     ? strncmp((const char *)pa, (const char *)pb, configFields[i].size) != 0
+                     : memcmp(pa, pb, configFields[i].size) != 0;
+    if (differs) changed |= CFG_BIT(i);
+  }
+  return changed;
+}
 
-      // --- IP Display initiation ---
-      pendingIpToShow = WiFi.localIP().toString();
 
-      // Replace all dots with your custom font code 184
-      for (int i = 0; i < pendingIpToShow.length(); i++) {
-        if (pendingIpToShow[i] == '.') {
-          pendingIpToShow[i] = 184;
-        }
-      }
+// "key" or "group.key", as used in journal records
+void configFieldPath(int i, char *buf, size_t size) {
+  if (configFields[i].group) {
+    snprintf(buf, size, "%s.%s", configFields[i].group, configFields[i].key);
+  } else {
+    strlcpy(buf, configFields[i].key, size);
+  }
+}
 
-      showingIp = true;
-      ipDisplayCount = 0;  // Reset count for IP display
-      P.displayClear();
-      P.setCharSpacing(1);  // Set spacing for IP scroll
-      textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
-      P.displayScroll(pendingIpToShow.c_str(), PA_CENTER, actualScrollDirection, IP_SCROLL_SPEED);
-      // --- END IP Display initiation ---
 
-      animating = false;  // Exit the connection loop
-      break;
-    } else if (now - startAttemptTime >= timeout) {
-      Serial.println(F("[WIFI] Failed. Starting AP mode..."));
-      WiFi.mode(WIFI_AP);
-      setupHostname();
-      WiFi.softAP(DEFAULT_AP_SSID, DEFAULT_AP_PASSWORD);
-      Serial.print(F("[WIFI] AP IP address: "));
-      Serial.println(WiFi.softAPIP());
-      dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
-      isAPMode = true;
+int configFindFieldPath(const char *path) {
+  char buf[48];
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    configFieldPath(i, buf, sizeof(buf));
+    if (strcmp(buf, path) == 0) return i;
+  }
+  return -1;
+}
 
-      auto mode = WiFi.getMode();
-      Serial.printf("[WIFI] WiFi mode after STA failure and setting AP: %s\n",
-                    mode == WIFI_OFF ? "OFF" : mode == WIFI_STA    ? "STA ONLY"
-                                             : mode == WIFI_AP     ? "AP ONLY"
-                                             : mode == WIFI_AP_STA ? "AP + STA (Error!)"
-                                                                   : "UNKNOWN");
 
-      animating = false;
-      Serial.println(F("[WIFI] AP Mode Started"));
+// Field value as text, in the form configSetFromString() reads back
+void configFieldToString(int i, char *buf, size_t size) {
+  const uint8_t *p = (const uint8_t *)&config + configFields[i].offset;
+  switch (configFields[i].type) {
+    case CFG_TYPE_STR:
+      strlcpy(buf, (const char *)p, size);
+      break;
+    case CFG_TYPE_BOOL:
+      strlcpy(buf, *(const bool *)p ? "1" : "0", size);
+      break;
+    case CFG_TYPE_INT:
+      snprintf(buf, size, "%d", *(const int *)p);
+      break;
+    case CFG_TYPE_TIME:
+      snprintf(buf, size, "%lld", (long long)*(const time_t *)p);
       break;
-    }
-    if (now - animTimer > 750) {
-      animTimer = now;
-      P.setTextAlignment(PA_CENTER);
-      switch (animFrame % 3) {
-        case 0: P.print(F("# ©")); break;
-        case 1: P.print(F("# ª")); break;
-        case 2: P.print(F("# «")); break;
-      }
-      animFrame++;
-    }
-    delay(1);
   }
 }
 
-// -----------------------------------------------------------------------------
-// mDNS
-// -----------------------------------------------------------------------------
-void setupMDNS() {
-  MDNS.end();
 
-  bool mdnsStarted = MDNS.begin(deviceHostname.c_str());
+void *configFieldPtr(Config &c, ConfigFieldId id) {
+  return (uint8_t *)&c + configFields[id].offset;
+}
 
-  if (mdnsStarted) {
-    MDNS.addService("http", "tcp", 80);
-    Serial.printf("[WIFI] mDNS started: http://%s.local\n", deviceHostname.c_str());
-  } else {
-    Serial.println("[WIFI] mDNS failed to start");
-  }
+
+// Stores: write one field of c, return true if the value actually changed
+bool configStoreStr(Config &c, ConfigFieldId id, const char *value) {
+  char *p = (char *)configFieldPtr(c, id);
+  if (strncmp(p, value, configFields[id].size - 1) == 0) return false;
+  strlcpy(p, value, configFields[id].size);
+  return true;
+}
+
+
+bool configStoreBool(Config &c, ConfigFieldId id, bool value) {
+  bool *p = (bool *)configFieldPtr(c, id);
+  if (*p == value) return false;
+  *p = value;
+  return true;
+}
+
+
+bool configStoreInt(Config &c, ConfigFieldId id, int value) {
+  int *p = (int *)configFieldPtr(c, id);
+  if (*p == value) return false;
+  *p = value;
+  return true;
+}
+
+
+bool configStoreTime(Config &c, ConfigFieldId id, time_t value) {
+  time_t *p = (time_t *)configFieldPtr(c, id);
+  if (*p == value) return false;
+  *p = value;
+  return true;
+}
+
+
+// Form value (as posted by the web UI) into a field of any type
+bool configStoreFromString(Config &c, ConfigFieldId id, const String &v) {
+  switch (configFields[id].type) {
+    case CFG_TYPE_STR:
+      return configStoreStr(c, id, v.c_str());
+    case CFG_TYPE_BOOL:
+      return configStoreBool(c, id, v == "true" || v == "on" || v == "1");
+    case CFG_TYPE_INT:
+      return configStoreInt(c, id, v.equalsIgnoreCase("off") ? -1 : v.toInt());
+    case CFG_TYPE_TIME:
+      return configStoreTime(c, id, (time_t)atoll(v.c_str()));
+  }
+  return false;
+}
+
+
+bool configMarkDirty(ConfigFieldId id, bool changed) {
+  if (changed) {
+    configDirty |= CFG_BIT(id);
+    configRevision++;
+  }
+  return changed;
+}
+
+
+// Setters: update one field of the live config and mark it dirty, only if
+// the value actually changed. Main loop only; web handlers go through
+// beginConfigEdit() / commitConfigEdit(). Return true on change.
+bool configSetStr(ConfigFieldId id, const char *value) {
+  CONFIG_LOCK();
+  bool changed = configStoreStr(config, id, value);
+  CONFIG_UNLOCK();
+  return configMarkDirty(id, changed);
+}
+
+
+bool configSetBool(ConfigFieldId id, bool value) {
+  CONFIG_LOCK();
+  bool changed = configStoreBool(config, id, value);
+  CONFIG_UNLOCK();
+  return configMarkDirty(id, changed);
+}
+
+
+bool configSetInt(ConfigFieldId id, int value) {
+  CONFIG_LOCK();
+  bool changed = configStoreInt(config, id, value);
+  CONFIG_UNLOCK();
+  return configMarkDirty(id, changed);
+}
+
+
+bool configSetTime(ConfigFieldId id, time_t value) {
+  CONFIG_LOCK();
+  bool changed = configStoreTime(config, id, value);
+  CONFIG_UNLOCK();
+  return configMarkDirty(id, changed);
+}
+
+
+bool configSetFromString(ConfigFieldId id, const String &v) {
+  CONFIG_LOCK();
+  bool changed = configStoreFromString(config, id, v);
+  CONFIG_UNLOCK();
+  return configMarkDirty(id, changed);
+}
+
+
+// Edits from web handlers. On ESP32 those run on the AsyncTCP task, so they
+// never write config themselves: they edit a copy, and commitConfigEdit()
+// queues the fields that differ for tickConfigApply() on the main loop,
+// which applies them and does all the flash writes. Handlers run one at a
+// time, so the two copies are shared. The edit starts from config with the
+// changes still queued on top, so it never undoes them.
+Config &beginConfigEdit() {
+  CONFIG_LOCK();
+  configEditBase = config;
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    if (!(configQueuedFields & CFG_BIT(i))) continue;
+    memcpy((uint8_t *)&configEditBase + configFields[i].offset,
+           (const uint8_t *)&configQueued + configFields[i].offset, configFields[i].size);
+  }
+  CONFIG_UNLOCK();
+  configEdit = configEditBase;
+  return configEdit;
+}
+
+
+// Returns the mask of the fields queued. flushNow skips the deferred write.
+uint64_t commitConfigEdit(bool flushNow) {
+  uint64_t changed = configDiff(configEditBase, configEdit);
+  CONFIG_LOCK();
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    if (!(changed & CFG_BIT(i))) continue;
+    memcpy((uint8_t *)&configQueued + configFields[i].offset,
+           (const uint8_t *)&configEdit + configFields[i].offset, configFields[i].size);
+  }
+  configQueuedFields |= changed;
+  configQueuedFlush |= flushNow;
+  CONFIG_UNLOCK();
+  return changed;
+}
+
+
+// For edits that replace the whole config (restore, upload): once applied,
+// the loop compacts into a fresh snapshot, which also drops the journal, and
+// only after that succeeded is anything from before discarded.
+void requestConfigSnapshot() {
+  CONFIG_LOCK();
+  configQueuedSnapshot = true;
+  CONFIG_UNLOCK();
+}
+
+
+// One-field edit for the /set_* endpoints, with the value in form syntax.
+// Applied and persisted (deferred) like a /settings change.
+bool queueConfigSetting(ConfigFieldId id, const String &value) {
+  Config &edit = beginConfigEdit();
+  configStoreFromString(edit, id, value);
+  return commitConfigEdit(false) != 0;
+}
+
+
+bool configIntInRange(int id, int v) {
+  switch (id) {
+    case CFG_BRIGHTNESS: return v >= 0 && v <= 15;
+    case CFG_DIM_BRIGHTNESS: return v >= -1 && v <= 15;  // -1 = display off
+    case CFG_DIM_START_HOUR:
+    case CFG_DIM_END_HOUR:
+    case CFG_SUNRISE_HOUR:
+    case CFG_SUNSET_HOUR: return v >= 0 && v <= 23;
+    case CFG_DIM_START_MINUTE:
+    case CFG_DIM_END_MINUTE:
+    case CFG_SUNRISE_MINUTE:
+    case CFG_SUNSET_MINUTE: return v >= 0 && v <= 59;
+    case CFG_CLOCK_DURATION:
+    case CFG_WEATHER_DURATION: return v >= 1000 && v <= 3600000;
+    default: return true;
+  }
+}
+
+
+// Checks a JSON value against field id without changing anything. Returns
+// what is wrong with it, nullptr if it can be set.
+const char *configCheckJsonValue(int id, JsonVariantConst v) {
+  if (CFG_BIT(id) & CONFIG_RESTART_FIELDS) return "WiFi credentials can only be changed through /save";
+  switch (configFields[id].type) {
+    case CFG_TYPE_STR:
+      if (!v.is<const char *>()) return "expected a string";
+      if (strlen(v.as<const char *>()) >= configFields[id].size) return "too long";
+      if (id == CFG_WEATHER_UNITS && strcmp(v.as<const char *>(), "metric") != 0
+          && strcmp(v.as<const char *>(), "imperial") != 0) return "expected metric or imperial";
+      break;
+    case CFG_TYPE_BOOL:
+      if (!v.is<bool>()) return "expected true or false";
+      break;
+    case CFG_TYPE_INT:
+      if (!v.is<int>()) return "expected an integer";
+      if (!configIntInRange(id, v.as<int>())) return "out of range";
+      break;
+    case CFG_TYPE_TIME:
+      if (!v.is<long>()) return "expected a Unix timestamp";
+      break;
+  }
+  return nullptr;
+}
+
+
+// Stores field id of c from a value that passed configCheckJsonValue()
+bool configStoreFromJson(Config &c, int id, JsonVariantConst v) {
+  switch (configFields[id].type) {
+    case CFG_TYPE_STR: return configStoreStr(c, (ConfigFieldId)id, v.as<const char *>());
+    case CFG_TYPE_BOOL: return configStoreBool(c, (ConfigFieldId)id, v.as<bool>());
+    case CFG_TYPE_INT: return configStoreInt(c, (ConfigFieldId)id, v.as<int>());
+    case CFG_TYPE_TIME: return configStoreTime(c, (ConfigFieldId)id, (time_t)v.as<long>());
+  }
+  return false;
+}
+
+
+uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+
+// Compaction: writes the whole config as a fresh /config.bin snapshot and
+// empties the journal. The previous snapshot is kept as /config.bak.
+bool saveConfig() {
+  ConfigSnapshotHeader h = { CONFIG_SNAPSHOT_MAGIC, CONFIG_SNAPSHOT_VERSION, sizeof(Config),
+                             crc32Update(0, (const uint8_t *)&config, sizeof(Config)) };
+
+  File f = LittleFS.open("/config.tmp", "w");
+  if (!f) {
+    Serial.println(F("[CONFIG] ERROR: Failed to open /config.tmp for writing"));
+    return false;
+  }
+  size_t bytesWritten = f.write((const uint8_t *)&h, sizeof(h));
+  bytesWritten += f.write((const uint8_t *)&config, sizeof(Config));
+  f.close();
+  if (bytesWritten != sizeof(h) + sizeof(Config)) {
+    Serial.println(F("[CONFIG] ERROR: Failed to write config snapshot"));
+    LittleFS.remove("/config.tmp");
+    return false;
+  }
+
+  // Swap the snapshot in. If power fails between the renames, loadConfig()
+  // finds the complete /config.tmp and finishes the job.
+  LittleFS.remove("/config.bak");
+  if (LittleFS.exists(CONFIG_SNAPSHOT_PATH)) {
+    LittleFS.rename(CONFIG_SNAPSHOT_PATH, "/config.bak");
+  }
+  if (!LittleFS.rename("/config.tmp", CONFIG_SNAPSHOT_PATH)) {
+    Serial.println(F("[CONFIG] ERROR: Failed to move snapshot into " CONFIG_SNAPSHOT_PATH));
+    return false;
+  }
+  LittleFS.remove(CONFIG_JOURNAL_PATH);
+
+  configDirty = 0;
+  configWrites++;
+  fsBytesWritten += bytesWritten;
+  Serial.printf("[CONFIG] Saved " CONFIG_SNAPSHOT_PATH " snapshot (%u bytes written)\n", bytesWritten);
+  return true;
+}
+
+
+// Reads a snapshot written by saveConfig() into c in one go. c should hold
+// the defaults: fields a shorter snapshot from an older build lacks keep
+// them, and partial is set so the caller can rewrite it. On any error c is
+// reset to the defaults and false is returned.
+bool readConfigSnapshot(const char *path, Config &c, bool &partial) {
+  partial = false;
+  File f = LittleFS.open(path, "r");
+  if (!f) return false;
+
+  ConfigSnapshotHeader h;
+  bool ok = f.read((uint8_t *)&h, sizeof(h)) == sizeof(h)
+            && h.magic == CONFIG_SNAPSHOT_MAGIC
+            && h.version == CONFIG_SNAPSHOT_VERSION
+            && h.size <= sizeof(Config)
+            && f.read((uint8_t *)&c, h.size) == h.size
+            && crc32Update(0, (const uint8_t *)&c, h.size) == h.crc;
+  f.close();
+
+  if (!ok) {
+    Serial.printf("[CONFIG] %s is damaged or from an incompatible build, ignoring it\n", path);
+    configSetDefaults(c);
+    return false;
+  }
+  partial = h.size < sizeof(Config);
+  return true;
+}
+
+
+bool writeConfigJournalRecord(File &f, int i) {
+  char key[48];
+  char value[260];
+  configFieldPath(i, key, sizeof(key));
+  configFieldToString(i, value, sizeof(value));
+
+  ConfigJournalHeader h = { CONFIG_JOURNAL_MAGIC, (uint8_t)strlen(key), (uint16_t)strlen(value) };
+  uint32_t crc = crc32Update(0, (const uint8_t *)&h, sizeof(h));
+  crc = crc32Update(crc, (const uint8_t *)key, h.keyLen);
+  crc = crc32Update(crc, (const uint8_t *)value, h.valueLen);
+
+  size_t n = f.write((const uint8_t *)&h, sizeof(h));
+  n += f.write((const uint8_t *)key, h.keyLen);
+  n += f.write((const uint8_t *)value, h.valueLen);
+  n += f.write((const uint8_t *)&crc, sizeof(crc));
+  fsBytesWritten += n;
+  return n == sizeof(h) + h.keyLen + h.valueLen + sizeof(crc);
+}
+
+
+// Appends one record per dirty field; compacts once the journal is too big
+bool appendConfigJournal() {
+  File f = LittleFS.open(CONFIG_JOURNAL_PATH, "a");
+  if (!f) {
+    Serial.println(F("[CONFIG] ERROR: Failed to open journal, writing a full snapshot"));
+    return saveConfig();
+  }
+
+  int records = 0;
+  bool ok = true;
+  for (int i = 0; i < CONFIG_FIELD_COUNT && ok; i++) {
+    if (!(configDirty & CFG_BIT(i))) continue;
+    ok = writeConfigJournalRecord(f, i);
+    records++;
+  }
+  size_t journalSize = f.size();
+  f.close();
+
+  if (!ok) {
+    // A short record would hide everything appended after it, start over
+    Serial.println(F("[CONFIG] ERROR: Journal write failed, writing a full snapshot"));
+    return saveConfig();
+  }
+
+  configDirty = 0;
+  configWrites++;
+  Serial.printf("[CONFIG] Journaled %d change(s), journal is %u bytes\n", records, journalSize);
+
+  if (journalSize > CONFIG_JOURNAL_COMPACT_BYTES) {
+    Serial.println(F("[CONFIG] Journal over threshold, compacting"));
+    saveConfig();
+  }
+  return true;
+}
+
+
+// Applies the journal on top of the snapshot already in config. Stops at the
+// first torn or corrupt record (power loss mid-append) and returns false.
+bool replayConfigJournal(int &applied) {
+  applied = 0;
+  File f = LittleFS.open(CONFIG_JOURNAL_PATH, "r");
+  if (!f) return true;
+
+  bool clean = true;
+  char key[48];
+  char value[260];
+  while (f.available()) {
+    ConfigJournalHeader h;
+    uint32_t crc;
+    if (f.read((uint8_t *)&h, sizeof(h)) != sizeof(h) || h.magic != CONFIG_JOURNAL_MAGIC
+        || h.keyLen >= sizeof(key) || h.valueLen >= sizeof(value)
+        || f.read((uint8_t *)key, h.keyLen) != h.keyLen
+        || f.read((uint8_t *)value, h.valueLen) != h.valueLen
+        || f.read((uint8_t *)&crc, sizeof(crc)) != sizeof(crc)) {
+      clean = false;
+      break;
+    }
+    uint32_t expected = crc32Update(0, (const uint8_t *)&h, sizeof(h));
+    expected = crc32Update(expected, (const uint8_t *)key, h.keyLen);
+    expected = crc32Update(expected, (const uint8_t *)value, h.valueLen);
+    if (crc != expected) {
+      clean = false;
+      break;
+    }
+
+    key[h.keyLen] = '\0';
+    value[h.valueLen] = '\0';
+    int field = configFindFieldPath(key);
+    if (field >= 0) {
+      configSetFromString((ConfigFieldId)field, String(value));
+      applied++;
+    }
+  }
+  f.close();
+  return clean;
+}
+
+
+// Queues a save of the dirty fields. The write happens CONFIG_FLUSH_DELAY ms
+// after the first request; later requests in that window ride along.
+void scheduleConfigSave() {
+  if (configDirty == 0) return;
+  if (configFlushPending) {
+    configWritesAvoided++;
+    return;
+  }
+  configFlushPending = true;
+  configFlushRequestedAt = millis();
+}
+
+
+// Writes any pending changes now. Used by /save and before a restart.
+bool flushConfig() {
+  configFlushPending = false;
+  if (configDirty == 0) return true;
+  if (appendConfigJournal()) return true;
+
+  // Keep the changes queued and try again later
+  configFlushPending = true;
+  configFlushRequestedAt = millis();
+  return false;
+}
+
+
+// Drops queued changes and the journal, for when the saved config has been
+// removed behind our back (factory reset) and a restart follows
+void cancelConfigFlush() {
+  configFlushPending = false;
+  configDirty = 0;
+  LittleFS.remove(CONFIG_JOURNAL_PATH);
+}
+
+
+// Copies one persisted field into the runtime global the rest of the sketch
+// reads, with whatever derived state hangs off it
+void applyConfigField(int id) {
+  switch (id) {
+    case CFG_SSID: strlcpy(ssid, config.ssid, sizeof(ssid)); break;
+    case CFG_PASSWORD: strlcpy(password, config.password, sizeof(password)); break;
+    case CFG_OPENWEATHER_API_KEY: strlcpy(openWeatherApiKey, config.openWeatherApiKey, sizeof(openWeatherApiKey)); break;
+    case CFG_OPENWEATHER_CITY: strlcpy(openWeatherCity, config.openWeatherCity, sizeof(openWeatherCity)); break;
+    case CFG_OPENWEATHER_COUNTRY: strlcpy(openWeatherCountry, config.openWeatherCountry, sizeof(openWeatherCountry)); break;
+    case CFG_WEATHER_UNITS:
+      strlcpy(weatherUnits, config.weatherUnits, sizeof(weatherUnits));
+      tempSymbol = strcmp(weatherUnits, "imperial") == 0 ? ']' : '[';
+      break;
+    case CFG_CLOCK_DURATION: clockDuration = config.clockDuration; break;
+    case CFG_WEATHER_DURATION: weatherDuration = config.weatherDuration; break;
+    case CFG_TIME_ZONE: strlcpy(timeZone, config.timeZone, sizeof(timeZone)); break;
+    case CFG_LANGUAGE: strlcpy(language, config.language, sizeof(language)); break;
+    case CFG_BRIGHTNESS: brightness = config.brightness; break;
+    case CFG_FLIP_DISPLAY: flipDisplay = config.flipDisplay; break;
+    case CFG_TWELVE_HOUR: twelveHourToggle = config.twelveHourToggle; break;
+    case CFG_SHOW_DAY_OF_WEEK: showDayOfWeek = config.showDayOfWeek; break;
+    case CFG_SHOW_DATE: showDate = config.showDate; break;
+    case CFG_SHOW_HUMIDITY: showHumidity = config.showHumidity; break;
+    case CFG_COLON_BLINK: colonBlinkEnabled = config.colonBlinkEnabled; break;
+    case CFG_NTP_SERVER1: strlcpy(ntpServer1, config.ntpServer1, sizeof(ntpServer1)); break;
+    case CFG_NTP_SERVER2: strlcpy(ntpServer2, config.ntpServer2, sizeof(ntpServer2)); break;
+
+    // --- Dimming settings ---
+    case CFG_DIMMING_ENABLED: dimmingEnabled = config.dimmingEnabled; break;
+    case CFG_DIM_START_HOUR: dimStartHour = config.dimStartHour; break;
+    case CFG_DIM_START_MINUTE: dimStartMinute = config.dimStartMinute; break;
+    case CFG_DIM_END_HOUR: dimEndHour = config.dimEndHour; break;
+    case CFG_DIM_END_MINUTE: dimEndMinute = config.dimEndMinute; break;
+    case CFG_DIM_BRIGHTNESS: dimBrightness = config.dimBrightness; break;
+    case CFG_SHOW_WEATHER_DESCRIPTION: showWeatherDescription = config.showWeatherDescription; break;
+    case CFG_AUTO_DIMMING: autoDimmingEnabled = config.autoDimmingEnabled; break;
+    case CFG_SUNRISE_HOUR: sunriseHour = config.sunriseHour; break;
+    case CFG_SUNRISE_MINUTE: sunriseMinute = config.sunriseMinute; break;
+    case CFG_SUNSET_HOUR: sunsetHour = config.sunsetHour; break;
+    case CFG_SUNSET_MINUTE: sunsetMinute = config.sunsetMinute; break;
+    case CFG_CLOCK_ONLY_DURING_DIMMING: clockOnlyDuringDimming = config.clockOnlyDuringDimming; break;
+
+    case CFG_DISPLAY_ORDER:
+      strlcpy(displayOrder, config.displayOrder, sizeof(displayOrder));
+      applyDisplayOrder(displayOrder);
+      break;
+    case CFG_CUSTOM_MESSAGE:
+      strlcpy(customMessage, config.customMessage, sizeof(customMessage));
+      strlcpy(lastPersistentMessage, customMessage, sizeof(lastPersistentMessage));
+      break;
+
+    // --- Countdown ---
+    case CFG_COUNTDOWN_ENABLED: countdownEnabled = config.countdownEnabled; break;
+    case CFG_COUNTDOWN_TARGET: countdownTargetTimestamp = config.countdownTargetTimestamp; break;
+    case CFG_COUNTDOWN_LABEL: strlcpy(countdownLabel, config.countdownLabel, sizeof(countdownLabel)); break;
+    case CFG_COUNTDOWN_DRAMATIC: isDramaticCountdown = config.isDramaticCountdown; break;
+  }
+  if (CFG_BIT(id) & CONFIG_COUNTDOWN_FIELDS) countdownFinished = false;
+}
+
+
+// Copies all persisted settings into the runtime globals
+void applyConfig() {
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) applyConfigField(i);
+}
+
+
+// Brings the running clock in line with config after a web edit,
+// copying only the changed fields and doing the work each one needs.
+// Brightness and dimming need nothing beyond the copy: tickDimming() applies
+// them on its next pass.
+void applyConfigChanges(uint64_t changed) {
+  if (changed == 0) return;
+
+  bool wasShowingDescription = showWeatherDescription;
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    if (changed & CFG_BIT(i)) applyConfigField(i);
+  }
+
+  if (changed & CFG_BIT(CFG_FLIP_DISPLAY)) {
+    P.setZoneEffect(0, flipDisplay, PA_FLIP_UD);
+    P.setZoneEffect(0, flipDisplay, PA_FLIP_LR);
+    invalidateRenderCache();
+  }
+
+  if (changed & (CFG_BIT(CFG_NTP_SERVER1) | CFG_BIT(CFG_NTP_SERVER2))) {
+    setupTime();  // configTime() resets TZ, setupTime() sets it again
+  } else if (changed & CFG_BIT(CFG_TIME_ZONE)) {
+    setenv("TZ", ianaToPosix(timeZone), 1);
+    tzset();
+  }
+
+  if (changed & CONFIG_WEATHER_FIELDS) {
+    shouldFetchWeatherNow = true;
+  }
+
+  if (wasShowingDescription && !showWeatherDescription && displayMode == 2) {
+    advanceDisplayMode();
+  }
+  if ((changed & CFG_BIT(CFG_COUNTDOWN_ENABLED)) && !countdownEnabled && displayMode == 3) {
+    advanceDisplayMode();
+  }
+  markDisplayModesDirty();
+
+  Serial.printf("[CONFIG] Applied %d changed setting(s) without restart\n", __builtin_popcountll(changed));
+}
+
+
+// Imports /config.json into c. A file that cannot be read is removed so it
+// does not shadow the snapshot on every boot.
+bool loadConfigJson(Config &c) {
+  Serial.println(F("[CONFIG] Attempting to open config.json for reading."));
+  File configFile = LittleFS.open("/config.json", "r");
+  if (!configFile) {
+    Serial.println(F("[ERROR] Failed to open config.json for reading."));
+    return false;
+  }
+
+  DynamicJsonDocument doc(2048);
+  DeserializationError error = deserializeJson(doc, configFile);
+  configFile.close();
+
+  if (error || !doc.is<JsonObject>()) {
+    Serial.print(F("[ERROR] JSON parse failed during load, ignoring config.json: "));
+    Serial.println(error.f_str());
+    LittleFS.remove("/config.json");
+    return false;
+  }
+
+  int missing = configFromJson(doc.as<JsonObjectConst>(), c);
+  if (missing > 0) {
+    Serial.printf("[CONFIG] Migrated: %d missing key(s) set to defaults.\n", missing);
+  }
+  return true;
+}
+
+
+void loadConfig() {
+  Serial.println(F("[CONFIG] Loading configuration..."));
+  unsigned long loadStartUs = micros();
+  configSetDefaults(config);
+
+  if (!LittleFS.exists(CONFIG_SNAPSHOT_PATH) && LittleFS.exists("/config.tmp")) {
+    Serial.println(F("[CONFIG] Finishing interrupted compaction from /config.tmp"));
+    LittleFS.rename("/config.tmp", CONFIG_SNAPSHOT_PATH);
+  }
+
+  bool needsSave = false;
+  bool partial = false;
+  const char *source = "config.bin";
+  if (LittleFS.exists("/config.json") && loadConfigJson(config)) {
+    // An uploaded config, or one saved before the binary snapshot existed
+    source = "config.json";
+    needsSave = true;
+  } else if (readConfigSnapshot(CONFIG_SNAPSHOT_PATH, config, partial)) {
+    if (partial) {
+      Serial.println(F("[CONFIG] Snapshot from an older build, new fields set to defaults."));
+      needsSave = true;
+    }
+  } else {
+    Serial.println(F("[CONFIG] No saved config found, creating with defaults..."));
+    source = "defaults";
+    needsSave = true;
+  }
+
+  int replayed = 0;
+  if (!replayConfigJournal(replayed)) {
+    Serial.println(F("[CONFIG] Journal ends in a torn record, ignoring the tail and compacting"));
+    needsSave = true;
+  }
+  if (replayed > 0) {
+    Serial.printf("[CONFIG] Replayed %d journal record(s)\n", replayed);
+  }
+  configDirty = 0;
+
+  applyConfig();
+  Serial.printf("[CONFIG] Loaded from %s in %lu us\n", source, micros() - loadStartUs);
+
+  if (needsSave) {
+    if (saveConfig()) {
+      // The snapshot now holds everything config.json had
+      if (strcmp(source, "config.json") == 0) LittleFS.remove("/config.json");
+      Serial.println(F("[CONFIG] Default/migrated config snapshot saved."));
+    } else {
+      Serial.println(F("[ERROR] Failed to save default/migrated config snapshot"));
+    }
+  }
+
+  Serial.println(F("[CONFIG] Configuration loaded."));
+}
+
+
+// -----------------------------------------------------------------------------
+// Config Upload
+// -----------------------------------------------------------------------------
+// Structural check of a JSON document fed in pieces: one top-level object,
+// balanced brackets outside strings, bounded size, depth and string length.
+// Literals and numbers are only checked for their characters here; the full
+// parse in finishConfigUpload() catches the rest.
+void jsonValidatorFeed(JsonStreamValidator &v, const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len && !v.error; i++) {
+    char c = (char)data[i];
+    if (++v.bytes > CONFIG_UPLOAD_MAX) {
+      v.error = "file too large";
+    } else if (v.inString) {
+      if (v.escape) {
+        v.escape = false;
+      } else if (c == '\\') {
+        v.escape = true;
+      } else if (c == '"') {
+        v.inString = false;
+      } else if ((uint8_t)c < 0x20) {
+        v.error = "control character in string";
+      }
+      if (++v.stringLen > CONFIG_UPLOAD_MAX_STRING) v.error = "string too long";
+    } else if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+      continue;
+    } else if (v.done) {
+      v.error = "data after the end of the object";
+    } else if (!v.started) {
+      if (c != '{') {
+        v.error = "not a JSON object";
+      } else {
+        v.started = true;
+        v.depth = 1;
+        v.objectLevels = 1;
+      }
+    } else if (c == '"') {
+      v.inString = true;
+      v.stringLen = 0;
+    } else if (c == '{' || c == '[') {
+      if (v.depth >= CONFIG_UPLOAD_MAX_DEPTH) {
+        v.error = "nested too deeply";
+      } else {
+        if (c == '{') v.objectLevels |= 1 << v.depth;
+        else v.objectLevels &= ~(1 << v.depth);
+        v.depth++;
+      }
+    } else if (c == '}' || c == ']') {
+      bool isObject = v.objectLevels & (1 << (v.depth - 1));
+      if (isObject != (c == '}')) {
+        v.error = "mismatched bracket";
+      } else if (--v.depth == 0) {
+        v.done = true;
+      }
+    } else if (!(isalnum((unsigned char)c) || c == ',' || c == ':' || c == '-' || c == '+' || c == '.')) {
+      v.error = "unexpected character";
+    }
+  }
+}
+
+
+void beginConfigUpload(AsyncWebServerRequest *request) {
+  if (configUpload.owner && millis() - configUpload.startedAt < CONFIG_UPLOAD_STALE_MS) {
+    Serial.println(F("[UPLOAD] Another upload is in progress, ignoring this one"));
+    return;
+  }
+  if (configUpload.file) configUpload.file.close();
+  memset(&configUpload.json, 0, sizeof(configUpload.json));
+  configUpload.owner = request;
+  configUpload.startedAt = millis();
+  configUpload.file = LittleFS.open(CONFIG_UPLOAD_TMP, "w");
+  if (!configUpload.file) configUpload.json.error = "cannot open temp file";
+  Serial.println(F("[UPLOAD] Receiving config upload into " CONFIG_UPLOAD_TMP));
+
+  // A client that goes away mid-body never reaches commitConfigUpload()
+  request->onDisconnect([request]() {
+    if (configUpload.owner != request) return;
+    configUpload.owner = nullptr;
+    if (configUpload.file) configUpload.file.close();
+    LittleFS.remove(CONFIG_UPLOAD_TMP);
+    Serial.println(F("[UPLOAD] Client disconnected mid-upload, dropped it"));
+  });
+}
+
+
+void feedConfigUpload(AsyncWebServerRequest *request, const uint8_t *data, size_t len) {
+  if (configUpload.owner != request || configUpload.json.error) return;
+  jsonValidatorFeed(configUpload.json, data, len);
+  if (!configUpload.json.error) {
+    size_t written = configUpload.file.write(data, len);
+    fsBytesWritten += written;
+    if (written != len) configUpload.json.error = "write to flash failed";
+  }
+}
+
+
+// Last chunk is in: close the temp file and check that the JSON ended
+void finishConfigUpload(AsyncWebServerRequest *request) {
+  if (configUpload.owner != request) return;
+  configUpload.file.close();
+  JsonStreamValidator &v = configUpload.json;
+  if (!v.error && (!v.done || v.inString)) v.error = "file is truncated";
+}
+
+
+// Parses the temp file onto the current config: settings the file leaves
+// out keep their values, so a partial file cannot wipe the WiFi
+// credentials or the API key. The result is queued as a whole-config edit.
+const char *mergeConfigUpload() {
+  DynamicJsonDocument filter(2 * JSON_OBJECT_SIZE(CONFIG_FIELD_COUNT + 1));
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    const ConfigField &field = configFields[i];
+    if (field.group) filter[field.group][field.key] = true;
+    else filter[field.key] = true;
+  }
+
+  File f = LittleFS.open(CONFIG_UPLOAD_TMP, "r");
+  if (!f) return "cannot read temp file";
+  DynamicJsonDocument doc(CONFIG_UPLOAD_DOC_SIZE);
+  DeserializationError err = deserializeJson(doc, f, DeserializationOption::Filter(filter));
+  f.close();
+  if (err == DeserializationError::NoMemory) return "too many settings in file";
+  if (err || !doc.is<JsonObject>()) return "not valid JSON";
+
+  Config &edit = beginConfigEdit();
+  if (configFromJson(doc.as<JsonObjectConst>(), edit) == CONFIG_FIELD_COUNT) return "no ESPTimeCast settings in file";
+  // An exported file has the secrets masked, keep the real ones
+  const ConfigFieldId secrets[] = { CFG_SSID, CFG_PASSWORD, CFG_OPENWEATHER_API_KEY };
+  for (ConfigFieldId id : secrets) {
+    const char *value = (const char *)configFieldPtr(edit, id);
+    if (value[0] == '*' && value[strspn(value, "*")] == '\0') {
+      configStoreStr(edit, id, (const char *)configFieldPtr(configEditBase, id));
+    }
+  }
+  commitConfigEdit(false);
+  requestConfigSnapshot();
+  return nullptr;
+}
+
+
+// Called once the request is complete. On success the upload is queued for
+// the main loop; on failure it is dropped and the live config is untouched.
+// Returns the reason for rejecting, nullptr on success.
+const char *commitConfigUpload(AsyncWebServerRequest *request) {
+  bool hasFile = false;
+  for (int i = 0; i < request->params(); i++) {
+    if (request->getParam(i)->isFile()) hasFile = true;
+  }
+  if (!hasFile && configUpload.owner != request) return "no file received";
+  if (configUpload.owner != request) return "another upload is in progress";
+  configUpload.owner = nullptr;
+  if (configUpload.file) configUpload.file.close();
+
+  const char *error = configUpload.json.error;
+  if (!configUpload.json.started && !error) error = "no file received";
+  if (!error) error = mergeConfigUpload();
+  LittleFS.remove(CONFIG_UPLOAD_TMP);
+  if (error) {
+    Serial.printf("[UPLOAD] Rejected config upload: %s\n", error);
+  } else {
+    Serial.printf("[UPLOAD] Accepted config upload (%u bytes)\n", (unsigned)configUpload.json.bytes);
+  }
+  return error;
+}
+
+
+// -----------------------------------------------------------------------------
+// Network Identity
+// -----------------------------------------------------------------------------
+void setupHostname() {
+#if defined(ESP8266)
+  WiFi.hostname(deviceHostname);
+#elif defined(ESP32)
+  WiFi.setHostname(deviceHostname.c_str());
+#endif
+}
+
+
+// -----------------------------------------------------------------------------
+// WiFi Setup
+// -----------------------------------------------------------------------------
+void connectWiFi() {
+  Serial.println(F("[WIFI] Connecting to WiFi..."));
+
+  bool credentialsExist = (strlen(ssid) > 0);
+
+  if (!credentialsExist) {
+    Serial.println(F("[WIFI] No saved credentials. Starting AP mode directly."));
+    WiFi.mode(WIFI_AP);
+    WiFi.disconnect(true);
+    delay(100);
+
+    setupHostname();
+
+    if (strlen(DEFAULT_AP_PASSWORD) < 8) {
+      WiFi.softAP(DEFAULT_AP_SSID);
+      Serial.println(F("[WIFI] AP Mode started (no password, too short)."));
+    } else {
+      WiFi.softAP(DEFAULT_AP_SSID, DEFAULT_AP_PASSWORD);
+      Serial.println(F("[WIFI] AP Mode started."));
+    }
+
+    IPAddress apIP(192, 168, 4, 1);
+    WiFi.softAPConfig(apIP, apIP, IPAddress(255, 255, 255, 0));
+    dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
+    Serial.print(F("[WIFI] AP IP address: "));
+    Serial.println(WiFi.softAPIP());
+    isAPMode = true;
+
+    WiFiMode_t mode = WiFi.getMode();
+    Serial.printf("[WIFI] WiFi mode after setting AP: %s\n",
+                  mode == WIFI_OFF ? "OFF" : mode == WIFI_STA    ? "STA ONLY"
+                                           : mode == WIFI_AP     ? "AP ONLY"
+                                           : mode == WIFI_AP_STA ? "AP + STA (Error!)"
+                                                                 : "UNKNOWN");
+
+    Serial.println(F("[WIFI] AP Mode Started"));
+    return;
+  }
+
+  // If credentials exist, attempt STA connection
+  WiFi.persistent(false);
+  WiFi.mode(WIFI_STA);
+  WiFi.disconnect(true);
+  delay(100);
+  setupHostname();
+  WiFi.begin(ssid, password);
+  unsigned long startAttemptTime = millis();
+
+  const unsigned long timeout = 30000;
+  unsigned long animTimer = 0;
+  int animFrame = 0;
+  bool animating = true;
+
+  while (animating) {
+    unsigned long now = millis();
+    if (WiFi.status() == WL_CONNECTED) {
+      Serial.println("[WIFI] Connected: " + WiFi.localIP().toString());
+      isAPMode = false;
+
+      WiFiMode_t mode = WiFi.getMode();
+      Serial.printf("[WIFI] WiFi mode after STA connection: %s\n",
+                    mode == WIFI_OFF ? "OFF" : mode == WIFI_STA    ? "STA ONLY"
+                                             : mode == WIFI_AP     ? "AP ONLY"
+                                             : mode == WIFI_AP_STA ? "AP + STA (Error!)"
+                                                                   : "UNKNOWN");
+
+      // --- IP Display initiation ---
+      pendingIpToShow = WiFi.localIP().toString();
+
+      // Replace all dots with your custom font code 184
+      for (int i = 0; i < pendingIpToShow.length(); i++) {
+        if (pendingIpToShow[i] == '.') {
+          pendingIpToShow[i] = 184;
+        }
+      }
+
+      showingIp = true;
+      ipDisplayCount = 0;  // Reset count for IP display
+      renderClear();
+      renderSetCharSpacing(1);  // Set spacing for IP scroll
+      textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
+      P.displayScroll(pendingIpToShow.c_str(), PA_CENTER, actualScrollDirection, IP_SCROLL_SPEED);
+      invalidateRenderCache();
+      // --- END IP Display initiation ---
+
+      animating = false;  // Exit the connection loop
+      break;
+    } else if (now - startAttemptTime >= timeout) {
+      Serial.println(F("[WIFI] Failed. Starting AP mode..."));
+      WiFi.mode(WIFI_AP);
+      setupHostname();
+      WiFi.softAP(DEFAULT_AP_SSID, DEFAULT_AP_PASSWORD);
+      Serial.print(F("[WIFI] AP IP address: "));
+      Serial.println(WiFi.softAPIP());
+      dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
+      isAPMode = true;
+
+      auto mode = WiFi.getMode();
+      Serial.printf("[WIFI] WiFi mode after STA failure and setting AP: %s\n",
+                    mode == WIFI_OFF ? "OFF" : mode == WIFI_STA    ? "STA ONLY"
+                                             : mode == WIFI_AP     ? "AP ONLY"
+                                             : mode == WIFI_AP_STA ? "AP + STA (Error!)"
+                                                                   : "UNKNOWN");
+
+      animating = false;
+      Serial.println(F("[WIFI] AP Mode Started"));
+      break;
+    }
+    if (now - animTimer > 750) {
+      animTimer = now;
+      renderSetTextAlignment(PA_CENTER);
+      switch (animFrame % 3) {
+        case 0: renderPrint(F("# ©")); break;
+        case 1: renderPrint(F("# ª")); break;
+        case 2: renderPrint(F("# «")); break;
+      }
+      animFrame++;
+    }
+    delay(1);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// mDNS
+// -----------------------------------------------------------------------------
+void setupMDNS() {
+  MDNS.end();
+
+  bool mdnsStarted = MDNS.begin(deviceHostname.c_str());
+
+  if (mdnsStarted) {
+    MDNS.addService("http", "tcp", 80);
+    Serial.printf("[WIFI] mDNS started: http://%s.local\n", deviceHostname.c_str());
+  } else {
+    Serial.println("[WIFI] mDNS failed to start");
+  }
 }
 
 // -----------------------------------------------------------------------------
 // Time / NTP Functions
 // -----------------------------------------------------------------------------
+// Called by SNTP on every time update, including the periodic re-syncs the
+// state machine below never sees
+void onNtpTimeSync(struct timeval *tv) {
+  ntpLastSyncAt = millis();
+}
+
+
 void setupTime() {
   if (!isAPMode) {
     Serial.println(F("[TIME] Starting NTP sync"));
   }
 
+  sntp_set_time_sync_notification_cb(onNtpTimeSync);
   configTime(0, 0, ntpServer1, ntpServer2);
 
   // Set the Time Zone
@@ -744,6 +2163,273 @@ void printConfigToSerial() {
 }
 
 
+// -----------------------------------------------------------------------------
+// Config View
+// -----------------------------------------------------------------------------
+// Builds the masked JSON body for /config.json (compact) or /export (pretty)
+// if the cached one is stale. Main loop only. The ETag is the CRC of the
+// body, so it stays valid across reboots as long as the content does.
+void refreshConfigView(ConfigView &v, bool forExport) {
+  if (v.body && v.revision == configRevision && v.apMode == isAPMode) return;
+
+  DynamicJsonDocument doc(2048);
+  configToJson(config, doc);
+  if (forExport) {
+    // Only sanitize if NOT in AP mode
+    if (!isAPMode) {
+      doc[F("ssid")] = "********";
+      doc[F("password")] = "********";
+      doc[F("openWeatherApiKey")] = "********************************";
+    }
+  } else {
+    // Always sanitize before sending to browser
+    doc[F("ssid")] = getSafeSsid();
+    doc[F("password")] = getSafePassword();
+    doc[F("openWeatherApiKey")] = getSafeApiKey();
+  }
+  doc[F("mode")] = isAPMode ? "ap" : "sta";
+
+  size_t len = forExport ? measureJsonPretty(doc) : measureJson(doc);
+  ConfigViewBody *body = (ConfigViewBody *)malloc(sizeof(ConfigViewBody) + len);
+  if (!body) {
+    // Keep serving the old body and try again on the next pass
+    if (!v.buildFailed) Serial.println(F("[CONFIG] ERROR: Out of memory building config view"));
+    v.buildFailed = true;
+    return;
+  }
+  if (forExport) {
+    serializeJsonPretty(doc, body->text, len + 1);
+  } else {
+    serializeJson(doc, body->text, len + 1);
+  }
+  body->refs = 1;
+  body->len = len;
+  snprintf(body->etag, sizeof(body->etag), "\"%08x\"", (unsigned)crc32Update(0, (const uint8_t *)body->text, len));
+
+  CONFIG_LOCK();
+  ConfigViewBody *old = v.body;
+  v.body = body;
+  CONFIG_UNLOCK();
+  releaseConfigView(old);
+  v.revision = configRevision;
+  v.apMode = isAPMode;
+  v.buildFailed = false;
+}
+
+
+ConfigViewBody *acquireConfigView(ConfigView &v) {
+  CONFIG_LOCK();
+  ConfigViewBody *body = v.body;
+  if (body) body->refs++;
+  CONFIG_UNLOCK();
+  return body;
+}
+
+
+void releaseConfigView(ConfigViewBody *body) {
+  if (!body) return;
+  CONFIG_LOCK();
+  bool last = --body->refs == 0;
+  CONFIG_UNLOCK();
+  if (last) free(body);
+}
+
+
+// True if an If-None-Match list names etag exactly (or is "*"). Weak
+// validators compare equal to strong ones, as RFC 9110 asks for GETs.
+bool etagMatches(AsyncWebServerRequest *request, const char *etag) {
+  if (!request->hasHeader("If-None-Match")) return false;
+  String list = request->header("If-None-Match");
+  int start = 0;
+  while (start < (int)list.length()) {
+    int end = list.indexOf(',', start);
+    if (end < 0) end = list.length();
+    String tag = list.substring(start, end);
+    tag.trim();
+    if (tag.startsWith("W/")) tag.remove(0, 2);
+    if (tag == "*" || tag == etag) return true;
+    start = end + 1;
+  }
+  return false;
+}
+
+
+void sendConfigView(AsyncWebServerRequest *request, ConfigView &v, bool forExport) {
+  ConfigViewBody *body = acquireConfigView(v);
+  if (!body) {
+    request->send(503, "application/json", "{\"error\":\"Config not ready, try again\"}");
+    return;
+  }
+
+  AsyncWebServerResponse *response;
+  if (etagMatches(request, body->etag)) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse_P(200, "application/json", (const uint8_t *)body->text, body->len);
+    if (forExport) response->addHeader("Content-Disposition", "attachment; filename=\"config.json\"");
+  }
+  response->addHeader("Cache-Control", "no-cache");
+  response->addHeader("ETag", body->etag);
+  request->send(response);
+  // The body stays referenced until the request is torn down
+  request->onDisconnect([body]() {
+    releaseConfigView(body);
+  });
+}
+
+
+// -----------------------------------------------------------------------------
+// Request Admission
+// -----------------------------------------------------------------------------
+// Bucket of ip, taking over the least recently refilled slot for a new client
+RateBucket &rateBucketFor(uint32_t ip, unsigned long now) {
+  RateBucket *victim = &rateBuckets[0];
+  for (uint8_t i = 0; i < RATE_LIMIT_CLIENTS; i++) {
+    RateBucket &b = rateBuckets[i];
+    if (b.ip == ip) return b;
+    if (victim->ip != 0 && (b.ip == 0 || now - b.refilledAt > now - victim->refilledAt)) victim = &b;
+  }
+  victim->ip = ip;
+  victim->tokens = RATE_LIMIT_BURST;
+  victim->refilledAt = now;
+  return *victim;
+}
+
+
+bool takeRateToken(uint32_t ip) {
+  unsigned long now = millis();
+  RateBucket &b = rateBucketFor(ip, now);
+  unsigned long refill = (now - b.refilledAt) / RATE_LIMIT_REFILL_MS;
+  if (b.tokens + refill >= RATE_LIMIT_BURST) {
+    b.tokens = RATE_LIMIT_BURST;
+    b.refilledAt = now;
+  } else if (refill > 0) {
+    b.tokens += refill;
+    b.refilledAt += refill * RATE_LIMIT_REFILL_MS;
+  }
+  if (b.tokens == 0) return false;
+  b.tokens--;
+  return true;
+}
+
+
+// Frees the in-flight slot held by request, if any. Safe to call again.
+void releaseRequest(AsyncWebServerRequest *request) {
+  for (uint8_t i = 0; i < REQUESTS_IN_FLIGHT_MAX; i++) {
+    if (requestsInFlight[i] == request) requestsInFlight[i] = nullptr;
+  }
+}
+
+
+// Admission without the answer: false, with the rejection counted, if the
+// request must be dropped; otherwise the request holds an in-flight slot
+// until its connection closes, whether the response went out completely or
+// the client went away first.
+bool takeRequestSlot(AsyncWebServerRequest *request) {
+  releaseRequest(request);  // the address of a finished request can come back
+
+  int slot = -1;
+  for (uint8_t i = 0; i < REQUESTS_IN_FLIGHT_MAX && slot < 0; i++) {
+    if (requestsInFlight[i] == nullptr) slot = i;
+  }
+
+  if (slot < 0) {
+    requestsRejectedBusy++;
+    return false;
+  }
+  if (!takeRateToken((uint32_t)request->client()->remoteIP())) {
+    requestsRejectedRate++;
+    return false;
+  }
+
+  requestsInFlight[slot] = request;
+  request->onDisconnect([request]() {
+    releaseRequest(request);  // only compared, never dereferenced
+  });
+  return true;
+}
+
+
+// True while request holds an in-flight slot
+bool requestAdmitted(AsyncWebServerRequest *request) {
+  for (uint8_t i = 0; i < REQUESTS_IN_FLIGHT_MAX; i++) {
+    if (requestsInFlight[i] == request) return true;
+  }
+  return false;
+}
+
+
+void sendTooManyRequests(AsyncWebServerRequest *request) {
+  AsyncWebServerResponse *response = request->beginResponse(429, "application/json", "{\"error\":\"Too many requests\"}");
+  response->addHeader("Retry-After", "1");
+  request->send(response);
+}
+
+
+// First thing in a rate-limited handler. Sends the 429 itself and returns
+// false if the request must be dropped.
+bool admitRequest(AsyncWebServerRequest *request) {
+  if (takeRequestSlot(request)) return true;
+  sendTooManyRequests(request);
+  return false;
+}
+
+
+// /settings with admission up front. AsyncCallbackJsonWebHandler buffers
+// the whole body before it calls back, so every rejected request would
+// still cost a buffer of up to MAX_CONTENT_LENGTH. The server runs
+// canHandle() as soon as the headers are in: the request is admitted there,
+// the body of a rejected one is dropped as it arrives, and handleRequest()
+// answers it with the 429.
+class SettingsWebHandler : public AsyncWebHandler {
+public:
+  static const size_t MAX_CONTENT_LENGTH = 2048;
+  static const size_t JSON_DOC_SIZE = 1024;  // what AsyncCallbackJsonWebHandler allotted
+
+  explicit SettingsWebHandler(ArJsonRequestHandlerFunction onRequest)
+    : onJson(onRequest) {}
+
+  bool canHandle(AsyncWebServerRequest *request) const override {
+    if (!(request->method() & (HTTP_POST | HTTP_PATCH))) return false;
+    if (request->url() != "/settings" || !request->contentType().equalsIgnoreCase("application/json")) return false;
+    takeRequestSlot(request);  // answered in handleRequest() either way
+    return true;
+  }
+
+  void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) override {
+    if (!requestAdmitted(request) || total > MAX_CONTENT_LENGTH) return;
+    if (index == 0) request->_tempObject = calloc(total + 1, 1);
+    if (request->_tempObject) memcpy((uint8_t *)request->_tempObject + index, data, len);
+  }
+
+  void handleRequest(AsyncWebServerRequest *request) override {
+    if (!requestAdmitted(request)) {
+      sendTooManyRequests(request);
+      return;
+    }
+    if (request->contentLength() > MAX_CONTENT_LENGTH) {
+      request->send(413, "application/json", "{\"error\":\"Request too large\"}");
+      return;
+    }
+    // The request frees _tempObject when it is destroyed
+    DynamicJsonDocument doc(JSON_DOC_SIZE);
+    if (!request->_tempObject || deserializeJson(doc, (const char *)request->_tempObject)) {
+      request->send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+      return;
+    }
+    JsonVariant json = doc.as<JsonVariant>();
+    onJson(request, json);
+  }
+
+  bool isRequestHandlerTrivial() const override {
+    return false;
+  }
+
+private:
+  ArJsonRequestHandlerFunction onJson;
+};
+
+
 // -----------------------------------------------------------------------------
 // Web Server and Captive Portal
 // -----------------------------------------------------------------------------
@@ -752,13 +2438,33 @@ void handleCaptivePortal(AsyncWebServerRequest *request);
 void setupWebServer() {
   Serial.println(F("[WEBSERVER] Setting up web server..."));
 
+  // The UI is served straight from PROGMEM, gzipped to every browser that
+  // accepts it and raw otherwise. The compile-time hash of the page is the
+  // ETag, so a revalidating browser gets a bodyless 304.
+  static char indexEtag[12];
+  static char indexEtagGz[16];
+  snprintf(indexEtag, sizeof(indexEtag), "\"%08x\"", (unsigned)INDEX_HTML_HASH);
+  snprintf(indexEtagGz, sizeof(indexEtagGz), "\"%08x-gz\"", (unsigned)INDEX_HTML_HASH);
+  Serial.printf("[WEBSERVER] UI in flash: %u bytes, %u gzipped, ETag %s\n",
+                (unsigned)INDEX_HTML_LEN, (unsigned)INDEX_HTML_GZ_LEN, indexEtag);
+
   server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
     Serial.println(F("[WEBSERVER] Request: /"));
-    // Create a response from LittleFS file so we can attach cache-control headers
-    AsyncWebServerResponse *response = request->beginResponse(LittleFS, "/index.html", "text/html");
-    response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-    response->addHeader("Pragma", "no-cache");
-    response->addHeader("Expires", "0");
+    bool gzip = request->hasHeader("Accept-Encoding") && request->header("Accept-Encoding").indexOf("gzip") >= 0;
+    const char *etag = gzip ? indexEtagGz : indexEtag;
+
+    AsyncWebServerResponse *response;
+    if (etagMatches(request, etag)) {
+      response = request->beginResponse(304);
+    } else if (gzip) {
+      response = request->beginResponse_P(200, "text/html", index_html_gz, INDEX_HTML_GZ_LEN);
+      response->addHeader("Content-Encoding", "gzip");
+    } else {
+      response = request->beginResponse_P(200, "text/html", (const uint8_t *)index_html, INDEX_HTML_LEN);
+    }
+    response->addHeader("Cache-Control", "no-cache");
+    response->addHeader("ETag", etag);
+    response->addHeader("Vary", "Accept-Encoding");
     request->send(response);
   });
 
@@ -792,101 +2498,39 @@ void setupWebServer() {
 
   server.on("/config.json", HTTP_GET, [](AsyncWebServerRequest *request) {
     Serial.println(F("[WEBSERVER] Request: /config.json"));
-    File f = LittleFS.open("/config.json", "r");
-    if (!f) {
-      Serial.println(F("[WEBSERVER] Error opening /config.json"));
-      request->send(500, "application/json", "{\"error\":\"Failed to open config.json\"}");
-      return;
-    }
-    DynamicJsonDocument doc(2048);
-    DeserializationError err = deserializeJson(doc, f);
-    f.close();
-    if (err) {
-      Serial.print(F("[WEBSERVER] Error parsing /config.json: "));
-      Serial.println(err.f_str());
-      request->send(500, "application/json", "{\"error\":\"Failed to parse config.json\"}");
-      return;
-    }
-
-    // Always sanitize before sending to browser
-    doc[F("ssid")] = getSafeSsid();
-    doc[F("password")] = getSafePassword();
-    doc[F("openWeatherApiKey")] = getSafeApiKey();
-    doc[F("mode")] = isAPMode ? "ap" : "sta";
-
-    String response;
-    serializeJson(doc, response);
-    request->send(200, "application/json", response);
+    sendConfigView(request, configView, false);
   });
 
   server.on("/save", HTTP_POST, [](AsyncWebServerRequest *request) {
     Serial.println(F("[WEBSERVER] Request: /save"));
-    DynamicJsonDocument doc(2048);
-
-    File configFile = LittleFS.open("/config.json", "r");
-    if (configFile) {
-      Serial.println(F("[WEBSERVER] Existing config.json found, loading for update..."));
-      DeserializationError err = deserializeJson(doc, configFile);
-      configFile.close();
-      if (err) {
-        Serial.print(F("[WEBSERVER] Error parsing existing config.json: "));
-        Serial.println(err.f_str());
-      }
-    } else {
-      Serial.println(F("[WEBSERVER] config.json not found, starting with empty doc for save."));
-    }
+    Config &edit = beginConfigEdit();
 
     for (int i = 0; i < request->params(); i++) {
       const AsyncWebParameter *p = request->getParam(i);
       String n = p->name();
       String v = p->value();
 
-      if (n == "brightness") doc[n] = v.toInt();
-      else if (n == "clockDuration") doc[n] = v.toInt();
-      else if (n == "weatherDuration") doc[n] = v.toInt();
-      else if (n == "flipDisplay") doc[n] = (v == "true" || v == "on" || v == "1");
-      else if (n == "twelveHourToggle") doc[n] = (v == "true" || v == "on" || v == "1");
-      else if (n == "showDayOfWeek") doc[n] = (v == "true" || v == "on" || v == "1");
-      else if (n == "showDate") doc[n] = (v == "true" || v == "on" || v == "1");
-      else if (n == "showHumidity") doc[n] = (v == "true" || v == "on" || v == "1");
-      else if (n == "colonBlinkEnabled") doc[n] = (v == "true" || v == "on" || v == "1");
-      else if (n == "dimStartHour") doc[n] = v.toInt();
-      else if (n == "dimStartMinute") doc[n] = v.toInt();
-      else if (n == "dimEndHour") doc[n] = v.toInt();
-      else if (n == "dimEndMinute") doc[n] = v.toInt();
-      else if (n == "dimBrightness") {
-        if (v == "Off" || v == "off") doc[n] = -1;
-        else doc[n] = v.toInt();
-      } else if (n == "showWeatherDescription") doc[n] = (v == "true" || v == "on" || v == "1");
-      else if (n == "dimmingEnabled") doc[n] = (v == "true" || v == "on" || v == "1");
-      else if (n == "clockOnlyDuringDimming") {
-        doc[n] = (v == "true" || v == "on" || v == "1");
-      } else if (n == "weatherUnits") doc[n] = v;
-
-      else if (n == "password") {
-        if (v != "********" && v.length() > 0) {
-          doc[n] = v;  // user entered a new password
-        } else {
+      if (n == "password") {
+        if (v == "********" || v.length() == 0) {
           Serial.println(F("[SAVE] Password unchanged."));
-          // do nothing, keep the one already in doc
+          continue;  // keep the one already in config
         }
       } else if (n == "ssid") {
-        if (v != "********" && v.length() > 0) {
-          doc[n] = v;
-        } else {
+        if (v == "********" || v.length() == 0) {
           Serial.println(F("[SAVE] SSID unchanged."));
+          continue;
         }
       } else if (n == "openWeatherApiKey") {
-        if (v != "********************************") {  // ignore mask only
-          doc[n] = v;                                   // save new key (even if empty)
-          Serial.print(F("[SAVE] API key updated: "));
-          Serial.println(v.length() == 0 ? "(empty)" : v);
-        } else {
+        if (v == "********************************") {  // ignore mask only
           Serial.println(F("[SAVE] API key unchanged (mask ignored)."));
+          continue;
         }
-      } else {
-        doc[n] = v;
+        Serial.print(F("[SAVE] API key updated: "));  // save new key (even if empty)
+        Serial.println(v.length() == 0 ? "(empty)" : v);
       }
+
+      int field = configFindField(n.c_str());
+      if (field >= 0) configStoreFromString(edit, (ConfigFieldId)field, v);
     }
 
     bool newCountdownEnabled = (request->hasParam("countdownEnabled", true) && (request->getParam("countdownEnabled", true)->value() == "true" || request->getParam("countdownEnabled", true)->value() == "on" || request->getParam("countdownEnabled", true)->value() == "1"));
@@ -921,114 +2565,130 @@ void setupWebServer() {
       }
     }
 
-    JsonObject countdownObj = doc.createNestedObject("countdown");
-    countdownObj["enabled"] = newCountdownEnabled;
-    countdownObj["targetTimestamp"] = newTargetTimestamp;
-    countdownObj["label"] = countdownLabelStr;
-    countdownObj["isDramaticCountdown"] = newIsDramaticCountdown;
+    configStoreBool(edit, CFG_COUNTDOWN_ENABLED, newCountdownEnabled);
+    configStoreTime(edit, CFG_COUNTDOWN_TARGET, newTargetTimestamp);
+    configStoreStr(edit, CFG_COUNTDOWN_LABEL, countdownLabelStr.c_str());
+    configStoreBool(edit, CFG_COUNTDOWN_DRAMATIC, newIsDramaticCountdown);
 
-    size_t total = LittleFS.totalBytes();
-    size_t used = LittleFS.usedBytes();
-    Serial.printf("[SAVE] LittleFS total bytes: %llu, used bytes: %llu\n", LittleFS.totalBytes(), LittleFS.usedBytes());
+    Serial.printf("[SAVE] LittleFS total bytes: %u, used bytes: %u\n", (unsigned)LittleFS.totalBytes(), (unsigned)LittleFS.usedBytes());
 
-    if (LittleFS.exists("/config.json")) {
-      Serial.println(F("[SAVE] Renaming /config.json to /config.bak"));
-      LittleFS.rename("/config.json", "/config.bak");
-    }
-    File f = LittleFS.open("/config.json", "w");
-    if (!f) {
-      Serial.println(F("[SAVE] ERROR: Failed to open /config.json for writing!"));
-      DynamicJsonDocument errorDoc(256);
-      errorDoc[F("error")] = "Failed to write config file.";
-      String response;
-      serializeJson(errorDoc, response);
-      request->send(500, "application/json", response);
+    // Written to flash right away by tickConfigApply(). New WiFi credentials
+    // (or leaving AP mode) still need a restart, everything else is live.
+    uint64_t changed = commitConfigEdit(true);
+    bool needsRestart = isAPMode || (changed & CONFIG_RESTART_FIELDS);
+
+    DynamicJsonDocument okDoc(128);
+    okDoc[F("message")] = needsRestart ? "Saved successfully. Rebooting..." : "Saved and applied.";
+    okDoc[F("restart")] = needsRestart;
+    String response;
+    serializeJson(okDoc, response);
+    request->send(200, "application/json", response);
+
+    if (!needsRestart) {
+      Serial.printf("[SAVE] %d setting(s) changed, applying without restart\n", __builtin_popcountll(changed));
       return;
     }
+    Serial.println(F("[WEBSERVER] Sending success response and scheduling reboot..."));
 
-    size_t bytesWritten = serializeJson(doc, f);
-    Serial.printf("[SAVE] Bytes written to /config.json: %u\n", bytesWritten);
-    f.close();
-    Serial.println(F("[SAVE] /config.json file closed."));
+    // The main loop writes the queued config first, then restarts
+    request->onDisconnect([]() {
+      Serial.println(F("[WEBSERVER] Client disconnected, rebooting ESP..."));
+      configRestartRequested = true;
+    });
+  });
 
-    File verify = LittleFS.open("/config.json", "r");
-    if (!verify) {
-      Serial.println(F("[SAVE] ERROR: Failed to open /config.json for reading during verification!"));
-      DynamicJsonDocument errorDoc(256);
-      errorDoc[F("error")] = "Verification failed: Could not re-open config file.";
-      String response;
-      serializeJson(errorDoc, response);
-      request->send(500, "application/json", response);
+  // Batch settings: a partial config object with the /config.json keys
+  // (countdown fields nested under "countdown"). Every field is checked
+  // before any is set, so a bad request changes nothing; the changes are then
+  // applied live and persisted with a single deferred write.
+  // Admitted by the handler (see SettingsWebHandler) before the body came in.
+  SettingsWebHandler *settingsHandler = new SettingsWebHandler([](AsyncWebServerRequest *request, JsonVariant &json) {
+    Serial.println(F("[WEBSERVER] Request: /settings"));
+    if (!json.is<JsonObject>()) {
+      request->send(400, "application/json", "{\"error\":\"Expected a JSON object\"}");
       return;
     }
 
-    while (verify.available()) {
-      verify.read();
-    }
-    verify.seek(0);
+    // Pass 1: resolve and check every key
+    int ids[CONFIG_FIELD_COUNT];
+    JsonVariantConst values[CONFIG_FIELD_COUNT];
+    int count = 0;
+    char error[96] = "";
+    auto take = [&](const char *key, JsonVariantConst value) {
+      int id = configFindFieldPath(key);
+      const char *problem = id < 0                        ? "unknown setting"
+                            : count >= CONFIG_FIELD_COUNT ? "too many settings"
+                                                          : configCheckJsonValue(id, value);
+      if (problem) {
+        if (!error[0]) snprintf(error, sizeof(error), "%s: %s", key, problem);
+        return;
+      }
+      ids[count] = id;
+      values[count] = value;
+      count++;
+    };
 
-    DynamicJsonDocument test(2048);
-    DeserializationError err = deserializeJson(test, verify);
-    verify.close();
+    char path[48];
+    for (JsonPairConst kv : json.as<JsonObjectConst>()) {
+      if (strcmp(kv.key().c_str(), "countdown") == 0 && kv.value().is<JsonObjectConst>()) {
+        for (JsonPairConst nested : kv.value().as<JsonObjectConst>()) {
+          snprintf(path, sizeof(path), "countdown.%s", nested.key().c_str());
+          take(path, nested.value());
+        }
+      } else {
+        take(kv.key().c_str(), kv.value());
+      }
+    }
 
-    if (err) {
-      Serial.print(F("[SAVE] Config corrupted after save: "));
-      Serial.println(err.f_str());
-      DynamicJsonDocument errorDoc(256);
-      errorDoc[F("error")] = String("Config corrupted. Reboot cancelled. Error: ") + err.f_str();
+    if (error[0]) {
+      Serial.printf("[SETTINGS] Rejected: %s\n", error);
+      DynamicJsonDocument errorDoc(192);
+      errorDoc[F("error")] = error;
       String response;
       serializeJson(errorDoc, response);
-      request->send(500, "application/json", response);
+      request->send(400, "application/json", response);
       return;
     }
 
-    Serial.println(F("[SAVE] Config verification successful."));
-    DynamicJsonDocument okDoc(128);
-    strlcpy(customMessage, doc["customMessage"] | "", sizeof(customMessage));
-    okDoc[F("message")] = "Saved successfully. Rebooting...";
+    // Pass 2: set them all, then apply and persist once
+    Config &edit = beginConfigEdit();
+    for (int i = 0; i < count; i++) configStoreFromJson(edit, ids[i], values[i]);
+    uint64_t changed = commitConfigEdit(false);
+    Serial.printf("[SETTINGS] %d field(s) received, %d changed\n", count, __builtin_popcountll(changed));
+
+    DynamicJsonDocument okDoc(1024);
+    okDoc[F("ok")] = true;
+    JsonArray list = okDoc.createNestedArray("changed");
+    for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+      if (!(changed & CFG_BIT(i))) continue;
+      configFieldPath(i, path, sizeof(path));
+      list.add(path);
+    }
     String response;
     serializeJson(okDoc, response);
     request->send(200, "application/json", response);
-    Serial.println(F("[WEBSERVER] Sending success response and scheduling reboot..."));
-
-    request->onDisconnect([]() {
-      Serial.println(F("[WEBSERVER] Client disconnected, rebooting ESP..."));
-      saveUptime();
-      delay(100);  // ensure file is written
-      ESP.restart();
-    });
   });
+  server.addHandler(settingsHandler);
 
   server.on("/restore", HTTP_POST, [](AsyncWebServerRequest *request) {
     Serial.println(F("[WEBSERVER] Request: /restore"));
     if (LittleFS.exists("/config.bak")) {
-      File src = LittleFS.open("/config.bak", "r");
-      if (!src) {
-        Serial.println(F("[WEBSERVER] Failed to open /config.bak"));
-        DynamicJsonDocument errorDoc(128);
-        errorDoc[F("error")] = "Failed to open backup file.";
-        String response;
-        serializeJson(errorDoc, response);
-        request->send(500, "application/json", response);
-        return;
-      }
-      File dst = LittleFS.open("/config.json", "w");
-      if (!dst) {
-        src.close();
-        Serial.println(F("[WEBSERVER] Failed to open /config.json for writing"));
+      Config &restored = beginConfigEdit();
+      bool partial;
+      configSetDefaults(restored);
+      if (!readConfigSnapshot("/config.bak", restored, partial)) {
         DynamicJsonDocument errorDoc(128);
-        errorDoc[F("error")] = "Failed to open config for writing.";
+        errorDoc[F("error")] = "Backup file is damaged.";
         String response;
         serializeJson(errorDoc, response);
         request->send(500, "application/json", response);
         return;
       }
 
-      while (src.available()) {
-        dst.write(src.read());
-      }
-      src.close();
-      dst.close();
+      // The loop writes the backup as the new snapshot (the current one
+      // becomes the backup), then restarts
+      commitConfigEdit(false);
+      requestConfigSnapshot();
 
       DynamicJsonDocument okDoc(128);
       okDoc[F("message")] = "✅ Backup restored! Device will now reboot.";
@@ -1037,9 +2697,7 @@ void setupWebServer() {
       request->send(200, "application/json", response);
       request->onDisconnect([]() {
         Serial.println(F("[WEBSERVER] Rebooting after restore..."));
-        saveUptime();
-        delay(100);  // ensure file is written
-        ESP.restart();
+        configRestartRequested = true;
       });
 
     } else {
@@ -1062,6 +2720,7 @@ void setupWebServer() {
   });
 
   server.on("/set_brightness", HTTP_POST, [](AsyncWebServerRequest *request) {
+    if (!admitRequest(request)) return;
     if (!request->hasParam("value", true)) {
       request->send(400, "application/json", "{\"error\":\"Missing value\"}");
       return;
@@ -1075,8 +2734,8 @@ void setupWebServer() {
 
     // Handle OFF request
     if (newBrightness == -1) {
-      P.displayShutdown(true);
-      P.displayClear();
+      renderShutdown(true);
+      renderClear();
       displayOff = true;
 
       Serial.printf("[BRIGHTNESS] Display OFF via %s\n",
@@ -1091,9 +2750,9 @@ void setupWebServer() {
 
     if (displayOff) {
       // Wake from OFF
-      P.setIntensity(newBrightness);
-      advanceDisplayModeSafe();
-      P.displayShutdown(false);
+      renderSetIntensity(newBrightness);
+      advanceDisplayMode();
+      renderShutdown(false);
       brightness = newBrightness;
       displayOff = false;
 
@@ -1103,7 +2762,7 @@ void setupWebServer() {
     } else {
       // Display already ON
       brightness = newBrightness;
-      P.setIntensity(brightness);
+      renderSetIntensity(brightness);
 
       Serial.printf("[BRIGHTNESS] Set to %d via %s\n",
                     brightness,
@@ -1113,74 +2772,61 @@ void setupWebServer() {
   });
 
   server.on("/set_flip", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool flip = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      flip = (v == "1" || v == "true" || v == "on");
-    }
-    flipDisplay = flip;
-    P.setZoneEffect(0, flipDisplay, PA_FLIP_UD);
-    P.setZoneEffect(0, flipDisplay, PA_FLIP_LR);
-    Serial.printf("[WEBSERVER] Set flipDisplay to %d\n", flipDisplay);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool flip = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_FLIP_DISPLAY, flip ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set flipDisplay to %d\n", flip);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_twelvehour", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool twelveHour = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      twelveHour = (v == "1" || v == "true" || v == "on");
-    }
-    twelveHourToggle = twelveHour;
-    Serial.printf("[WEBSERVER] Set twelveHourToggle to %d\n", twelveHourToggle);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool twelveHour = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_TWELVE_HOUR, twelveHour ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set twelveHourToggle to %d\n", twelveHour);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_dayofweek", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool showDay = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      showDay = (v == "1" || v == "true" || v == "on");
-    }
-    showDayOfWeek = showDay;
-    Serial.printf("[WEBSERVER] Set showDayOfWeek to %d\n", showDayOfWeek);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool showDay = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_SHOW_DAY_OF_WEEK, showDay ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set showDayOfWeek to %d\n", showDay);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_showdate", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool showDateVal = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      showDateVal = (v == "1" || v == "true" || v == "on");
-    }
-    showDate = showDateVal;
-    Serial.printf("[WEBSERVER] Set showDate to %d\n", showDate);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool showDateVal = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_SHOW_DATE, showDateVal ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set showDate to %d\n", showDateVal);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_humidity", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool showHumidityNow = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      showHumidityNow = (v == "1" || v == "true" || v == "on");
-    }
-    showHumidity = showHumidityNow;
-    Serial.printf("[WEBSERVER] Set showHumidity to %d\n", showHumidity);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool showHumidityNow = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_SHOW_HUMIDITY, showHumidityNow ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set showHumidity to %d\n", showHumidityNow);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_colon_blink", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool enableBlink = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      enableBlink = (v == "1" || v == "true" || v == "on");
-    }
-    colonBlinkEnabled = enableBlink;
-    Serial.printf("[WEBSERVER] Set colonBlinkEnabled to %d\n", colonBlinkEnabled);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool enableBlink = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_COLON_BLINK, enableBlink ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set colonBlinkEnabled to %d\n", enableBlink);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_language", HTTP_POST, [](AsyncWebServerRequest *request) {
+    if (!admitRequest(request)) return;
     if (!request->hasParam("value", true)) {
       request->send(400, "application/json", "{\"error\":\"Missing value\"}");
       return;
@@ -1190,46 +2836,28 @@ void setupWebServer() {
     lang.trim();         // Remove whitespace/newlines
     lang.toLowerCase();  // Normalize to lowercase
 
-    strlcpy(language, lang.c_str(), sizeof(language));              // Safe copy to char[]
-    Serial.printf("[WEBSERVER] Set language to '%s'\n", language);  // Use quotes for debug
-
-    shouldFetchWeatherNow = true;
+    queueConfigSetting(CFG_LANGUAGE, lang);                             // weather refetch follows
+    Serial.printf("[WEBSERVER] Set language to '%s'\n", lang.c_str());  // Use quotes for debug
 
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_weatherdesc", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool showDesc = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      showDesc = (v == "1" || v == "true" || v == "on");
-    }
-
-    if (showWeatherDescription == true && showDesc == false) {
-      Serial.println(F("[WEBSERVER] showWeatherDescription toggled OFF. Checking display mode..."));
-      if (displayMode == 2) {
-        Serial.println(F("[WEBSERVER] Currently in Weather Description mode. Forcing mode advance/cleanup."));
-        advanceDisplayMode();
-      }
-    }
-
-    showWeatherDescription = showDesc;
-    Serial.printf("[WEBSERVER] Set Show Weather Description to %d\n", showWeatherDescription);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool showDesc = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_SHOW_WEATHER_DESCRIPTION, showDesc ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set Show Weather Description to %d\n", showDesc);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_units", HTTP_POST, [](AsyncWebServerRequest *request) {
+    if (!admitRequest(request)) return;
     if (request->hasParam("value", true)) {
       String v = request->getParam("value", true)->value();
-      if (v == "1" || v == "true" || v == "on") {
-        strcpy(weatherUnits, "imperial");
-        tempSymbol = ']';
-      } else {
-        strcpy(weatherUnits, "metric");
-        tempSymbol = '[';
-      }
-      Serial.printf("[WEBSERVER] Set weatherUnits to %s\n", weatherUnits);
-      shouldFetchWeatherNow = true;
+      const char *units = (v == "1" || v == "true" || v == "on") ? "imperial" : "metric";
+      queueConfigSetting(CFG_WEATHER_UNITS, units);  // weather refetch follows
+      Serial.printf("[WEBSERVER] Set weatherUnits to %s\n", units);
       request->send(200, "application/json", "{\"ok\":true}");
     } else {
       request->send(400, "application/json", "{\"error\":\"Missing value parameter\"}");
@@ -1237,130 +2865,41 @@ void setupWebServer() {
   });
 
   server.on("/set_countdown_enabled", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool enableCountdownNow = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      enableCountdownNow = (v == "1" || v == "true" || v == "on");
-    }
-
-    if (countdownEnabled == enableCountdownNow) {
-      Serial.println(F("[WEBSERVER] Countdown enable state unchanged, ignoring."));
-      request->send(200, "application/json", "{\"ok\":true}");
-      return;
-    }
-
-    if (countdownEnabled == true && enableCountdownNow == false) {
-      Serial.println(F("[WEBSERVER] Countdown toggled OFF. Checking display mode..."));
-      if (displayMode == 3) {
-        Serial.println(F("[WEBSERVER] Currently in Countdown mode. Forcing mode advance/cleanup."));
-        advanceDisplayMode();
-      }
-    }
-
-    countdownEnabled = enableCountdownNow;
-    Serial.printf("[WEBSERVER] Set Countdown Enabled to %d\n", countdownEnabled);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool enableCountdownNow = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_COUNTDOWN_ENABLED, enableCountdownNow ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set Countdown Enabled to %d\n", enableCountdownNow);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   server.on("/set_dramatic_countdown", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool enableDramaticNow = false;
-    if (request->hasParam("value", true)) {
-      String v = request->getParam("value", true)->value();
-      enableDramaticNow = (v == "1" || v == "true" || v == "on");
-    }
-
-    // Check if the state has changed
-    if (isDramaticCountdown == enableDramaticNow) {
-      Serial.println(F("[WEBSERVER] Dramatic Countdown state unchanged, ignoring."));
-      request->send(200, "application/json", "{\"ok\":true}");
-      return;
-    }
-
-    // Update the global variable
-    isDramaticCountdown = enableDramaticNow;
-
-    // Call saveCountdownConfig with only the existing parameters.
-    // It will read the updated global variable 'isDramaticCountdown'.
-    saveCountdownConfig(countdownEnabled, countdownTargetTimestamp, countdownLabel);
-
-    Serial.printf("[WEBSERVER] Set Dramatic Countdown to %d\n", isDramaticCountdown);
+    if (!admitRequest(request)) return;
+    String v = request->hasParam("value", true) ? request->getParam("value", true)->value() : "";
+    bool enableDramaticNow = (v == "1" || v == "true" || v == "on");
+    queueConfigSetting(CFG_COUNTDOWN_DRAMATIC, enableDramaticNow ? "true" : "false");
+    Serial.printf("[WEBSERVER] Set Dramatic Countdown to %d\n", enableDramaticNow);
     request->send(200, "application/json", "{\"ok\":true}");
   });
 
   // Set Clock-only-during-dimming (no reboot)
   server.on("/set_clock_only_dimming", HTTP_POST, [](AsyncWebServerRequest *request) {
+    if (!admitRequest(request)) return;
     bool enableNow = false;
     if (request->hasParam("value", true)) {
       String v = request->getParam("value", true)->value();
       enableNow = (v == "1" || v == "true" || v == "on");
     }
 
-    // Update runtime variable immediately
-    clockOnlyDuringDimming = enableNow;
-    Serial.printf("[WEBSERVER] Set clockOnlyDuringDimming to %d (requested)\n", clockOnlyDuringDimming);
-
-    // Read existing config.json (if present)
-    DynamicJsonDocument doc(2048);
-    bool needToWrite = true;
-    File configFile = LittleFS.open("/config.json", "r");
-    if (configFile) {
-      DeserializationError err = deserializeJson(doc, configFile);
-      configFile.close();
-      if (err) {
-        Serial.print(F("[WEBSERVER] Error parsing existing config.json: "));
-        Serial.println(err.f_str());
-        // proceed to write (will create a new doc)
-        doc.clear();
-      } else {
-        // If the key exists and matches the requested value, skip write
-        bool existing = doc["clockOnlyDuringDimming"] | false;
-        if (existing == enableNow) {
-          Serial.println(F("[WEBSERVER] clockOnlyDuringDimming unchanged — skipping write."));
-          // Send immediate OK response without touching FS
-          DynamicJsonDocument okDoc(128);
-          okDoc[F("ok")] = true;
-          okDoc[F("clockOnlyDuringDimming")] = enableNow;
-          String response;
-          serializeJson(okDoc, response);
-          request->send(200, "application/json", response);
-          return;
-        }
-      }
-    } else {
-      // No config file found — doc is empty and we will write
-      doc.clear();
-    }
-
-    // Set/update the key in the JSON doc
-    doc[F("clockOnlyDuringDimming")] = clockOnlyDuringDimming;
-
-    // Backup existing file only if it exists (and only because we're about to replace it)
-    if (LittleFS.exists("/config.json")) {
-      if (!LittleFS.rename("/config.json", "/config.bak")) {
-        Serial.println(F("[WEBSERVER] Warning: failed to create config backup"));
-        // continue anyway
-      }
-    }
-
-    File f = LittleFS.open("/config.json", "w");
-    if (!f) {
-      Serial.println(F("[WEBSERVER] ERROR: Failed to open /config.json for writing"));
-      DynamicJsonDocument errDoc(128);
-      errDoc[F("error")] = "Failed to write config file.";
-      String response;
-      serializeJson(errDoc, response);
-      request->send(500, "application/json", response);
-      return;
+    Serial.printf("[WEBSERVER] Set clockOnlyDuringDimming to %d (requested)\n", enableNow);
+    if (!queueConfigSetting(CFG_CLOCK_ONLY_DURING_DIMMING, enableNow ? "true" : "false")) {
+      Serial.println(F("[WEBSERVER] clockOnlyDuringDimming unchanged — skipping write."));
     }
 
-    size_t bytesWritten = serializeJson(doc, f);
-    f.close();
-    Serial.printf("[WEBSERVER] Saved clockOnlyDuringDimming=%d to /config.json (%u bytes written)\n", clockOnlyDuringDimming, bytesWritten);
-
     // Send immediate response (no reboot)
     DynamicJsonDocument okDoc(128);
     okDoc[F("ok")] = true;
-    okDoc[F("clockOnlyDuringDimming")] = clockOnlyDuringDimming;
+    okDoc[F("clockOnlyDuringDimming")] = enableNow;
     String response;
     serializeJson(okDoc, response);
     request->send(200, "application/json", response);
@@ -1368,6 +2907,7 @@ void setupWebServer() {
 
   // --- Custom Message Endpoint ---
   server.on("/set_custom_message", HTTP_POST, [](AsyncWebServerRequest *request) {
+    if (!admitRequest(request)) return;
     if (request->hasParam("message", true)) {
       String msg = request->getParam("message", true)->value();
       msg.trim();
@@ -1438,6 +2978,7 @@ void setupWebServer() {
             request->send(200, "text/plain", "CLEARED (HA temporary, no persistent)");
           }
         }
+        markDisplayModesDirty();
         return;
       }
 
@@ -1457,6 +2998,7 @@ void setupWebServer() {
       }
 
       filtered.toCharArray(customMessage, sizeof(customMessage));
+      markDisplayModesDirty();
 
       // --- STORE MESSAGE ---
       if (isFromHA) {
@@ -1486,7 +3028,7 @@ void setupWebServer() {
         Serial.printf("[UI] Persistent message stored: %s (speed=%d)\n",
                       customMessage, messageScrollSpeed);
 
-        // --- Persist to config.json immediately ---
+        // --- Persist to config ---
         saveCustomMessageToConfig(customMessage);
       }
 
@@ -1505,33 +3047,33 @@ void setupWebServer() {
     }
   });
 
+  // Served from the scan cache while it is fresh. ?top=N keeps the N
+  // strongest, ?dedupe=0 lists every BSSID, ?refresh=1 rescans anyway.
   server.on("/scan", HTTP_GET, [](AsyncWebServerRequest *request) {
     int scanStatus = WiFi.scanComplete();
-
-    // -2 means scan not triggered, -1 means scan in progress
-    if (scanStatus < -1 || scanStatus == WIFI_SCAN_FAILED) {
-      // Start the asynchronous scan
-      WiFi.scanNetworks(true);
+    if (scanStatus >= 0) {
+      cacheWifiScan(scanStatus);
+    } else if (request->hasParam("refresh") || !wifiScanFresh()) {
+      // -1 means a scan is already running, anything else starts one
+      if (scanStatus != -1) WiFi.scanNetworks(true);
       request->send(202, "application/json", "{\"status\":\"processing\"}");
-    } else if (scanStatus == -1) {
-      // Scan is currently running
-      request->send(202, "application/json", "{\"status\":\"processing\"}");
-    } else {
-      // Scan finished (scanStatus >= 0)
-      String json = "[";
-      for (int i = 0; i < scanStatus; ++i) {
-        json += "{";
-        json += "\"ssid\":\"" + WiFi.SSID(i) + "\",";
-        json += "\"rssi\":" + String(WiFi.RSSI(i));
-        json += "}";
-        if (i < scanStatus - 1) json += ",";
-      }
-      json += "]";
+      return;
+    }
 
-      // Clean up scan results from memory
-      WiFi.scanDelete();
-      request->send(200, "application/json", json);
+    ScanStream s;
+    memset(&s, 0, sizeof(s));
+    int top = request->hasParam("top") ? constrain(request->getParam("top")->value().toInt(), 0, WIFI_SCAN_MAX) : 0;
+    bool dedupe = !(request->hasParam("dedupe") && request->getParam("dedupe")->value() == "0");
+    for (uint8_t i = 0; i < wifiScanCount && (top == 0 || s.count < top); i++) {
+      if (dedupe && scanSsidSeenBefore(i)) continue;
+      s.entries[s.count++] = wifiScanResults[i];
     }
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+                                                                     [s](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+                                                                       return fillScanJson(s, buffer, maxLen);
+                                                                     });
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
   });
 
   server.on("/ip", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -1556,19 +3098,10 @@ void setupWebServer() {
       request->send(200, "text/plain", host);
     }
   });
-
-  server.on("/uptime", HTTP_GET, [](AsyncWebServerRequest *request) {
-    unsigned long seconds = 0;
-    String formatted = "No uptime recorded yet.";
-    if (LittleFS.exists("/uptime.dat")) {
-      File f = LittleFS.open("/uptime.dat", "r");
-      if (f) {
-        String content = f.readString();
-        seconds = content.toInt();
-        formatted = formatUptime(seconds);
-        f.close();
-      }
-    }
+
+  server.on("/uptime", HTTP_GET, [](AsyncWebServerRequest *request) {
+    unsigned long seconds = getTotalRuntimeSeconds();  // last saved total plus the time since
+    String formatted = formatUptime(seconds);
     String json = "{";
     json += "\"uptime_seconds\":" + String(seconds) + ",";
     json += "\"uptime_formatted\":\"" + formatted + "\",";
@@ -1577,46 +3110,72 @@ void setupWebServer() {
     request->send(200, "application/json", json);
   });
 
-  server.on("/export", HTTP_GET, [](AsyncWebServerRequest *request) {
-    Serial.println(F("[WEBSERVER] Request: /export"));
-
-    File f;
-    if (LittleFS.exists("/config.json")) {
-      f = LittleFS.open("/config.json", "r");
-      Serial.println(F("[EXPORT] Using /config.json"));
-    } else if (LittleFS.exists("/config.bak")) {
-      f = LittleFS.open("/config.bak", "r");
-      Serial.println(F("[EXPORT] /config.json not found, using /config.bak"));
-    } else {
-      request->send(404, "application/json", "{\"error\":\"No config found\"}");
-      return;
+  server.on("/loop_stats", HTTP_GET, [](AsyncWebServerRequest *request) {
+    String json;
+    json.reserve(2560);
+    json = "{\"bucket_bounds_us\":[";
+    for (int b = 0; b < LOOP_HIST_BUCKETS - 1; b++) {
+      if (b > 0) json += ",";
+      json += String(LOOP_HIST_BOUNDS_US[b]);
     }
-
-    DynamicJsonDocument doc(2048);
-    DeserializationError err = deserializeJson(doc, f);
-    f.close();
-    if (err) {
-      Serial.print(F("[EXPORT] Error parsing config: "));
-      Serial.println(err.f_str());
-      request->send(500, "application/json", "{\"error\":\"Failed to parse config\"}");
-      return;
+    json += "],\"pass\":{";
+    json += "\"budget_us\":" + String(LOOP_PASS_BUDGET_US) + ",";
+    json += "\"overruns\":" + String(loopPassStats.overruns) + ",";
+    json += "\"worst_us\":" + String(loopPassStats.worstUs) + ",";
+    json += "\"worst_task\":\"" + String(loopPassStats.worstTask) + "\",";
+    json += "\"worst_task_us\":" + String(loopPassStats.worstTaskUs);
+    json += "},\"sections\":{";
+    for (int s = 0; s < LOOP_SECTION_COUNT; s++) {
+      const LoopSectionStats &stats = loopSectionStats[s];
+      if (s > 0) json += ",";
+      json += "\"" + String(LOOP_SECTION_NAMES[s]) + "\":{";
+      json += "\"count\":" + String(stats.count) + ",";
+      json += "\"max_us\":" + String(stats.maxUs) + ",";
+      json += "\"avg_us\":" + String(stats.count ? (unsigned long)(stats.totalUs / stats.count) : 0UL) + ",";
+      json += "\"buckets\":[";
+      for (int b = 0; b < LOOP_HIST_BUCKETS; b++) {
+        if (b > 0) json += ",";
+        json += String(stats.buckets[b]);
+      }
+      json += "]}";
     }
+    json += "}}";
+    request->send(200, "application/json", json);
+  });
 
-    // Only sanitize if NOT in AP mode
-    if (!isAPMode) {
-      doc["ssid"] = "********";
-      doc["password"] = "********";
-      doc["openWeatherApiKey"] = "********************************";
-    }
+  server.on("/config_stats", HTTP_GET, [](AsyncWebServerRequest *request) {
+    String json = "{\"writes\":" + String(configWrites);
+    json += ",\"writes_avoided\":" + String(configWritesAvoided);
+    json += ",\"pending\":" + String(configFlushPending ? "true" : "false") + "}";
+    request->send(200, "application/json", json);
+  });
 
-    doc["mode"] = isAPMode ? "ap" : "sta";
+  server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (metricsBusySince != 0 && millis() - metricsBusySince < METRICS_BUSY_TIMEOUT) {
+      AsyncWebServerResponse *busy = request->beginResponse(503, "text/plain", "scrape in progress\n");
+      busy->addHeader("Retry-After", "1");
+      request->send(busy);
+      return;
+    }
+    size_t len = renderMetrics();
+    metricsBusySince = millis() | 1;  // never 0 while held
+    request->onDisconnect([]() {
+      metricsBusySince = 0;
+    });
+    request->send(request->beginResponse_P(200, "text/plain; version=0.0.4", (const uint8_t *)metricsBuffer, len));
+  });
 
-    String jsonOut;
-    serializeJsonPretty(doc, jsonOut);
+  server.on("/display_stats", HTTP_GET, [](AsyncWebServerRequest *request) {
+    String json = "{";
+    json += "\"spi_transactions\":" + String(displaySpiTransactions) + ",";
+    json += "\"spi_skipped\":" + String(displaySpiSkipped);
+    json += "}";
+    request->send(200, "application/json", json);
+  });
 
-    AsyncWebServerResponse *resp = request->beginResponse(200, "application/json", jsonOut);
-    resp->addHeader("Content-Disposition", "attachment; filename=\"config.json\"");
-    request->send(resp);
+  server.on("/export", HTTP_GET, [](AsyncWebServerRequest *request) {
+    Serial.println(F("[WEBSERVER] Request: /export"));
+    sendConfigView(request, exportView, true);
   });
 
   server.on("/upload", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -1684,6 +3243,11 @@ void setupWebServer() {
 
   server.on(
     "/upload", HTTP_POST, [](AsyncWebServerRequest *request) {
+      const char *uploadError = commitConfigUpload(request);
+      if (uploadError) {
+        request->send(400, "text/plain", String("Upload rejected: ") + uploadError + ". The current configuration was not changed.");
+        return;
+      }
       String html = R"rawliteral(
       <!DOCTYPE html>
       <html>
@@ -1744,19 +3308,15 @@ void setupWebServer() {
       </html>
     )rawliteral";
       request->send(200, "text/html", html);
-      // Restart after short delay to let browser handle redirect
+      // The loop saves the merged config, then restarts
       request->onDisconnect([]() {
-        delay(500);  // ensure response is sent
-        ESP.restart();
+        configRestartRequested = true;
       });
     },
     [](AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) {
-      static File f;
-      if (index == 0) {
-        f = LittleFS.open("/config.json", "w");  // start new file
-      }
-      if (f) f.write(data, len);  // write chunk
-      if (final) f.close();       // finish file
+      if (index == 0) beginConfigUpload(request);
+      feedConfigUpload(request, data, len);
+      if (final) finishConfigUpload(request);
     });
 
   server.on("/factory_reset", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -1831,7 +3391,8 @@ void setupWebServer() {
       delay(500);
 
       // --- Remove configuration and uptime files ---
-      const char *filesToRemove[] = { "/config.json", "/uptime.dat", "/index.html" };
+      cancelConfigFlush();
+      const char *filesToRemove[] = { "/config.bin", "/config.bak", "/config.tmp", "/config.json", CONFIG_UPLOAD_TMP, "/uptime.log", "/uptime.dat", "/index.html" };
       for (auto &file : filesToRemove) {
         if (LittleFS.exists(file)) {
           if (LittleFS.remove(file)) {
@@ -1857,6 +3418,7 @@ void setupWebServer() {
     });
   });
 
+  setupEvents();
   server.onNotFound(handleCaptivePortal);
   server.begin();
   Serial.println(F("[WEBSERVER] Web server started"));
@@ -1897,147 +3459,74 @@ void handleCaptivePortal(AsyncWebServerRequest *request) {
 }
 
 
-String normalizeWeatherDescription(String str) {
-  // Serbian Cyrillic → Latin
-  str.replace("а", "a");
-  str.replace("б", "b");
-  str.replace("в", "v");
-  str.replace("г", "g");
-  str.replace("д", "d");
-  str.replace("ђ", "dj");
-  str.replace("е", "e");
-  str.replace("ё", "e");  // Russian
-  str.replace("ж", "z");
-  str.replace("з", "z");
-  str.replace("и", "i");
-  str.replace("й", "j");  // Russian
-  str.replace("ј", "j");  // Serbian
-  str.replace("к", "k");
-  str.replace("л", "l");
-  str.replace("љ", "lj");
-  str.replace("м", "m");
-  str.replace("н", "n");
-  str.replace("њ", "nj");
-  str.replace("о", "o");
-  str.replace("п", "p");
-  str.replace("р", "r");
-  str.replace("с", "s");
-  str.replace("т", "t");
-  str.replace("ћ", "c");
-  str.replace("у", "u");
-  str.replace("ф", "f");
-  str.replace("х", "h");
-  str.replace("ц", "c");
-  str.replace("ч", "c");
-  str.replace("џ", "dz");
-  str.replace("ш", "s");
-  str.replace("щ", "sh");  // Russian
-  str.replace("ы", "y");   // Russian
-  str.replace("э", "e");   // Russian
-  str.replace("ю", "yu");  // Russian
-  str.replace("я", "ya");  // Russian
-
-  // Latin diacritics → ASCII
-  str.replace("å", "a");
-  str.replace("ä", "a");
-  str.replace("à", "a");
-  str.replace("á", "a");
-  str.replace("â", "a");
-  str.replace("ã", "a");
-  str.replace("ā", "a");
-  str.replace("ă", "a");
-  str.replace("ą", "a");
-
-  str.replace("æ", "ae");
-
-  str.replace("ç", "c");
-  str.replace("č", "c");
-  str.replace("ć", "c");
-
-  str.replace("ď", "d");
-
-  str.replace("é", "e");
-  str.replace("è", "e");
-  str.replace("ê", "e");
-  str.replace("ë", "e");
-  str.replace("ē", "e");
-  str.replace("ė", "e");
-  str.replace("ę", "e");
-
-  str.replace("ğ", "g");
-  str.replace("ģ", "g");
-
-  str.replace("ĥ", "h");
-
-  str.replace("í", "i");
-  str.replace("ì", "i");
-  str.replace("î", "i");
-  str.replace("ï", "i");
-  str.replace("ī", "i");
-  str.replace("į", "i");
-
-  str.replace("ĵ", "j");
-
-  str.replace("ķ", "k");
-
-  str.replace("ľ", "l");
-  str.replace("ł", "l");
-
-  str.replace("ñ", "n");
-  str.replace("ń", "n");
-  str.replace("ņ", "n");
-
-  str.replace("ó", "o");
-  str.replace("ò", "o");
-  str.replace("ô", "o");
-  str.replace("ö", "o");
-  str.replace("õ", "o");
-  str.replace("ø", "o");
-  str.replace("ō", "o");
-  str.replace("ő", "o");
-
-  str.replace("œ", "oe");
-
-  str.replace("ŕ", "r");
-
-  str.replace("ś", "s");
-  str.replace("š", "s");
-  str.replace("ș", "s");
-  str.replace("ŝ", "s");
-
-  str.replace("ß", "ss");
-
-  str.replace("ť", "t");
-  str.replace("ț", "t");
-
-  str.replace("ú", "u");
-  str.replace("ù", "u");
-  str.replace("û", "u");
-  str.replace("ü", "u");
-  str.replace("ū", "u");
-  str.replace("ů", "u");
-  str.replace("ű", "u");
-
-  str.replace("ŵ", "w");
-
-  str.replace("ý", "y");
-  str.replace("ÿ", "y");
-  str.replace("ŷ", "y");
-
-  str.replace("ž", "z");
-  str.replace("ź", "z");
-  str.replace("ż", "z");
+// Look up the ASCII replacement for a code point, nullptr if the font can't show it
+const char *transliterateCodepoint(uint32_t cp) {
+  int lo = 0;
+  int hi = (int)TRANSLIT_MAPPING_COUNT - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    uint16_t midCp = translit_mappings[mid].codepoint;
+    if (midCp == cp) return translit_mappings[mid].ascii;
+    if (midCp < cp) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return nullptr;
+}
 
-  str.toUpperCase();
+// Single pass over the UTF-8 input: letters are upper-cased, Cyrillic and
+// Latin diacritics transliterated, everything except A-Z and space dropped.
+void normalizeWeatherDescription(const char *in, char *out, size_t outSize) {
+  if (outSize == 0) return;
+  size_t len = 0;
+  const uint8_t *p = (const uint8_t *)in;
+
+  while (*p && len < outSize - 1) {
+    uint8_t c = *p;
+    uint32_t cp;
+    int extra;
+    if (c < 0x80) {
+      cp = c;
+      extra = 0;
+    } else if ((c & 0xE0) == 0xC0) {
+      cp = c & 0x1F;
+      extra = 1;
+    } else if ((c & 0xF0) == 0xE0) {
+      cp = c & 0x0F;
+      extra = 2;
+    } else if ((c & 0xF8) == 0xF0) {
+      cp = c & 0x07;
+      extra = 3;
+    } else {
+      p++;  // stray continuation byte
+      continue;
+    }
+    p++;
+    bool valid = true;
+    for (int i = 0; i < extra; i++) {
+      if ((*p & 0xC0) != 0x80) {
+        valid = false;  // truncated sequence, resync on this byte
+        break;
+      }
+      cp = (cp << 6) | (*p & 0x3F);
+      p++;
+    }
+    if (!valid) continue;
 
-  String result = "";
-  for (unsigned int i = 0; i < str.length(); i++) {
-    char c = str.charAt(i);
-    if ((c >= 'A' && c <= 'Z') || c == ' ') {
-      result += c;
+    if (cp < 0x80) {
+      char ch = (char)cp;
+      if (ch >= 'a' && ch <= 'z') ch -= 'a' - 'A';
+      if ((ch >= 'A' && ch <= 'Z') || ch == ' ') out[len++] = ch;
+      continue;
     }
+
+    const char *ascii = transliterateCodepoint(cp);
+    if (!ascii) continue;
+    size_t n = strlen(ascii);
+    if (len + n > outSize - 1) break;  // don't emit half a digraph
+    memcpy(out + len, ascii, n);
+    len += n;
   }
-  return result;
+  out[len] = '\0';
 }
 
 
@@ -2057,6 +3546,111 @@ bool isFiveDigitZip(const char *str) {
 }
 
 
+// -----------------------------------------------------------------------------
+// HTTPS Connection Manager
+// -----------------------------------------------------------------------------
+// Splits "https://host[:port]/path" into host and port
+bool parseHttpsHost(const char *url, char *host, size_t hostSize, uint16_t &port) {
+  if (strncmp(url, "https://", 8) != 0) return false;
+  const char *start = url + 8;
+  size_t len = strcspn(start, ":/?");
+  if (len == 0 || len >= hostSize) return false;
+  memcpy(host, start, len);
+  host[len] = '\0';
+  port = (start[len] == ':') ? atoi(start + len + 1) : 443;
+  return port != 0;
+}
+
+
+// Points conn at the server of url, dropping the socket and session when it
+// changes. False if url is not an https:// URL.
+bool tlsSelectHost(TlsConnection &conn, const char *url) {
+  char host[sizeof(conn.host)];
+  uint16_t port;
+  if (!parseHttpsHost(url, host, sizeof(host), port)) return false;
+
+  if (strcmp(host, conn.host) != 0 || port != conn.port) {
+    // Different server: neither the socket nor the session apply any more
+    conn.client.stop();
+#if defined(ESP8266)
+    conn.session = BearSSL::Session();
+#endif
+    strlcpy(conn.host, host, sizeof(conn.host));
+    conn.port = port;
+  }
+  return true;
+}
+
+
+// Opens a fresh connection to conn.host, resuming the cached session where
+// the platform supports it. The handshake blocks for up to timeoutMs.
+bool tlsConnect(TlsConnection &conn, uint16_t timeoutMs) {
+  conn.client.stop();
+  conn.client.setInsecure();  // no cert validation
+#if defined(ESP8266)
+  conn.client.setBufferSizes(512, 512);
+  conn.client.setSession(&conn.session);
+  conn.client.setTimeout(timeoutMs);
+#endif
+  unsigned long start = millis();
+#if defined(ESP32)
+  bool connected = conn.client.connect(conn.host, conn.port, timeoutMs);
+#else
+  bool connected = conn.client.connect(conn.host, conn.port);
+#endif
+  unsigned long took = millis() - start;
+  if (!connected) {
+    Serial.printf("[TLS] %s: connection to %s failed after %lu ms\n", conn.label, conn.host, took);
+    return false;
+  }
+  conn.handshakes++;
+  conn.lastHandshakeMs = took;
+  conn.totalHandshakeMs += took;
+  Serial.printf("[TLS] %s: handshake with %s took %lu ms (%lu handshakes, avg %lu ms)\n",
+                conn.label, conn.host, took, (unsigned long)conn.handshakes, conn.totalHandshakeMs / conn.handshakes);
+  return true;
+}
+
+
+// Sends a GET for url over conn, reusing its open connection when the server
+// kept it alive and (re)connecting otherwise. Returns the HTTP status or a
+// negative HTTPClient error; read the body from conn.http, then call tlsDone().
+int tlsGet(TlsConnection &conn, const char *url, uint16_t timeoutMs) {
+  if (!tlsSelectHost(conn, url)) return HTTPC_ERROR_CONNECTION_REFUSED;
+
+  for (int attempt = 0; attempt < 2; attempt++) {
+    bool reused = conn.client.connected();
+    if (reused) {
+      conn.reuses++;
+      Serial.printf("[TLS] %s: reusing connection to %s (%lu handshakes, %lu reuses)\n",
+                    conn.label, conn.host, (unsigned long)conn.handshakes, (unsigned long)conn.reuses);
+    } else if (!tlsConnect(conn, timeoutMs)) {
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+
+    conn.http.begin(conn.client, url);
+    conn.http.setReuse(TLS_KEEP_ALIVE);
+    conn.http.setTimeout(timeoutMs);
+    int httpCode = conn.http.GET();
+    if (httpCode >= 0 || !reused) return httpCode;
+
+    // The server closed the idle connection under us, start over once
+    Serial.printf("[TLS] %s: kept-alive connection was dropped, reconnecting\n", conn.label);
+    conn.http.end();
+    conn.client.stop();
+  }
+  return HTTPC_ERROR_CONNECTION_LOST;
+}
+
+
+// Finishes the request started by tlsGet(). The socket stays open for the
+// next request when keep-alive is enabled and the server agreed to it.
+void tlsDone(TlsConnection &conn) {
+  conn.http.end();
+  if (!TLS_KEEP_ALIVE) conn.client.stop();
+}
+
+
 // -----------------------------------------------------------------------------
 // Weather Fetching and API settings
 // -----------------------------------------------------------------------------
@@ -2099,10 +3693,168 @@ String buildWeatherURL() {
 }
 
 
-void fetchWeather() {
+// Filter for deserializeJson(): everything parseWeatherDoc() doesn't read is
+// skipped while parsing instead of being stored
+const JsonDocument &weatherFilterDoc() {
+  if (weatherFilter.isNull()) {
+    weatherFilter["main"]["temp"] = true;
+    weatherFilter["main"]["humidity"] = true;
+    weatherFilter["weather"][0]["description"] = true;
+    weatherFilter["sys"]["sunrise"] = true;
+    weatherFilter["sys"]["sunset"] = true;
+  }
+  return weatherFilter;
+}
+
+
+void fetchStatsBegin(FetchStats &stats) {
+  stats.startedAt = millis();
+}
+
+
+void fetchStatsEnd(FetchStats &stats, bool ok) {
+  stats.lastMs = millis() - stats.startedAt;
+  stats.count++;
+  if (!ok) stats.failures++;
+}
+
+
+void weatherHeapBegin() {
+  weatherHeapStart = ESP.getFreeHeap();
+  weatherHeapLow = weatherHeapStart;
+}
+
+
+void weatherHeapSample() {
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap < weatherHeapLow) weatherHeapLow = freeHeap;
+}
+
+
+void weatherHeapReport() {
+  weatherHeapSample();
+  Serial.printf("[WEATHER] Heap: %u bytes free before fetch, peak use during fetch %u bytes\n",
+                (unsigned)weatherHeapStart, (unsigned)(weatherHeapStart - weatherHeapLow));
+}
+
+
+// Turns the filtered OpenWeatherMap response in weatherDoc into snap. Runs on
+// the fetcher side, so it must not touch the display globals.
+bool parseWeatherDoc(DeserializationError error, WeatherSnapshot &snap) {
+  JsonDocument &doc = weatherDoc;
+
+  if (error) {
+    Serial.print(F("[WEATHER] JSON parse error: "));
+    Serial.println(error.f_str());
+    return false;
+  }
+
+  Serial.print(F("[WEATHER] Filtered payload: "));
+  serializeJson(doc, Serial);
+  Serial.println();
+
+  if (doc.containsKey(F("main")) && doc[F("main")].containsKey(F("temp"))) {
+    float temp = doc[F("main")][F("temp")];
+    snprintf(snap.temp, sizeof(snap.temp), "%d°", (int)round(temp));
+    Serial.printf("[WEATHER] Temp: %s\n", snap.temp);
+  } else {
+    Serial.println(F("[WEATHER] Temperature not found in JSON payload"));
+    return false;
+  }
+
+  if (doc.containsKey(F("main")) && doc[F("main")].containsKey(F("humidity"))) {
+    snap.humidity = doc[F("main")][F("humidity")];
+    Serial.printf("[WEATHER] Humidity: %d%%\n", snap.humidity);
+  } else {
+    snap.humidity = -1;
+  }
+
+  snap.description[0] = '\0';
+  if (doc.containsKey(F("weather")) && doc[F("weather")].is<JsonArray>()) {
+    JsonObject weatherObj = doc[F("weather")][0];
+    if (weatherObj.containsKey(F("description"))) {
+      normalizeWeatherDescription(weatherObj[F("description")] | "", snap.description, sizeof(snap.description));
+      Serial.printf("[WEATHER] Description used: %s\n", snap.description);
+    }
+  } else {
+    Serial.println(F("[WEATHER] Weather description not found in JSON payload"));
+  }
+
+  // -----------------------------------------
+  // Sunrise/Sunset for Auto Dimming (local time)
+  // -----------------------------------------
+  snap.hasSunTimes = false;
+  if (doc.containsKey(F("sys"))) {
+    JsonObject sys = doc[F("sys")];
+    if (sys.containsKey(F("sunrise")) && sys.containsKey(F("sunset"))) {
+      // OWM gives UTC timestamps
+      time_t sunriseUtc = sys[F("sunrise")].as<time_t>();
+      time_t sunsetUtc = sys[F("sunset")].as<time_t>();
+
+      // Get local timezone offset (in seconds)
+      long tzOffset = 0;
+      struct tm local_tm;
+      time_t now = time(nullptr);
+      if (localtime_r(&now, &local_tm)) {
+        tzOffset = mktime(&local_tm) - now;
+      }
+
+      // Convert UTC → local
+      time_t sunriseLocal = sunriseUtc + tzOffset;
+      time_t sunsetLocal = sunsetUtc + tzOffset;
+
+      // Break into hour/minute
+      struct tm tmSunrise, tmSunset;
+      localtime_r(&sunriseLocal, &tmSunrise);
+      localtime_r(&sunsetLocal, &tmSunset);
+
+      snap.sunriseHour = tmSunrise.tm_hour;
+      snap.sunriseMinute = tmSunrise.tm_min;
+      snap.sunsetHour = tmSunset.tm_hour;
+      snap.sunsetMinute = tmSunset.tm_min;
+      snap.hasSunTimes = true;
+
+      Serial.printf("[WEATHER] Adjusted Sunrise/Sunset (local): %02d:%02d | %02d:%02d\n",
+                    snap.sunriseHour, snap.sunriseMinute, snap.sunsetHour, snap.sunsetMinute);
+    } else {
+      Serial.println(F("[WEATHER] Sunrise/Sunset not found in JSON."));
+    }
+  } else {
+    Serial.println(F("[WEATHER] 'sys' object not found in JSON payload."));
+  }
+
+  return true;
+}
+
+
+// Fetcher side: make snap the new front buffer. Only the fetcher writes the
+// back buffer, so the copy needs no lock; the flip itself does.
+void publishWeatherSnapshot(WeatherSnapshot &snap) {
+  fetchStatsEnd(weatherFetchStats, snap.status == WEATHER_FETCH_OK);
+  uint8_t back = weatherFrontIndex ^ 1;
+  snap.fetchedAt = millis();
+  snap.seq = weatherSnapshots[weatherFrontIndex].seq + 1;
+  weatherSnapshots[back] = snap;
+  FETCH_LOCK();
+  weatherFrontIndex = back;
+  FETCH_UNLOCK();
+}
+
+
+// Main loop side: copy of the latest complete snapshot
+void readWeatherSnapshot(WeatherSnapshot &out) {
+  FETCH_LOCK();
+  out = weatherSnapshots[weatherFrontIndex];
+  FETCH_UNLOCK();
+}
+
+
+// Checks that a fetch makes sense and builds the request URL. Runs on the main
+// loop because it reads the config globals.
+bool prepareWeatherFetch() {
   if (millis() - lastWifiConnectTime < 5000) {
     Serial.println(F("[WEATHER] Skipped: Network just reconnected. Letting it stabilize..."));
-    return;  // Stop execution if connection is less than 5 seconds old
+    return false;  // Stop execution if connection is less than 5 seconds old
   }
 
   Serial.println(F("[WEATHER] Fetching weather data..."));
@@ -2110,192 +3862,532 @@ void fetchWeather() {
     Serial.println(F("[WEATHER] Skipped: WiFi not connected"));
     weatherAvailable = false;
     weatherFetched = false;
-    return;
+    return false;
   }
   if (!openWeatherApiKey || strlen(openWeatherApiKey) != 32) {
     Serial.println(F("[WEATHER] Skipped: Invalid API key (must be exactly 32 characters)"));
     weatherAvailable = false;
     weatherFetched = false;
-    return;
+    return false;
   }
   if (!(strlen(openWeatherCity) > 0 && strlen(openWeatherCountry) > 0)) {
     Serial.println(F("[WEATHER] Skipped: City or Country is empty."));
     weatherAvailable = false;
+    return false;
+  }
+
+  Serial.println(F("[WEATHER] Connecting to OpenWeatherMap..."));
+  String url = buildWeatherURL();
+  Serial.print(F("[WEATHER] URL: "));  // Use F() with Serial.print
+  Serial.println(url);
+
+  FETCH_LOCK();
+  strlcpy(weatherRequestUrl, url.c_str(), sizeof(weatherRequestUrl));
+  FETCH_UNLOCK();
+  return true;
+}
+
+
+#if defined(ESP32)
+// Blocking GET + parse, only ever called from fetchTask
+void fetchWeatherSnapshot(const char *url, WeatherSnapshot &snap) {
+  fetchStatsBegin(weatherFetchStats);
+  weatherHeapBegin();
+
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+  // ===== ESP32-S2 → HTTP =====
+  HTTPClient http;  // Create an HTTPClient object
+  WiFiClient client;
+  client.stop();
+
+  http.begin(client, url);
+  http.setTimeout(10000);  // Sets both connection and stream timeout to 10 seconds
+  http.useHTTP10(true);    // no chunked encoding, so the body can be parsed off the socket
+
+  Serial.println(F("[WEATHER] Sending GET request..."));
+  int httpCode = http.GET();  // Send the GET request
+  bool streamable = true;
+#else
+  // ===== ESP32 → HTTPS, over the kept-alive weather connection =====
+  HTTPClient &http = weatherTls.http;
+
+  Serial.println(F("[WEATHER] Sending GET request..."));
+  int httpCode = tlsGet(weatherTls, url, 10000);
+  bool streamable = http.getSize() >= 0;  // a chunked body has to be de-chunked by HTTPClient first
+#endif
+  weatherHeapSample();
+
+  if (httpCode == HTTP_CODE_OK) {  // Check if HTTP response code is 200 (OK)
+    DeserializationError error;
+    if (streamable) {
+      Serial.println(F("[WEATHER] HTTP 200 OK. Parsing payload from stream..."));
+      error = deserializeJson(weatherDoc, http.getStream(), DeserializationOption::Filter(weatherFilterDoc()));
+    } else {
+      Serial.println(F("[WEATHER] HTTP 200 OK. Reading chunked payload..."));
+      String payload = http.getString();
+      error = deserializeJson(weatherDoc, payload, DeserializationOption::Filter(weatherFilterDoc()));
+    }
+    weatherHeapSample();
+    snap.status = parseWeatherDoc(error, snap) ? WEATHER_FETCH_OK : WEATHER_FETCH_PARSE_FAILED;
+  } else {
+    Serial.printf("[WEATHER] HTTP GET failed, error code: %d, reason: %s\n",
+                  httpCode, http.errorToString(httpCode).c_str());
+    snap.status = WEATHER_FETCH_HTTP_FAILED;
+  }
+
+#if defined(CONFIG_IDF_TARGET_ESP32S2)
+  http.end();
+#else
+  tlsDone(weatherTls);
+#endif
+  weatherDoc.clear();
+  weatherHeapReport();
+}
+
+
+// Fetch task: sleeps until the main loop sets a FETCH_* bit, then runs the
+// blocking request(s) and publishes the result. The display loop never waits
+// on it.
+void fetchTask(void *param) {
+  static WeatherSnapshot snap;  // kept off the task stack, TLS needs the room
+  static NightscoutReading reading;
+  static char url[sizeof(weatherRequestUrl)];
+
+  for (;;) {
+    uint32_t jobs = 0;
+    xTaskNotifyWait(0, ULONG_MAX, &jobs, portMAX_DELAY);
+
+    if (jobs & FETCH_WEATHER) {
+      FETCH_LOCK();
+      memcpy(url, weatherRequestUrl, sizeof(weatherRequestUrl));
+      FETCH_UNLOCK();
+
+      memset(&snap, 0, sizeof(snap));
+      fetchWeatherSnapshot(url, snap);
+      publishWeatherSnapshot(snap);
+      weatherFetchBusy = false;
+    }
+
+    if (jobs & FETCH_NIGHTSCOUT) {
+      FETCH_LOCK();
+      memcpy(url, nightscoutRequestUrl, sizeof(nightscoutRequestUrl));
+      reading = nightscoutReading;
+      FETCH_UNLOCK();
+
+      if (fetchNightscoutReading(url, reading)) {
+        FETCH_LOCK();
+        nightscoutReading = reading;
+        FETCH_UNLOCK();
+      }
+      nightscoutFetchBusy = false;
+    }
+  }
+}
+
+
+bool weatherFetchRunning() {
+  return weatherFetchBusy;
+}
+
+
+void startWeatherFetch() {
+  if (weatherFetchBusy) {
+    Serial.println(F("[WEATHER] Skipped: previous fetch still running"));
+    return;
+  }
+  if (!prepareWeatherFetch()) return;
+  weatherFetchBusy = true;
+  xTaskNotify(fetchTaskHandle, FETCH_WEATHER, eSetBits);
+}
+
+
+void serviceWeatherFetch() {}
+
+#else
+// One polling step of an HTTP/1.0 response: drains what has arrived (a
+// bounded amount per call) into buf and, once the headers are complete,
+// keeps the status in httpCode and drops the headers so the body gets the
+// whole buffer. httpCode stays 0 until then. False if buf is full.
+bool pollHttpResponse(Client &client, char *buf, size_t size, size_t &len, int &httpCode) {
+  int avail = client.available();
+  if (avail > 0) {
+    size_t room = size - 1 - len;
+    if (room == 0) return false;
+    int n = client.read((uint8_t *)buf + len, min((size_t)avail, min(room, (size_t)256)));
+    if (n > 0) len += n;
+    buf[len] = '\0';
+  }
+
+  // "HTTP/1.x 200 OK\r\n...\r\n\r\n<body>"
+  if (httpCode == 0) {
+    char *bodyStart = strstr(buf, "\r\n\r\n");
+    if (bodyStart) {
+      const char *space = strchr(buf, ' ');
+      httpCode = (space && space < bodyStart) ? atoi(space + 1) : -1;
+      if (httpCode == 0) httpCode = -1;
+      bodyStart += 4;
+      len -= bodyStart - buf;
+      memmove(buf, bodyStart, len + 1);
+    }
+  }
+  return true;
+}
+
+
+// ===== ESP8266 → HTTP, one step per weather tick =====
+// Plain HTTP/1.0 so the body arrives unchunked and the server closes the
+// connection when it is done.
+bool weatherFetchRunning() {
+  return weatherFetchState != WEATHER_FETCH_IDLE;
+}
+
+
+void startWeatherFetch() {
+  if (weatherFetchState != WEATHER_FETCH_IDLE) {
+    Serial.println(F("[WEATHER] Skipped: previous fetch still running"));
+    return;
+  }
+  if (!prepareWeatherFetch()) return;
+  fetchStatsBegin(weatherFetchStats);
+  weatherHeapBegin();
+
+  const char *host = "api.openweathermap.org";
+  const char *path = strchr(weatherRequestUrl + strlen("http://"), '/');
+
+  weatherClient.stop();
+  weatherClient.setTimeout(2000);  // bounds the blocking connect(), reads are polled below
+  if (!path || !weatherClient.connect(host, 80)) {
+    Serial.println(F("[WEATHER] HTTP GET failed, error code: -1, reason: connection refused"));
+    WeatherSnapshot snap = {};
+    snap.status = WEATHER_FETCH_HTTP_FAILED;
+    publishWeatherSnapshot(snap);
+    return;
+  }
+
+  Serial.println(F("[WEATHER] Sending GET request..."));
+  weatherClient.printf("GET %s HTTP/1.0\r\nHost: %s\r\nUser-Agent: ESPTimeCast\r\nConnection: close\r\n\r\n", path, host);
+
+  weatherResponseLen = 0;
+  weatherResponse[0] = '\0';
+  weatherHttpCode = 0;
+  weatherHeapSample();
+  weatherFetchStartTime = millis();
+  weatherFetchState = WEATHER_FETCH_READING;
+}
+
+
+void serviceWeatherFetch() {
+  if (weatherFetchState != WEATHER_FETCH_READING) return;
+
+  // Drain what has arrived so far straight into the fixed response buffer
+  bool overflow = !pollHttpResponse(weatherClient, weatherResponse, sizeof(weatherResponse), weatherResponseLen, weatherHttpCode);
+  weatherHeapSample();
+
+  WeatherSnapshot snap = {};
+  if (overflow) {
+    Serial.println(F("[WEATHER] HTTP GET failed, error code: -1, reason: response too large"));
+    snap.status = WEATHER_FETCH_HTTP_FAILED;
+  } else if (weatherClient.available() > 0 || weatherClient.connected()) {
+    if (millis() - weatherFetchStartTime < WEATHER_FETCH_TIMEOUT) return;  // keep reading next tick
+    Serial.println(F("[WEATHER] HTTP GET failed, error code: -11, reason: read Timeout"));
+    snap.status = WEATHER_FETCH_HTTP_FAILED;
+  } else if (weatherHttpCode == HTTP_CODE_OK) {
+    // Connection closed, the whole body is in the buffer
+    Serial.println(F("[WEATHER] HTTP 200 OK. Parsing payload..."));
+    DeserializationError error = deserializeJson(weatherDoc, weatherResponse, weatherResponseLen,
+                                                 DeserializationOption::Filter(weatherFilterDoc()));
+    weatherHeapSample();
+    snap.status = parseWeatherDoc(error, snap) ? WEATHER_FETCH_OK : WEATHER_FETCH_PARSE_FAILED;
+  } else {
+    Serial.printf("[WEATHER] HTTP GET failed, error code: %d\n", weatherHttpCode);
+    snap.status = WEATHER_FETCH_HTTP_FAILED;
+  }
+
+  weatherClient.stop();
+  weatherResponseLen = 0;
+  weatherDoc.clear();
+  weatherFetchState = WEATHER_FETCH_IDLE;
+  weatherHeapReport();
+  publishWeatherSnapshot(snap);
+}
+#endif
+
+
+// -----------------------------------------
+// Save updated sunrise/sunset to config
+// -----------------------------------------
+void saveSunTimesToConfig() {
+  bool valuesChanged = configSetInt(CFG_SUNRISE_HOUR, sunriseHour);
+  valuesChanged |= configSetInt(CFG_SUNRISE_MINUTE, sunriseMinute);
+  valuesChanged |= configSetInt(CFG_SUNSET_HOUR, sunsetHour);
+  valuesChanged |= configSetInt(CFG_SUNSET_MINUTE, sunsetMinute);
+
+  if (valuesChanged) {  // Only write if a change occurred
+    Serial.println(F("[WEATHER] Sunrise/Sunset changed, queued config save."));
+    scheduleConfigSave();
+  } else {
+    Serial.println(F("[WEATHER] Sunrise/Sunset unchanged, skipping config save."));
+  }
+}
+
+
+// Copies a newly published snapshot into the globals the display modes use.
+// Main loop only, so LittleFS writes stay off the fetcher.
+void applyWeatherSnapshot() {
+  static WeatherSnapshot snap;
+  if (weatherSnapshots[weatherFrontIndex].seq == weatherSeqApplied) return;
+  readWeatherSnapshot(snap);
+  weatherSeqApplied = snap.seq;
+  markDisplayModesDirty();
+
+  if (snap.status != WEATHER_FETCH_OK) {
+    weatherAvailable = false;
+    weatherFetched = false;
     return;
   }
 
-  Serial.println(F("[WEATHER] Connecting to OpenWeatherMap..."));
-  String url = buildWeatherURL();
-  Serial.print(F("[WEATHER] URL: "));  // Use F() with Serial.print
-  Serial.println(url);
+  currentTemp = snap.temp;
+  currentHumidity = snap.humidity;
+  if (snap.description[0] != '\0') {
+    weatherDescription = snap.description;
+  }
+  weatherAvailable = true;
+
+  if (snap.hasSunTimes) {
+    sunriseHour = snap.sunriseHour;
+    sunriseMinute = snap.sunriseMinute;
+    sunsetHour = snap.sunsetHour;
+    sunsetMinute = snap.sunsetMinute;
+  }
+
+  weatherFetched = true;
+
+  if (autoDimmingEnabled && sunriseHour >= 0 && sunsetHour >= 0) {
+    saveSunTimesToConfig();
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Nightscout Poller
+// -----------------------------------------------------------------------------
+// Reads the newest entry of a Nightscout entries response into reading.
+// reading keeps its previous values when the parse fails.
+bool parseNightscoutReading(const char *json, size_t len, NightscoutReading &reading) {
+  // --- Small helper inside this block ---
+  auto makeTimeUTC = [](struct tm *tm) -> time_t {
+#if defined(ESP32)
+    // ESP32: timegm() is not implemented — emulate correctly
+    struct tm tm_copy = *tm;
+    // mktime() interprets tm as local, but system time is UTC already
+    // so we can safely assume input is UTC
+    return mktime(&tm_copy);
+#elif defined(ESP8266)
+    // ESP8266: timegm() not available either, same logic
+    struct tm tm_copy = *tm;
+    return mktime(&tm_copy);
+#else
+    // Platforms with proper timegm()
+    return timegm(tm);
+#endif
+  };
+  // --------------------------------------
+
+  StaticJsonDocument<1024> doc;
+  DeserializationError error = deserializeJson(doc, json, len);
+  if (error || !doc.is<JsonArray>() || doc.size() == 0) {
+    Serial.println("Failed to parse Nightscout JSON");
+    return false;
+  }
+
+  JsonObject firstReading = doc[0].as<JsonObject>();
+  reading.glucose = firstReading["glucose"] | firstReading["sgv"] | -1;
+  strlcpy(reading.direction, firstReading["direction"] | "?", sizeof(reading.direction));
+  const char *dateStr = firstReading["dateString"];
+
+  // --- Parse ISO 8601 UTC time ---
+  if (dateStr) {
+    struct tm tm {};
+    if (sscanf(dateStr, "%4d-%2d-%2dT%2d:%2d:%2dZ",
+               &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+               &tm.tm_hour, &tm.tm_min, &tm.tm_sec)
+        == 6) {
+      tm.tm_year -= 1900;
+      tm.tm_mon -= 1;
+      reading.timestamp = makeTimeUTC(&tm);
+    }
+  }
+  reading.fetchedAt = millis();
 
-  HTTPClient http;  // Create an HTTPClient object
+  Serial.printf("Nightscout data fetched: %d mg/dL %s\n", reading.glucose, reading.direction);
+  return true;
+}
 
-#if defined(ESP8266) || defined(CONFIG_IDF_TARGET_ESP32S2)
-  // ===== ESP8266 → HTTP =====
-  WiFiClient client;
-  client.stop();
-  yield();
 
-  http.begin(client, url);
-#else
-  // ===== ESP32 → HTTPS =====
-  WiFiClientSecure client;
-  client.stop();
-  yield();
-  client.setInsecure();  // no cert validation
+#if defined(ESP32)
+// HTTPS GET of the Nightscout entries URL, run by the fetch task. reading
+// keeps its previous values when the request or the parse fails.
+bool fetchNightscoutReading(const char *url, NightscoutReading &reading) {
+  bool updated = false;
+  HTTPClient &https = nightscoutTls.http;
+  fetchStatsBegin(nightscoutFetchStats);
+
+  Serial.println("[HTTPS] Nightscout fetch initiated...");
+  int httpCode = tlsGet(nightscoutTls, url, NIGHTSCOUT_FETCH_TIMEOUT);
+
+  if (httpCode == HTTP_CODE_OK) {
+    String payload = https.getString();
+    updated = parseNightscoutReading(payload.c_str(), payload.length(), reading);
+  } else {
+    Serial.printf("[HTTPS] GET failed, error: %s\n", https.errorToString(httpCode).c_str());
+  }
 
-  http.begin(client, url);
-#endif
+  tlsDone(nightscoutTls);
+  fetchStatsEnd(nightscoutFetchStats, updated);
+  return updated;
+}
 
-  http.setTimeout(10000);  // Sets both connection and stream timeout to 10 seconds
 
-  Serial.println(F("[WEATHER] Sending GET request..."));
-  int httpCode = http.GET();  // Send the GET request
+void serviceNightscoutFetch() {}
 
-  if (httpCode == HTTP_CODE_OK) {  // Check if HTTP response code is 200 (OK)
-    Serial.println(F("[WEATHER] HTTP 200 OK. Reading payload..."));
 
-    String payload = http.getString();
-    Serial.println(F("[WEATHER] Response received."));
-    Serial.print(F("[WEATHER] Payload: "));  // Use F() with Serial.print
-    Serial.println(payload);
+void startNightscoutFetch() {
+  if (nightscoutFetchBusy) return;
+  FETCH_LOCK();
+  strlcpy(nightscoutRequestUrl, ntpServer2, sizeof(nightscoutRequestUrl));
+  FETCH_UNLOCK();
+  nightscoutFetchBusy = true;
+  xTaskNotify(fetchTaskHandle, FETCH_NIGHTSCOUT, eSetBits);
+}
 
-    DynamicJsonDocument doc(1536);  // Adjust size as needed, use ArduinoJson Assistant
-    DeserializationError error = deserializeJson(doc, payload);
+#else
+// ===== ESP8266 → HTTPS over HTTP/1.0, one step per tick =====
+// Same shape as the weather fetch: connect and send, then collect the
+// response a bounded amount per tick. Only the BearSSL handshake inside
+// connect() still blocks, and the cached session keeps it short after the
+// first one.
+void startNightscoutFetch() {
+  if (nightscoutFetchRunning) return;
+  fetchStatsBegin(nightscoutFetchStats);
+  Serial.println("[HTTPS] Nightscout fetch initiated...");
+
+  const char *path = strchr(ntpServer2 + strlen("https://"), '/');
+  if (!tlsSelectHost(nightscoutTls, ntpServer2) || !tlsConnect(nightscoutTls, NIGHTSCOUT_FETCH_TIMEOUT)) {
+    Serial.println(F("[HTTPS] GET failed, error: connection refused"));
+    fetchStatsEnd(nightscoutFetchStats, false);
+    return;
+  }
+  nightscoutTls.client.printf("GET %s HTTP/1.0\r\nHost: %s\r\nUser-Agent: ESPTimeCast\r\nConnection: close\r\n\r\n",
+                              path ? path : "/", nightscoutTls.host);
+
+  nightscoutResponseLen = 0;
+  nightscoutResponse[0] = '\0';
+  nightscoutHttpCode = 0;
+  nightscoutFetchStartTime = millis();
+  nightscoutFetchRunning = true;
+}
 
-    if (error) {
-      Serial.print(F("[WEATHER] JSON parse error: "));
-      Serial.println(error.f_str());
-      weatherAvailable = false;
-      return;
-    }
 
-    if (doc.containsKey(F("main")) && doc[F("main")].containsKey(F("temp"))) {
-      float temp = doc[F("main")][F("temp")];
-      currentTemp = String((int)round(temp)) + "°";
-      Serial.printf("[WEATHER] Temp: %s\n", currentTemp.c_str());
-      weatherAvailable = true;
-    } else {
-      Serial.println(F("[WEATHER] Temperature not found in JSON payload"));
-      weatherAvailable = false;
-      return;
-    }
+void serviceNightscoutFetch() {
+  if (!nightscoutFetchRunning) return;
 
-    if (doc.containsKey(F("main")) && doc[F("main")].containsKey(F("humidity"))) {
-      currentHumidity = doc[F("main")][F("humidity")];
-      Serial.printf("[WEATHER] Humidity: %d%%\n", currentHumidity);
-    } else {
-      currentHumidity = -1;
-    }
+  bool updated = false;
+  WiFiClientSecure &client = nightscoutTls.client;
+  if (!pollHttpResponse(client, nightscoutResponse, sizeof(nightscoutResponse), nightscoutResponseLen, nightscoutHttpCode)) {
+    Serial.println(F("[HTTPS] GET failed, error: response too large"));
+  } else if (client.available() > 0 || client.connected()) {
+    if (millis() - nightscoutFetchStartTime < NIGHTSCOUT_FETCH_TIMEOUT) return;  // keep reading next tick
+    Serial.println(F("[HTTPS] GET failed, error: read Timeout"));
+  } else if (nightscoutHttpCode == HTTP_CODE_OK) {
+    updated = parseNightscoutReading(nightscoutResponse, nightscoutResponseLen, nightscoutReading);
+  } else {
+    Serial.printf("[HTTPS] GET failed, error: HTTP %d\n", nightscoutHttpCode);
+  }
 
-    if (doc.containsKey(F("weather")) && doc[F("weather")].is<JsonArray>()) {
-      JsonObject weatherObj = doc[F("weather")][0];
-      if (weatherObj.containsKey(F("main"))) {
-        mainDesc = weatherObj[F("main")].as<String>();
-      }
-      if (weatherObj.containsKey(F("description"))) {
-        detailedDesc = weatherObj[F("description")].as<String>();
-      }
-    } else {
-      Serial.println(F("[WEATHER] Weather description not found in JSON payload"));
-    }
+  client.stop();
+  nightscoutResponseLen = 0;
+  nightscoutFetchRunning = false;
+  fetchStatsEnd(nightscoutFetchStats, updated);
+}
+#endif
 
-    weatherDescription = normalizeWeatherDescription(detailedDesc);
-    Serial.printf("[WEATHER] Description used: %s\n", weatherDescription.c_str());
 
-    // -----------------------------------------
-    // Sunrise/Sunset for Auto Dimming (local time)
-    // -----------------------------------------
-    if (doc.containsKey(F("sys"))) {
-      JsonObject sys = doc[F("sys")];
-      if (sys.containsKey(F("sunrise")) && sys.containsKey(F("sunset"))) {
-        // OWM gives UTC timestamps
-        time_t sunriseUtc = sys[F("sunrise")].as<time_t>();
-        time_t sunsetUtc = sys[F("sunset")].as<time_t>();
+// Polls Nightscout on its own cadence whenever it is configured, so display
+// mode 4 always has a cached reading to draw
+void tickNightscout() {
+  serviceNightscoutFetch();
+  if (showingIp || WiFi.status() != WL_CONNECTED) return;
+  if (strncmp(ntpServer2, "https://", 8) != 0) return;  // Nightscout not configured
 
-        // Get local timezone offset (in seconds)
-        long tzOffset = 0;
-        struct tm local_tm;
-        time_t now = time(nullptr);
-        if (localtime_r(&now, &local_tm)) {
-          tzOffset = mktime(&local_tm) - now;
-        }
+  unsigned long interval = (nightscoutReading.glucose == -1) ? NIGHTSCOUT_RETRY_INTERVAL : NIGHTSCOUT_FETCH_INTERVAL;
+  if (lastNightscoutPoll != 0 && millis() - lastNightscoutPoll < interval) return;
+  lastNightscoutPoll = millis();
+  startNightscoutFetch();
+}
 
-        // Convert UTC → local
-        time_t sunriseLocal = sunriseUtc + tzOffset;
-        time_t sunsetLocal = sunsetUtc + tzOffset;
 
-        // Break into hour/minute
-        struct tm tmSunrise, tmSunset;
-        localtime_r(&sunriseLocal, &tmSunrise);
-        localtime_r(&sunsetLocal, &tmSunset);
+// -----------------------------
+// Uptime ring on LittleFS
+// -----------------------------
+uint32_t uptimeRecordCrc(const UptimeRecord &r) {
+  return crc32Update(0, (const uint8_t *)&r, offsetof(UptimeRecord, crc));
+}
 
-        sunriseHour = tmSunrise.tm_hour;
-        sunriseMinute = tmSunrise.tm_min;
-        sunsetHour = tmSunset.tm_hour;
-        sunsetMinute = tmSunset.tm_min;
 
-        Serial.printf("[WEATHER] Adjusted Sunrise/Sunset (local): %02d:%02d | %02d:%02d\n",
-                      sunriseHour, sunriseMinute, sunsetHour, sunsetMinute);
-      } else {
-        Serial.println(F("[WEATHER] Sunrise/Sunset not found in JSON."));
-      }
-    } else {
-      Serial.println(F("[WEATHER] 'sys' object not found in JSON payload."));
-    }
-
-    weatherFetched = true;
-
-    // -----------------------------------------
-    // Save updated sunrise/sunset to config.json
-    // -----------------------------------------
-    if (autoDimmingEnabled && sunriseHour >= 0 && sunsetHour >= 0) {
-      File configFile = LittleFS.open("/config.json", "r");
-      DynamicJsonDocument doc(1024);
-
-      if (configFile) {
-        DeserializationError error = deserializeJson(doc, configFile);
-        configFile.close();
-
-        if (!error) {
-          // Check if ANY value has changed
-          bool valuesChanged =
-            (doc["sunriseHour"].as<int>() != sunriseHour || doc["sunriseMinute"].as<int>() != sunriseMinute || doc["sunsetHour"].as<int>() != sunsetHour || doc["sunsetMinute"].as<int>() != sunsetMinute);
-
-          if (valuesChanged) {  // Only write if a change occurred
-            doc["sunriseHour"] = sunriseHour;
-            doc["sunriseMinute"] = sunriseMinute;
-            doc["sunsetHour"] = sunsetHour;
-            doc["sunsetMinute"] = sunsetMinute;
-
-            File f = LittleFS.open("/config.json", "w");
-            if (f) {
-              serializeJsonPretty(doc, f);
-              f.close();
-              Serial.println(F("[WEATHER] SAVED NEW sunrise/sunset to config.json (Values changed)"));
-            } else {
-              Serial.println(F("[WEATHER] Failed to write updated sunrise/sunset to config.json"));
-            }
-          } else {
-            Serial.println(F("[WEATHER] Sunrise/Sunset unchanged, skipping config save."));
-          }
-          // --- END MODIFIED COMPARISON LOGIC ---
+// Creates the ring at full size so later saves never grow or truncate it
+bool createUptimeRing() {
+  File f = LittleFS.open(UPTIME_RING_PATH, "w");
+  if (!f) return false;
+  UptimeRecord empty = { 0, 0, 0 };
+  size_t written = 0;
+  for (uint8_t i = 0; i < UPTIME_RING_SLOTS; i++) {
+    written += f.write((const uint8_t *)&empty, sizeof(empty));
+  }
+  f.close();
+  fsBytesWritten += written;
+  uptimeRingSeq = 0;
+  uptimeRingNext = 0;
+  return written == UPTIME_RING_SLOTS * sizeof(UptimeRecord);
+}
 
-        } else {
-          Serial.println(F("[WEATHER] JSON parse error when saving updated sunrise/sunset"));
-        }
-      }
-    }
 
-  } else {
-    Serial.printf("[WEATHER] HTTP GET failed, error code: %d, reason: %s\n",
-                  httpCode, http.errorToString(httpCode).c_str());
-    weatherAvailable = false;
-    weatherFetched = false;
+// One read, one scan: the valid record with the highest seq is the newest
+bool readUptimeRing(unsigned long &seconds) {
+  File f = LittleFS.open(UPTIME_RING_PATH, "r");
+  if (!f) return false;
+  UptimeRecord ring[UPTIME_RING_SLOTS];
+  size_t bytesRead = f.read((uint8_t *)ring, sizeof(ring));
+  f.close();
+  if (bytesRead != sizeof(ring)) return false;
+
+  bool found = false;
+  for (uint8_t i = 0; i < UPTIME_RING_SLOTS; i++) {
+    if (ring[i].seq == 0 || ring[i].crc != uptimeRecordCrc(ring[i])) continue;
+    if (!found || ring[i].seq > uptimeRingSeq) {
+      found = true;
+      uptimeRingSeq = ring[i].seq;
+      uptimeRingNext = (i + 1) % UPTIME_RING_SLOTS;
+      seconds = ring[i].seconds;
+    }
   }
+  return found;
+}
 
-  http.end();
+
+bool writeUptimeRecord(unsigned long seconds) {
+  File f = LittleFS.open(UPTIME_RING_PATH, "r+");
+  if (!f) return false;
+  UptimeRecord r;
+  r.seq = uptimeRingSeq + 1;
+  r.seconds = seconds;
+  r.crc = uptimeRecordCrc(r);
+  bool ok = f.seek(uptimeRingNext * sizeof(UptimeRecord))
+            && f.write((const uint8_t *)&r, sizeof(r)) == sizeof(r);
+  f.close();
+  if (!ok) return false;
+  fsBytesWritten += sizeof(r);
+  uptimeRingSeq = r.seq;
+  uptimeRingNext = (uptimeRingNext + 1) % UPTIME_RING_SLOTS;
+  return true;
 }
 
 
@@ -2303,24 +4395,34 @@ void fetchWeather() {
 // Load uptime from LittleFS
 // -----------------------------
 void loadUptime() {
-  if (LittleFS.exists("/uptime.dat")) {
-    File f = LittleFS.open("/uptime.dat", "r");
-    if (f) {
-      totalUptimeSeconds = f.parseInt();
-      f.close();
-      bootMillis = millis();
-      Serial.printf("[UPTIME] Loaded accumulated uptime: %lu seconds (%.2f hours)\n",
-                    totalUptimeSeconds, totalUptimeSeconds / 3600.0);
-    } else {
-      Serial.println(F("[UPTIME] Failed to open /uptime.dat for reading."));
-      totalUptimeSeconds = 0;
-      bootMillis = millis();
-    }
+  unsigned long seconds = 0;
+  if (readUptimeRing(seconds)) {
+    totalUptimeSeconds = seconds;
+    Serial.printf("[UPTIME] Loaded accumulated uptime: %lu seconds (%.2f hours), record #%u\n",
+                  totalUptimeSeconds, totalUptimeSeconds / 3600.0, uptimeRingSeq);
   } else {
-    Serial.println(F("[UPTIME] No previous uptime file found. Starting from 0."));
-    totalUptimeSeconds = 0;
-    bootMillis = millis();
+    // No usable ring: start one, carrying over a pre-ring /uptime.dat if present
+    bool migrated = false;
+    if (LittleFS.exists("/uptime.dat")) {
+      File f = LittleFS.open("/uptime.dat", "r");
+      if (f) {
+        seconds = f.parseInt();
+        f.close();
+        migrated = true;
+      }
+    }
+    totalUptimeSeconds = seconds;
+    if (!createUptimeRing()) {
+      Serial.println(F("[UPTIME] Failed to create " UPTIME_RING_PATH));
+    } else if (migrated && writeUptimeRecord(seconds)) {
+      LittleFS.remove("/uptime.dat");
+      Serial.printf("[UPTIME] Migrated /uptime.dat into " UPTIME_RING_PATH ": %lu seconds\n", seconds);
+    }
+    if (!migrated) {
+      Serial.println(F("[UPTIME] No previous uptime found. Starting from 0."));
+    }
   }
+  bootMillis = millis();
 }
 
 
@@ -2332,13 +4434,13 @@ void saveUptime() {
   totalUptimeSeconds = getTotalRuntimeSeconds();
   bootMillis = millis();  // reset session start
 
-  File f = LittleFS.open("/uptime.dat", "w");
-  if (f) {
-    f.print(totalUptimeSeconds);
-    f.close();
-    Serial.printf("[UPTIME] Saved accumulated uptime: %s\n", formatTotalRuntime().c_str());
+  // A missing or unwritable ring is recreated once
+  if (writeUptimeRecord(totalUptimeSeconds)
+      || (createUptimeRing() && writeUptimeRecord(totalUptimeSeconds))) {
+    Serial.printf("[UPTIME] Saved accumulated uptime: %s (record #%u)\n",
+                  formatTotalRuntime().c_str(), uptimeRingSeq);
   } else {
-    Serial.println(F("[UPTIME] Failed to write /uptime.dat"));
+    Serial.println(F("[UPTIME] Failed to write " UPTIME_RING_PATH));
   }
 }
 
@@ -2366,38 +4468,12 @@ String formatTotalRuntime() {
 
 
 void saveCustomMessageToConfig(const char *msg) {
-  Serial.println(F("[CONFIG] Updating customMessage in config.json..."));
-
-  DynamicJsonDocument doc(2048);
-
-  // Load existing config.json (if present)
-  File configFile = LittleFS.open("/config.json", "r");
-  if (configFile) {
-    DeserializationError err = deserializeJson(doc, configFile);
-    configFile.close();
-    if (err) {
-      Serial.print(F("[CONFIG] Error reading existing config: "));
-      Serial.println(err.f_str());
-    }
-  }
-
-  // Update only customMessage
-  doc["customMessage"] = msg;
-
-  // Safely write back to config.json
-  if (LittleFS.exists("/config.json")) {
-    LittleFS.rename("/config.json", "/config.bak");
-  }
-
-  File f = LittleFS.open("/config.json", "w");
-  if (!f) {
-    Serial.println(F("[CONFIG] ERROR: Failed to open /config.json for writing"));
+  Serial.println(F("[CONFIG] Updating customMessage in config..."));
+  if (!queueConfigSetting(CFG_CUSTOM_MESSAGE, msg)) {
+    Serial.println(F("[CONFIG] customMessage unchanged, skipping write."));
     return;
   }
-
-  size_t bytesWritten = serializeJson(doc, f);
-  f.close();
-  Serial.printf("[CONFIG] Saved customMessage='%s' (%u bytes written)\n", msg, bytesWritten);
+  Serial.printf("[CONFIG] customMessage='%s' queued for saving\n", msg);
 }
 
 // Returns formatted uptime (for web UI or logs)
@@ -2450,16 +4526,17 @@ void setup() {
   }
   Serial.println(F("[FS] LittleFS mounted and ready."));
   loadUptime();
-  ensureHtmlFileExists();
+  removeLegacyHtmlFile();
   P.begin();  // Initialize Parola library
 
-  P.setCharSpacing(0);
+  renderSetCharSpacing(0);
   P.setFont(mFactory);
   loadConfig();  // This function now has internal yields and prints
 
-  P.setIntensity(brightness);
+  renderSetIntensity(brightness);
   P.setZoneEffect(0, flipDisplay, PA_FLIP_UD);
   P.setZoneEffect(0, flipDisplay, PA_FLIP_LR);
+  invalidateRenderCache();
 
   Serial.println(F("[SETUP] Parola (LED Matrix) initialized"));
 
@@ -2479,6 +4556,7 @@ void setup() {
         break;
       case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
         name = "DISCONNECTED";
+        wifiDisconnects++;
         MDNS.end();
         Serial.println("[WIFI EVENT] mDNS stopped.");
         break;
@@ -2497,6 +4575,7 @@ void setup() {
 
   mDisConnectHandler = WiFi.onStationModeDisconnected([](const WiFiEventStationModeDisconnected &ev) {
     Serial.printf("[WIFI EVENT] Disconnected (Reason: %d)\n", ev.reason);
+    wifiDisconnects++;
     MDNS.end();
     Serial.println("[WIFI EVENT] mDNS stopped.");
   });
@@ -2529,6 +4608,10 @@ void setup() {
   printConfigToSerial();
 #endif
   setupTime();
+#if defined(ESP32)
+  xTaskCreatePinnedToCore(fetchTask, "fetch", 8192, nullptr, 1, &fetchTaskHandle, 0);
+  Serial.println(F("[FETCH] Weather/Nightscout fetch task started"));
+#endif
   displayMode = 0;
   lastSwitch = millis() - (clockDuration - 500);
   lastColonBlink = millis();
@@ -2536,90 +4619,131 @@ void setup() {
   saveUptime();
 }
 
-void ensureHtmlFileExists() {
-  Serial.println(F("[FS] Checking for /index.html on LittleFS..."));
+// The UI used to be copied to LittleFS and served from there; now it is
+// served from flash and an old copy only takes up space
+void removeLegacyHtmlFile() {
+  if (LittleFS.exists("/index.html")) {
+    LittleFS.remove("/index.html");
+    Serial.println(F("[FS] Removed /index.html left by older firmware"));
+  }
+}
 
-  // Length of embedded HTML in PROGMEM
-  size_t expectedSize = strlen_P(index_html);
+// -----------------------------------------------------------------------------
+// Display Mode Rotation
+// -----------------------------------------------------------------------------
+// Each mode has a descriptor with an eligibility check. The checks only run
+// when markDisplayModesDirty() was called (weather arrived, a setting was
+// toggled, the countdown ended...); refreshDisplayModeMask() then rebuilds the
+// eligibility mask and the successor of every mode, so advancing is a lookup.
+bool weatherConfigured() {
+  return strlen(openWeatherApiKey) == 32 && strlen(openWeatherCity) > 0 && strlen(openWeatherCountry) > 0;
+}
 
-  // If the file exists, verify size before deciding to trust it
-  if (LittleFS.exists("/index.html")) {
-    File f = LittleFS.open("/index.html", "r");
+bool clockModeEligible() {
+  return true;
+}
 
-    if (!f) {
-      Serial.println(F("[FS] ERROR: /index.html exists but failed to open! Will rewrite."));
-    } else {
+bool weatherModeEligible() {
+  return weatherAvailable && weatherConfigured();
+}
 
-      bool identical = true;
+bool descriptionModeEligible() {
+  return showWeatherDescription && weatherAvailable && weatherDescription.length() > 0;
+}
 
-      for (size_t i = 0; i < expectedSize; i++) {
-        if (!f.available()) {
-          identical = false;
-          break;
-        }
+bool countdownModeEligible() {
+  return countdownEnabled && !countdownFinished && ntpSyncSuccessful && countdownTargetTimestamp > 0 && countdownTargetTimestamp > time(nullptr);
+}
 
-        char fileChar = f.read();
-        char progChar = pgm_read_byte_near(index_html + i);
+bool nightscoutModeEligible() {
+  return strncmp(ntpServer2, "https://", 8) == 0;
+}
 
-        if (fileChar != progChar) {
-          identical = false;
-          break;
-        }
-      }
+bool dateModeEligible() {
+  return showDate;
+}
 
-      // Also check if file has extra trailing bytes
-      if (f.available()) {
-        identical = false;
-      }
+bool customMessageModeEligible() {
+  return strlen(customMessage) > 0;
+}
 
-      f.close();
+// Indexed by displayMode
+const DisplayModeInfo displayModes[DISPLAY_MODE_COUNT] = {
+  { "clock", "CLOCK", clockModeEligible },
+  { "weather", "WEATHER", weatherModeEligible },
+  { "description", "DESCRIPTION", descriptionModeEligible },
+  { "countdown", "COUNTDOWN", countdownModeEligible },
+  { "nightscout", "NIGHTSCOUT", nightscoutModeEligible },
+  { "date", "DATE", dateModeEligible },
+  { "message", "CUSTOM MESSAGE", customMessageModeEligible },
+};
 
-      if (identical) {
-        Serial.printf("[FS] /index.html content identical (%u bytes). Using file system version.\n", expectedSize);
-        return;
-      }
 
-      Serial.println(F("[FS] /index.html content differs. Rewriting..."));
+void markDisplayModesDirty() {
+  displayModeMaskDirty = true;
+}
+
+
+// Parses a comma separated list of mode keys ("clock,date,weather,...") into
+// displayModeOrder. Unknown and repeated keys are ignored, modes left out are
+// never shown. The order must contain the clock, otherwise the default is used.
+void applyDisplayOrder(const char *order) {
+  char buf[sizeof(displayOrder)];
+  bool seen[DISPLAY_MODE_COUNT] = { false };
+  char *savePtr = nullptr;
+
+  strlcpy(buf, order, sizeof(buf));
+  displayModeOrderLen = 0;
+  for (char *key = strtok_r(buf, ", ", &savePtr); key; key = strtok_r(nullptr, ", ", &savePtr)) {
+    for (int m = 0; m < DISPLAY_MODE_COUNT; m++) {
+      if (!seen[m] && strcasecmp(key, displayModes[m].key) == 0) {
+        seen[m] = true;
+        displayModeOrder[displayModeOrderLen++] = m;
+        break;
+      }
     }
-  } else {
-    Serial.println(F("[FS] /index.html NOT found. Writing embedded content to LittleFS..."));
   }
 
-  // -------------------------------
-  // Write embedded HTML to LittleFS
-  // -------------------------------
-
-  File f = LittleFS.open("/index.html", "w");
-  if (!f) {
-    Serial.println(F("[FS] ERROR: Failed to create /index.html for writing!"));
+  if (!seen[0]) {
+    if (strlen(order) > 0) {
+      Serial.printf("[DISPLAY] Invalid displayOrder '%s' (no clock), using default order.\n", order);
+    }
+    applyDisplayOrder(DEFAULT_DISPLAY_ORDER);
     return;
   }
+  markDisplayModesDirty();
+}
 
-  size_t htmlLength = expectedSize;
-  size_t bytesWritten = 0;
 
-  for (size_t i = 0; i < htmlLength; i++) {
-    char c = pgm_read_byte_near(index_html + i);
+void refreshDisplayModeMask() {
+  uint8_t mask = 0;
+  for (int m = 0; m < DISPLAY_MODE_COUNT; m++) {
+    if (displayModes[m].eligible()) mask |= (1 << m);
+  }
 
-    if (f.write((uint8_t *)&c, 1) == 1) {
-      bytesWritten++;
-    } else {
-      Serial.printf("[FS] Write failure at character %u. Aborting write.\n", i);
-      f.close();
-      return;
+  // Successor of every mode along the user order. A mode that is not in the
+  // order (e.g. a countdown forced on screen) continues from the top.
+  for (int m = 0; m < DISPLAY_MODE_COUNT; m++) {
+    int pos = -1;
+    for (int p = 0; p < displayModeOrderLen; p++) {
+      if (displayModeOrder[p] == m) pos = p;
+    }
+    int next = 0;  // Clock is always eligible
+    for (int step = 1; step <= displayModeOrderLen; step++) {
+      int candidate = displayModeOrder[(pos + step) % displayModeOrderLen];
+      if (mask & (1 << candidate)) {
+        next = candidate;
+        break;
+      }
     }
+    nextDisplayMode[m] = next;
   }
 
-  f.close();
-
-  if (bytesWritten == htmlLength) {
-    Serial.printf("[FS] Successfully wrote %u bytes to /index.html.\n", bytesWritten);
-  } else {
-    Serial.printf("[FS] WARNING: Only wrote %u of %u bytes to /index.html (might be incomplete).\n",
-                  bytesWritten, htmlLength);
-  }
+  displayModeMask = mask;
+  displayModeMaskDirty = false;
 }
 
+
 void advanceDisplayMode() {
 
   // If user requested clock-only during dimming and we are currently dimmed, stay on clock
@@ -2654,210 +4778,371 @@ void advanceDisplayMode() {
     }
   }
 
+  if (displayModeMaskDirty) refreshDisplayModeMask();
+
   prevDisplayMode = displayMode;
-  int oldMode = displayMode;
-  String ntpField = String(ntpServer2);
-  bool nightscoutConfigured = ntpField.startsWith("https://");
-
-  if (displayMode == 0) {  // Clock
-    if (showDate) {
-      displayMode = 5;  // Date mode right after Clock
-      Serial.println(F("[DISPLAY] Switching to display mode: DATE (from Clock)"));
-    } else if (weatherAvailable && (strlen(openWeatherApiKey) == 32) && (strlen(openWeatherCity) > 0) && (strlen(openWeatherCountry) > 0)) {
-      displayMode = 1;
-      Serial.println(F("[DISPLAY] Switching to display mode: WEATHER (from Clock)"));
-    } else if (countdownEnabled && !countdownFinished && ntpSyncSuccessful && countdownTargetTimestamp > 0 && countdownTargetTimestamp > time(nullptr)) {
-      displayMode = 3;
-      Serial.println(F("[DISPLAY] Switching to display mode: COUNTDOWN (from Clock, weather skipped)"));
-    } else if (nightscoutConfigured) {
-      displayMode = 4;  // Clock -> Nightscout (if weather & countdown are skipped)
-      Serial.println(F("[DISPLAY] Switching to display mode: NIGHTSCOUT (from Clock, weather & countdown skipped)"));
-    } else {
-      displayMode = 0;
-      Serial.println(F("[DISPLAY] Staying in CLOCK (from Clock)"));
-    }
-  } else if (displayMode == 5) {  // Date mode
-    if (weatherAvailable && (strlen(openWeatherApiKey) == 32) && (strlen(openWeatherCity) > 0) && (strlen(openWeatherCountry) > 0)) {
-      displayMode = 1;
-      Serial.println(F("[DISPLAY] Switching to display mode: WEATHER (from Date)"));
-    } else if (countdownEnabled && !countdownFinished && ntpSyncSuccessful && countdownTargetTimestamp > 0 && countdownTargetTimestamp > time(nullptr)) {
-      displayMode = 3;
-      Serial.println(F("[DISPLAY] Switching to display mode: COUNTDOWN (from Date, weather skipped)"));
-    } else if (nightscoutConfigured) {
-      displayMode = 4;
-      Serial.println(F("[DISPLAY] Switching to display mode: NIGHTSCOUT (from Date, weather & countdown skipped)"));
-    } else {
-      displayMode = 0;
-      Serial.println(F("[DISPLAY] Switching to display mode: CLOCK (from Date)"));
-    }
-  } else if (displayMode == 1) {  // Weather
-    if (showWeatherDescription && weatherAvailable && weatherDescription.length() > 0) {
-      displayMode = 2;
-      Serial.println(F("[DISPLAY] Switching to display mode: DESCRIPTION (from Weather)"));
-    } else if (countdownEnabled && !countdownFinished && ntpSyncSuccessful && countdownTargetTimestamp > 0 && countdownTargetTimestamp > time(nullptr)) {
-      displayMode = 3;
-      Serial.println(F("[DISPLAY] Switching to display mode: COUNTDOWN (from Weather)"));
-    } else if (nightscoutConfigured) {
-      displayMode = 4;  // Weather -> Nightscout (if description & countdown are skipped)
-      Serial.println(F("[DISPLAY] Switching to display mode: NIGHTSCOUT (from Weather, description & countdown skipped)"));
-    } else {
-      displayMode = 0;
-      Serial.println(F("[DISPLAY] Switching to display mode: CLOCK (from Weather)"));
-    }
-  } else if (displayMode == 2) {  // Weather Description
-    if (countdownEnabled && !countdownFinished && ntpSyncSuccessful && countdownTargetTimestamp > 0 && countdownTargetTimestamp > time(nullptr)) {
-      displayMode = 3;
-      Serial.println(F("[DISPLAY] Switching to display mode: COUNTDOWN (from Description)"));
-    } else if (nightscoutConfigured) {
-      displayMode = 4;  // Description -> Nightscout (if countdown is skipped)
-      Serial.println(F("[DISPLAY] Switching to display mode: NIGHTSCOUT (from Description, countdown skipped)"));
-    } else {
-      displayMode = 0;
-      Serial.println(F("[DISPLAY] Switching to display mode: CLOCK (from Description)"));
-    }
-  } else if (displayMode == 3) {  // Countdown -> Nightscout
-    if (nightscoutConfigured) {
-      displayMode = 4;
-      Serial.println(F("[DISPLAY] Switching to display mode: NIGHTSCOUT (from Countdown)"));
-    } else {
-      displayMode = 0;
-      Serial.println(F("[DISPLAY] Switching to display mode: CLOCK (from Countdown)"));
-    }
-  } else if (displayMode == 4) {  // Nightscout -> Custom Message
-    displayMode = 6;
-    Serial.println(F("[DISPLAY] Switching to display mode: CUSTOM MESSAGE (from Nightscout)"));
-  } else if (displayMode == 6) {  // Custom Message -> Clock
+  if (displayMode >= 0 && displayMode < DISPLAY_MODE_COUNT) {
+    displayMode = nextDisplayMode[displayMode];
+  } else {
     displayMode = 0;
-    Serial.println(F("[DISPLAY] Switching to display mode: CLOCK (from Custom Message)"));
   }
 
-  // --- Common cleanup/reset logic remains the same ---
-  if ((displayMode == 0) && strlen(customMessage) > 0 && oldMode != 6) {
-    displayMode = 6;
-    Serial.println(F("[DISPLAY] Custom Message display before returning to CLOCK"));
+  if (displayMode == prevDisplayMode) {
+    Serial.printf("[DISPLAY] Staying in %s\n", displayModes[displayMode].name);
+  } else {
+    Serial.printf("[DISPLAY] Switching to display mode: %s (from %s)\n",
+                  displayModes[displayMode].name,
+                  prevDisplayMode >= 0 ? displayModes[prevDisplayMode].name : "BOOT");
   }
   lastSwitch = millis();
 }
 
 
-void advanceDisplayModeSafe() {
-  int attempts = 0;
-  const int MAX_ATTEMPTS = 7;  // Number of possible modes + 1
-  int startMode = displayMode;
-  bool valid = false;
-  do {
-    advanceDisplayMode();  // One step advance
-    attempts++;
-    // Recalculate validity for the new mode
-    valid = false;
-    String ntpField = String(ntpServer2);
-    bool nightscoutConfigured = ntpField.startsWith("https://");
-
-    if (displayMode == 0) valid = true;  // Clock always valid
-    else if (displayMode == 5 && showDate) valid = true;
-    else if (displayMode == 1 && weatherAvailable && (strlen(openWeatherApiKey) == 32) && (strlen(openWeatherCity) > 0) && (strlen(openWeatherCountry) > 0)) valid = true;
-    else if (displayMode == 2 && showWeatherDescription && weatherAvailable && weatherDescription.length() > 0) valid = true;
-    else if (displayMode == 3 && countdownEnabled && !countdownFinished && ntpSyncSuccessful) valid = true;
-    else if (displayMode == 4 && nightscoutConfigured) valid = true;
-    else if (displayMode == 6 && strlen(customMessage) > 0) valid = true;
-
-    // If we've looped back to where we started, break to avoid infinite loop
-    if (displayMode == startMode) break;
-
-    if (valid) break;
-  } while (attempts < MAX_ATTEMPTS);
-
-  // If no valid mode found, fall back to Clock
-  if (!valid) {
-    displayMode = 0;
-    Serial.println(F("[DISPLAY] Safe fallback to CLOCK"));
+//config save after countdown finishes
+bool saveCountdownConfig(bool enabled, time_t targetTimestamp, const String &label) {
+  configSetBool(CFG_COUNTDOWN_ENABLED, enabled);
+  configSetTime(CFG_COUNTDOWN_TARGET, targetTimestamp);
+  configSetStr(CFG_COUNTDOWN_LABEL, label.c_str());
+  configSetBool(CFG_COUNTDOWN_DRAMATIC, isDramaticCountdown);
+
+  scheduleConfigSave();
+  Serial.println(F("[saveCountdownConfig] Config updated, save queued."));
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WiFi Scan Cache
+// -----------------------------------------------------------------------------
+// Copies a finished scan into the cache (strongest first) and frees the
+// driver's copy
+void cacheWifiScan(int found) {
+  wifiScanCount = 0;
+  for (int i = 0; i < found; i++) {
+    String ssidStr = WiFi.SSID(i);
+    if (ssidStr.length() == 0) continue;  // hidden network
+    int rssi = WiFi.RSSI(i);
+
+    // Insertion into the sorted array, dropping the weakest when full
+    int pos = wifiScanCount;
+    while (pos > 0 && wifiScanResults[pos - 1].rssi < rssi) pos--;
+    if (pos >= WIFI_SCAN_MAX) continue;
+    int last = wifiScanCount < WIFI_SCAN_MAX ? wifiScanCount : WIFI_SCAN_MAX - 1;
+    memmove(&wifiScanResults[pos + 1], &wifiScanResults[pos], (last - pos) * sizeof(ScanEntry));
+    strlcpy(wifiScanResults[pos].ssid, ssidStr.c_str(), sizeof(wifiScanResults[pos].ssid));
+    wifiScanResults[pos].rssi = (int8_t)rssi;
+    if (wifiScanCount < WIFI_SCAN_MAX) wifiScanCount++;
   }
-  lastSwitch = millis();
+  WiFi.scanDelete();
+  wifiScanAt = millis();
+  if (wifiScanAt == 0) wifiScanAt = 1;
+  Serial.printf("[WIFI] Scan cached: %d network(s) found, %u kept\n", found, wifiScanCount);
 }
 
 
-//config save after countdown finishes
-bool saveCountdownConfig(bool enabled, time_t targetTimestamp, const String &label) {
-  DynamicJsonDocument doc(2048);
+bool wifiScanFresh() {
+  return wifiScanAt != 0 && millis() - wifiScanAt < WIFI_SCAN_TTL;
+}
 
-  File configFile = LittleFS.open("/config.json", "r");
-  if (configFile) {
-    DeserializationError err = deserializeJson(doc, configFile);
-    configFile.close();
-    if (err) {
-      Serial.print(F("[saveCountdownConfig] Error parsing config.json: "));
-      Serial.println(err.f_str());
-      return false;
+
+// Stronger entries come first, so the first one with an SSID is the one kept
+bool scanSsidSeenBefore(uint8_t index) {
+  for (uint8_t j = 0; j < index; j++) {
+    if (strcmp(wifiScanResults[j].ssid, wifiScanResults[index].ssid) == 0) return true;
+  }
+  return false;
+}
+
+
+size_t formatScanEntry(char *buf, size_t size, const ScanEntry &e, bool first) {
+  size_t n = snprintf(buf, size, "%s{\"ssid\":\"", first ? "" : ",");
+  for (const char *p = e.ssid; *p && n + 8 < size; p++) {
+    uint8_t c = (uint8_t)*p;
+    if (c == '"' || c == '\\') {
+      buf[n++] = '\\';
+      buf[n++] = c;
+    } else if (c < 0x20) {
+      n += snprintf(buf + n, size - n, "\\u%04x", c);
+    } else {
+      buf[n++] = c;
+    }
+  }
+  n += snprintf(buf + n, size - n, "\",\"rssi\":%d}", e.rssi);
+  return n < size ? n : size - 1;
+}
+
+
+// Next piece of the response into s.line: "[", one entry per call, "]"
+size_t nextScanJsonPiece(ScanStream &s) {
+  if (!s.opened) {
+    s.opened = true;
+    s.line[0] = '[';
+    return 1;
+  }
+  if (s.next < s.count) {
+    uint8_t i = s.next++;
+    return formatScanEntry(s.line, sizeof(s.line), s.entries[i], i == 0);
+  }
+  s.done = true;
+  s.line[0] = ']';
+  return 1;
+}
+
+
+// AwsResponseFiller body: copies as much of the JSON as fits, 0 when done
+size_t fillScanJson(ScanStream &s, uint8_t *buf, size_t maxLen) {
+  size_t out = 0;
+  while (out < maxLen) {
+    if (s.lineOff == s.lineLen) {
+      if (s.done) break;
+      s.lineOff = 0;
+      s.lineLen = nextScanJsonPiece(s);
     }
+    size_t n = min(maxLen - out, s.lineLen - s.lineOff);
+    memcpy(buf + out, s.line + s.lineOff, n);
+    out += n;
+    s.lineOff += n;
   }
+  return out;
+}
 
-  JsonObject countdownObj = doc["countdown"].is<JsonObject>() ? doc["countdown"].as<JsonObject>() : doc.createNestedObject("countdown");
-  countdownObj["enabled"] = enabled;
-  countdownObj["targetTimestamp"] = targetTimestamp;
-  countdownObj["label"] = label;
-  countdownObj["isDramaticCountdown"] = isDramaticCountdown;
-  doc.remove("countdownEnabled");
-  doc.remove("countdownDate");
-  doc.remove("countdownTime");
-  doc.remove("countdownLabel");
 
-  if (LittleFS.exists("/config.json")) {
-    LittleFS.rename("/config.json", "/config.bak");
+// -----------------------------------------------------------------------------
+// Live Events (Server-Sent Events on /events)
+// -----------------------------------------------------------------------------
+// The web UI keeps one EventSource open instead of polling. Each event type
+// carries a small JSON object; a client gets all of them on connect and
+// after that only the ones that changed.
+const char *const LIVE_EVENT_TYPES[] = { "mode", "brightness", "ntp", "weather", "uptime" };
+
+const char *ntpStateName(int state) {
+  switch (state) {
+    case NTP_SYNCING: return "syncing";
+    case NTP_SUCCESS: return "synced";
+    case NTP_FAILED: return "failed";
+    default: return "idle";
   }
+}
 
-  File f = LittleFS.open("/config.json", "w");
-  if (!f) {
-    Serial.println(F("[saveCountdownConfig] ERROR: Cannot write to /config.json"));
-    return false;
+
+void buildLiveEvent(const char *type, char *buf, size_t size) {
+  if (strcmp(type, "mode") == 0) {
+    snprintf(buf, size, "{\"mode\":%d,\"name\":\"%s\"}", displayMode, displayModes[displayMode].name);
+  } else if (strcmp(type, "brightness") == 0) {
+    snprintf(buf, size, "{\"brightness\":%d,\"intensity\":%d,\"off\":%s}",
+             brightness, renderCache[0].intensity, displayOff ? "true" : "false");
+  } else if (strcmp(type, "ntp") == 0) {
+    snprintf(buf, size, "{\"state\":\"%s\"}", ntpStateName(ntpState));
+  } else if (strcmp(type, "weather") == 0) {
+    StaticJsonDocument<256> doc;  // the description is free text, let ArduinoJson escape it
+    doc[F("available")] = weatherAvailable;
+    doc[F("temp")] = currentTemp;
+    doc[F("humidity")] = currentHumidity;
+    doc[F("description")] = weatherDescription;
+    serializeJson(doc, buf, size);
+  } else {
+    snprintf(buf, size, "{\"uptime_seconds\":%lu,\"version\":\"" FIRMWARE_VERSION "\"}", getTotalRuntimeSeconds());
   }
+}
 
-  size_t bytesWritten = serializeJson(doc, f);
-  f.close();
 
-  Serial.printf("[saveCountdownConfig] Config updated. %u bytes written.\n", bytesWritten);
-  return true;
+void publishLiveEvent(const char *type) {
+  char buf[320];
+  buildLiveEvent(type, buf, sizeof(buf));
+  events.send(buf, type, millis());
 }
 
 
-void loop() {
-  if (isAPMode) {
-    dnsServer.processNextRequest();
-    // AP Mode animation
-    static unsigned long apAnimTimer = 0;
-    static int apAnimFrame = 0;
-    unsigned long now = millis();
-    if (now - apAnimTimer > 750) {
-      apAnimTimer = now;
-      apAnimFrame++;
+void setupEvents() {
+  events.onConnect([](AsyncEventSourceClient *client) {
+    if (events.count() > EVENTS_MAX_CLIENTS) {
+      Serial.println(F("[EVENTS] Too many listeners, closing new one"));
+      client->close();
+      return;
     }
-    P.setTextAlignment(PA_CENTER);
-    switch (apAnimFrame % 3) {
-      case 0: P.print(F("= ©")); break;
-      case 1: P.print(F("= ª")); break;
-      case 2: P.print(F("= «")); break;
+    char buf[320];
+    for (const char *type : LIVE_EVENT_TYPES) {
+      buildLiveEvent(type, buf, sizeof(buf));
+      client->send(buf, type, millis());
     }
-    yield();
-    return;
+  });
+  server.addHandler(&events);
+}
+
+
+// --- Push state changes to /events listeners ---
+void tickEvents() {
+  if (events.count() == 0) return;
+
+  if (displayMode != eventsSentMode) {
+    eventsSentMode = displayMode;
+    publishLiveEvent("mode");
+  }
+  if (brightness != eventsSentBrightness || displayOff != eventsSentDisplayOff) {
+    eventsSentBrightness = brightness;
+    eventsSentDisplayOff = displayOff;
+    publishLiveEvent("brightness");
+  }
+  if (ntpState != eventsSentNtpState) {
+    eventsSentNtpState = ntpState;
+    publishLiveEvent("ntp");
+  }
+  if (weatherSeqApplied != eventsSentWeatherSeq) {
+    eventsSentWeatherSeq = weatherSeqApplied;
+    publishLiveEvent("weather");
+  }
+  if (millis() - eventsUptimeSentAt >= EVENTS_UPTIME_INTERVAL) {
+    eventsUptimeSentAt = millis();
+    publishLiveEvent("uptime");
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Metrics (Prometheus text format on /metrics)
+// -----------------------------------------------------------------------------
+// Everything here is read from counters the hot paths already keep; a scrape
+// only formats them into metricsBuffer.
+void metricsAppend(MetricsWriter &w, const char *fmt, ...) {
+  if (w.len >= METRICS_BUFFER_SIZE) return;
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(metricsBuffer + w.len, METRICS_BUFFER_SIZE - w.len, fmt, args);
+  va_end(args);
+  w.len = (n < 0) ? METRICS_BUFFER_SIZE : w.len + n;
+}
+
+
+void metricsBeginFamily(MetricsWriter &w, const char *name, const char *type) {
+  w.familyStart = w.len;
+  metricsAppend(w, "# TYPE %s %s\n", name, type);
+}
+
+
+// A family goes out whole or not at all: if any of its samples did not fit,
+// the buffer is cut back to before its # TYPE line
+void metricsEndFamily(MetricsWriter &w) {
+  if (w.len < METRICS_BUFFER_SIZE) return;
+  w.len = w.familyStart;
+  metricsBuffer[w.len] = '\0';
+  w.dropped++;
+}
+
+
+void metricsSingle(MetricsWriter &w, const char *name, const char *type, unsigned long value) {
+  metricsBeginFamily(w, name, type);
+  metricsAppend(w, "%s %lu\n", name, value);
+  metricsEndFamily(w);
+}
+
+
+// Returns the length of the text in metricsBuffer
+size_t renderMetrics() {
+  MetricsWriter w = { 0, 0, 0 };
+  unsigned long now = millis();
+  const char *const fetchSources[] = { "weather", "nightscout" };
+  const FetchStats *const fetchStats[] = { &weatherFetchStats, &nightscoutFetchStats };
+#if defined(ESP32) && !defined(CONFIG_IDF_TARGET_ESP32S2)
+  const TlsConnection *const tlsConns[] = { &weatherTls, &nightscoutTls };
+#else
+  const TlsConnection *const tlsConns[] = { &nightscoutTls };
+#endif
+  const size_t tlsConnCount = sizeof(tlsConns) / sizeof(tlsConns[0]);
+
+  metricsBeginFamily(w, "esptimecast_build_info", "gauge");
+  metricsAppend(w, "esptimecast_build_info{version=\"" FIRMWARE_VERSION "\"} 1\n");
+  metricsEndFamily(w);
+  metricsSingle(w, "esptimecast_uptime_seconds", "counter", now / 1000);
+
+  metricsSingle(w, "esptimecast_heap_free_bytes", "gauge", ESP.getFreeHeap());
+#if defined(ESP32)
+  metricsSingle(w, "esptimecast_heap_largest_free_block_bytes", "gauge", ESP.getMaxAllocHeap());
+#else
+  metricsSingle(w, "esptimecast_heap_largest_free_block_bytes", "gauge", ESP.getMaxFreeBlockSize());
+#endif
+
+  metricsSingle(w, "esptimecast_loop_iterations_total", "counter", loopSectionStats[SECTION_LOOP_PASS].count);
+  metricsBeginFamily(w, "esptimecast_loop_max_latency_us", "gauge");
+  for (int s = 0; s < LOOP_SECTION_COUNT; s++) {
+    metricsAppend(w, "esptimecast_loop_max_latency_us{section=\"%s\"} %lu\n",
+                  LOOP_SECTION_NAMES[s], (unsigned long)loopSectionStats[s].maxUs);
   }
+  metricsEndFamily(w);
 
-  static bool colonVisible = true;
-  const unsigned long colonBlinkInterval = 800;
-  if (millis() - lastColonBlink > colonBlinkInterval) {
-    colonVisible = !colonVisible;
-    lastColonBlink = millis();
+  metricsBeginFamily(w, "esptimecast_fetch_total", "counter");
+  for (int i = 0; i < 2; i++) {
+    metricsAppend(w, "esptimecast_fetch_total{source=\"%s\"} %lu\n", fetchSources[i], (unsigned long)fetchStats[i]->count);
   }
+  metricsEndFamily(w);
+  metricsBeginFamily(w, "esptimecast_fetch_failures_total", "counter");
+  for (int i = 0; i < 2; i++) {
+    metricsAppend(w, "esptimecast_fetch_failures_total{source=\"%s\"} %lu\n", fetchSources[i], (unsigned long)fetchStats[i]->failures);
+  }
+  metricsEndFamily(w);
+  metricsBeginFamily(w, "esptimecast_fetch_last_duration_ms", "gauge");
+  for (int i = 0; i < 2; i++) {
+    metricsAppend(w, "esptimecast_fetch_last_duration_ms{source=\"%s\"} %lu\n", fetchSources[i], fetchStats[i]->lastMs);
+  }
+  metricsEndFamily(w);
 
-  static unsigned long ntpAnimTimer = 0;
-  static int ntpAnimFrame = 0;
-  static bool tzSetAfterSync = false;
+  metricsBeginFamily(w, "esptimecast_tls_handshakes_total", "counter");
+  for (size_t i = 0; i < tlsConnCount; i++) {
+    metricsAppend(w, "esptimecast_tls_handshakes_total{conn=\"%s\"} %lu\n", tlsConns[i]->label, (unsigned long)tlsConns[i]->handshakes);
+  }
+  metricsEndFamily(w);
+  metricsBeginFamily(w, "esptimecast_tls_last_handshake_ms", "gauge");
+  for (size_t i = 0; i < tlsConnCount; i++) {
+    metricsAppend(w, "esptimecast_tls_last_handshake_ms{conn=\"%s\"} %lu\n", tlsConns[i]->label, tlsConns[i]->lastHandshakeMs);
+  }
+  metricsEndFamily(w);
 
-  static unsigned long lastFetch = 0;
-  const unsigned long fetchInterval = 300000;  // 5 minutes
+  metricsBeginFamily(w, "esptimecast_ntp_state", "gauge");
+  for (int st = NTP_IDLE; st <= NTP_FAILED; st++) {
+    metricsAppend(w, "esptimecast_ntp_state{state=\"%s\"} %d\n", ntpStateName(st), st == ntpState ? 1 : 0);
+  }
+  metricsEndFamily(w);
+  unsigned long lastSync = ntpLastSyncAt;
+  if (lastSync != 0) {
+    metricsSingle(w, "esptimecast_ntp_last_sync_age_seconds", "gauge", (now - lastSync) / 1000);
+  }
 
+  if (WiFi.status() == WL_CONNECTED) {
+    metricsBeginFamily(w, "esptimecast_wifi_rssi_dbm", "gauge");
+    metricsAppend(w, "esptimecast_wifi_rssi_dbm %d\n", (int)WiFi.RSSI());
+    metricsEndFamily(w);
+  }
+  metricsSingle(w, "esptimecast_wifi_disconnects_total", "counter", wifiDisconnects);
+
+  metricsSingle(w, "esptimecast_fs_bytes_written_total", "counter", fsBytesWritten);
+  metricsSingle(w, "esptimecast_config_writes_total", "counter", configWrites);
+  metricsBeginFamily(w, "esptimecast_http_rejected_total", "counter");
+  metricsAppend(w, "esptimecast_http_rejected_total{reason=\"rate\"} %lu\n", requestsRejectedRate);
+  metricsAppend(w, "esptimecast_http_rejected_total{reason=\"busy\"} %lu\n", requestsRejectedBusy);
+  metricsEndFamily(w);
+
+  metricsBeginFamily(w, "esptimecast_display_mode_seconds_total", "counter");
+  for (int m = 0; m < DISPLAY_MODE_COUNT; m++) {
+    metricsAppend(w, "esptimecast_display_mode_seconds_total{mode=\"%s\"} %lu.%03lu\n",
+                  displayModes[m].key, modeDwellMs[m] / 1000, modeDwellMs[m] % 1000);
+  }
+  metricsEndFamily(w);
 
-  // -----------------------------
-  // Dimming (auto + manual)
-  // -----------------------------
+  if (w.dropped > 0) {
+    Serial.printf("[METRICS] metricsBuffer full, %u metric families left out\n", w.dropped);
+  }
+  return w.len;
+}
+
+
+// -----------------------------------------------------------------------------
+// Loop Tasks
+// -----------------------------------------------------------------------------
+// Every job that used to run inline in loop() is a task. A tick must return
+// quickly: nothing here may delay() or spin on P.displayAnimate(). Work that
+// spans several frames keeps its own state and continues on the next tick.
+
+// --- Dimming (auto + manual), brightness and display on/off ---
+void tickDimming() {
   time_t now_time = time(nullptr);
   struct tm timeinfo;
   localtime_r(&now_time, &timeinfo);
@@ -2915,20 +5200,20 @@ void loop() {
   if (targetBrightness == -1) {
     if (!displayOff) {
       Serial.println(F("[DISPLAY] Turning display OFF (dimming -1)"));
-      P.displayShutdown(true);
-      P.displayClear();
+      renderShutdown(true);
+      renderClear();
       displayOff = true;
       displayOffByDimming = dimActive;
       displayOffByBrightness = !dimActive;
     }
   } else {
     if (displayOff && ((dimActive && displayOffByBrightness) || (!dimActive && displayOffByDimming))) {
-      P.displayShutdown(false);
+      renderShutdown(false);
       displayOff = false;
       displayOffByDimming = false;
       displayOffByBrightness = false;
     }
-    P.setIntensity(targetBrightness);
+    renderSetIntensity(targetBrightness);
   }
 
   // Enforce "Clock only during dimming" if enabled
@@ -2941,52 +5226,39 @@ void loop() {
     }
   }
 
-  // --- IMMEDIATE COUNTDOWN FINISH TRIGGER ---
+  // --- BRIGHTNESS/OFF CHECK ---
+  if (brightness == -1) {
+    if (!displayOff) {
+      Serial.println(F("[DISPLAY] Turning display OFF"));
+      renderShutdown(true);  // fully off
+      renderClear();
+      displayOff = true;
+    }
+  }
+}
+
+
+// --- IMMEDIATE COUNTDOWN FINISH TRIGGER ---
+void tickCountdownTrigger() {
+  time_t now_time = time(nullptr);
   if (countdownEnabled && !countdownFinished && ntpSyncSuccessful && countdownTargetTimestamp > 0 && now_time >= countdownTargetTimestamp) {
     countdownFinished = true;
     displayMode = 3;  // Let main loop handle animation + TIMES UP
     countdownShowFinishedMessage = true;
     hourglassPlayed = false;
+    hourglassFrame = 0;
     countdownFinishedMessageStartTime = millis();
+    markDisplayModesDirty();
 
     Serial.println("[SYSTEM] Countdown target reached! Switching to Mode 3 to display finish sequence.");
-    yield();
-  }
-
-
-  // --- IP Display ---
-  if (showingIp) {
-    if (P.displayAnimate()) {
-      ipDisplayCount++;
-      if (ipDisplayCount < ipDisplayMax) {
-        textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
-        P.displayScroll(pendingIpToShow.c_str(), PA_CENTER, actualScrollDirection, 120);
-      } else {
-        showingIp = false;
-        P.displayClear();
-        delay(500);  // Blocking delay as in working copy
-        displayMode = 0;
-        lastSwitch = millis();
-      }
-    }
-    yield();
-    return;  // Exit loop early if showing IP
   }
+}
 
 
-  // --- BRIGHTNESS/OFF CHECK ---
-  if (brightness == -1) {
-    if (!displayOff) {
-      Serial.println(F("[DISPLAY] Turning display OFF"));
-      P.displayShutdown(true);  // fully off
-      P.displayClear();
-      displayOff = true;
-    }
-    yield();
-  }
-
+// --- NTP State Machine ---
+void tickNtp() {
+  static bool tzSetAfterSync = false;
 
-  // --- NTP State Machine ---
   switch (ntpState) {
     case NTP_IDLE: break;
     case NTP_SYNCING:
@@ -2996,10 +5268,12 @@ void loop() {
           Serial.println(F("[TIME] NTP sync successful."));
           ntpSyncSuccessful = true;
           ntpState = NTP_SUCCESS;
+          markDisplayModesDirty();
         } else if (millis() - ntpStartTime > ntpTimeout || ntpRetryCount >= maxNtpRetries) {
           Serial.println(F("[TIME] NTP sync failed."));
           ntpSyncSuccessful = false;
           ntpState = NTP_FAILED;
+          markDisplayModesDirty();
         } else {
           // Periodically print a more descriptive status message
           if (millis() - lastNtpStatusPrintTime >= ntpStatusPrintInterval) {
@@ -3049,18 +5323,26 @@ void loop() {
       }
       break;
   }
+}
 
 
-  // Only advance mode by timer for clock/weather, not description!
-  unsigned long displayDuration = (displayMode == 0) ? clockDuration : weatherDuration;
-  if ((displayMode == 0 || displayMode == 1) && millis() - lastSwitch > displayDuration) {
-    advanceDisplayMode();
-  }
+// --- Weather fetching ---
+void tickWeather() {
+  static unsigned long lastFetch = 0;
+  const unsigned long fetchInterval = 300000;  // 5 minutes
 
+  serviceWeatherFetch();
+  applyWeatherSnapshot();
+
+  // Leave the network alone while the IP address is scrolling after connect
+  if (showingIp) return;
 
-  // --- MODIFIED WEATHER FETCHING LOGIC ---
   if (WiFi.status() == WL_CONNECTED) {
     if (!weatherFetchInitiated || shouldFetchWeatherNow || (millis() - lastFetch > fetchInterval)) {
+      // Wait for a running fetch to finish: it may have used the settings a
+      // refetch was asked for, so the request must survive until then
+      if (weatherFetchRunning()) return;
+
       if (shouldFetchWeatherNow) {
         Serial.println(F("[LOOP] Immediate weather fetch requested by web server."));
         shouldFetchWeatherNow = false;
@@ -3071,914 +5353,905 @@ void loop() {
       }
       weatherFetchInitiated = true;
       weatherFetched = false;
-      fetchWeather();
+      startWeatherFetch();
+      markDisplayModesDirty();  // a skipped fetch may have cleared weatherAvailable
       lastFetch = millis();
     }
   } else {
     weatherFetchInitiated = false;
     shouldFetchWeatherNow = false;
   }
+}
 
-  const char *const *daysOfTheWeek = getDaysOfWeek(language);
-  const char *daySymbol = daysOfTheWeek[timeinfo.tm_wday];
 
+// --- Runtime uptime accounting ---
+void tickUptime() {
+  unsigned long currentMillis = millis();
+  unsigned long runtimeSeconds = (currentMillis - bootMillis) / 1000;
+  unsigned long currentTotal = totalUptimeSeconds + runtimeSeconds;
 
-  // build base HH:MM first ---
-  char baseTime[9];
-  if (twelveHourToggle) {
-    int hour12 = timeinfo.tm_hour % 12;
-    if (hour12 == 0) hour12 = 12;
-    sprintf(baseTime, "%d:%02d", hour12, timeinfo.tm_min);
-  } else {
-    sprintf(baseTime, "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+  // --- Log and save uptime every 10 minutes ---
+  if (currentMillis - lastUptimeLog >= uptimeLogInterval) {
+    lastUptimeLog = currentMillis;
+    Serial.printf("[UPTIME] Runtime: %s (total %.2f hours)\n",
+                  formatUptime(currentTotal).c_str(), currentTotal / 3600.0);
+    unsigned long saveStart = micros();
+    saveUptime();  // Save accumulated uptime every 10 minutes
+    recordLoopSection(SECTION_UPTIME_SAVE, micros() - saveStart);
   }
+}
 
-  // add seconds only if colon blink enabled AND weekday hidden ---
-  char timeWithSeconds[12];
-  if (!showDayOfWeek && colonBlinkEnabled) {
-    // Remove any leading space from baseTime
-    const char *trimmedBase = baseTime;
-    if (baseTime[0] == ' ') trimmedBase++;  // skip leading space
-    sprintf(timeWithSeconds, "%s:%02d", trimmedBase, timeinfo.tm_sec);
-  } else {
-    strcpy(timeWithSeconds, baseTime);  // no seconds
-  }
 
-  // keep spacing logic the same ---
-  char timeSpacedStr[24];
-  int j = 0;
-  for (int i = 0; timeWithSeconds[i] != '\0'; i++) {
-    timeSpacedStr[j++] = timeWithSeconds[i];
-    if (timeWithSeconds[i + 1] != '\0') {
-      timeSpacedStr[j++] = ' ';
-    }
+// --- Settings changed by /save ---
+void tickConfigApply() {
+  uint64_t changed = 0;
+  CONFIG_LOCK();
+  bool flushNow = configQueuedFlush;
+  bool snapshotNow = configQueuedSnapshot;
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    if (!(configQueuedFields & CFG_BIT(i))) continue;
+    uint8_t *dst = (uint8_t *)&config + configFields[i].offset;
+    const uint8_t *src = (const uint8_t *)&configQueued + configFields[i].offset;
+    if (memcmp(dst, src, configFields[i].size) == 0) continue;
+    memcpy(dst, src, configFields[i].size);
+    changed |= CFG_BIT(i);
   }
-  timeSpacedStr[j] = '\0';
-
-  // build final string ---
-  String formattedTime;
-  if (showDayOfWeek) {
-    formattedTime = String(daySymbol) + "   " + String(timeSpacedStr);
-  } else {
-    formattedTime = String(timeSpacedStr);
+  configQueuedFields = 0;
+  configQueuedFlush = false;
+  configQueuedSnapshot = false;
+  CONFIG_UNLOCK();
+
+  if (changed) {
+    configDirty |= changed;
+    configRevision++;
+    applyConfigChanges(changed);
   }
-
-  unsigned long currentDisplayDuration = 0;
-  if (displayMode == 0) {
-    currentDisplayDuration = clockDuration;
-  } else if (displayMode == 1) {  // Weather
-    currentDisplayDuration = weatherDuration;
+  if (snapshotNow) {
+    if (!saveConfig()) flushConfig();  // the journal still gets the changes
+  } else if (flushNow) {
+    flushConfig();
+  } else if (changed) {
+    scheduleConfigSave();
   }
 
-  // Only advance mode by timer for clock/weather static (Mode 0 & 1).
-  // Other modes (2, 3) have their own internal timers/conditions for advancement.
-  if ((displayMode == 0 || displayMode == 1) && (millis() - lastSwitch > currentDisplayDuration)) {
-    advanceDisplayMode();
+  refreshConfigView(configView, false);
+  refreshConfigView(exportView, true);
+
+  if (configRestartRequested) {
+    Serial.println(F("[CONFIG] Restarting to apply saved settings..."));
+    flushConfig();
+    saveUptime();
+    delay(100);  // ensure file is written
+    ESP.restart();
   }
+}
 
 
-  // --- CLOCK Display Mode ---
-  if (displayMode == 0) {
-    P.setCharSpacing(0);
+// --- Deferred config writes (see scheduleConfigSave) ---
+void tickConfigFlush() {
+  if (!configFlushPending) return;
+  if (millis() - configFlushRequestedAt < CONFIG_FLUSH_DELAY) return;
+  flushConfig();
+}
 
-    // --- NTP SYNC ---
-    if (ntpState == NTP_SYNCING) {
-      if (ntpSyncSuccessful || ntpRetryCount >= maxNtpRetries || millis() - ntpStartTime > ntpTimeout) {
-        ntpState = NTP_FAILED;
-      } else if (millis() - ntpAnimTimer > 750) {
-        ntpAnimTimer = millis();
-        switch (ntpAnimFrame % 3) {
-          case 0: P.print(F("S Y N C ®")); break;
-          case 1: P.print(F("S Y N C ¯")); break;
-          case 2: P.print(F("S Y N C º")); break;
-        }
-        ntpAnimFrame++;
-      }
+
+// -----------------------------------------------------------------------------
+// Display Modes
+// -----------------------------------------------------------------------------
+// Clears the per-mode progress flags so a mode always starts from its first
+// frame, even when a web request switched modes in the middle of an animation.
+void resetDisplayModeState() {
+  clockScrolling = false;
+  descScrolling = false;
+  descScrollEndTime = 0;
+  descStartTime = 0;
+  countdownScrolling = false;
+  countdownLabelPhase = CD_LABEL_IDLE;
+  nightscoutShown = false;
+  messageShowing = false;
+  messageScrolling = false;
+}
+
+
+// --- IP address scroll after connecting ---
+void renderIpAddress() {
+  // Scroll finished: keep the display blank for a moment before the clock
+  if (ipClearStartTime != 0) {
+    if (millis() - ipClearStartTime >= 500) {
+      ipClearStartTime = 0;
+      showingIp = false;
+      displayMode = 0;
+      lastSwitch = millis();
+    }
+    return;
+  }
+
+  if (P.displayAnimate()) {
+    ipDisplayCount++;
+    if (ipDisplayCount < ipDisplayMax) {
+      textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
+      P.displayScroll(pendingIpToShow.c_str(), PA_CENTER, actualScrollDirection, 120);
+      invalidateRenderCache();
+    } else {
+      renderClear();
+      ipClearStartTime = millis();
     }
-    // --- NTP / WEATHER ERROR ---
-    else if (!ntpSyncSuccessful) {
-      P.setTextAlignment(PA_CENTER);
-      static unsigned long errorAltTimer = 0;
-      static bool showNtpError = true;
+  }
+}
 
-      if (!ntpSyncSuccessful && !weatherAvailable) {
-        if (millis() - errorAltTimer > 2000) {
-          errorAltTimer = millis();
-          showNtpError = !showNtpError;
-        }
-        P.print(showNtpError ? F("(<") : F("(*"));
-      } else if (!ntpSyncSuccessful) {
-        P.print(F("(<"));
-      } else if (!weatherAvailable) {
-        P.print(F("(*"));
+
+// --- CLOCK Display Mode ---
+void renderClockMode(const String &formattedTime) {
+  renderSetCharSpacing(0);
+
+  // --- NTP SYNC ---
+  if (ntpState == NTP_SYNCING) {
+    if (ntpSyncSuccessful || ntpRetryCount >= maxNtpRetries || millis() - ntpStartTime > ntpTimeout) {
+      ntpState = NTP_FAILED;
+    } else if (millis() - ntpAnimTimer > 750) {
+      ntpAnimTimer = millis();
+      switch (ntpAnimFrame % 3) {
+        case 0: renderPrint(F("S Y N C ®")); break;
+        case 1: renderPrint(F("S Y N C ¯")); break;
+        case 2: renderPrint(F("S Y N C º")); break;
       }
+      ntpAnimFrame++;
     }
-    // --- DISPLAY CLOCK ---
-    else {
-      String timeString = formattedTime;
-      if (showDayOfWeek && colonBlinkEnabled && !colonVisible) {
-        timeString.replace(":", " ");
+  }
+  // --- NTP / WEATHER ERROR ---
+  else if (!ntpSyncSuccessful) {
+    renderSetTextAlignment(PA_CENTER);
+    static unsigned long errorAltTimer = 0;
+    static bool showNtpError = true;
+
+    if (!ntpSyncSuccessful && !weatherAvailable) {
+      if (millis() - errorAltTimer > 2000) {
+        errorAltTimer = millis();
+        showNtpError = !showNtpError;
       }
+      renderPrint(showNtpError ? F("(<") : F("(*"));
+    } else if (!ntpSyncSuccessful) {
+      renderPrint(F("(<"));
+    } else if (!weatherAvailable) {
+      renderPrint(F("(*"));
+    }
+  }
+  // --- DISPLAY CLOCK ---
+  else {
+    String timeString = formattedTime;
+    if (showDayOfWeek && colonBlinkEnabled && !colonVisible) {
+      timeString.replace(":", " ");
+    }
 
-      // --- SCROLL IN ONLY WHEN COMING FROM SPECIFIC MODES OR FIRST BOOT ---
-      bool shouldScrollIn = false;
-      if (prevDisplayMode == -1 || prevDisplayMode == 3 || prevDisplayMode == 4) {
-        shouldScrollIn = true;  // first boot or other special modes
-      } else if (prevDisplayMode == 2 && weatherDescription.length() > 8) {
-        shouldScrollIn = true;  // only scroll in if weather was scrolling
-      } else if (prevDisplayMode == 6) {
-        shouldScrollIn = true;  // scroll in when coming from custom message
-      }
+    // --- SCROLL IN ONLY WHEN COMING FROM SPECIFIC MODES OR FIRST BOOT ---
+    bool shouldScrollIn = false;
+    if (prevDisplayMode == -1 || prevDisplayMode == 3 || prevDisplayMode == 4) {
+      shouldScrollIn = true;  // first boot or other special modes
+    } else if (prevDisplayMode == 2 && weatherDescription.length() > 8) {
+      shouldScrollIn = true;  // only scroll in if weather was scrolling
+    } else if (prevDisplayMode == 6) {
+      shouldScrollIn = true;  // scroll in when coming from custom message
+    }
 
-      if (shouldScrollIn && !clockScrollDone) {
+    if (shouldScrollIn && !clockScrollDone) {
+      if (!clockScrolling) {
         textEffect_t inDir = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
-
+        strlcpy(clockScrollBuffer, timeString.c_str(), sizeof(clockScrollBuffer));
         P.displayText(
-          timeString.c_str(),
+          clockScrollBuffer,
           PA_CENTER,
           GENERAL_SCROLL_SPEED,
           0,
           inDir,
           PA_NO_EFFECT);
-        while (!P.displayAnimate()) yield();
+        invalidateRenderCache();
+        clockScrolling = true;
+      }
+      if (P.displayAnimate()) {
+        clockScrolling = false;
         clockScrollDone = true;  // mark scroll done
-      } else {
-        P.setTextAlignment(PA_CENTER);
-        P.print(timeString);
       }
-    }
-
-    yield();
-  } else {
-    // --- leaving clock mode ---
-    if (prevDisplayMode == 0) {
-      clockScrollDone = false;  // reset for next time we enter clock
+    } else {
+      renderSetTextAlignment(PA_CENTER);
+      renderPrint(timeString);
     }
   }
+}
 
 
-  // --- WEATHER Display Mode ---
+// --- WEATHER Display Mode ---
+void renderWeatherMode(const String &formattedTime) {
   static bool weatherWasAvailable = false;
-  if (displayMode == 1) {
-    P.setCharSpacing(1);
-    if (weatherAvailable) {
-      String weatherDisplay;
-      if (showHumidity && currentHumidity != -1) {
-        int cappedHumidity = (currentHumidity > 99) ? 99 : currentHumidity;
-        weatherDisplay = currentTemp + " " + String(cappedHumidity) + "%";
-      } else {
-        weatherDisplay = currentTemp + tempSymbol;
-      }
-      P.print(weatherDisplay.c_str());
-      weatherWasAvailable = true;
+  renderSetCharSpacing(1);
+  if (weatherAvailable) {
+    String weatherDisplay;
+    if (showHumidity && currentHumidity != -1) {
+      int cappedHumidity = (currentHumidity > 99) ? 99 : currentHumidity;
+      weatherDisplay = currentTemp + " " + String(cappedHumidity) + "%";
     } else {
-      if (weatherWasAvailable) {
-        Serial.println(F("[DISPLAY] Weather not available, showing clock..."));
-        weatherWasAvailable = false;
-      }
-      if (ntpSyncSuccessful) {
-        String timeString = formattedTime;
-        if (!colonVisible) timeString.replace(":", " ");
-        P.setCharSpacing(0);
-        P.print(timeString);
-      } else {
-        P.setCharSpacing(0);
-        P.setTextAlignment(PA_CENTER);
-        P.print(F("(*"));
-      }
+      weatherDisplay = currentTemp + tempSymbol;
+    }
+    renderPrint(weatherDisplay.c_str());
+    weatherWasAvailable = true;
+  } else {
+    if (weatherWasAvailable) {
+      Serial.println(F("[DISPLAY] Weather not available, showing clock..."));
+      weatherWasAvailable = false;
+    }
+    if (ntpSyncSuccessful) {
+      String timeString = formattedTime;
+      if (!colonVisible) timeString.replace(":", " ");
+      renderSetCharSpacing(0);
+      renderPrint(timeString);
+    } else {
+      renderSetCharSpacing(0);
+      renderSetTextAlignment(PA_CENTER);
+      renderPrint(F("(*"));
     }
-    yield();
-    return;
   }
+}
 
 
-  // --- WEATHER DESCRIPTION Display Mode ---
-  if (displayMode == 2 && showWeatherDescription && weatherAvailable && weatherDescription.length() > 0) {
-    String desc = weatherDescription;
+// --- WEATHER DESCRIPTION Display Mode ---
+void renderDescriptionMode() {
+  String desc = weatherDescription;
 
-    // --- Check if humidity is actually visible ---
-    bool humidityVisible = showHumidity && weatherAvailable && strlen(openWeatherApiKey) == 32 && strlen(openWeatherCity) > 0 && strlen(openWeatherCountry) > 0;
+  // --- Check if humidity is actually visible ---
+  bool humidityVisible = showHumidity && weatherAvailable && strlen(openWeatherApiKey) == 32 && strlen(openWeatherCity) > 0 && strlen(openWeatherCountry) > 0;
 
-    // --- Conditional padding ---
-    bool addPadding = false;
-    if (prevDisplayMode == 1 && humidityVisible) {
-      addPadding = true;
-    }
-    if (addPadding) {
-      desc = "    " + desc;  // 4-space padding before scrolling
-    }
+  // --- Conditional padding ---
+  bool addPadding = false;
+  if (prevDisplayMode == 1 && humidityVisible) {
+    addPadding = true;
+  }
+  if (addPadding) {
+    desc = "    " + desc;  // 4-space padding before scrolling
+  }
 
-    // prepare safe buffer
-    static char descBuffer[128];  // large enough for OWM translations
-    desc.toCharArray(descBuffer, sizeof(descBuffer));
+  // prepare safe buffer
+  static char descBuffer[128];  // large enough for OWM translations
 
-    if (desc.length() > 8) {
-      if (!descScrolling) {
-        textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
-        P.displayScroll(descBuffer, PA_CENTER, actualScrollDirection, GENERAL_SCROLL_SPEED);
-        descScrolling = true;
-        descScrollEndTime = 0;  // reset end time at start
-      }
-      if (P.displayAnimate()) {
-        if (descScrollEndTime == 0) {
-          descScrollEndTime = millis();  // mark the time when scroll finishes
-        }
-        // wait small pause after scroll stops
-        if (millis() - descScrollEndTime > descriptionScrollPause) {
-          descScrolling = false;
-          descScrollEndTime = 0;
-          advanceDisplayMode();
-        }
-      } else {
-        descScrollEndTime = 0;  // reset if not finished
-      }
-      yield();
-      return;
-    } else {
-      if (descStartTime == 0) {
-        P.setTextAlignment(PA_CENTER);
-        P.setCharSpacing(1);
-        P.print(descBuffer);
-        descStartTime = millis();
+  if (desc.length() > 8) {
+    if (!descScrolling) {
+      desc.toCharArray(descBuffer, sizeof(descBuffer));
+      textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
+      P.displayScroll(descBuffer, PA_CENTER, actualScrollDirection, GENERAL_SCROLL_SPEED);
+      invalidateRenderCache();
+      descScrolling = true;
+      descScrollEndTime = 0;  // reset end time at start
+    }
+    if (P.displayAnimate()) {
+      if (descScrollEndTime == 0) {
+        descScrollEndTime = millis();  // mark the time when scroll finishes
       }
-      if (millis() - descStartTime > descriptionDuration) {
-        descStartTime = 0;
+      // wait small pause after scroll stops
+      if (millis() - descScrollEndTime > descriptionScrollPause) {
+        descScrolling = false;
+        descScrollEndTime = 0;
         advanceDisplayMode();
       }
-      yield();
-      return;
+    } else {
+      descScrollEndTime = 0;  // reset if not finished
+    }
+  } else {
+    if (descStartTime == 0) {
+      desc.toCharArray(descBuffer, sizeof(descBuffer));
+      renderSetTextAlignment(PA_CENTER);
+      renderSetCharSpacing(1);
+      renderPrint(descBuffer);
+      descStartTime = millis();
+    }
+    if (millis() - descStartTime > descriptionDuration) {
+      descStartTime = 0;
+      advanceDisplayMode();
+    }
+  }
+}
+
+
+// Builds the "TO: ..." label scrolled after the dramatic countdown segments
+String buildCountdownLabel() {
+  String label;
+  if (strlen(countdownLabel) > 0) {
+    label = String(countdownLabel);
+    label.trim();
+    if (!label.startsWith("TO:") && !label.startsWith("to:")) {
+      label = "TO: " + label;
     }
+    label.replace('.', ',');
+  } else {
+    static const char *fallbackLabels[] = {
+      "TO: PARTY TIME!", "TO: SHOWTIME!", "TO: CLOCKOUT!", "TO: BLASTOFF!",
+      "TO: GO TIME!", "TO: LIFTOFF!", "TO: THE BIG REVEAL!",
+      "TO: ZERO HOUR!", "TO: THE FINAL COUNT!", "TO: MISSION COMPLETE"
+    };
+    int randomIndex = random(0, 10);
+    label = fallbackLabels[randomIndex];
   }
+  return label;
+}
 
 
-  // --- Countdown Display Mode ---
-  if (displayMode == 3 && countdownEnabled && ntpSyncSuccessful) {
-    static int countdownSegment = 0;
-    static unsigned long segmentStartTime = 0;
-    const unsigned long SEGMENT_DISPLAY_DURATION = 1500;  // 1.5 seconds for each static segment
+// Prints the "NN SECS" frame of the dramatic countdown
+void printCountdownSeconds() {
+  long currentSecond = (countdownTargetTimestamp - time(nullptr)) % 60;
+  char secondsBuf[10];
+  sprintf(secondsBuf, "%02ld %s", currentSecond, currentSecond == 1 ? "SEC" : "SECS");
+  Serial.printf("[COUNTDOWN-STATIC] Displaying segment 3: %s\n", secondsBuf);
+  renderClear();
+  renderSetTextAlignment(PA_CENTER);
+  renderSetCharSpacing(1);
+  renderPrint(secondsBuf);
+}
 
-    long timeRemaining = countdownTargetTimestamp - now_time;
 
-    // --- Countdown Finished Logic ---
-    // This part of the code remains unchanged.
-    if (timeRemaining <= 0 || countdownShowFinishedMessage) {
-      // NEW: Only show "TIMES UP" if countdown target timestamp is valid and expired
-      time_t now = time(nullptr);
-      if (countdownTargetTimestamp == 0 || countdownTargetTimestamp > now) {
-        // Target invalid or in the future, don't show "TIMES UP" yet, advance display instead
-        countdownShowFinishedMessage = false;
-        countdownFinished = false;
-        countdownFinishedMessageStartTime = 0;
-        hourglassPlayed = false;  // Reset if we decide not to show it
-        Serial.println("[COUNTDOWN-FINISH] Countdown target invalid or not reached yet, skipping 'TIMES UP'. Advancing display.");
-        advanceDisplayMode();
-        yield();
-        return;
-      }
+// --- Countdown Display Mode ---
+void renderCountdownMode(time_t now_time) {
+  static int countdownSegment = 0;
+  static unsigned long segmentStartTime = 0;
+  const unsigned long SEGMENT_DISPLAY_DURATION = 1500;  // 1.5 seconds for each static segment
+
+  long timeRemaining = countdownTargetTimestamp - now_time;
+
+  // --- Countdown Finished Logic ---
+  if (timeRemaining <= 0 || countdownShowFinishedMessage) {
+    // NEW: Only show "TIMES UP" if countdown target timestamp is valid and expired
+    time_t now = time(nullptr);
+    if (countdownTargetTimestamp == 0 || countdownTargetTimestamp > now) {
+      // Target invalid or in the future, don't show "TIMES UP" yet, advance display instead
+      countdownShowFinishedMessage = false;
+      countdownFinished = false;
+      countdownFinishedMessageStartTime = 0;
+      hourglassPlayed = false;  // Reset if we decide not to show it
+      hourglassFrame = 0;
+      markDisplayModesDirty();
+      Serial.println("[COUNTDOWN-FINISH] Countdown target invalid or not reached yet, skipping 'TIMES UP'. Advancing display.");
+      advanceDisplayMode();
+      return;
+    }
 
-      // Define these static variables here if they are not global (or already defined in your loop())
-      static const char *flashFrames[] = { "{|", "}~" };
-      static unsigned long lastFlashingSwitch = 0;
-      static int flashingMessageFrame = 0;
+    static const char *flashFrames[] = { "{|", "}~" };
+    static unsigned long lastFlashingSwitch = 0;
+    static int flashingMessageFrame = 0;
 
-      // --- Initial Combined Sequence: Play Hourglass THEN start Flashing ---
-      // This 'if' runs ONLY ONCE when the "finished" sequence begins.
-      if (!hourglassPlayed) {                          // <-- This is the single entry point for the combined sequence
+    // --- Initial Combined Sequence: Play Hourglass THEN start Flashing ---
+    // The hourglass advances one frame per HOURGLASS_FRAME_MS; the flashing
+    // only starts once the last frame has had its full time on the display.
+    if (!hourglassPlayed) {
+      if (hourglassFrame == 0 && hourglassFrameTime == 0) {
         countdownFinished = true;                      // Mark as finished overall
         countdownShowFinishedMessage = true;           // Confirm we are in the finished sequence
         countdownFinishedMessageStartTime = millis();  // Start the 15-second timer for the flashing duration
-
-        // 1. Play Hourglass Animation (Blocking)
-        const char *hourglassFrames[] = { "¡", "¢", "£", "¤" };
-        for (int repeat = 0; repeat < 3; repeat++) {
-          for (int i = 0; i < 4; i++) {
-            P.setTextAlignment(PA_CENTER);
-            P.setCharSpacing(0);
-            P.print(hourglassFrames[i]);
-            delay(350);  // This is blocking! (Total ~4.2 seconds for hourglass)
-          }
-        }
-        Serial.println("[COUNTDOWN-FINISH] Played hourglass animation.");
-        P.displayClear();  // Clear display after hourglass animation
-
-        // 2. Initialize Flashing "TIMES UP" for its very first frame
-        flashingMessageFrame = 0;
-        lastFlashingSwitch = millis();  // Set initial time for first flash frame
-        P.setTextAlignment(PA_CENTER);
-        P.setCharSpacing(0);
-        P.print(flashFrames[flashingMessageFrame]);             // Display the first frame immediately
-        flashingMessageFrame = (flashingMessageFrame + 1) % 2;  // Prepare for the next frame
-
-        hourglassPlayed = true;  // <-- Mark that this initial combined sequence has completed!
-        countdownSegment = 0;    // Reset segment counter after finished sequence initiation
-        segmentStartTime = 0;    // Reset segment timer after finished sequence initiation
       }
 
-      // --- Continue Flashing "TIMES UP" for its duration (after initial combined sequence) ---
-      // This part runs in subsequent loop iterations after the hourglass has played.
-      if (millis() - countdownFinishedMessageStartTime < 15000) {  // Flashing duration
-        if (millis() - lastFlashingSwitch >= 500) {                // Check for flashing interval
-          lastFlashingSwitch = millis();
-          P.displayClear();
-          P.setTextAlignment(PA_CENTER);
-          P.setCharSpacing(0);
-          P.print(flashFrames[flashingMessageFrame]);
-          flashingMessageFrame = (flashingMessageFrame + 1) % 2;
+      // 1. Play Hourglass Animation
+      const char *hourglassFrames[] = { "¡", "¢", "£", "¤" };
+      if (hourglassFrame < HOURGLASS_FRAME_COUNT) {
+        if (hourglassFrameTime == 0 || millis() - hourglassFrameTime >= HOURGLASS_FRAME_MS) {
+          renderSetTextAlignment(PA_CENTER);
+          renderSetCharSpacing(0);
+          renderPrint(hourglassFrames[hourglassFrame % 4]);
+          hourglassFrame++;
+          hourglassFrameTime = millis();
         }
-        P.displayAnimate();  // Ensure display updates
-        yield();
-        return;  // Stay in this mode until the 15 seconds are over
-      } else {
-        // 15 seconds are over, clean up and advance
-        Serial.println("[COUNTDOWN-FINISH] Flashing duration over. Advancing to Clock.");
-        countdownShowFinishedMessage = false;
-        countdownFinishedMessageStartTime = 0;
-        hourglassPlayed = false;  // <-- RESET this flag for the next countdown cycle!
-
-        // Final cleanup (persisted)
-        countdownEnabled = false;
-        countdownTargetTimestamp = 0;
-        countdownLabel[0] = '\0';
-        saveCountdownConfig(false, 0, "");
-
-        P.setInvert(false);
-        advanceDisplayMode();
-        yield();
-        return;  // Exit loop after processing
+        return;
       }
-    }  // END of 'if (timeRemaining <= 0 || countdownShowFinishedMessage)'
-
-
-    // --- NORMAL COUNTDOWN LOGIC ---
-    // This 'else' block will only run if `timeRemaining > 0` and `!countdownShowFinishedMessage`
-    else {
-
-      // The new variable `isDramaticCountdown` toggles between the two modes
-      if (isDramaticCountdown) {
-        // --- EXISTING DRAMATIC COUNTDOWN LOGIC ---
-        long days = timeRemaining / (24 * 3600);
-        long hours = (timeRemaining % (24 * 3600)) / 3600;
-        long minutes = (timeRemaining % 3600) / 60;
-        long seconds = timeRemaining % 60;
-        String currentSegmentText = "";
-
-        if (segmentStartTime == 0 || (millis() - segmentStartTime > SEGMENT_DISPLAY_DURATION)) {
-          segmentStartTime = millis();
-          P.displayClear();
-
-          switch (countdownSegment) {
-            case 0:  // Days
-              if (days > 0) {
-                currentSegmentText = String(days) + " " + (days == 1 ? "DAY" : "DAYS");
-                Serial.printf("[COUNTDOWN-STATIC] Displaying segment %d: %s\n", countdownSegment, currentSegmentText.c_str());
-                countdownSegment++;
-              } else {
-                // Skip days if zero
-                countdownSegment++;
-                segmentStartTime = 0;
-              }
-              break;
-            case 1:
-              {  // Hours
-                char buf[10];
-                sprintf(buf, "%02ld HRS", hours);  // pad hours with 0
-                currentSegmentText = String(buf);
-                Serial.printf("[COUNTDOWN-STATIC] Displaying segment %d: %s\n", countdownSegment, currentSegmentText.c_str());
-                countdownSegment++;
-                break;
-              }
-            case 2:
-              {  // Minutes
-                char buf[10];
-                sprintf(buf, "%02ld MINS", minutes);  // pad minutes with 0
-                currentSegmentText = String(buf);
-                Serial.printf("[COUNTDOWN-STATIC] Displaying segment %d: %s\n", countdownSegment, currentSegmentText.c_str());
-                countdownSegment++;
-                break;
-              }
-            case 3:
-              {  // Seconds & Label Scroll
-                time_t segmentStartTime = time(nullptr);
-                unsigned long segmentStartMillis = millis();
-
-                long nowRemaining = countdownTargetTimestamp - segmentStartTime;
-                long currentSecond = nowRemaining % 60;
-                char secondsBuf[10];
-                sprintf(secondsBuf, "%02ld %s", currentSecond, currentSecond == 1 ? "SEC" : "SECS");
-                String secondsText = String(secondsBuf);
-                Serial.printf("[COUNTDOWN-STATIC] Displaying segment 3: %s\n", secondsText.c_str());
-                P.displayClear();
-                P.setTextAlignment(PA_CENTER);
-                P.setCharSpacing(1);
-                P.print(secondsText.c_str());
-                delay(SEGMENT_DISPLAY_DURATION - 400);
-
-                unsigned long elapsed = millis() - segmentStartMillis;
-                long adjustedSecond = (countdownTargetTimestamp - segmentStartTime - (elapsed / 1000)) % 60;
-                sprintf(secondsBuf, "%02ld %s", adjustedSecond, adjustedSecond == 1 ? "SEC" : "SECS");
-                secondsText = String(secondsBuf);
-                P.displayClear();
-                P.setTextAlignment(PA_CENTER);
-                P.setCharSpacing(1);
-                P.print(secondsText.c_str());
-                delay(400);
-
-                String label;
-                if (strlen(countdownLabel) > 0) {
-                  label = String(countdownLabel);
-                  label.trim();
-                  if (!label.startsWith("TO:") && !label.startsWith("to:")) {
-                    label = "TO: " + label;
-                  }
-                  label.replace('.', ',');
-                } else {
-                  static const char *fallbackLabels[] = {
-                    "TO: PARTY TIME!", "TO: SHOWTIME!", "TO: CLOCKOUT!", "TO: BLASTOFF!",
-                    "TO: GO TIME!", "TO: LIFTOFF!", "TO: THE BIG REVEAL!",
-                    "TO: ZERO HOUR!", "TO: THE FINAL COUNT!", "TO: MISSION COMPLETE"
-                  };
-                  int randomIndex = random(0, 10);
-                  label = fallbackLabels[randomIndex];
-                }
-
-                P.setTextAlignment(PA_LEFT);
-                P.setCharSpacing(1);
-                textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
-                P.displayScroll(label.c_str(), PA_LEFT, actualScrollDirection, GENERAL_SCROLL_SPEED);
-
-                while (!P.displayAnimate()) {
-                  yield();
-                }
-                countdownSegment++;
-                segmentStartTime = millis();
-                break;
-              }
-            case 4:  // Exit countdown
-              Serial.println("[COUNTDOWN-STATIC] All segments and label displayed. Advancing to Clock.");
-              countdownSegment = 0;
-              segmentStartTime = 0;
-              P.setTextAlignment(PA_CENTER);
-              P.setCharSpacing(1);
-              advanceDisplayMode();
-              yield();
-              return;
-
-            default:
-              Serial.println("[COUNTDOWN-ERROR] Invalid countdownSegment, resetting.");
-              countdownSegment = 0;
-              segmentStartTime = 0;
-              break;
-          }
-
-          if (currentSegmentText.length() > 0) {
-            P.setTextAlignment(PA_CENTER);
-            P.setCharSpacing(1);
-            P.print(currentSegmentText.c_str());
-          }
-        }
-        P.displayAnimate();
+      if (millis() - hourglassFrameTime < HOURGLASS_FRAME_MS) {
+        return;  // let the last frame finish
       }
+      Serial.println("[COUNTDOWN-FINISH] Played hourglass animation.");
+      renderClear();  // Clear display after hourglass animation
+      hourglassFrame = 0;
+      hourglassFrameTime = 0;
+
+      // 2. Initialize Flashing "TIMES UP" for its very first frame
+      flashingMessageFrame = 0;
+      lastFlashingSwitch = millis();  // Set initial time for first flash frame
+      renderSetTextAlignment(PA_CENTER);
+      renderSetCharSpacing(0);
+      renderPrint(flashFrames[flashingMessageFrame]);             // Display the first frame immediately
+      flashingMessageFrame = (flashingMessageFrame + 1) % 2;  // Prepare for the next frame
+
+      hourglassPlayed = true;  // <-- Mark that this initial combined sequence has completed!
+      countdownSegment = 0;    // Reset segment counter after finished sequence initiation
+      segmentStartTime = 0;    // Reset segment timer after finished sequence initiation
+    }
 
-      // --- NEW: SINGLE-LINE COUNTDOWN LOGIC ---
-      else {
-        long days = timeRemaining / (24 * 3600);
-        long hours = (timeRemaining % (24 * 3600)) / 3600;
-        long minutes = (timeRemaining % 3600) / 60;
-        long seconds = timeRemaining % 60;
-
-        String label;
-        // Check if countdownLabel is empty and grab a random one if needed
-        if (strlen(countdownLabel) > 0) {
-          label = String(countdownLabel);
-          label.trim();
-
-          // Replace standard digits 0–9 with your custom font character codes
-          for (int i = 0; i < label.length(); i++) {
-            if (isDigit(label[i])) {
-              int num = label[i] - '0';           // 0–9
-              label[i] = 145 + ((num + 9) % 10);  // Maps 0→154, 1→145, ... 9→153
-            }
-          }
-
-        } else {
-          static const char *fallbackLabels[] = {
-            "PARTY TIME", "SHOWTIME", "CLOCKOUT", "BLASTOFF",
-            "GO TIME", "LIFTOFF", "THE BIG REVEAL",
-            "ZERO HOUR", "THE FINAL COUNT", "MISSION COMPLETE"
-          };
-          int randomIndex = random(0, 10);
-          label = fallbackLabels[randomIndex];
-        }
-
-        // Format the full string
-        char buf[50];
-        // Only show days if there are any, otherwise start with hours
-        if (days > 0) {
-          sprintf(buf, "%s IN: %ldD %02ldH %02ldM %02ldS", label.c_str(), days, hours, minutes, seconds);
-        } else {
-          sprintf(buf, "%s IN: %02ldH %02ldM %02ldS", label.c_str(), hours, minutes, seconds);
-        }
-
-        String fullString = String(buf);
-        bool addPadding = false;
-        bool humidityVisible = showHumidity && weatherAvailable && strlen(openWeatherApiKey) == 32 && strlen(openWeatherCity) > 0 && strlen(openWeatherCountry) > 0;
-
-        // Padding logic
-        if (prevDisplayMode == 0 && (showDayOfWeek || colonBlinkEnabled)) {
-          addPadding = true;
-        } else if (prevDisplayMode == 1 && humidityVisible) {
-          addPadding = true;
-        }
-        if (addPadding) {
-          fullString = "    " + fullString;  // 4 spaces
-        }
-
-        // Display the full string and scroll it
-        P.setTextAlignment(PA_LEFT);
-        P.setCharSpacing(1);
+    // --- Continue Flashing "TIMES UP" for its duration (after initial combined sequence) ---
+    if (millis() - countdownFinishedMessageStartTime < 15000) {  // Flashing duration
+      if (millis() - lastFlashingSwitch >= 500) {                // Check for flashing interval
+        lastFlashingSwitch = millis();
+        renderClear();
+        renderSetTextAlignment(PA_CENTER);
+        renderSetCharSpacing(0);
+        renderPrint(flashFrames[flashingMessageFrame]);
+        flashingMessageFrame = (flashingMessageFrame + 1) % 2;
+      }
+      P.displayAnimate();  // Ensure display updates
+      return;              // Stay in this mode until the 15 seconds are over
+    } else {
+      // 15 seconds are over, clean up and advance
+      Serial.println("[COUNTDOWN-FINISH] Flashing duration over. Advancing to Clock.");
+      countdownShowFinishedMessage = false;
+      countdownFinishedMessageStartTime = 0;
+      hourglassPlayed = false;  // <-- RESET this flag for the next countdown cycle!
+
+      // Final cleanup (persisted)
+      countdownEnabled = false;
+      countdownTargetTimestamp = 0;
+      countdownLabel[0] = '\0';
+      saveCountdownConfig(false, 0, "");
+      markDisplayModesDirty();
+
+      P.setInvert(false);
+      invalidateRenderCache();
+      advanceDisplayMode();
+      return;
+    }
+  }  // END of 'if (timeRemaining <= 0 || countdownShowFinishedMessage)'
+
+
+  // --- NORMAL COUNTDOWN LOGIC ---
+  // The new variable `isDramaticCountdown` toggles between the two modes
+  if (isDramaticCountdown) {
+    long days = timeRemaining / (24 * 3600);
+    long hours = (timeRemaining % (24 * 3600)) / 3600;
+    long minutes = (timeRemaining % 3600) / 60;
+    String currentSegmentText = "";
+
+    // --- Seconds & Label segment, stepped through its phases ---
+    if (countdownSegment == 3 && countdownLabelPhase != CD_LABEL_IDLE) {
+      if (countdownLabelPhase == CD_LABEL_SECONDS && millis() - countdownLabelPhaseTime >= SEGMENT_DISPLAY_DURATION - 400) {
+        printCountdownSeconds();  // re-sync the seconds right before the label
+        countdownLabelPhase = CD_LABEL_ADJUSTED;
+        countdownLabelPhaseTime = millis();
+      } else if (countdownLabelPhase == CD_LABEL_ADJUSTED && millis() - countdownLabelPhaseTime >= 400) {
+        String label = buildCountdownLabel();
+        label.toCharArray(countdownScrollBuffer, sizeof(countdownScrollBuffer));
+        renderSetTextAlignment(PA_LEFT);
+        renderSetCharSpacing(1);
         textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
-        P.displayScroll(fullString.c_str(), PA_LEFT, actualScrollDirection, GENERAL_SCROLL_SPEED);
-
-        // Blocking loop to ensure the full message scrolls
-        while (!P.displayAnimate()) {
-          yield();
-        }
-
-        // After scrolling is complete, we're done with this display mode
-        // Move to the next mode and exit the function.
-        P.setTextAlignment(PA_CENTER);
-        advanceDisplayMode();
-        yield();
-        return;
+        P.displayScroll(countdownScrollBuffer, PA_LEFT, actualScrollDirection, GENERAL_SCROLL_SPEED);
+        invalidateRenderCache();
+        countdownLabelPhase = CD_LABEL_SCROLLING;
+      } else if (countdownLabelPhase == CD_LABEL_SCROLLING && P.displayAnimate()) {
+        countdownLabelPhase = CD_LABEL_IDLE;
+        countdownSegment++;
+        segmentStartTime = millis();
       }
+      return;
     }
 
-    // Keep alignment reset just in case
-    P.setTextAlignment(PA_CENTER);
-    P.setCharSpacing(1);
-    yield();
-    return;
-  }  // End of if (displayMode == 3 && ...)
-
-
-  // --- NIGHTSCOUT Display Mode ---
-
-  if (displayMode == 4) {
-    String ntpField = String(ntpServer2);
-
-    // These static variables will retain their values between calls to this block
-    static unsigned long lastNightscoutFetchTime = 0;
-    const unsigned long NIGHTSCOUT_FETCH_INTERVAL = 150000;  // 2.5 minutes
-    static int currentGlucose = -1;
-    static String currentDirection = "?";
-    static time_t lastGlucoseTime = 0;  // store timestamp from JSON
+    if (segmentStartTime == 0 || (millis() - segmentStartTime > SEGMENT_DISPLAY_DURATION)) {
+      segmentStartTime = millis();
+      renderClear();
 
-    // --- Small helper inside this block ---
-    auto makeTimeUTC = [](struct tm *tm) -> time_t {
-#if defined(ESP32)
-      // ESP32: timegm() is not implemented — emulate correctly
-      struct tm tm_copy = *tm;
-      // mktime() interprets tm as local, but system time is UTC already
-      // so we can safely assume input is UTC
-      return mktime(&tm_copy);
-#elif defined(ESP8266)
-      // ESP8266: timegm() not available either, same logic
-      struct tm tm_copy = *tm;
-      return mktime(&tm_copy);
-#else
-      // Platforms with proper timegm()
-      return timegm(tm);
-#endif
-    };
-    // --------------------------------------
-
-    // Check if it's time to fetch new data or if we have no data yet
-    if (currentGlucose == -1 || millis() - lastNightscoutFetchTime >= NIGHTSCOUT_FETCH_INTERVAL) {
-      WiFiClientSecure client;
-      client.setInsecure();
-      HTTPClient https;
-      https.begin(client, ntpField);
-      https.setTimeout(5000);
-
-      Serial.println("[HTTPS] Nightscout fetch initiated...");
-      int httpCode = https.GET();
-
-      if (httpCode == HTTP_CODE_OK) {
-        String payload = https.getString();
-        StaticJsonDocument<1024> doc;
-        DeserializationError error = deserializeJson(doc, payload);
-
-        if (!error && doc.is<JsonArray>() && doc.size() > 0) {
-          JsonObject firstReading = doc[0].as<JsonObject>();
-          currentGlucose = firstReading["glucose"] | firstReading["sgv"] | -1;
-          currentDirection = firstReading["direction"] | "?";
-          const char *dateStr = firstReading["dateString"];
-
-          // --- Parse ISO 8601 UTC time ---
-          if (dateStr) {
-            struct tm tm {};
-            if (sscanf(dateStr, "%4d-%2d-%2dT%2d:%2d:%2dZ",
-                       &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
-                       &tm.tm_hour, &tm.tm_min, &tm.tm_sec)
-                == 6) {
-              tm.tm_year -= 1900;
-              tm.tm_mon -= 1;
-              lastGlucoseTime = makeTimeUTC(&tm);
-            }
+      switch (countdownSegment) {
+        case 0:  // Days
+          if (days > 0) {
+            currentSegmentText = String(days) + " " + (days == 1 ? "DAY" : "DAYS");
+            Serial.printf("[COUNTDOWN-STATIC] Displaying segment %d: %s\n", countdownSegment, currentSegmentText.c_str());
+            countdownSegment++;
+          } else {
+            // Skip days if zero
+            countdownSegment++;
+            segmentStartTime = 0;
+          }
+          break;
+        case 1:
+          {  // Hours
+            char buf[10];
+            sprintf(buf, "%02ld HRS", hours);  // pad hours with 0
+            currentSegmentText = String(buf);
+            Serial.printf("[COUNTDOWN-STATIC] Displaying segment %d: %s\n", countdownSegment, currentSegmentText.c_str());
+            countdownSegment++;
+            break;
+          }
+        case 2:
+          {  // Minutes
+            char buf[10];
+            sprintf(buf, "%02ld MINS", minutes);  // pad minutes with 0
+            currentSegmentText = String(buf);
+            Serial.printf("[COUNTDOWN-STATIC] Displaying segment %d: %s\n", countdownSegment, currentSegmentText.c_str());
+            countdownSegment++;
+            break;
           }
+        case 3:  // Seconds & Label Scroll (continues in the phase block above)
+          printCountdownSeconds();
+          countdownLabelPhase = CD_LABEL_SECONDS;
+          countdownLabelPhaseTime = millis();
+          break;
+        case 4:  // Exit countdown
+          Serial.println("[COUNTDOWN-STATIC] All segments and label displayed. Advancing to Clock.");
+          countdownSegment = 0;
+          segmentStartTime = 0;
+          renderSetTextAlignment(PA_CENTER);
+          renderSetCharSpacing(1);
+          advanceDisplayMode();
+          return;
 
-          Serial.printf("Nightscout data fetched: %d mg/dL %s\n", currentGlucose, currentDirection.c_str());
-        } else {
-          Serial.println("Failed to parse Nightscout JSON");
-        }
-      } else {
-        Serial.printf("[HTTPS] GET failed, error: %s\n", https.errorToString(httpCode).c_str());
+        default:
+          Serial.println("[COUNTDOWN-ERROR] Invalid countdownSegment, resetting.");
+          countdownSegment = 0;
+          segmentStartTime = 0;
+          break;
       }
 
-      https.end();
-      lastNightscoutFetchTime = millis();
+      if (currentSegmentText.length() > 0) {
+        renderSetTextAlignment(PA_CENTER);
+        renderSetCharSpacing(1);
+        renderPrint(currentSegmentText.c_str());
+      }
     }
+    P.displayAnimate();
+  }
 
-    // --- Display the data ---
-    if (currentGlucose != -1) {
-      // Calculate age of reading
-      // Get current UTC time (avoid local timezone offset)
-      time_t nowLocal = time(nullptr);
-      struct tm *gmt = gmtime(&nowLocal);
-      time_t nowUTC = mktime(gmt);
-
-      bool isOutdated = false;
-      int ageMinutes = 0;
+  // --- NEW: SINGLE-LINE COUNTDOWN LOGIC ---
+  else {
+    if (!countdownScrolling) {
+      long days = timeRemaining / (24 * 3600);
+      long hours = (timeRemaining % (24 * 3600)) / 3600;
+      long minutes = (timeRemaining % 3600) / 60;
+      long seconds = timeRemaining % 60;
+
+      String label;
+      // Check if countdownLabel is empty and grab a random one if needed
+      if (strlen(countdownLabel) > 0) {
+        label = String(countdownLabel);
+        label.trim();
+
+        // Replace standard digits 0–9 with your custom font character codes
+        for (int i = 0; i < label.length(); i++) {
+          if (isDigit(label[i])) {
+            int num = label[i] - '0';           // 0–9
+            label[i] = 145 + ((num + 9) % 10);  // Maps 0→154, 1→145, ... 9→153
+          }
+        }
 
-      if (lastGlucoseTime > 0) {
-        double diffSec = difftime(nowUTC, lastGlucoseTime);
-        ageMinutes = (int)(diffSec / 60.0);
-        isOutdated = (ageMinutes > NIGHTSCOUT_IDLE_THRESHOLD_MIN);
-        Serial.printf("[NIGHTSCOUT] Data age: %d minutes old (threshold: %d)\n", ageMinutes, NIGHTSCOUT_IDLE_THRESHOLD_MIN);
+      } else {
+        static const char *fallbackLabels[] = {
+          "PARTY TIME", "SHOWTIME", "CLOCKOUT", "BLASTOFF",
+          "GO TIME", "LIFTOFF", "THE BIG REVEAL",
+          "ZERO HOUR", "THE FINAL COUNT", "MISSION COMPLETE"
+        };
+        int randomIndex = random(0, 10);
+        label = fallbackLabels[randomIndex];
       }
 
-      // Pick arrow character
-      char arrow;
-      if (currentDirection == "Flat") arrow = 139;
-      else if (currentDirection == "SingleUp") arrow = 134;
-      else if (currentDirection == "DoubleUp") arrow = 135;
-      else if (currentDirection == "SingleDown") arrow = 136;
-      else if (currentDirection == "DoubleDown") arrow = 137;
-      else if (currentDirection == "FortyFiveUp") arrow = 138;
-      else if (currentDirection == "FortyFiveDown") arrow = 140;
-      else arrow = '?';
-
-      // Build display text
-      String displayText = "";
-      // ADD crossed digits
-      if (isOutdated) {
-
-        String glucoseStr = String(currentGlucose);
-
-        for (int i = 0; i < glucoseStr.length(); i++) {
-          if (isDigit(glucoseStr[i])) {
-            int num = glucoseStr[i] - '0';           // 0–9
-            glucoseStr[i] = 195 + ((num + 9) % 10);  // Maps 0→204, 1→195, ...
-          }
-        }
+      bool addPadding = false;
+      bool humidityVisible = showHumidity && weatherAvailable && strlen(openWeatherApiKey) == 32 && strlen(openWeatherCity) > 0 && strlen(openWeatherCountry) > 0;
 
-        String separatedStr = "";
-        for (int i = 0; i < glucoseStr.length(); i++) {
-          separatedStr += glucoseStr[i];
-          if (i < glucoseStr.length() - 1) {
-            separatedStr += char(255);  // insert separator between digits
-          }
-        }
+      // Padding logic
+      if (prevDisplayMode == 0 && (showDayOfWeek || colonBlinkEnabled)) {
+        addPadding = true;
+      } else if (prevDisplayMode == 1 && humidityVisible) {
+        addPadding = true;
+      }
 
-        displayText += char(255);
-        displayText += char(255);
-        displayText += separatedStr;
-        displayText += char(255);
-        displayText += char(255);
-        displayText += " ";  // extra space
-        displayText += arrow;
-        P.setCharSpacing(0);
+      // Format the full string (only show days if there are any, otherwise start with hours)
+      const char *padding = addPadding ? "    " : "";  // 4 spaces
+      if (days > 0) {
+        snprintf(countdownScrollBuffer, sizeof(countdownScrollBuffer), "%s%s IN: %ldD %02ldH %02ldM %02ldS", padding, label.c_str(), days, hours, minutes, seconds);
       } else {
-        displayText += String(currentGlucose) + String(arrow);
-        P.setCharSpacing(1);
+        snprintf(countdownScrollBuffer, sizeof(countdownScrollBuffer), "%s%s IN: %02ldH %02ldM %02ldS", padding, label.c_str(), hours, minutes, seconds);
       }
 
-      P.setTextAlignment(PA_CENTER);
-      P.print(displayText.c_str());
-      delay(weatherDuration);
-      advanceDisplayMode();
-      return;
-    } else {
-      P.setTextAlignment(PA_CENTER);
-      P.setCharSpacing(0);
-      P.print(F("())"));
-      delay(2000);
-      advanceDisplayMode();
+      // Display the full string and scroll it
+      renderSetTextAlignment(PA_LEFT);
+      renderSetCharSpacing(1);
+      textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
+      P.displayScroll(countdownScrollBuffer, PA_LEFT, actualScrollDirection, GENERAL_SCROLL_SPEED);
+      invalidateRenderCache();
+      countdownScrolling = true;
+    }
+
+    // Wait for the full message to scroll
+    if (!P.displayAnimate()) {
       return;
     }
+    countdownScrolling = false;
+
+    // After scrolling is complete, we're done with this display mode
+    renderSetTextAlignment(PA_CENTER);
+    advanceDisplayMode();
+    return;
   }
 
+  // Keep alignment reset just in case
+  renderSetTextAlignment(PA_CENTER);
+  renderSetCharSpacing(1);
+}
 
-  //DATE Display Mode
-  else if (displayMode == 5 && showDate) {
 
-    // --- VALID DATE CHECK ---
-    if (timeinfo.tm_year < 120 || timeinfo.tm_mday <= 0 || timeinfo.tm_mon < 0 || timeinfo.tm_mon > 11) {
+// --- NIGHTSCOUT Display Mode ---
+void renderNightscoutMode() {
+  // The reading stays on the display for weatherDuration (2s for the error
+  // glyph) and then the rotation moves on.
+  if (nightscoutShown) {
+    if (millis() - nightscoutShownAt >= nightscoutHoldMs) {
+      nightscoutShown = false;
       advanceDisplayMode();
-      return;  // skip drawing
-    }
-    // -------------------------
-    String dateString;
-
-    // Get localized month names
-    const char *const *months = getMonthsOfYear(language);
-    String monthAbbr = String(months[timeinfo.tm_mon]).substring(0, 5);
-    monthAbbr.toLowerCase();
-
-    // Add spaces between day digits
-    String dayString = String(timeinfo.tm_mday);
-    String spacedDay = "";
-    for (size_t i = 0; i < dayString.length(); i++) {
-      spacedDay += dayString[i];
-      if (i < dayString.length() - 1) spacedDay += " ";
-    }
-
-    // Function to check if day should come first for given language
-    auto isDayFirst = [](const String &lang) {
-      // Languages with DD-MM order
-      const char *dayFirstLangs[] = {
-        "af",  // Afrikaans
-        "cs",  // Czech
-        "da",  // Danish
-        "de",  // German
-        "eo",  // Esperanto
-        "es",  // Spanish
-        "et",  // Estonian
-        "fi",  // Finnish
-        "fr",  // French
-        "ga",  // Irish
-        "hr",  // Croatian
-        "hu",  // Hungarian
-        "it",  // Italian
-        "lt",  // Lithuanian
-        "lv",  // Latvian
-        "nl",  // Dutch
-        "no",  // Norwegian
-        "pl",  // Polish
-        "pt",  // Portuguese
-        "ro",  // Romanian
-        "ru",  // Russian
-        "sk",  // Slovak
-        "sl",  // Slovenian
-        "sr",  // Serbian
-        "sv",  // Swedish
-        "sw",  // Swahili
-        "tr"   // Turkish
-      };
-      for (auto lf : dayFirstLangs) {
-        if (lang.equalsIgnoreCase(lf)) {
-          return true;
+    }
+    return;
+  }
+
+  // Drawn from the poller's cache, no network I/O here
+  NightscoutReading reading;
+  FETCH_LOCK();
+  reading = nightscoutReading;
+  FETCH_UNLOCK();
+  int currentGlucose = reading.glucose;
+  String currentDirection = reading.direction;
+  time_t lastGlucoseTime = reading.timestamp;
+
+  // --- Display the data ---
+  if (currentGlucose != -1) {
+    // Calculate age of reading
+    // Get current UTC time (avoid local timezone offset)
+    time_t nowLocal = time(nullptr);
+    struct tm *gmt = gmtime(&nowLocal);
+    time_t nowUTC = mktime(gmt);
+
+    bool isOutdated = false;
+    int ageMinutes = 0;
+
+    if (lastGlucoseTime > 0) {
+      double diffSec = difftime(nowUTC, lastGlucoseTime);
+      ageMinutes = (int)(diffSec / 60.0);
+      isOutdated = (ageMinutes > NIGHTSCOUT_IDLE_THRESHOLD_MIN);
+      Serial.printf("[NIGHTSCOUT] Data age: %d minutes old (threshold: %d)\n", ageMinutes, NIGHTSCOUT_IDLE_THRESHOLD_MIN);
+    }
+
+    // Pick arrow character
+    char arrow;
+    if (currentDirection == "Flat") arrow = 139;
+    else if (currentDirection == "SingleUp") arrow = 134;
+    else if (currentDirection == "DoubleUp") arrow = 135;
+    else if (currentDirection == "SingleDown") arrow = 136;
+    else if (currentDirection == "DoubleDown") arrow = 137;
+    else if (currentDirection == "FortyFiveUp") arrow = 138;
+    else if (currentDirection == "FortyFiveDown") arrow = 140;
+    else arrow = '?';
+
+    // Build display text
+    String displayText = "";
+    // ADD crossed digits
+    if (isOutdated) {
+
+      String glucoseStr = String(currentGlucose);
+
+      for (int i = 0; i < glucoseStr.length(); i++) {
+        if (isDigit(glucoseStr[i])) {
+          int num = glucoseStr[i] - '0';           // 0–9
+          glucoseStr[i] = 195 + ((num + 9) % 10);  // Maps 0→204, 1→195, ...
         }
       }
-      return false;
-    };
 
-    String langForDate = String(language);
-
-    if (langForDate == "ja") {
-      // Japanese: month number (spaced digits) + day + symbol
-      String spacedMonth = "";
-      String monthNum = String(timeinfo.tm_mon + 1);
-      dateString = monthAbbr + "  " + spacedDay + " ±";
+      String separatedStr = "";
+      for (int i = 0; i < glucoseStr.length(); i++) {
+        separatedStr += glucoseStr[i];
+        if (i < glucoseStr.length() - 1) {
+          separatedStr += char(255);  // insert separator between digits
+        }
+      }
 
+      displayText += char(255);
+      displayText += char(255);
+      displayText += separatedStr;
+      displayText += char(255);
+      displayText += char(255);
+      displayText += " ";  // extra space
+      displayText += arrow;
+      renderSetCharSpacing(0);
     } else {
-      if (isDayFirst(language)) {
-        dateString = spacedDay + "   " + monthAbbr;
-      } else {
-        dateString = monthAbbr + "   " + spacedDay;
-      }
+      displayText += String(currentGlucose) + String(arrow);
+      renderSetCharSpacing(1);
     }
 
-    P.setTextAlignment(PA_CENTER);
-    P.setCharSpacing(0);
-    P.print(dateString);
-
-    if (millis() - lastSwitch > weatherDuration) {
-      advanceDisplayMode();
-    }
+    renderSetTextAlignment(PA_CENTER);
+    renderPrint(displayText.c_str());
+    nightscoutHoldMs = weatherDuration;
+  } else {
+    renderSetTextAlignment(PA_CENTER);
+    renderSetCharSpacing(0);
+    renderPrint(F("())"));
+    nightscoutHoldMs = 2000;
   }
+  nightscoutShown = true;
+  nightscoutShownAt = millis();
+}
 
 
-  // --- Custom Message Display Mode (displayMode == 6) ---
-  if (displayMode == 6) {
+// --- DATE Display Mode ---
+void renderDateMode(const struct tm &timeinfo) {
+  // --- VALID DATE CHECK ---
+  if (timeinfo.tm_year < 120 || timeinfo.tm_mday <= 0 || timeinfo.tm_mon < 0 || timeinfo.tm_mon > 11) {
+    advanceDisplayMode();
+    return;  // skip drawing
+  }
+  // -------------------------
+  String dateString;
+
+  // Get localized month names
+  const char *const *months = getMonthsOfYear(language);
+  String monthAbbr = String(months[timeinfo.tm_mon]).substring(0, 5);
+  monthAbbr.toLowerCase();
+
+  // Add spaces between day digits
+  String dayString = String(timeinfo.tm_mday);
+  String spacedDay = "";
+  for (size_t i = 0; i < dayString.length(); i++) {
+    spacedDay += dayString[i];
+    if (i < dayString.length() - 1) spacedDay += " ";
+  }
 
-    // 1. Initial Check: If message is empty, skip mode 6.
-    if (strlen(customMessage) == 0) {
-      advanceDisplayMode();
-      yield();
-      return;
+  // Function to check if day should come first for given language
+  auto isDayFirst = [](const String &lang) {
+    // Languages with DD-MM order
+    const char *dayFirstLangs[] = {
+      "af",  // Afrikaans
+      "cs",  // Czech
+      "da",  // Danish
+      "de",  // German
+      "eo",  // Esperanto
+      "es",  // Spanish
+      "et",  // Estonian
+      "fi",  // Finnish
+      "fr",  // French
+      "ga",  // Irish
+      "hr",  // Croatian
+      "hu",  // Hungarian
+      "it",  // Italian
+      "lt",  // Lithuanian
+      "lv",  // Latvian
+      "nl",  // Dutch
+      "no",  // Norwegian
+      "pl",  // Polish
+      "pt",  // Portuguese
+      "ro",  // Romanian
+      "ru",  // Russian
+      "sk",  // Slovak
+      "sl",  // Slovenian
+      "sr",  // Serbian
+      "sv",  // Swedish
+      "sw",  // Swahili
+      "tr"   // Turkish
+    };
+    for (auto lf : dayFirstLangs) {
+      if (lang.equalsIgnoreCase(lf)) {
+        return true;
+      }
     }
+    return false;
+  };
 
-    // --- CHARACTER REPLACEMENT AND PADDING (Common to both short and long) ---
-    const size_t MAX_NON_SCROLLING_CHARS = 8;
-    String msg = String(customMessage);
+  String langForDate = String(language);
 
-    // Replace standard digits 0–9 with your custom font character codes
-    for (int i = 0; i < msg.length(); i++) {
-      if (isDigit(msg[i])) {
-        int num = msg[i] - '0';
-        msg[i] = 145 + ((num + 9) % 10);
-      }
-    }
+  if (langForDate == "ja") {
+    // Japanese: month number (spaced digits) + day + symbol
+    String spacedMonth = "";
+    String monthNum = String(timeinfo.tm_mon + 1);
+    dateString = monthAbbr + "  " + spacedDay + " ±";
 
-    // --- CHECK FOR TIMEOUT (Applies to temporary short & long messages) ---
-    bool timedOut = false;
-    // Check if a time limit (messageDisplaySeconds > 0) has been exceeded
-    if (messageDisplaySeconds > 0 && (millis() - messageStartTime) >= (messageDisplaySeconds * 1000UL)) {
-      Serial.printf("[MESSAGE] HA message timed out after %d seconds.\n", messageDisplaySeconds);
-      timedOut = true;
+  } else {
+    if (isDayFirst(language)) {
+      dateString = spacedDay + "   " + monthAbbr;
+    } else {
+      dateString = monthAbbr + "   " + spacedDay;
     }
+  }
 
-    // --- CHECK FOR SCROLL/CYCLE LIMIT BEFORE DISPLAYING ---
-    // Scrolls complete applies to long messages.
-    bool scrollsComplete = (messageScrollTimes > 0) && (currentScrollCount >= messageScrollTimes);
+  renderSetTextAlignment(PA_CENTER);
+  renderSetCharSpacing(0);
+  renderPrint(dateString);
+
+  if (millis() - lastSwitch > weatherDuration) {
+    advanceDisplayMode();
+  }
+}
 
-    // Cycles complete applies to short messages.
-    extern int currentDisplayCycleCount;  // Use the dedicated short message counter
-    bool cyclesComplete = (messageScrollTimes > 0) && (currentDisplayCycleCount >= messageScrollTimes);
 
+// --- Custom Message Display Mode (displayMode == 6) ---
+void renderCustomMessageMode() {
+  // 1. Initial Check: If message is empty, skip mode 6.
+  if (strlen(customMessage) == 0) {
+    advanceDisplayMode();
+    return;
+  }
 
-    // --- ADVANCE MODE CHECK (Check if HA parameters are complete) ---
-    // If either timer or cycle/scroll count is finished, we clean up the temporary message.
-    if (scrollsComplete || cyclesComplete) {
-      Serial.println(F("[MESSAGE] HA-controlled message finished."));
+  // --- CHARACTER REPLACEMENT AND PADDING (Common to both short and long) ---
+  const size_t MAX_NON_SCROLLING_CHARS = 8;
+  String msg = String(customMessage);
 
-      // Reset common counters
-      currentScrollCount = 0;
-      messageStartTime = 0;
-      currentDisplayCycleCount = 0;  // Reset the cycle counter
-
-      // CRITICAL LOGIC: RESTORE PERSISTENT MESSAGE (Exit Mode 6 Logic)
-      if (strlen(lastPersistentMessage) > 0) {
-        // A persistent message exists, restore it
-        strncpy(customMessage, lastPersistentMessage, sizeof(customMessage));
-        messageScrollSpeed = GENERAL_SCROLL_SPEED;
-        messageDisplaySeconds = 0;
-        messageScrollTimes = 0;
-        Serial.printf("[MESSAGE] Restored persistent message: '%s'. Staying in mode 6.\n", customMessage);
-      } else {
-        // No persistent message to restore. Clear the temporary HA message and Exit mode 6.
-        customMessage[0] = '\0';
-        Serial.println(F("[MESSAGE] No persistent message to restore. Advancing display mode."));
-        advanceDisplayMode();
-      }
-      yield();
-      return;
+  // Replace standard digits 0–9 with your custom font character codes
+  for (int i = 0; i < msg.length(); i++) {
+    if (isDigit(msg[i])) {
+      int num = msg[i] - '0';
+      msg[i] = 145 + ((num + 9) % 10);
     }
+  }
 
-    // ----------------------------------------------------------------------
-    // BRANCH A: NON-SCROLLING (Short Message: strlen <= 8)
-    // ----------------------------------------------------------------------
-    if (msg.length() <= MAX_NON_SCROLLING_CHARS) {
+  // --- CHECK FOR SCROLL/CYCLE LIMIT BEFORE DISPLAYING ---
+  // Scrolls complete applies to long messages.
+  bool scrollsComplete = (messageScrollTimes > 0) && (currentScrollCount >= messageScrollTimes);
+
+  // Cycles complete applies to short messages.
+  bool cyclesComplete = (messageScrollTimes > 0) && (currentDisplayCycleCount >= messageScrollTimes);
+
+
+  // --- ADVANCE MODE CHECK (Check if HA parameters are complete) ---
+  // If either timer or cycle/scroll count is finished, we clean up the temporary message.
+  if (scrollsComplete || cyclesComplete) {
+    Serial.println(F("[MESSAGE] HA-controlled message finished."));
+
+    // Reset common counters
+    currentScrollCount = 0;
+    messageStartTime = 0;
+    currentDisplayCycleCount = 0;  // Reset the cycle counter
+    messageShowing = false;
+    messageScrolling = false;
+    markDisplayModesDirty();
+
+    // CRITICAL LOGIC: RESTORE PERSISTENT MESSAGE (Exit Mode 6 Logic)
+    if (strlen(lastPersistentMessage) > 0) {
+      // A persistent message exists, restore it
+      strncpy(customMessage, lastPersistentMessage, sizeof(customMessage));
+      messageScrollSpeed = GENERAL_SCROLL_SPEED;
+      messageDisplaySeconds = 0;
+      messageScrollTimes = 0;
+      Serial.printf("[MESSAGE] Restored persistent message: '%s'. Staying in mode 6.\n", customMessage);
+    } else {
+      // No persistent message to restore. Clear the temporary HA message and Exit mode 6.
+      customMessage[0] = '\0';
+      Serial.println(F("[MESSAGE] No persistent message to restore. Advancing display mode."));
+      advanceDisplayMode();
+    }
+    return;
+  }
 
+  // ----------------------------------------------------------------------
+  // BRANCH A: NON-SCROLLING (Short Message: strlen <= 8)
+  // ----------------------------------------------------------------------
+  if (msg.length() <= MAX_NON_SCROLLING_CHARS && !messageScrolling) {
+    if (!messageShowing) {
       // Determine the duration: use HA seconds if set, otherwise use weatherDuration.
-      unsigned long durationMs = (messageDisplaySeconds > 0)
-                                   ? (messageDisplaySeconds * 1000UL)
-                                   : weatherDuration;
-
-      // If HA seconds is set, we use the timedOut check at the top.
       // If only scrollTimes is set, we still display for weatherDuration before incrementing the cycle count.
+      messageHoldMs = (messageDisplaySeconds > 0)
+                        ? (messageDisplaySeconds * 1000UL)
+                        : weatherDuration;
 
-      Serial.printf("[MESSAGE] Displaying timed short message: '%s' for %lu ms. Advancing mode.\n", customMessage, durationMs);
-
-      P.setTextAlignment(PA_CENTER);
-      P.setCharSpacing(1);
-      P.print(msg.c_str());
-
-      // Block execution for the specified duration (non-HA uses weatherDuration)
-      unsigned long displayUntil = millis() + durationMs;
-      while (millis() < displayUntil) {
-        yield();
-      }
+      Serial.printf("[MESSAGE] Displaying timed short message: '%s' for %lu ms. Advancing mode.\n", customMessage, messageHoldMs);
 
-      // --- CYCLE TRACKING FOR SCROLLTIMES ---
-      // Increment the counter if the HA message is configured to clear by scroll count.
-      if (messageScrollTimes > 0) {
-        currentDisplayCycleCount++;
-        Serial.printf("[MESSAGE] Short message cycle complete. Count: %d/%d\n", currentDisplayCycleCount, messageScrollTimes);
-      }
+      renderSetTextAlignment(PA_CENTER);
+      renderSetCharSpacing(1);
+      renderPrint(msg.c_str());
+      messageShowing = true;
+      messageShownAt = millis();
+    }
 
-      // After display, the message content must persist, but the display must cycle.
-      Serial.println(F("[MESSAGE] Short message duration complete. Advancing display mode."));
-      advanceDisplayMode();
-      yield();
+    // Hold the message for the specified duration (non-HA uses weatherDuration)
+    if (millis() - messageShownAt < messageHoldMs) {
       return;
     }
+    messageShowing = false;
+
+    // --- CYCLE TRACKING FOR SCROLLTIMES ---
+    // Increment the counter if the HA message is configured to clear by scroll count.
+    if (messageScrollTimes > 0) {
+      currentDisplayCycleCount++;
+      Serial.printf("[MESSAGE] Short message cycle complete. Count: %d/%d\n", currentDisplayCycleCount, messageScrollTimes);
+    }
 
-    // ----------------------------------------------------------------------
-    // BRANCH B: SCROLLING (Long Message: strlen > 8) - (Existing Logic)
-    // ----------------------------------------------------------------------
+    // After display, the message content must persist, but the display must cycle.
+    Serial.println(F("[MESSAGE] Short message duration complete. Advancing display mode."));
+    advanceDisplayMode();
+    return;
+  }
 
+  // ----------------------------------------------------------------------
+  // BRANCH B: SCROLLING (Long Message: strlen > 8) - (Existing Logic)
+  // ----------------------------------------------------------------------
+  if (!messageScrolling) {
     // --- Determine if we need left padding based on previous mode ---
     bool addPadding = false;
     bool humidityVisible = showHumidity && weatherAvailable && strlen(openWeatherApiKey) == 32 && strlen(openWeatherCity) > 0 && strlen(openWeatherCountry) > 0;
@@ -3993,49 +6266,290 @@ void loop() {
     if (addPadding) {
       msg = "    " + msg;
     }
+    msg.toCharArray(messageScrollBuffer, sizeof(messageScrollBuffer));
 
     // --- Display scrolling message ---
-    P.setTextAlignment(PA_LEFT);
-    P.setCharSpacing(1);
+    renderSetTextAlignment(PA_LEFT);
+    renderSetCharSpacing(1);
     textEffect_t actualScrollDirection = getEffectiveScrollDirection(PA_SCROLL_LEFT, flipDisplay);
-    extern int messageScrollSpeed;
 
     // START SCROLL CYCLE
-    P.displayScroll(msg.c_str(), PA_LEFT, actualScrollDirection, messageScrollSpeed);
+    P.displayScroll(messageScrollBuffer, PA_LEFT, actualScrollDirection, messageScrollSpeed);
+    invalidateRenderCache();
+    messageScrolling = true;
+  }
 
-    // BLOCKING WAIT: Completes 1 full scroll
-    while (!P.displayAnimate()) yield();
+  // Wait for 1 full scroll
+  if (!P.displayAnimate()) {
+    return;
+  }
+  messageScrolling = false;
 
-    // SCROLL COUNT INCREMENT
-    if (messageScrollTimes > 0) {
-      currentScrollCount++;
-      Serial.printf("[MESSAGE] Scroll complete. Count: %d/%d\n", currentScrollCount, messageScrollTimes);
-    }
+  // SCROLL COUNT INCREMENT
+  if (messageScrollTimes > 0) {
+    currentScrollCount++;
+    Serial.printf("[MESSAGE] Scroll complete. Count: %d/%d\n", currentScrollCount, messageScrollTimes);
+  }
 
-    // If no HA parameters are set, this is a persistent/infinite scroll, so advance mode after 1 scroll cycle.
-    // If HA parameters ARE set, the mode relies on the check at the top to break out.
-    if (messageDisplaySeconds == 0 && messageScrollTimes == 0) {
-      P.setTextAlignment(PA_CENTER);
-      advanceDisplayMode();
-    }
+  // If no HA parameters are set, this is a persistent/infinite scroll, so advance mode after 1 scroll cycle.
+  // If HA parameters ARE set, the mode relies on the check at the top to break out.
+  if (messageDisplaySeconds == 0 && messageScrollTimes == 0) {
+    renderSetTextAlignment(PA_CENTER);
+    advanceDisplayMode();
+  }
+}
 
-    yield();
+
+// --- Display task: colon blink, mode timer and the active mode's frame ---
+void tickDisplay() {
+  static unsigned long dwellSampledAt = millis();
+  unsigned long dwellNow = millis();
+  modeDwellMs[displayMode] += dwellNow - dwellSampledAt;
+  dwellSampledAt = dwellNow;
+
+  const unsigned long colonBlinkInterval = 800;
+  if (millis() - lastColonBlink > colonBlinkInterval) {
+    colonVisible = !colonVisible;
+    lastColonBlink = millis();
+  }
+
+  // --- IP Display ---
+  if (showingIp) {
+    renderIpAddress();
     return;
   }
 
+  // Any mode change (timer, web request, countdown trigger) restarts the new
+  // mode from its first frame
+  static int renderedMode = -1;
+  static unsigned long renderedSwitch = 0;
+  if (displayMode != renderedMode || lastSwitch != renderedSwitch) {
+    resetDisplayModeState();
+    renderedMode = displayMode;
+    renderedSwitch = lastSwitch;
+  }
 
-  unsigned long currentMillis = millis();
-  unsigned long runtimeSeconds = (currentMillis - bootMillis) / 1000;
-  unsigned long currentTotal = totalUptimeSeconds + runtimeSeconds;
+  time_t now_time = time(nullptr);
+  struct tm timeinfo;
+  localtime_r(&now_time, &timeinfo);
 
-  // --- Log and save uptime every 10 minutes ---
-  const unsigned long uptimeLogInterval = 600000UL;  // 10 minutes in ms
+  // Only advance mode by timer for clock/weather static (Mode 0 & 1).
+  // Other modes have their own internal timers/conditions for advancement.
+  unsigned long displayDuration = (displayMode == 0) ? clockDuration : weatherDuration;
+  if ((displayMode == 0 || displayMode == 1) && millis() - lastSwitch > displayDuration) {
+    advanceDisplayMode();
+  }
 
-  if (currentMillis - lastUptimeLog >= uptimeLogInterval) {
-    lastUptimeLog = currentMillis;
-    Serial.printf("[UPTIME] Runtime: %s (total %.2f hours)\n",
-                  formatUptime(currentTotal).c_str(), currentTotal / 3600.0);
-    saveUptime();  // Save accumulated uptime every 10 minutes
+  const char *const *daysOfTheWeek = getDaysOfWeek(language);
+  const char *daySymbol = daysOfTheWeek[timeinfo.tm_wday];
+
+  // build base HH:MM first ---
+  char baseTime[9];
+  if (twelveHourToggle) {
+    int hour12 = timeinfo.tm_hour % 12;
+    if (hour12 == 0) hour12 = 12;
+    sprintf(baseTime, "%d:%02d", hour12, timeinfo.tm_min);
+  } else {
+    sprintf(baseTime, "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
+  }
+
+  // add seconds only if colon blink enabled AND weekday hidden ---
+  char timeWithSeconds[12];
+  if (!showDayOfWeek && colonBlinkEnabled) {
+    // Remove any leading space from baseTime
+    const char *trimmedBase = baseTime;
+    if (baseTime[0] == ' ') trimmedBase++;  // skip leading space
+    sprintf(timeWithSeconds, "%s:%02d", trimmedBase, timeinfo.tm_sec);
+  } else {
+    strcpy(timeWithSeconds, baseTime);  // no seconds
+  }
+
+  // keep spacing logic the same ---
+  char timeSpacedStr[24];
+  int j = 0;
+  for (int i = 0; timeWithSeconds[i] != '\0'; i++) {
+    timeSpacedStr[j++] = timeWithSeconds[i];
+    if (timeWithSeconds[i + 1] != '\0') {
+      timeSpacedStr[j++] = ' ';
+    }
+  }
+  timeSpacedStr[j] = '\0';
+
+  // build final string ---
+  String formattedTime;
+  if (showDayOfWeek) {
+    formattedTime = String(daySymbol) + "   " + String(timeSpacedStr);
+  } else {
+    formattedTime = String(timeSpacedStr);
+  }
+
+  // --- leaving clock mode ---
+  if (displayMode != 0 && prevDisplayMode == 0) {
+    clockScrollDone = false;  // reset for next time we enter clock
+  }
+
+  static const LoopSection modeSections[DISPLAY_MODE_COUNT] = {
+    SECTION_CLOCK_RENDER, SECTION_WEATHER_RENDER, SECTION_DESCRIPTION_RENDER, SECTION_COUNTDOWN_RENDER,
+    SECTION_NIGHTSCOUT_RENDER, SECTION_DATE_RENDER, SECTION_MESSAGE_RENDER
+  };
+  int renderMode = displayMode;  // the renderer may advance displayMode
+  unsigned long renderStart = micros();
+
+  switch (displayMode) {
+    case 0:
+      renderClockMode(formattedTime);
+      break;
+    case 1:
+      renderWeatherMode(formattedTime);
+      break;
+    case 2:
+      if (showWeatherDescription && weatherAvailable && weatherDescription.length() > 0) {
+        renderDescriptionMode();
+      }
+      break;
+    case 3:
+      if (countdownEnabled && ntpSyncSuccessful) {
+        renderCountdownMode(now_time);
+      }
+      break;
+    case 4:
+      renderNightscoutMode();
+      break;
+    case 5:
+      if (showDate) {
+        renderDateMode(timeinfo);
+      }
+      break;
+    case 6:
+      renderCustomMessageMode();
+      break;
+  }
+
+  if (renderMode >= 0 && renderMode < DISPLAY_MODE_COUNT) {
+    recordLoopSection(modeSections[renderMode], micros() - renderStart);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Cooperative Task Scheduler
+// -----------------------------------------------------------------------------
+typedef void (*TaskTickFn)();
+
+struct LoopTask {
+  const char *name;
+  TaskTickFn tick;
+  LoopSection section;       // histogram the tick time is recorded in
+  unsigned long intervalMs;  // 0 = every loop() pass
+  unsigned long lastRunMs;
+  unsigned long overruns;    // ticks longer than LOOP_TICK_BUDGET_US
+};
+
+const unsigned long LOOP_TICK_BUDGET_US = 5000;  // 5 ms per tick
+
+LoopTask loopTasks[] = {
+  { "config_apply", tickConfigApply, SECTION_CONFIG_APPLY, 0, 0, 0 },
+  { "dimming", tickDimming, SECTION_DIMMING, 0, 0, 0 },
+  { "countdown", tickCountdownTrigger, SECTION_COUNTDOWN_TRIGGER, 0, 0, 0 },
+  { "ntp", tickNtp, SECTION_NTP, 0, 0, 0 },
+  { "weather", tickWeather, SECTION_WEATHER_FETCH, 0, 0, 0 },
+  { "nightscout", tickNightscout, SECTION_NIGHTSCOUT_POLL, 0, 0, 0 },
+  { "display", tickDisplay, SECTION_DISPLAY, 0, 0, 0 },
+  { "uptime", tickUptime, SECTION_UPTIME, 1000, 0, 0 },
+  { "config", tickConfigFlush, SECTION_CONFIG_FLUSH, 500, 0, 0 },
+  { "events", tickEvents, SECTION_EVENTS, 250, 0, 0 },
+};
+const size_t LOOP_TASK_COUNT = sizeof(loopTasks) / sizeof(loopTasks[0]);
+
+
+void recordLoopSection(LoopSection section, unsigned long us) {
+  LoopSectionStats &stats = loopSectionStats[section];
+  stats.count++;
+  stats.totalUs += us;
+  if (us > stats.maxUs) stats.maxUs = us;
+
+  int bucket = 0;
+  while (bucket < LOOP_HIST_BUCKETS - 1 && us >= LOOP_HIST_BOUNDS_US[bucket]) bucket++;
+  stats.buckets[bucket]++;
+}
+
+// Tracks whole passes against LOOP_PASS_BUDGET_US, remembering the worst one
+// and the task that took the biggest share of it
+void recordLoopPass(unsigned long passUs, const char *heaviestTask, unsigned long heaviestUs) {
+  static unsigned long lastOverrunLog = 0;
+  if (passUs > loopPassStats.worstUs) {
+    loopPassStats.worstUs = passUs;
+    loopPassStats.worstTask = heaviestTask;
+    loopPassStats.worstTaskUs = heaviestUs;
+  }
+  if (passUs <= LOOP_PASS_BUDGET_US) return;
+  loopPassStats.overruns++;
+  if (millis() - lastOverrunLog > 1000) {
+    lastOverrunLog = millis();
+    Serial.printf("[TASK] loop pass took %lu us (budget %lu us, %lu overruns), heaviest '%s' %lu us\n",
+                  passUs, LOOP_PASS_BUDGET_US, (unsigned long)loopPassStats.overruns, heaviestTask, heaviestUs);
+  }
+}
+
+void runLoopTasks() {
+  static unsigned long lastOverrunLog = 0;
+  unsigned long passStart = micros();
+  const char *heaviestTask = "";
+  unsigned long heaviestUs = 0;
+
+  for (size_t i = 0; i < LOOP_TASK_COUNT; i++) {
+    LoopTask &task = loopTasks[i];
+    unsigned long nowMs = millis();
+    if (task.intervalMs > 0 && nowMs - task.lastRunMs < task.intervalMs) continue;
+    task.lastRunMs = nowMs;
+
+    unsigned long tickStart = micros();
+    task.tick();
+    unsigned long tickUs = micros() - tickStart;
+
+    recordLoopSection(task.section, tickUs);
+    if (tickUs > heaviestUs) {
+      heaviestUs = tickUs;
+      heaviestTask = task.name;
+    }
+    if (tickUs > LOOP_TICK_BUDGET_US) {
+      task.overruns++;
+      if (millis() - lastOverrunLog > 1000) {
+        lastOverrunLog = millis();
+        Serial.printf("[TASK] '%s' tick took %lu us (budget %lu us, %lu overruns)\n",
+                      task.name, tickUs, LOOP_TICK_BUDGET_US, task.overruns);
+      }
+    }
+    yield();
+  }
+
+  unsigned long passUs = micros() - passStart;
+  recordLoopSection(SECTION_LOOP_PASS, passUs);
+  recordLoopPass(passUs, heaviestTask, heaviestUs);
+}
+
+
+void loop() {
+  if (isAPMode) {
+    dnsServer.processNextRequest();
+    // AP Mode animation
+    static unsigned long apAnimTimer = 0;
+    static int apAnimFrame = 0;
+    unsigned long now = millis();
+    if (now - apAnimTimer > 750) {
+      apAnimTimer = now;
+      apAnimFrame++;
+    }
+    renderSetTextAlignment(PA_CENTER);
+    switch (apAnimFrame % 3) {
+      case 0: renderPrint(F("= ©")); break;
+      case 1: renderPrint(F("= ª")); break;
+      case 2: renderPrint(F("= «")); break;
+    }
+    yield();
+    return;
   }
+
+  runLoopTasks();
   yield();
 }
\ No newline at end of file
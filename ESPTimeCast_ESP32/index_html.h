@@ -1,7 +1,7 @@
 #pragma once
 // index_html.h
 
-const char index_html[] PROGMEM = R"rawliteral(
+constexpr char index_html[] PROGMEM = R"rawliteral(
 <!doctype html>
 <html lang="en">
   <head>
@@ -1216,6 +1216,14 @@ opacity: 0.5;
                 </span>
               </label>
             </div>
+
+            <label for="displayOrder">Display Order:</label>
+            <input
+              type="text"
+              name="displayOrder"
+              id="displayOrder"
+              placeholder="clock,date,weather,description,countdown,nightscout,message"
+            />
           </div>
         </div>
 
@@ -1460,6 +1468,15 @@ opacity: 0.5;
               </span><br><br>
               <span>Uptime: 
                 <span id="uptimeDisplay">Loading...</span>
+              </span><br><br>
+              <span>Showing: 
+                <span id="liveMode">-</span>
+              </span><br><br>
+              <span>Time sync: 
+                <span id="ntpStatus">-</span>
+              </span><br><br>
+              <span>Weather: 
+                <span id="liveWeather">-</span>
               </span>
             </div>
           </div>
@@ -1595,6 +1612,8 @@ opacity: 0.5;
             document.getElementById("showDayOfWeek").checked =
               !!data.showDayOfWeek;
             document.getElementById("showDate").checked = !!data.showDate;
+            document.getElementById("displayOrder").value =
+              data.displayOrder || "";
             document.getElementById("showHumidity").checked =
               !!data.showHumidity;
             document.getElementById("colonBlinkEnabled").checked =
@@ -1984,12 +2003,14 @@ opacity: 0.5;
             } else {
               showSavingModal("");
               updateSavingModal(
-                "✅ Configuration saved successfully.<br><br>Device will reboot",
+                json.restart
+                  ? "✅ Configuration saved successfully.<br><br>Device will reboot"
+                  : "✅ Configuration saved and applied.",
                 false,
               );
               setTimeout(
                 () => (location.href = location.href.split("#")[0]),
-                3000,
+                json.restart ? 3000 : 1500,
               );
             }
           })
@@ -2523,16 +2544,20 @@ opacity: 0.5;
             if (versionEl) {
               versionEl.textContent = "v" + data.version;
             }
-            // Restart local increment timer
-            if (uptimeTimer) clearInterval(uptimeTimer);
-            uptimeTimer = setInterval(() => {
-              uptimeSeconds++;
-              updateUptimeDisplay();
-            }, 1000);
+            startUptimeTicker();
           })
           .catch((err) => console.error("Error fetching /uptime:", err));
       }
 
+      // Count seconds locally between updates from the device
+      function startUptimeTicker() {
+        if (uptimeTimer) clearInterval(uptimeTimer);
+        uptimeTimer = setInterval(() => {
+          uptimeSeconds++;
+          updateUptimeDisplay();
+        }, 1000);
+      }
+
       // Format seconds → "2 days 04:09:31", "1 day 03:05:12", or "03:05:12"
       function formatUptime(seconds) {
         const days = Math.floor(seconds / 86400);
@@ -2553,8 +2578,68 @@ opacity: 0.5;
           formatUptime(uptimeSeconds);
       }
 
+      // --- Live device state ---
+      // One long-lived /events connection replaces polling; browsers without
+      // EventSource fall back to a single /uptime fetch.
+      function setText(id, text) {
+        const el = document.getElementById(id);
+        if (el) el.textContent = text;
+      }
+
+      function connectLiveEvents() {
+        if (!window.EventSource) {
+          fetchUptime();
+          return;
+        }
+        const source = new EventSource("/events");
+
+        source.addEventListener("uptime", (e) => {
+          const data = JSON.parse(e.data);
+          uptimeSeconds = data.uptime_seconds || 0;
+          updateUptimeDisplay();
+          setText("fwVersion", "v" + data.version);
+          startUptimeTicker();
+        });
+
+        source.addEventListener("mode", (e) => {
+          setText("liveMode", JSON.parse(e.data).name);
+        });
+
+        source.addEventListener("ntp", (e) => {
+          const labels = {
+            idle: "Idle",
+            syncing: "Syncing...",
+            synced: "Synced",
+            failed: "Failed, will retry",
+          };
+          setText("ntpStatus", labels[JSON.parse(e.data).state] || "-");
+        });
+
+        source.addEventListener("weather", (e) => {
+          const w = JSON.parse(e.data);
+          if (!w.available) {
+            setText("liveWeather", "Not available");
+            return;
+          }
+          let text = w.temp + "°";
+          if (w.humidity >= 0) text += ", " + w.humidity + "%";
+          if (w.description) text += ", " + w.description;
+          setText("liveWeather", text);
+        });
+
+        // Brightness changed elsewhere (e.g. Home Assistant): follow it,
+        // unless the slider is being dragged right now
+        source.addEventListener("brightness", (e) => {
+          const b = JSON.parse(e.data);
+          const slider = document.getElementById("brightnessSlider");
+          if (!slider || document.activeElement === slider) return;
+          slider.value = b.brightness;
+          setText("brightnessValue", b.brightness == -1 ? "Off" : b.brightness);
+        });
+      }
+
       // Start it up
-      fetchUptime();
+      connectLiveEvents();
 
       function sendCustomMessage() {
         const input = document.getElementById("customMessage");
@@ -2855,4 +2940,15 @@ opacity: 0.5;
     </script>
   </body>
 </html>
-)rawliteral";
\ No newline at end of file
+)rawliteral";
+
+constexpr size_t INDEX_HTML_LEN = sizeof(index_html) - 1;
+
+// FNV-1a of the page, worked out by the compiler: a content version that
+// changes with every UI edit, used as the ETag
+constexpr uint32_t fnv1a32(const char *s, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; i++) h = (h ^ (uint8_t)s[i]) * 16777619u;
+  return h;
+}
+constexpr uint32_t INDEX_HTML_HASH = fnv1a32(index_html, INDEX_HTML_LEN);
\ No newline at end of file
@@ -0,0 +1,1270 @@
+#pragma once
+// index_html_gz.h
+// Generated by tools/gen_index_html_gz.py from index_html.h, do not edit.
+
+#define INDEX_HTML_GZ_SOURCE_HASH 0x84c53a5du  // INDEX_HTML_HASH of the page it was built from
+
+const uint8_t index_html_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0xbd, 0xdb, 0x92, 0x1b, 0x47,
+  0x92, 0x20, 0xfa, 0x5e, 0x5f, 0x11, 0x84, 0xd4, 0x12, 0xd0, 0x02, 0x50, 0x00, 0xea, 0x8e, 0x62,
+  0x51, 0x43, 0x15, 0xc9, 0x66, 0xb5, 0x78, 0x33, 0x16, 0x29, 0x8d, 0x5a, 0xdd, 0x87, 0x4a, 0x20,
+  0x03, 0x85, 0xec, 0x4a, 0x64, 0xa2, 0x33, 0x13, 0x55, 0x2c, 0x71, 0x68, 0x36, 0x0f, 0x3b, 0xfb,
+  0xb4, 0x66, 0x6b, 0xb6, 0xbb, 0x2f, 0xe7, 0xd8, 0x1e, 0xb3, 0x63, 0xe7, 0x0b, 0xe6, 0xf1, 0xd8,
+  0x3e, 0xce, 0xa7, 0xe8, 0x07, 0xf6, 0x17, 0x8e, 0x7b, 0x5c, 0x32, 0xe3, 0x96, 0x17, 0x54, 0x15,
+  0x29, 0xaa, 0x67, 0x5a, 0xad, 0x12, 0x32, 0x33, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xdd,
+  0xc3, 0x63, 0xe3, 0xee, 0x1d, 0x3f, 0x9e, 0x66, 0x57, 0x4b, 0x4a, 0xe6, 0xd9, 0x22, 0xbc, 0xb7,
+  0x71, 0x17, 0xff, 0x43, 0x42, 0x2f, 0x3a, 0x3b, 0x6a, 0xd1, 0xa8, 0x75, 0x6f, 0x83, 0x90, 0xbb,
+  0x73, 0xea, 0xf9, 0xf8, 0x03, 0x7e, 0x2e, 0x68, 0xe6, 0x91, 0xe9, 0xdc, 0x4b, 0x52, 0x9a, 0x1d,
+  0xb5, 0x5e, 0xbf, 0x7a, 0xd4, 0xdb, 0x6f, 0x91, 0x4d, 0xf5, 0x63, 0xe4, 0x2d, 0xe8, 0x51, 0xeb,
+  0x22, 0xa0, 0x97, 0xcb, 0x38, 0xc9, 0x5a, 0x64, 0x1a, 0x47, 0x19, 0x8d, 0xa0, 0xf0, 0x65, 0xe0,
+  0x67, 0xf3, 0x23, 0x9f, 0x5e, 0x04, 0x53, 0xda, 0x63, 0x0f, 0x5d, 0x12, 0x44, 0x41, 0x16, 0x78,
+  0x61, 0x2f, 0x9d, 0x7a, 0x21, 0x3d, 0x1a, 0xea, 0xa0, 0xd8, 0x2f, 0x02, 0x78, 0x65, 0xcb, 0x1e,
+  0xfd, 0xdb, 0x2a, 0xb8, 0x38, 0x6a, 0x1d, 0x7b, 0xd3, 0x39, 0xed, 0x1d, 0x03, 0xc8, 0x24, 0x0e,
+  0x5b, 0xa2, 0x40, 0xde, 0x42, 0x14, 0xf7, 0xa6, 0x58, 0xa0, 0x4b, 0xe0, 0x57, 0x9a, 0xc5, 0x09,
+  0xfc, 0x5a, 0xac, 0xd2, 0xac, 0x97, 0xd0, 0x0b, 0x2f, 0x0c, 0x7c, 0x2f, 0xa3, 0xbc, 0x8e, 0x86,
+  0xb0, 0x0a, 0xff, 0x45, 0xe2, 0x9d, 0x2d, 0xbc, 0x96, 0x0d, 0xb2, 0x55, 0x5e, 0xe7, 0xe1, 0xdb,
+  0x65, 0x90, 0xd0, 0x54, 0xa9, 0x34, 0x28, 0x4a, 0x67, 0x41, 0x16, 0xd2, 0x7b, 0x0f, 0x4f, 0x5f,
+  0xbc, 0x0a, 0x16, 0xf4, 0xd8, 0x4b, 0x33, 0x72, 0x4a, 0xb3, 0x2c, 0x88, 0xce, 0xd2, 0xbb, 0x9b,
+  0xfc, 0x1b, 0x2f, 0x97, 0x66, 0x57, 0xf2, 0x37, 0x21, 0xe3, 0x24, 0x8e, 0x33, 0xf2, 0x4e, 0x3c,
+  0x11, 0xd2, 0xeb, 0x4d, 0xce, 0x7a, 0x67, 0x89, 0xe7, 0x07, 0x00, 0x7e, 0x4c, 0xc2, 0x20, 0xa2,
+  0x5e, 0x92, 0xbf, 0x68, 0xe7, 0xe5, 0x08, 0x19, 0x6e, 0xed, 0xf8, 0xf4, 0xac, 0xab, 0xbc, 0xf9,
+  0x6c, 0xb0, 0x3f, 0x9c, 0xed, 0xec, 0x92, 0xc1, 0xef, 0xb4, 0xb7, 0xc3, 0xe1, 0x60, 0x36, 0xa2,
+  0x64, 0xc7, 0x78, 0xbd, 0xbd, 0x3d, 0xf4, 0x76, 0x77, 0xc8, 0x70, 0x30, 0xf8, 0x5d, 0xfe, 0xba,
+  0x73, 0xa8, 0x20, 0xe2, 0x4d, 0xa7, 0xd0, 0x64, 0x6f, 0x1a, 0x87, 0x71, 0x32, 0x06, 0xe0, 0xd4,
+  0xdb, 0xa1, 0x07, 0x6a, 0x81, 0xb3, 0xd0, 0x4b, 0x53, 0xc0, 0x77, 0x4c, 0x92, 0xb3, 0x89, 0xd7,
+  0x1e, 0xed, 0xec, 0x74, 0x49, 0xf1, 0x67, 0xd0, 0x1f, 0x6c, 0x77, 0x1c, 0xc5, 0xe3, 0xc4, 0xa7,
+  0x49, 0x59, 0x95, 0xe1, 0x28, 0xaf, 0xf2, 0x7e, 0x43, 0xfc, 0xe8, 0xa7, 0x69, 0xe0, 0xf7, 0x2e,
+  0x13, 0x6f, 0xb9, 0xa4, 0x89, 0x42, 0xaa, 0x65, 0x9c, 0x02, 0x47, 0xc5, 0x11, 0xc0, 0xa2, 0xa1,
+  0x97, 0x05, 0x17, 0xd4, 0xae, 0x3a, 0x8d, 0x17, 0x13, 0x18, 0x56, 0x18, 0x2d, 0x0f, 0x28, 0xa9,
+  0xd6, 0xf6, 0x83, 0x74, 0x19, 0x7a, 0x57, 0x63, 0x32, 0x0b, 0xe9, 0xdb, 0x02, 0xcd, 0x49, 0xfc,
+  0xb6, 0x97, 0x06, 0x3f, 0xc3, 0xa8, 0x8d, 0x09, 0x47, 0x15, 0x30, 0x56, 0xbe, 0x33, 0x66, 0x1e,
+  0x33, 0xaa, 0xa9, 0x95, 0x78, 0x9f, 0x86, 0xfd, 0x9d, 0xe5, 0x5b, 0x92, 0xc6, 0xc0, 0x7f, 0xbc,
+  0x7f, 0xc3, 0xfd, 0x01, 0x74, 0x6d, 0x6b, 0x50, 0x90, 0x64, 0xbf, 0x63, 0x56, 0xeb, 0xe1, 0xd8,
+  0xae, 0xd2, 0x31, 0xd9, 0x5f, 0xaa, 0x78, 0x78, 0xd3, 0xf3, 0xb3, 0x24, 0x5e, 0x45, 0xbe, 0x1c,
+  0x00, 0x4e, 0xb0, 0x11, 0xd2, 0x6a, 0x5b, 0xa1, 0xf1, 0x9e, 0x02, 0x50, 0x0e, 0xd5, 0x8c, 0xfd,
+  0xaf, 0x78, 0x3f, 0x83, 0xfe, 0x63, 0xaf, 0x28, 0xa0, 0x98, 0xd0, 0x45, 0xf1, 0x01, 0x49, 0xea,
+  0x25, 0x5e, 0x34, 0x85, 0x2f, 0x51, 0x1c, 0xd9, 0x04, 0xfc, 0x0c, 0x69, 0xaf, 0x50, 0xcd, 0x46,
+  0x99, 0x0c, 0xe0, 0x1f, 0x0d, 0x75, 0x24, 0x28, 0x34, 0x64, 0x93, 0x47, 0x6d, 0x81, 0x90, 0x78,
+  0x95, 0x21, 0x77, 0x9b, 0xaf, 0x8b, 0x8e, 0x8f, 0x49, 0x06, 0xa8, 0xa5, 0x4b, 0x2f, 0x01, 0x36,
+  0xb4, 0x87, 0x36, 0x80, 0x51, 0xed, 0x4d, 0xb2, 0x48, 0xc1, 0x4e, 0x0c, 0xce, 0xf6, 0x40, 0xa3,
+  0xa4, 0xb3, 0x75, 0xb5, 0x19, 0xfd, 0xcb, 0x74, 0x95, 0xa4, 0x48, 0xc5, 0x65, 0x1c, 0xc0, 0x1c,
+  0x4f, 0x0e, 0xeb, 0x38, 0x06, 0xa4, 0xcd, 0x59, 0xd4, 0x0b, 0x32, 0xba, 0x00, 0x82, 0xe0, 0x8c,
+  0x51, 0xeb, 0xfc, 0x15, 0x44, 0x52, 0x30, 0xbb, 0xea, 0x09, 0x79, 0x61, 0x17, 0x90, 0x43, 0xb6,
+  0xbb, 0xbb, 0x5b, 0xbc, 0x64, 0xfd, 0x16, 0xbc, 0x5d, 0x20, 0x0a, 0xa3, 0x3d, 0x4a, 0xed, 0x11,
+  0xf2, 0x92, 0x24, 0xbe, 0xfc, 0x46, 0xa3, 0x43, 0x0d, 0x0d, 0xcb, 0x68, 0x52, 0x41, 0xbe, 0x5e,
+  0x48, 0x67, 0xd9, 0x9a, 0x0c, 0xee, 0x40, 0xf1, 0x1e, 0x49, 0x2f, 0xce, 0x1a, 0x4d, 0x61, 0x20,
+  0x42, 0xbc, 0x1c, 0x93, 0x91, 0xc6, 0x58, 0x41, 0x98, 0x21, 0xd6, 0x41, 0x74, 0x41, 0x93, 0xac,
+  0x3d, 0x50, 0x38, 0x3f, 0x5e, 0x7a, 0xd3, 0x20, 0xbb, 0x52, 0xd8, 0xce, 0x6e, 0x7d, 0x0c, 0x03,
+  0xe8, 0x4d, 0x42, 0xea, 0xdf, 0x10, 0x8d, 0xbc, 0x2d, 0x18, 0x8f, 0x9d, 0x8a, 0xe6, 0xe6, 0xf1,
+  0x85, 0x26, 0x71, 0xd8, 0x48, 0xcc, 0xe2, 0x64, 0x21, 0x06, 0x05, 0x5a, 0xa2, 0x3f, 0xb4, 0x7b,
+  0xc3, 0xe5, 0xdb, 0x8e, 0x21, 0x7f, 0xe6, 0x9e, 0x1f, 0x5f, 0x02, 0x7c, 0xb2, 0x0b, 0xd4, 0x1e,
+  0xe2, 0x1f, 0x46, 0x6c, 0xa0, 0xf2, 0x70, 0x34, 0xca, 0x49, 0xbd, 0xb5, 0xd3, 0x69, 0xd0, 0xd9,
+  0x86, 0x68, 0x0c, 0x4a, 0xb1, 0x70, 0xcb, 0x05, 0x9b, 0xa8, 0xef, 0xac, 0x19, 0x14, 0xc5, 0x59,
+  0xcf, 0x0b, 0xc3, 0xf8, 0x92, 0xfa, 0x8d, 0x26, 0x9e, 0x2a, 0xe7, 0xcc, 0x85, 0x61, 0xe4, 0xea,
+  0x2c, 0xa8, 0x12, 0x91, 0xc1, 0xf9, 0xba, 0x7c, 0x62, 0x92, 0x89, 0x4b, 0x29, 0x8b, 0xcd, 0xf7,
+  0x76, 0xd4, 0x41, 0x5d, 0x7a, 0xbe, 0xcf, 0x84, 0xbe, 0x52, 0x30, 0xa3, 0x6f, 0xb1, 0x03, 0x30,
+  0xbd, 0xed, 0x79, 0xcb, 0x67, 0x7d, 0x4a, 0xc3, 0xd9, 0x98, 0x78, 0xab, 0x2c, 0x2e, 0x97, 0x4f,
+  0xd6, 0x00, 0xa8, 0x14, 0xf8, 0x6c, 0xb6, 0x83, 0xff, 0x14, 0xb5, 0xf5, 0x9e, 0xb9, 0xa8, 0xab,
+  0x56, 0x77, 0xd3, 0x6a, 0xa7, 0x63, 0x4b, 0xb3, 0x4b, 0x2f, 0xb0, 0x65, 0xe8, 0xe6, 0xef, 0xc9,
+  0xab, 0x39, 0x25, 0x0f, 0x92, 0x78, 0x09, 0x43, 0x1d, 0x91, 0xa7, 0x34, 0x5a, 0x91, 0xdf, 0x6f,
+  0xaa, 0xb2, 0xff, 0x49, 0x90, 0x66, 0xce, 0x99, 0xe2, 0x4d, 0x40, 0x0c, 0xac, 0x32, 0x5a, 0xb3,
+  0x34, 0x2e, 0xbc, 0xb7, 0xbd, 0x39, 0x0d, 0xce, 0xe6, 0x20, 0x3d, 0x76, 0x06, 0x17, 0x73, 0x65,
+  0x1a, 0x01, 0x55, 0x66, 0xc0, 0x1c, 0xbd, 0x2b, 0x9d, 0x82, 0x7a, 0x0f, 0x2f, 0xe7, 0x81, 0xda,
+  0x46, 0xbe, 0xd2, 0xe6, 0x62, 0xe8, 0xc2, 0x4b, 0xda, 0x3d, 0xa1, 0x55, 0xf0, 0xa5, 0xb2, 0x7c,
+  0x85, 0xdd, 0x55, 0x47, 0x3c, 0x17, 0xe7, 0x3a, 0x17, 0xfe, 0xdc, 0x0b, 0x22, 0x9f, 0x2d, 0x60,
+  0x83, 0xc1, 0xa0, 0x6c, 0x5e, 0x0e, 0x07, 0x38, 0x31, 0x51, 0x16, 0xf6, 0xb6, 0x94, 0xd9, 0x29,
+  0xfe, 0xdf, 0x1f, 0x96, 0x29, 0x31, 0xf1, 0x12, 0x89, 0xa7, 0xd2, 0x53, 0xb2, 0x1d, 0x87, 0xa8,
+  0xc9, 0x99, 0xd2, 0x85, 0x48, 0x4c, 0x94, 0x49, 0x08, 0x74, 0xaa, 0x6c, 0xa8, 0x82, 0xf5, 0xa4,
+  0x56, 0xc1, 0xc9, 0xa7, 0xaa, 0x7a, 0xb6, 0x3e, 0xa1, 0x8d, 0x41, 0xde, 0xd0, 0xef, 0xb5, 0x69,
+  0x57, 0xa5, 0x35, 0xe5, 0x55, 0xd8, 0x7e, 0xc3, 0xcd, 0xc9, 0x62, 0x18, 0x0b, 0xdd, 0x57, 0x41,
+  0x43, 0xf2, 0x8f, 0xa1, 0x74, 0x15, 0x7d, 0xf1, 0xb2, 0x0c, 0x14, 0xf7, 0x05, 0x5b, 0x60, 0x67,
+  0xc1, 0xdb, 0x42, 0xdc, 0xe4, 0x2d, 0x4f, 0x62, 0xff, 0x4a, 0x69, 0x99, 0x29, 0x44, 0x33, 0x6f,
+  0x11, 0x84, 0x30, 0xfe, 0x2f, 0xe3, 0x49, 0x9c, 0xc5, 0x5d, 0x92, 0x5e, 0xa5, 0xb0, 0x88, 0xf7,
+  0x56, 0x81, 0xca, 0xbd, 0xc9, 0x59, 0x10, 0x69, 0x42, 0x21, 0x1f, 0xb1, 0x11, 0x68, 0x52, 0x86,
+  0x3a, 0x55, 0xa6, 0x7f, 0x29, 0xa8, 0x26, 0x14, 0x34, 0xae, 0x0c, 0x99, 0x4e, 0xfc, 0xec, 0x12,
+  0xfd, 0xbf, 0xae, 0x75, 0xc6, 0xad, 0x19, 0x88, 0xef, 0xc0, 0x6f, 0xbb, 0x29, 0x30, 0xcb, 0x24,
+  0x98, 0xf6, 0x26, 0xf4, 0xe7, 0x80, 0x26, 0xed, 0x41, 0x7f, 0x5b, 0x70, 0x22, 0xac, 0x16, 0x43,
+  0x85, 0x92, 0x17, 0x41, 0x1a, 0x4c, 0x82, 0x90, 0x41, 0x9d, 0x07, 0xbe, 0x4f, 0xa3, 0x3a, 0x2a,
+  0xa3, 0x8a, 0x96, 0x4f, 0x60, 0x58, 0xfe, 0x15, 0x85, 0xfe, 0x92, 0x4e, 0xce, 0x03, 0x20, 0x23,
+  0x53, 0x2e, 0x17, 0xb0, 0x8d, 0x99, 0x33, 0xba, 0x78, 0x11, 0x6e, 0xf3, 0x02, 0x2f, 0x55, 0xa5,
+  0x7e, 0x6f, 0x11, 0xff, 0xdc, 0x8b, 0xd3, 0xb7, 0x56, 0x69, 0x18, 0xee, 0x2b, 0xb6, 0x23, 0x74,
+  0x0e, 0x59, 0x3f, 0x8c, 0x3d, 0x5f, 0x93, 0x7e, 0x6a, 0x0f, 0xd8, 0xef, 0x90, 0x36, 0xd2, 0x02,
+  0x18, 0xb4, 0x45, 0xec, 0xc3, 0x06, 0x34, 0x5e, 0x52, 0x75, 0x0a, 0x4a, 0x39, 0x64, 0x52, 0xa4,
+  0xe0, 0xda, 0xa1, 0xba, 0x7a, 0x56, 0xac, 0x09, 0xaa, 0x9a, 0xdd, 0xdf, 0xd1, 0x38, 0x83, 0x33,
+  0x12, 0x4c, 0x8a, 0x2c, 0x8b, 0x17, 0xf6, 0x67, 0x37, 0xe3, 0x14, 0x18, 0x8c, 0x14, 0x0c, 0x04,
+  0x28, 0xa6, 0x97, 0x6c, 0x57, 0x35, 0x32, 0xb0, 0xe0, 0xb0, 0x55, 0x7f, 0x16, 0x24, 0xb0, 0x4d,
+  0x8e, 0x67, 0x3d, 0x66, 0x09, 0xb8, 0x07, 0xc0, 0xf5, 0x57, 0xee, 0x96, 0x74, 0x8c, 0x0b, 0x69,
+  0x13, 0xc6, 0x67, 0x71, 0xed, 0xa6, 0xaa, 0x46, 0x0b, 0xd6, 0xa1, 0x19, 0xba, 0x99, 0x54, 0xfa,
+  0x7c, 0x58, 0xa4, 0x84, 0x04, 0x46, 0x65, 0x85, 0xa0, 0xf0, 0x65, 0x42, 0x93, 0x89, 0xc1, 0x8e,
+  0xb5, 0x0c, 0x1d, 0xa8, 0x5c, 0x2c, 0x19, 0x58, 0x5f, 0x67, 0xf2, 0xd9, 0xcd, 0xfa, 0x56, 0x42,
+  0xaf, 0x4a, 0x79, 0x25, 0x77, 0xc0, 0x9d, 0xfa, 0x15, 0x4a, 0xdd, 0xfd, 0x76, 0x6a, 0x37, 0x15,
+  0xf8, 0xd4, 0xf3, 0x83, 0x84, 0x4e, 0xf9, 0x5c, 0x07, 0x06, 0x59, 0x2d, 0x22, 0x7d, 0x59, 0x15,
+  0x1d, 0xdd, 0x19, 0x68, 0xfa, 0x7a, 0xde, 0x29, 0xa3, 0xb3, 0xc5, 0x4a, 0xc3, 0x7b, 0x2b, 0xfe,
+  0x33, 0x52, 0x9f, 0x4a, 0x17, 0xce, 0xd1, 0xf6, 0xf2, 0xad, 0x73, 0x2d, 0x54, 0x0c, 0x0a, 0x62,
+  0x55, 0xdc, 0xda, 0x65, 0x7b, 0x42, 0xb6, 0x24, 0x6e, 0xa3, 0xc6, 0xba, 0x57, 0x6c, 0x0e, 0x86,
+  0xc3, 0x4e, 0x57, 0xab, 0x31, 0x92, 0xda, 0x99, 0x28, 0x0f, 0x62, 0x0b, 0x8b, 0x0f, 0x87, 0x83,
+  0xb2, 0xbd, 0x44, 0xe8, 0x4d, 0x68, 0x68, 0x4a, 0x72, 0x3e, 0xe7, 0x06, 0xfd, 0x03, 0xad, 0x0f,
+  0x39, 0x69, 0x27, 0x61, 0x5c, 0x2c, 0x94, 0x3a, 0x5b, 0x0f, 0xfa, 0x7b, 0x4e, 0xbe, 0x0e, 0xa2,
+  0xe5, 0x2a, 0xfb, 0x11, 0xa7, 0xc3, 0x51, 0x0b, 0xa7, 0x7c, 0xeb, 0x2f, 0x5d, 0xd7, 0x97, 0x60,
+  0x41, 0xdd, 0x5f, 0x96, 0x30, 0xd8, 0x97, 0x40, 0x43, 0xf7, 0x57, 0x66, 0x9d, 0x72, 0x7e, 0x89,
+  0x56, 0x8b, 0x09, 0x4d, 0x8a, 0x6f, 0xa0, 0x60, 0x02, 0x0b, 0xd8, 0x5b, 0x5c, 0x5d, 0x48, 0x17,
+  0xca, 0xab, 0xde, 0x9d, 0xbf, 0x67, 0xcb, 0x84, 0x3d, 0x0e, 0xb9, 0xb2, 0xdc, 0x2d, 0x1d, 0xc4,
+  0xca, 0x22, 0x92, 0xf6, 0x95, 0x85, 0xf8, 0xd0, 0x39, 0x77, 0x3d, 0xeb, 0x6e, 0x5f, 0x54, 0xb0,
+  0xe9, 0x6a, 0xb2, 0x08, 0x00, 0xc1, 0xdb, 0xd5, 0xd5, 0x2a, 0xe8, 0x5b, 0x62, 0x15, 0xd1, 0xc7,
+  0xfd, 0xe0, 0xe0, 0xa0, 0x91, 0x42, 0xea, 0xb6, 0x57, 0x70, 0x14, 0x99, 0xd5, 0x82, 0x50, 0x50,
+  0x07, 0x40, 0xb1, 0xee, 0xc5, 0xab, 0xcc, 0xc9, 0xb6, 0x07, 0x5c, 0x08, 0xed, 0xd7, 0xcd, 0x45,
+  0x49, 0xa7, 0x9b, 0x6a, 0xb6, 0x72, 0x55, 0x99, 0x24, 0xb8, 0x30, 0x44, 0x34, 0x4d, 0xdb, 0xc3,
+  0xfe, 0xa8, 0xd3, 0x84, 0xcb, 0xc6, 0x52, 0xf1, 0x41, 0xad, 0x25, 0xf2, 0xbd, 0xa4, 0xb7, 0x0c,
+  0xa6, 0xe7, 0x40, 0x35, 0xd8, 0x37, 0x04, 0x53, 0x2f, 0x8b, 0x93, 0x0a, 0xbe, 0xa9, 0xaf, 0xec,
+  0x58, 0xfa, 0x84, 0xbd, 0x03, 0xe7, 0x7c, 0xc7, 0xb5, 0x87, 0x7b, 0x18, 0x71, 0x5e, 0xfc, 0x82,
+  0x4c, 0xe7, 0x14, 0xa0, 0xf9, 0x24, 0x8b, 0xcf, 0xce, 0x42, 0x5a, 0x6c, 0xe5, 0xfa, 0xfc, 0x45,
+  0x2f, 0xbd, 0x0c, 0xb2, 0xe9, 0x5c, 0x43, 0x8c, 0x55, 0x01, 0x89, 0x0e, 0xc8, 0xc9, 0xda, 0x5f,
+  0x15, 0xe5, 0x41, 0x5e, 0x5c, 0x9f, 0xcc, 0xc5, 0xba, 0xde, 0xa8, 0xf9, 0x7c, 0x4e, 0x99, 0xed,
+  0x8f, 0xc7, 0x13, 0x0a, 0x4b, 0x31, 0xad, 0xc4, 0x83, 0xcf, 0xbb, 0x01, 0xac, 0x20, 0xc5, 0x1f,
+  0x75, 0x2b, 0xac, 0x0f, 0x69, 0x3e, 0x0e, 0xb8, 0x48, 0x02, 0x9d, 0xc3, 0x6e, 0xe5, 0xd7, 0xf1,
+  0x2c, 0x9e, 0xae, 0xd2, 0x9a, 0x32, 0x55, 0xfb, 0xfc, 0x52, 0x11, 0x49, 0xee, 0x04, 0x0b, 0x74,
+  0x9e, 0x78, 0xaa, 0x79, 0x4e, 0x91, 0x96, 0xce, 0xef, 0xb2, 0x69, 0x7d, 0x53, 0x3a, 0x60, 0x4b,
+  0x30, 0x6a, 0x03, 0x15, 0xcd, 0x05, 0x51, 0x4a, 0x33, 0x27, 0xd0, 0x5b, 0x05, 0x26, 0x31, 0x64,
+  0xea, 0x32, 0x52, 0xa7, 0x57, 0xd7, 0xa7, 0x12, 0x9b, 0x27, 0x88, 0xa0, 0x03, 0x4d, 0x7c, 0x90,
+  0x41, 0x5a, 0x32, 0xa4, 0x63, 0x58, 0xed, 0xa7, 0x74, 0x1e, 0x87, 0xc0, 0x32, 0x72, 0xa8, 0xb0,
+  0x7d, 0x2f, 0xa1, 0x9e, 0xf6, 0xd1, 0x16, 0xda, 0xf3, 0xcb, 0x49, 0x9b, 0xf5, 0xf7, 0x77, 0x04,
+  0xfe, 0xbf, 0x89, 0xc6, 0xb5, 0x83, 0xce, 0x21, 0x9b, 0x5b, 0x6f, 0xbd, 0xc5, 0x32, 0xa4, 0xe8,
+  0x89, 0x01, 0x41, 0x01, 0xaa, 0xc4, 0x4a, 0x99, 0x56, 0xda, 0x8e, 0x03, 0x4b, 0x3f, 0xf5, 0xce,
+  0x29, 0x49, 0x57, 0xc0, 0xaa, 0x41, 0xf6, 0x65, 0x8a, 0x06, 0x30, 0x58, 0xc1, 0x17, 0x41, 0x4f,
+  0x31, 0xc2, 0x16, 0xb5, 0x8b, 0xe9, 0x81, 0x7a, 0x66, 0x2f, 0x89, 0x2f, 0xeb, 0xdd, 0x13, 0xd5,
+  0x7a, 0xa1, 0x0d, 0xb1, 0x9f, 0x5d, 0xa2, 0xfb, 0x43, 0xd3, 0x98, 0x6a, 0x40, 0x94, 0x41, 0xb8,
+  0x07, 0x38, 0x5d, 0x18, 0x70, 0xb4, 0x9d, 0x96, 0xa8, 0xb8, 0x4c, 0x02, 0xd0, 0xb0, 0xae, 0x7a,
+  0x93, 0x15, 0x6c, 0x43, 0xa2, 0x4a, 0xf5, 0x79, 0xad, 0xa5, 0xac, 0x7a, 0xb5, 0xa8, 0x58, 0xea,
+  0xd8, 0x87, 0x4b, 0xb1, 0x03, 0xd8, 0xd5, 0x8d, 0x3a, 0xb7, 0xb9, 0x08, 0x36, 0xb4, 0x16, 0x9a,
+  0xdf, 0x84, 0x46, 0x37, 0xc3, 0x45, 0x81, 0xef, 0x8f, 0x9c, 0x93, 0x42, 0xd1, 0x9b, 0x75, 0x97,
+  0xc0, 0x4e, 0xaa, 0xea, 0xd4, 0xb9, 0x75, 0x17, 0xd5, 0xed, 0x1d, 0xe7, 0xc2, 0x5b, 0x70, 0x89,
+  0x3e, 0x54, 0x1f, 0xd3, 0x60, 0xdd, 0x7c, 0x05, 0x36, 0x91, 0xf4, 0xa6, 0x68, 0x9f, 0x77, 0x63,
+  0xc9, 0x0c, 0x09, 0x6d, 0xe0, 0x8f, 0x3d, 0x07, 0x1c, 0x98, 0x8c, 0xb4, 0x6c, 0xe3, 0xb0, 0xaf,
+  0x6b, 0xcd, 0x55, 0x43, 0xa9, 0x6d, 0x8a, 0x5d, 0xea, 0xca, 0x67, 0xa9, 0x77, 0x01, 0x7c, 0xfa,
+  0x14, 0x6d, 0x0d, 0x4e, 0xcb, 0xa9, 0x66, 0xa1, 0x12, 0x0e, 0x06, 0x85, 0x29, 0xb9, 0xa7, 0x65,
+  0x50, 0x63, 0x57, 0x75, 0x5b, 0x6b, 0x4a, 0x6c, 0x9a, 0xb5, 0x5e, 0xa8, 0x4a, 0x1f, 0x56, 0x99,
+  0x45, 0xd4, 0x5c, 0xde, 0x14, 0x03, 0xe8, 0xb6, 0x3a, 0xd2, 0x25, 0xf5, 0xdd, 0xa6, 0xac, 0x2d,
+  0xce, 0xb2, 0x95, 0x54, 0x3d, 0xe6, 0xdd, 0xb8, 0xde, 0xce, 0xfc, 0xd3, 0xd9, 0xd3, 0x16, 0x7b,
+  0x75, 0x73, 0xf7, 0xad, 0xdb, 0x18, 0x47, 0xfd, 0xe6, 0xdc, 0xb9, 0xa6, 0xf5, 0x01, 0xe9, 0xc6,
+  0x0c, 0x2b, 0xf9, 0x6c, 0x0c, 0x57, 0x49, 0x1b, 0x0d, 0xdb, 0x2e, 0x0b, 0xf6, 0x32, 0x88, 0x74,
+  0x1f, 0xba, 0x6c, 0x6d, 0x5b, 0xdf, 0x5b, 0xda, 0xbb, 0x1f, 0x7b, 0x14, 0xb8, 0xf9, 0x2a, 0xaf,
+  0xf7, 0xd9, 0x60, 0xb0, 0xe7, 0x69, 0x26, 0x53, 0x7d, 0xb0, 0x76, 0x54, 0x2e, 0x17, 0x13, 0x62,
+  0x4b, 0x33, 0xe7, 0xcb, 0x09, 0xa1, 0xbf, 0xf5, 0x22, 0x10, 0x1e, 0x9c, 0xc7, 0x10, 0x7d, 0x32,
+  0x4c, 0x45, 0x48, 0x05, 0xe8, 0x0c, 0x33, 0x8c, 0x48, 0xa1, 0x65, 0x96, 0x13, 0xf7, 0xe4, 0x86,
+  0x65, 0x11, 0xc4, 0x48, 0x52, 0x2a, 0x47, 0x6e, 0x2c, 0x46, 0x34, 0xf7, 0xe2, 0xbe, 0xd5, 0xbe,
+  0x67, 0xeb, 0x2e, 0x6e, 0xeb, 0x7c, 0x3f, 0x5d, 0x78, 0x61, 0xe8, 0x52, 0x28, 0x0c, 0x6b, 0x48,
+  0x05, 0xfe, 0xba, 0xa1, 0x64, 0xe4, 0x34, 0x94, 0x08, 0x03, 0x85, 0xe5, 0xd8, 0xa8, 0xf6, 0x51,
+  0x9c, 0xd1, 0xb8, 0xa7, 0x6c, 0xa1, 0x95, 0x2e, 0x0b, 0x03, 0xb3, 0xe9, 0x25, 0xb4, 0x54, 0x46,
+  0xb5, 0xf3, 0xd6, 0x47, 0xc9, 0x97, 0x30, 0x3b, 0x71, 0x02, 0xf1, 0x42, 0x8c, 0xd1, 0x44, 0xe5,
+  0x72, 0x07, 0xa5, 0x1b, 0xc7, 0xaa, 0xa5, 0xd1, 0x54, 0x1e, 0xdc, 0x9e, 0x53, 0xd7, 0x96, 0xa5,
+  0x59, 0x44, 0x42, 0x81, 0x11, 0x5f, 0x01, 0x9b, 0x29, 0x8a, 0xfa, 0xd8, 0xe9, 0x02, 0xe4, 0xcc,
+  0xb3, 0x98, 0xce, 0x5a, 0x21, 0x40, 0x5b, 0x9d, 0xd2, 0x1e, 0xbd, 0xa0, 0x51, 0x78, 0xb5, 0xb6,
+  0xfa, 0xf9, 0x0f, 0xe7, 0xf4, 0x6a, 0x96, 0x78, 0x0b, 0x9a, 0xf2, 0x59, 0x57, 0x60, 0x0b, 0xda,
+  0xf5, 0x3b, 0x97, 0xb6, 0x02, 0x4b, 0x48, 0x9c, 0x81, 0x7a, 0xd1, 0x1e, 0xf8, 0x54, 0x95, 0xd9,
+  0xef, 0xf3, 0x5f, 0x4c, 0x39, 0xaf, 0xae, 0xbb, 0xb5, 0x5b, 0x52, 0xbb, 0x58, 0x45, 0xd0, 0xf6,
+  0xff, 0x3d, 0xf5, 0xb2, 0x39, 0x4d, 0x8e, 0x81, 0xd4, 0x59, 0x72, 0x55, 0x62, 0x59, 0x2f, 0x33,
+  0x0c, 0xfe, 0xc3, 0x82, 0xfa, 0x81, 0x47, 0xda, 0x0b, 0x28, 0x98, 0xcb, 0x21, 0xd4, 0x88, 0x14,
+  0x38, 0x55, 0xda, 0xb7, 0x4d, 0x43, 0x28, 0x77, 0xa8, 0x7c, 0x76, 0x0c, 0x4e, 0xde, 0x78, 0x19,
+  0x0f, 0x34, 0x03, 0x3a, 0x70, 0x42, 0xac, 0x26, 0x89, 0x41, 0x94, 0x0a, 0xd2, 0x6a, 0xbb, 0x9f,
+  0xbe, 0x4f, 0x33, 0x2f, 0x08, 0x53, 0xc9, 0x4f, 0x24, 0x48, 0xa5, 0xb7, 0x86, 0xc4, 0xc0, 0x51,
+  0x30, 0x25, 0x69, 0x44, 0x98, 0x23, 0xa6, 0xb0, 0x51, 0x70, 0x59, 0x4d, 0xfd, 0x9e, 0xa8, 0xfc,
+  0x23, 0x7e, 0xff, 0x8b, 0x0d, 0xab, 0xc0, 0x0e, 0xda, 0xfc, 0xe3, 0x29, 0x2c, 0x07, 0x20, 0xe8,
+  0x44, 0x65, 0x02, 0xdd, 0x10, 0x4b, 0x81, 0x63, 0xa3, 0x85, 0xfe, 0x6e, 0x6e, 0x19, 0x39, 0xe5,
+  0x96, 0x88, 0xd3, 0xec, 0x0a, 0x96, 0x83, 0x33, 0x34, 0xf4, 0x93, 0x47, 0x61, 0xb0, 0x24, 0x0f,
+  0xf8, 0x6c, 0x2a, 0xb5, 0x9c, 0x38, 0xe6, 0x5d, 0x10, 0x31, 0x1f, 0xd9, 0x1a, 0x41, 0x41, 0x7c,
+  0x88, 0x07, 0x8d, 0x76, 0x15, 0x0d, 0x82, 0xdc, 0xa0, 0x57, 0x8f, 0x03, 0x9f, 0x12, 0x9f, 0xce,
+  0xbc, 0x55, 0x98, 0x11, 0x69, 0x52, 0xa9, 0x36, 0xff, 0xa8, 0x1e, 0x30, 0x87, 0xa3, 0x51, 0xf0,
+  0xf6, 0xc0, 0x5e, 0x60, 0x07, 0x87, 0x0d, 0xa2, 0x01, 0x34, 0x92, 0x27, 0x20, 0xd9, 0x1c, 0xc8,
+  0x98, 0xb6, 0xa5, 0xaa, 0x28, 0x1c, 0x19, 0x9a, 0xb4, 0xef, 0x5a, 0xf2, 0x4d, 0x4d, 0xae, 0x6a,
+  0xfb, 0xa6, 0x6a, 0x9d, 0xb8, 0x40, 0xc2, 0x12, 0xb1, 0x5f, 0xe7, 0x3d, 0x55, 0xf9, 0xed, 0xf9,
+  0xa3, 0x47, 0x24, 0x45, 0x69, 0x43, 0xda, 0xbe, 0x97, 0x9c, 0x93, 0xd7, 0x27, 0x6c, 0xed, 0x5b,
+  0xc0, 0x02, 0xea, 0x77, 0x54, 0xcb, 0x40, 0x7d, 0x98, 0xc6, 0xa8, 0x64, 0x17, 0xc5, 0xad, 0x2a,
+  0xc2, 0x04, 0x93, 0xdb, 0x5f, 0x9a, 0x44, 0x4a, 0x02, 0x7e, 0xdf, 0x46, 0xf1, 0xa4, 0x8c, 0xd6,
+  0x0e, 0x3b, 0x5a, 0x2e, 0xef, 0x5b, 0xad, 0xc3, 0x46, 0x41, 0x1e, 0xf9, 0xbe, 0x43, 0x1b, 0x09,
+  0xb9, 0x45, 0xd1, 0x5e, 0xf2, 0x8d, 0xcc, 0x96, 0x46, 0x7d, 0x94, 0x22, 0x5b, 0x15, 0xa3, 0xb5,
+  0xe3, 0xf6, 0xf0, 0x3b, 0x3c, 0x07, 0xd7, 0x19, 0x48, 0xf7, 0x9e, 0x15, 0x15, 0xf6, 0x5d, 0x47,
+  0x14, 0xc7, 0xb6, 0x93, 0xc0, 0xcf, 0x9f, 0x89, 0xf1, 0xaf, 0x9c, 0x5d, 0xeb, 0xd9, 0x52, 0x75,
+  0x7b, 0x48, 0xa7, 0xdc, 0x26, 0x37, 0x1c, 0xa8, 0x5b, 0xeb, 0x83, 0x61, 0x65, 0x2c, 0x18, 0x20,
+  0x7b, 0x8a, 0x6d, 0x92, 0x73, 0x37, 0x4f, 0x34, 0x41, 0xd7, 0xc1, 0x32, 0x2e, 0xab, 0xc0, 0x3f,
+  0xb6, 0x71, 0x0e, 0x3a, 0x51, 0x78, 0x20, 0xd5, 0xbc, 0x6a, 0x04, 0x4a, 0x8d, 0xbf, 0x4e, 0x39,
+  0xd5, 0xdf, 0x3d, 0x6c, 0x18, 0x6d, 0x56, 0x1b, 0xfc, 0x59, 0x19, 0x63, 0xca, 0x07, 0x44, 0x41,
+  0x41, 0x8f, 0x89, 0x6e, 0x64, 0xfb, 0x86, 0xf7, 0xa1, 0xb7, 0x64, 0x6b, 0x5f, 0x4f, 0xd8, 0xe5,
+  0xdf, 0xdd, 0x28, 0xa6, 0xb4, 0x74, 0xad, 0xd0, 0xe2, 0x0f, 0x2a, 0x6c, 0x60, 0x11, 0x0c, 0x9e,
+  0x17, 0x36, 0x09, 0xc9, 0x73, 0x93, 0xaf, 0xce, 0x3e, 0x57, 0x19, 0x3f, 0x53, 0x12, 0xf6, 0xcb,
+  0x35, 0x94, 0xfe, 0x8e, 0x8a, 0xf4, 0x2a, 0x05, 0xc9, 0xc0, 0x37, 0x18, 0x66, 0x71, 0x55, 0x2b,
+  0xd9, 0xb5, 0x37, 0x5d, 0x3e, 0x9d, 0xc6, 0x89, 0xd8, 0xf7, 0x41, 0xb7, 0x68, 0x82, 0x4d, 0x96,
+  0x96, 0xe9, 0x65, 0xf3, 0x60, 0x7a, 0x8e, 0x26, 0x28, 0xb6, 0x71, 0x36, 0xca, 0xe5, 0xf5, 0x7b,
+  0xf1, 0x6c, 0x06, 0x92, 0x59, 0x8b, 0x06, 0xad, 0x1c, 0x66, 0x1e, 0x02, 0x88, 0xe6, 0x67, 0x73,
+  0xfa, 0x08, 0xb9, 0xa5, 0x1a, 0xeb, 0xb6, 0x9a, 0x0a, 0x2f, 0x27, 0xcb, 0x54, 0xe1, 0xd1, 0x67,
+  0x7a, 0x56, 0x39, 0x32, 0x9a, 0x0e, 0x7d, 0xa0, 0xa9, 0xd0, 0x6e, 0xb0, 0xb6, 0x22, 0x56, 0x16,
+  0x43, 0xe3, 0xd4, 0x1a, 0x54, 0x0a, 0x08, 0x55, 0x6d, 0x8d, 0xee, 0x2b, 0x7e, 0x84, 0xd2, 0xc8,
+  0x97, 0x2d, 0xe7, 0xd6, 0xdd, 0xd1, 0x85, 0x9e, 0x69, 0xd1, 0x28, 0xa2, 0x24, 0x9c, 0x01, 0x21,
+  0xaa, 0xe7, 0x0a, 0x7a, 0x71, 0x46, 0x35, 0x8f, 0x6d, 0xee, 0x11, 0x2a, 0xf1, 0x5d, 0xd7, 0x98,
+  0xf2, 0x76, 0xdd, 0x5e, 0xf6, 0x92, 0x10, 0xee, 0x12, 0x29, 0x60, 0x2b, 0x5e, 0xed, 0xe3, 0x79,
+  0x12, 0x2f, 0x68, 0x97, 0x9c, 0x7a, 0x33, 0x2f, 0x09, 0xba, 0xe4, 0xa1, 0x7f, 0x46, 0x15, 0x55,
+  0xc5, 0xd1, 0xa7, 0xc2, 0x4d, 0xc9, 0x65, 0x70, 0x2f, 0x59, 0x45, 0xcc, 0xc7, 0x88, 0x8e, 0x0c,
+  0x00, 0xf9, 0xae, 0x39, 0xee, 0x8d, 0x0d, 0x42, 0x8e, 0x18, 0x4d, 0x3d, 0x4e, 0x75, 0xb5, 0x98,
+  0xdc, 0x4a, 0x5f, 0x32, 0x06, 0xe9, 0x3a, 0xa3, 0xe6, 0x54, 0x3e, 0xf5, 0xb7, 0x4d, 0xd5, 0x99,
+  0x4a, 0xff, 0x87, 0x5b, 0xea, 0xaa, 0x22, 0xaf, 0x87, 0x54, 0x42, 0xb2, 0xf0, 0xb5, 0x81, 0xf0,
+  0x3e, 0xa9, 0xda, 0xa7, 0x4b, 0x71, 0xa8, 0x6c, 0xb4, 0x4c, 0x2e, 0x49, 0x27, 0x42, 0x93, 0xb9,
+  0xc0, 0xcd, 0x24, 0xb5, 0x14, 0xb7, 0x2c, 0xf6, 0x43, 0x57, 0xc4, 0x6c, 0xc1, 0xc0, 0x8f, 0x60,
+  0x5f, 0x3b, 0x8b, 0xdf, 0xd6, 0x8e, 0x33, 0xc6, 0x18, 0xb2, 0xa7, 0x5f, 0x9d, 0x4d, 0xaf, 0x81,
+  0xb1, 0x41, 0xa3, 0x4f, 0x83, 0xe7, 0xd6, 0x65, 0x23, 0xa7, 0xe2, 0x37, 0x01, 0xee, 0xa9, 0x26,
+  0xc4, 0xba, 0x67, 0x08, 0x5c, 0x8a, 0xa0, 0xb3, 0xe9, 0x4c, 0xdf, 0x7a, 0x56, 0xb5, 0xdd, 0x5c,
+  0xe6, 0xd5, 0xf3, 0x8d, 0x2b, 0x70, 0xad, 0xa6, 0xed, 0x72, 0xde, 0xbd, 0x5e, 0x73, 0x1a, 0x15,
+  0x74, 0xe9, 0xb0, 0x16, 0x15, 0x4c, 0xbe, 0xd4, 0xf6, 0x64, 0x7b, 0x7b, 0x7b, 0x4d, 0x2c, 0x9f,
+  0x25, 0xc6, 0xd2, 0x6b, 0x90, 0xe6, 0xc6, 0xc8, 0x28, 0xf6, 0xf1, 0xd5, 0xa4, 0xa7, 0x68, 0x04,
+  0xb6, 0xe9, 0x3a, 0x88, 0xe6, 0x34, 0x09, 0xb2, 0x66, 0x8e, 0xda, 0x75, 0x55, 0xe8, 0xa6, 0x81,
+  0xb2, 0xdc, 0x0c, 0x3b, 0xa1, 0xd9, 0x25, 0x55, 0xb5, 0xaa, 0xca, 0xfd, 0x41, 0x49, 0xa4, 0x27,
+  0x33, 0x85, 0x8f, 0x1a, 0x7a, 0xc6, 0x43, 0x9a, 0x65, 0xa8, 0x7c, 0xe3, 0x44, 0xe3, 0x3e, 0xf7,
+  0xc1, 0xbe, 0xa5, 0x65, 0x2b, 0xe3, 0xba, 0xc2, 0xb3, 0x99, 0x53, 0x65, 0x99, 0xd0, 0x27, 0xe9,
+  0xce, 0x7a, 0xbb, 0x17, 0x3d, 0x92, 0xb3, 0x74, 0xcc, 0xfa, 0x66, 0x24, 0x77, 0x79, 0xf8, 0xb7,
+  0x59, 0xf5, 0x43, 0xe9, 0xb0, 0xce, 0x95, 0xb2, 0xb4, 0xf1, 0xbe, 0x54, 0x43, 0xed, 0xc3, 0xad,
+  0x86, 0x50, 0xd7, 0x4f, 0x86, 0x14, 0x23, 0x2c, 0xc7, 0xb4, 0xf8, 0x53, 0x69, 0x3e, 0x19, 0xec,
+  0x97, 0xea, 0xcc, 0xa3, 0x26, 0x14, 0xff, 0x11, 0x94, 0x2e, 0xaf, 0x47, 0xdf, 0x2e, 0x3d, 0xd8,
+  0x14, 0xf9, 0x47, 0xad, 0x2c, 0x59, 0xa1, 0x0a, 0xfc, 0x55, 0x13, 0xfa, 0xba, 0x1d, 0x50, 0xa5,
+  0x4d, 0x8d, 0xc7, 0xde, 0x2c, 0x73, 0xe9, 0xe6, 0x45, 0x7c, 0x7b, 0x7f, 0xe4, 0xf2, 0x9a, 0x8a,
+  0xa3, 0x8a, 0xb0, 0x81, 0xd0, 0xbe, 0x6a, 0x07, 0x19, 0x06, 0x8d, 0x36, 0xcd, 0x85, 0x71, 0xec,
+  0x97, 0x7f, 0xfe, 0x5f, 0xad, 0x7a, 0x55, 0x69, 0xb4, 0xd3, 0x90, 0x01, 0x18, 0xe3, 0xda, 0x1d,
+  0x2c, 0x89, 0xb7, 0xe0, 0x5e, 0xac, 0x8e, 0x7b, 0x87, 0xe6, 0xe6, 0xfa, 0x7c, 0xc7, 0xa3, 0xb3,
+  0xd7, 0x3d, 0x1e, 0x3e, 0x3d, 0x8e, 0xb2, 0x79, 0x6f, 0x3a, 0x0f, 0x42, 0xbf, 0x3d, 0xec, 0x94,
+  0xf9, 0x3f, 0x5c, 0xfb, 0x27, 0x13, 0x9a, 0xb4, 0xd4, 0x08, 0xca, 0x3b, 0xe1, 0x77, 0x2b, 0xaa,
+  0x33, 0x3f, 0x09, 0xb2, 0xe8, 0x52, 0x47, 0x69, 0x1d, 0x3c, 0x4b, 0xfc, 0x34, 0x9f, 0xa1, 0x0f,
+  0xf7, 0x41, 0xb0, 0x58, 0x00, 0x5e, 0xcf, 0xf4, 0xc8, 0x0f, 0xdb, 0xdb, 0x68, 0x3a, 0x6b, 0x57,
+  0x68, 0x81, 0x6d, 0x66, 0x0f, 0x95, 0x4c, 0x97, 0x08, 0xef, 0xb3, 0x6e, 0x8b, 0xe0, 0x18, 0x1e,
+  0x94, 0x6c, 0x47, 0x75, 0x7a, 0x58, 0x1e, 0xdb, 0x2a, 0xf7, 0xb1, 0xd2, 0x87, 0xbd, 0x1d, 0xa7,
+  0xe5, 0x6f, 0x0e, 0xfb, 0x45, 0x9f, 0x2d, 0x2f, 0x32, 0x1a, 0x14, 0x7d, 0x46, 0x96, 0x11, 0xae,
+  0x91, 0x33, 0x71, 0xbd, 0x23, 0xce, 0xce, 0x35, 0x4b, 0xc3, 0xcd, 0x5b, 0x50, 0x05, 0xa9, 0x14,
+  0x14, 0x14, 0x2f, 0x83, 0x46, 0xd2, 0x98, 0xc0, 0x92, 0x0d, 0xd3, 0x90, 0x0d, 0x29, 0x52, 0x4f,
+  0x0c, 0xb5, 0x13, 0xed, 0x5e, 0x78, 0xf6, 0x51, 0x30, 0x37, 0xcf, 0xc1, 0xb8, 0xf9, 0xad, 0x70,
+  0x2d, 0xb1, 0x1e, 0x5d, 0x06, 0xd9, 0x5c, 0xf2, 0x66, 0x65, 0x27, 0xd2, 0xc5, 0xaf, 0xd0, 0x89,
+  0x41, 0x79, 0x27, 0x4e, 0x41, 0xb4, 0x8b, 0x43, 0x16, 0x62, 0xf1, 0x57, 0xf0, 0x66, 0xef, 0x59,
+  0x4c, 0xa7, 0x3d, 0x1b, 0xc5, 0x04, 0xd0, 0x4c, 0x78, 0x96, 0x29, 0x3a, 0x21, 0xb3, 0x15, 0xf0,
+  0x38, 0xd3, 0xa4, 0x14, 0xb8, 0x5c, 0xbb, 0x63, 0x9f, 0x2a, 0x4f, 0x3a, 0xe8, 0xd4, 0xce, 0xb9,
+  0x43, 0x32, 0x4c, 0x7b, 0x95, 0x22, 0xcb, 0xc7, 0x09, 0xef, 0x40, 0xaa, 0x6c, 0xbf, 0xfa, 0x8b,
+  0x4c, 0xe7, 0x97, 0x26, 0x63, 0xfa, 0x19, 0xd0, 0x74, 0x16, 0x9c, 0x3d, 0x42, 0xe9, 0xce, 0xa2,
+  0x1f, 0x9d, 0x56, 0x30, 0xf6, 0x45, 0x11, 0x55, 0xa3, 0x8e, 0x08, 0x95, 0x34, 0x03, 0x26, 0xd5,
+  0x26, 0x47, 0x35, 0xed, 0xe5, 0x95, 0x4a, 0xdb, 0xd5, 0x4b, 0x28, 0xed, 0xef, 0x77, 0xf4, 0x4f,
+  0x06, 0x28, 0x5d, 0x64, 0x97, 0x42, 0x19, 0xaa, 0x50, 0xcc, 0x43, 0x37, 0x8d, 0x04, 0xf0, 0xad,
+  0x74, 0x66, 0xf7, 0x9a, 0x9d, 0x31, 0xd7, 0x8f, 0xed, 0xce, 0x7a, 0x89, 0x43, 0x3e, 0xc3, 0xe8,
+  0x0f, 0xee, 0x6b, 0xef, 0xba, 0x03, 0x11, 0xfb, 0xd3, 0x45, 0x7a, 0x36, 0xac, 0xfa, 0x38, 0xaa,
+  0x8c, 0x57, 0x37, 0xac, 0xe7, 0xd2, 0xac, 0x39, 0x9c, 0xe1, 0x3f, 0x0d, 0x0d, 0xf7, 0x9a, 0xca,
+  0x5c, 0x32, 0x0c, 0x45, 0x47, 0xb8, 0x75, 0xa6, 0xb2, 0x3b, 0x1f, 0xf4, 0xc0, 0xb0, 0x93, 0x46,
+  0x0d, 0x5a, 0x04, 0xdd, 0x75, 0x6b, 0xba, 0x35, 0x6d, 0xda, 0x8a, 0xc8, 0x3a, 0x14, 0x44, 0xb3,
+  0xb8, 0x21, 0xc7, 0xb2, 0xac, 0x3c, 0x9b, 0x79, 0x5a, 0x9e, 0xbb, 0x9b, 0x32, 0x09, 0xd2, 0x5d,
+  0x3c, 0x35, 0x2a, 0xb2, 0xf6, 0x30, 0x1d, 0x2f, 0x00, 0x9d, 0xb7, 0xe0, 0xeb, 0x16, 0x89, 0x23,
+  0x7e, 0x20, 0x45, 0x1e, 0x4c, 0x39, 0x66, 0xdf, 0xda, 0x18, 0x36, 0x93, 0x75, 0x5a, 0x32, 0xc7,
+  0xcf, 0x5d, 0x94, 0x03, 0x53, 0x8c, 0xc0, 0x3b, 0x6a, 0xe1, 0x09, 0xc7, 0xfc, 0x03, 0x26, 0x03,
+  0xba, 0x38, 0x53, 0x82, 0x2d, 0x78, 0xde, 0xa4, 0xd6, 0xf6, 0xce, 0xa0, 0xa5, 0xbc, 0xe5, 0x5a,
+  0xeb, 0x51, 0x4b, 0x7f, 0x8b, 0x69, 0x97, 0xbe, 0x89, 0xdf, 0x1e, 0xb5, 0x98, 0x61, 0x66, 0x78,
+  0xd0, 0x1f, 0xec, 0x6e, 0x91, 0xe1, 0x56, 0x7f, 0x34, 0x3a, 0x50, 0x8b, 0xbd, 0x5d, 0x84, 0x63,
+  0xb6, 0x24, 0x1c, 0xb5, 0x96, 0x09, 0x4d, 0x69, 0x72, 0x41, 0x8d, 0xcf, 0x11, 0xa0, 0x85, 0x49,
+  0x8e, 0xc6, 0x9b, 0x9b, 0x97, 0x97, 0x97, 0xfd, 0xcb, 0xad, 0x7e, 0x9c, 0x9c, 0x6d, 0x8e, 0x06,
+  0x83, 0xc1, 0x26, 0x60, 0x57, 0x14, 0xbe, 0xa7, 0x54, 0xbb, 0xbb, 0xf4, 0xb2, 0xb9, 0xf2, 0x4c,
+  0x08, 0x23, 0xdf, 0x51, 0x4b, 0x7b, 0xc7, 0xa2, 0x7c, 0xc3, 0x31, 0xee, 0xf9, 0xd0, 0x78, 0x7d,
+  0x8c, 0xe3, 0x76, 0x68, 0x96, 0x40, 0x1e, 0xbe, 0xc0, 0x7d, 0x05, 0x73, 0xc5, 0xa4, 0x22, 0x65,
+  0xd2, 0xd8, 0x28, 0x46, 0xc8, 0x17, 0x7f, 0x5b, 0xc5, 0xd9, 0xe1, 0x25, 0x10, 0x88, 0xff, 0x22,
+  0xfb, 0x7b, 0xdd, 0xb2, 0x42, 0x40, 0x2e, 0x51, 0x68, 0x4f, 0xdd, 0xd5, 0x4a, 0x95, 0x0d, 0x76,
+  0x9e, 0x3d, 0xb1, 0x2d, 0x07, 0xc6, 0x38, 0xa7, 0x49, 0xca, 0x10, 0x85, 0x3e, 0x24, 0xf1, 0x39,
+  0xd5, 0xcb, 0xeb, 0x3d, 0x82, 0xf1, 0x7f, 0x0a, 0xec, 0x43, 0x06, 0x1e, 0xfc, 0x65, 0x3f, 0xc8,
+  0x90, 0x0c, 0x7a, 0xfd, 0xc1, 0x60, 0x04, 0xcb, 0xc8, 0xf6, 0xc1, 0xce, 0xfd, 0xfc, 0x3d, 0xfe,
+  0xc3, 0x7e, 0x2d, 0x86, 0xfd, 0x83, 0x9d, 0x3d, 0x47, 0x95, 0x21, 0xab, 0x72, 0xa0, 0xd5, 0x18,
+  0xf4, 0xd8, 0x3b, 0x56, 0x67, 0x97, 0xd5, 0xd9, 0x3e, 0xc0, 0x7f, 0x79, 0x2d, 0xfc, 0x0b, 0x9f,
+  0xf7, 0x95, 0xb7, 0x45, 0xa5, 0xfd, 0xeb, 0x57, 0xda, 0x5b, 0xb7, 0xd2, 0x6e, 0x7f, 0xb0, 0x3f,
+  0xfa, 0x28, 0x2d, 0x5d, 0xab, 0x4f, 0x88, 0xde, 0x56, 0xd3, 0x41, 0x1a, 0x6d, 0xf7, 0x77, 0x77,
+  0xb6, 0x6f, 0x3c, 0x4e, 0x45, 0x1d, 0x81, 0xdc, 0x2d, 0x0e, 0x6c, 0xd1, 0x1f, 0xb5, 0x52, 0x81,
+  0xdb, 0xaf, 0xcf, 0x10, 0x1f, 0xaf, 0xa5, 0xed, 0xfe, 0x70, 0xb4, 0xdb, 0x74, 0x6c, 0xb7, 0xf7,
+  0xfb, 0x3b, 0x3b, 0xfb, 0x30, 0xb6, 0xa3, 0x83, 0xfe, 0xc1, 0xfe, 0x5e, 0xd3, 0x6a, 0x7b, 0x50,
+  0x6d, 0x1b, 0x1e, 0x9e, 0xee, 0x83, 0x3e, 0xfb, 0xa1, 0x47, 0xf7, 0xe9, 0x70, 0xb8, 0xdd, 0xdf,
+  0x5e, 0xb7, 0x12, 0xb6, 0x8d, 0xad, 0xed, 0x38, 0x7b, 0xb4, 0xa3, 0x8b, 0x21, 0x78, 0x09, 0xd5,
+  0x76, 0x16, 0x43, 0xac, 0x31, 0x72, 0x32, 0xd2, 0xc8, 0xd9, 0x9a, 0xa8, 0x89, 0x74, 0xdf, 0xeb,
+  0xef, 0x8f, 0x76, 0xd7, 0xe0, 0x41, 0xfc, 0xd0, 0x60, 0xc8, 0x4a, 0x30, 0xbd, 0x41, 0x6b, 0xfb,
+  0xfd, 0xc1, 0xd6, 0xc1, 0xf5, 0xfa, 0xb8, 0x05, 0x13, 0x6d, 0xf7, 0xe0, 0xb6, 0xe9, 0x53, 0x5b,
+  0x95, 0x31, 0xe7, 0xf5, 0xea, 0x32, 0x3e, 0xd8, 0xea, 0x1f, 0x0c, 0x6d, 0x1e, 0xdd, 0xb1, 0x38,
+  0xb4, 0x92, 0x01, 0x6a, 0x24, 0x49, 0x51, 0xb1, 0x41, 0x33, 0x6e, 0x5a, 0xd4, 0x4c, 0x6c, 0xf7,
+  0xb8, 0xd5, 0x57, 0xda, 0x6e, 0xca, 0x59, 0x43, 0x86, 0x1b, 0x32, 0xe3, 0x4e, 0x89, 0x94, 0x77,
+  0x92, 0xac, 0x62, 0x55, 0x28, 0x2b, 0xbf, 0xfb, 0xb1, 0x64, 0xf5, 0xb5, 0x68, 0xf6, 0xeb, 0xaf,
+  0xc3, 0xa5, 0xb4, 0x03, 0x4e, 0x1e, 0xec, 0xff, 0x9d, 0x2d, 0x58, 0x6b, 0x13, 0xa1, 0x4c, 0xa5,
+  0xb8, 0x19, 0x77, 0xe6, 0x13, 0xe0, 0x5a, 0x3d, 0x2f, 0x66, 0xcd, 0xc7, 0x18, 0x98, 0x8f, 0x32,
+  0x9a, 0x4c, 0x74, 0xee, 0xf4, 0xf7, 0x77, 0x77, 0x4b, 0x94, 0x82, 0x83, 0x92, 0x45, 0xd4, 0x89,
+  0x60, 0x23, 0x41, 0x5f, 0x2e, 0x1b, 0x78, 0xd5, 0xbd, 0xb2, 0xaa, 0x7b, 0xd5, 0x3d, 0xdc, 0xd3,
+  0x79, 0xa5, 0xe1, 0x42, 0x58, 0xd3, 0xda, 0xde, 0x6d, 0x22, 0x5a, 0xc8, 0xbf, 0xbd, 0xb2, 0x95,
+  0x7b, 0xaf, 0x46, 0x6d, 0xff, 0x98, 0xc3, 0x51, 0xab, 0x64, 0x5c, 0x63, 0x38, 0x60, 0x91, 0x3f,
+  0xb8, 0xe6, 0xe0, 0x97, 0xac, 0x72, 0x5b, 0x55, 0x74, 0x71, 0xcf, 0xd8, 0x66, 0x6a, 0x10, 0xe8,
+  0x13, 0x5b, 0xd7, 0xc3, 0xf4, 0x06, 0x55, 0xcb, 0x11, 0xae, 0x65, 0x1c, 0xd4, 0x37, 0xf6, 0xae,
+  0x57, 0xb5, 0xd0, 0x4d, 0xd7, 0x67, 0x1f, 0x64, 0x82, 0xe1, 0x6f, 0x0a, 0x63, 0xf7, 0xfa, 0xda,
+  0x64, 0x78, 0x98, 0xb4, 0x44, 0xac, 0x1b, 0xae, 0x4b, 0x00, 0x65, 0x6f, 0xff, 0x36, 0xf6, 0x76,
+  0xe5, 0x4d, 0xa0, 0xec, 0xde, 0xf9, 0x75, 0x15, 0x46, 0xd7, 0x3e, 0x70, 0xa7, 0x62, 0x12, 0x54,
+  0xab, 0x80, 0xee, 0x7a, 0xff, 0xfe, 0x56, 0xe6, 0xdb, 0x35, 0x0c, 0x94, 0x8f, 0x53, 0xc9, 0x04,
+  0xae, 0x69, 0xc7, 0x3d, 0x75, 0x3f, 0x96, 0x12, 0x58, 0xd2, 0x93, 0xf5, 0xd5, 0x40, 0xd4, 0x0e,
+  0xf6, 0xaf, 0xa3, 0x32, 0xe1, 0xcc, 0x5e, 0x4b, 0x65, 0x62, 0x86, 0x91, 0x3a, 0xcb, 0x43, 0xc5,
+  0xc2, 0x50, 0x67, 0x0b, 0x68, 0x24, 0x2b, 0xd7, 0xc3, 0xd6, 0x2d, 0x5a, 0x3e, 0xd0, 0x5a, 0x8d,
+  0x2d, 0xfe, 0x7b, 0x5a, 0xad, 0x19, 0x2f, 0x6c, 0x7d, 0x18, 0x2b, 0xcb, 0x87, 0xc1, 0x18, 0xd8,
+  0xe1, 0x9a, 0x8b, 0x75, 0xb9, 0x76, 0xda, 0x8c, 0x4c, 0xd7, 0x9c, 0x32, 0x6e, 0xfb, 0x7c, 0xe3,
+  0x75, 0x1e, 0x9a, 0xde, 0xdb, 0x1a, 0xde, 0x7c, 0x07, 0xfa, 0x1f, 0xde, 0x8d, 0x8f, 0x65, 0x55,
+  0xf9, 0xcd, 0x69, 0x49, 0xc8, 0x06, 0x1f, 0x55, 0x4f, 0xfa, 0xc4, 0x07, 0xb5, 0x84, 0xe2, 0xb7,
+  0xa2, 0x1f, 0x5c, 0x7b, 0xca, 0x7d, 0x3c, 0xf3, 0xe2, 0xb5, 0x55, 0xdf, 0xdd, 0x6b, 0x88, 0x9e,
+  0xbd, 0x0f, 0x4d, 0xe8, 0x35, 0x55, 0x31, 0xb4, 0x0c, 0xec, 0x7c, 0x0c, 0x2e, 0x53, 0x9d, 0xd9,
+  0x9b, 0x4a, 0x14, 0x02, 0x3a, 0xfa, 0xf3, 0x68, 0x85, 0x4d, 0x3f, 0xb8, 0xc8, 0x1f, 0xe6, 0xa3,
+  0x7b, 0xdf, 0x07, 0x8f, 0x02, 0xe5, 0x2a, 0x23, 0x78, 0x23, 0x3f, 0xf2, 0xb8, 0xa0, 0x59, 0x9c,
+  0x1c, 0xb5, 0x30, 0xeb, 0x7c, 0xeb, 0xde, 0xe9, 0xe9, 0xc9, 0x83, 0xbb, 0x9b, 0xec, 0xb5, 0x2b,
+  0xf8, 0x41, 0xbd, 0xc8, 0x47, 0x0d, 0x82, 0x50, 0x8a, 0x18, 0x17, 0xf6, 0xb4, 0xb4, 0xa0, 0x03,
+  0x9e, 0xb8, 0x40, 0x49, 0xe8, 0xca, 0x02, 0x32, 0x58, 0xd3, 0xe2, 0x2e, 0x2a, 0xfe, 0x3b, 0xc1,
+  0xeb, 0x9a, 0x30, 0xfc, 0x71, 0x53, 0xab, 0x2e, 0x32, 0xd2, 0xf1, 0xfa, 0xfc, 0x81, 0x43, 0x90,
+  0x97, 0x59, 0xb4, 0x08, 0xbb, 0xa7, 0xe9, 0xa8, 0x75, 0x3a, 0x8f, 0x2f, 0xf1, 0x6c, 0x52, 0x14,
+  0x51, 0x00, 0x27, 0xcf, 0x22, 0xdc, 0xd3, 0x42, 0x01, 0x8c, 0xd0, 0x8d, 0x35, 0x83, 0x29, 0xb4,
+  0x78, 0x8f, 0xe1, 0xae, 0xf9, 0x41, 0x86, 0x7c, 0xd8, 0x5f, 0x30, 0x50, 0x01, 0xef, 0xaa, 0x8a,
+  0xa8, 0xf9, 0x45, 0x0b, 0x08, 0x19, 0xf4, 0xb7, 0xf7, 0xd9, 0x1f, 0xbd, 0xd4, 0x3d, 0xa3, 0xce,
+  0xdd, 0x33, 0x19, 0xb8, 0x51, 0x84, 0x11, 0xb7, 0xee, 0x59, 0x61, 0x15, 0x76, 0xb8, 0x47, 0x11,
+  0x0e, 0xd1, 0x43, 0xff, 0xf9, 0xde, 0x01, 0x19, 0x8e, 0xfa, 0xbb, 0xc3, 0x83, 0x39, 0x34, 0x79,
+  0x01, 0xff, 0xce, 0x7b, 0xf0, 0xe7, 0xe7, 0x96, 0xa3, 0x8e, 0x3b, 0x50, 0x64, 0xcd, 0x60, 0x90,
+  0x35, 0x42, 0x42, 0x9a, 0x07, 0x86, 0xa8, 0x21, 0x2b, 0xfa, 0x71, 0x0d, 0x1d, 0x7f, 0x0c, 0x12,
+  0x91, 0xc9, 0x5f, 0x06, 0xfd, 0xc1, 0x70, 0xb4, 0x37, 0xdc, 0xdb, 0x76, 0x17, 0x5e, 0x2f, 0xd6,
+  0xc4, 0x15, 0x71, 0x62, 0x84, 0x86, 0x63, 0xcc, 0xbd, 0x08, 0x0d, 0x6f, 0x0b, 0xc2, 0xf7, 0x90,
+  0xf2, 0xa3, 0x8e, 0x5d, 0x6d, 0xf3, 0x1a, 0x03, 0xb9, 0x3b, 0xc4, 0x81, 0xdc, 0xdb, 0x1a, 0x79,
+  0xfd, 0x01, 0x3a, 0x43, 0xa5, 0xfc, 0x00, 0x61, 0xb5, 0xbf, 0x13, 0xf6, 0x87, 0xbb, 0x23, 0xfc,
+  0x17, 0x3e, 0xee, 0xe3, 0x7a, 0x2a, 0x3f, 0x83, 0x1c, 0x26, 0x03, 0xfc, 0xba, 0xd5, 0x13, 0x9f,
+  0xd5, 0xba, 0x3d, 0xac, 0xab, 0xbe, 0x62, 0x2f, 0xa0, 0x02, 0x14, 0xde, 0xda, 0xc7, 0x7f, 0xf1,
+  0xc7, 0x1e, 0x7b, 0xf2, 0x1c, 0xe5, 0xd6, 0x66, 0x23, 0x3c, 0x71, 0xc6, 0xe2, 0xfd, 0xd3, 0x79,
+  0x80, 0x67, 0x01, 0xe4, 0xb3, 0x7b, 0x8c, 0x8c, 0x4c, 0x2e, 0xee, 0x42, 0xc5, 0xe9, 0x10, 0xeb,
+  0xd6, 0x01, 0x6d, 0x0e, 0xd2, 0x69, 0x16, 0x27, 0x3d, 0x3a, 0x9b, 0x39, 0x0e, 0xad, 0xdb, 0x5c,
+  0xa6, 0x9f, 0x62, 0xae, 0xe4, 0xb2, 0x5d, 0x10, 0x21, 0xa3, 0xad, 0xca, 0xc2, 0x88, 0xfd, 0x14,
+  0xcf, 0xd1, 0xb3, 0xf0, 0xb9, 0xda, 0xa2, 0x7f, 0x8d, 0x83, 0xa8, 0xb2, 0x2c, 0xe5, 0xe7, 0xdf,
+  0xd4, 0x73, 0x24, 0xde, 0x74, 0xba, 0x5a, 0xac, 0x90, 0xfb, 0xca, 0xc0, 0xc7, 0xcb, 0xe2, 0xc6,
+  0xb8, 0xb2, 0x29, 0xc6, 0x4a, 0xd9, 0xe7, 0x16, 0x3e, 0xce, 0x24, 0xb8, 0xbb, 0x79, 0x66, 0x08,
+  0x72, 0x75, 0xf5, 0xe3, 0x2f, 0xf8, 0xe2, 0x50, 0xbf, 0x78, 0x88, 0x45, 0x4b, 0x0f, 0x6c, 0x14,
+  0xab, 0x12, 0xbf, 0xc1, 0xc7, 0x10, 0xa6, 0xa7, 0xf0, 0xb6, 0xb2, 0x25, 0x6d, 0xf5, 0x15, 0x4b,
+  0xa3, 0x5c, 0xe4, 0xf0, 0x2e, 0x9e, 0xd6, 0x3d, 0x7d, 0x7d, 0xd6, 0x1e, 0x94, 0xf5, 0x38, 0x4f,
+  0x40, 0x7f, 0xef, 0x85, 0xf8, 0xe5, 0x5a, 0x97, 0xc5, 0x24, 0xb2, 0x03, 0x62, 0xd5, 0xd5, 0x59,
+  0x5d, 0x75, 0x73, 0xb0, 0x0c, 0xa9, 0xe2, 0x89, 0xaf, 0xbe, 0xc5, 0xb3, 0x6b, 0x05, 0x16, 0xe8,
+  0x49, 0x5d, 0x00, 0x4f, 0x3b, 0x38, 0x96, 0x77, 0x8d, 0x5c, 0x46, 0x8e, 0x68, 0xed, 0x1b, 0x22,
+  0xc0, 0xe3, 0x7f, 0x65, 0x0f, 0x5b, 0xae, 0x80, 0x44, 0x33, 0x3c, 0x1d, 0x4f, 0x68, 0x94, 0xa8,
+  0x41, 0x30, 0x3c, 0xb8, 0xee, 0x4b, 0x70, 0xca, 0x98, 0xe8, 0x94, 0xe3, 0x34, 0x57, 0x34, 0x24,
+  0xbc, 0xf0, 0x91, 0x7c, 0x41, 0x5e, 0xd2, 0x33, 0x20, 0x62, 0x99, 0x86, 0x84, 0xe9, 0xc3, 0xff,
+  0x84, 0xcb, 0x36, 0x2f, 0x8e, 0x3f, 0x4d, 0xc0, 0x22, 0x99, 0x1e, 0xeb, 0x99, 0x2c, 0x2d, 0x48,
+  0x5b, 0x3c, 0x4b, 0xd2, 0x2a, 0x84, 0x15, 0xd9, 0xf7, 0x2e, 0xbc, 0x70, 0x05, 0x45, 0x0b, 0x85,
+  0x45, 0x64, 0xe7, 0x83, 0xb2, 0xa7, 0x1c, 0xf2, 0x55, 0xbc, 0x4a, 0x08, 0x82, 0x22, 0x3f, 0xb3,
+  0xe6, 0x79, 0xc5, 0x52, 0x48, 0xf7, 0x67, 0x49, 0x30, 0xf5, 0x36, 0x8f, 0xbd, 0x20, 0x89, 0x5b,
+  0xf7, 0xd4, 0xa7, 0xe6, 0x55, 0x11, 0x13, 0x2f, 0x9a, 0x7a, 0x4a, 0x7d, 0xf9, 0xaa, 0x29, 0x90,
+  0x3f, 0xc6, 0x73, 0xd4, 0xc4, 0xd2, 0xc9, 0x2a, 0x39, 0xcb, 0xc1, 0xa8, 0x2f, 0xeb, 0x01, 0x2d,
+  0x28, 0xab, 0x74, 0x3f, 0x9a, 0xce, 0xe3, 0xc4, 0x3b, 0x83, 0x41, 0xb0, 0x5e, 0x35, 0x07, 0x92,
+  0x9c, 0xd1, 0x08, 0xf4, 0x12, 0x6f, 0xf3, 0x9b, 0x15, 0x8d, 0xe2, 0xf4, 0xcd, 0x7d, 0x76, 0x27,
+  0xa8, 0xca, 0x47, 0xd5, 0x45, 0x15, 0xc6, 0x6a, 0xd8, 0xe4, 0xf1, 0x1c, 0xfe, 0x62, 0xe0, 0xb0,
+  0xf1, 0xa2, 0x31, 0x80, 0x07, 0x14, 0x73, 0xc8, 0x17, 0xf5, 0xf9, 0x73, 0xe3, 0xea, 0x7f, 0x58,
+  0x81, 0xa8, 0x85, 0x09, 0xeb, 0x15, 0x10, 0xf2, 0x57, 0x8d, 0x81, 0x3c, 0xf6, 0xc2, 0x60, 0xe6,
+  0xbd, 0x2d, 0x40, 0x88, 0x17, 0x8d, 0x01, 0x3c, 0x41, 0x02, 0x46, 0x67, 0xc0, 0xca, 0x69, 0x01,
+  0x44, 0x79, 0xd9, 0x18, 0xd0, 0x53, 0xfa, 0x36, 0x98, 0xc6, 0x6f, 0x8e, 0x61, 0xf9, 0x29, 0x00,
+  0x29, 0x2f, 0x1b, 0x03, 0x7a, 0x46, 0x2f, 0xdf, 0xfc, 0x10, 0x27, 0xe7, 0x05, 0x14, 0xf9, 0xa6,
+  0x31, 0x88, 0x17, 0xf3, 0x98, 0x46, 0x81, 0x42, 0x15, 0xf1, 0xa2, 0x31, 0x80, 0x53, 0x76, 0xe1,
+  0x92, 0xca, 0x1c, 0xf2, 0xcd, 0x1a, 0x20, 0xe2, 0x37, 0x2f, 0xbc, 0x55, 0xa8, 0xc1, 0x10, 0xaf,
+  0x9a, 0x03, 0xc9, 0xde, 0xc0, 0x9c, 0x8c, 0x94, 0xa1, 0x91, 0x6f, 0x1a, 0x83, 0x78, 0x15, 0x27,
+  0xb0, 0x01, 0x50, 0xb0, 0x10, 0x2f, 0x1a, 0x03, 0xf8, 0x0e, 0xc4, 0x4a, 0xbc, 0xd2, 0x38, 0x3d,
+  0x7f, 0x55, 0x0f, 0x24, 0x0d, 0x60, 0xc6, 0x86, 0x0b, 0x8f, 0x71, 0x45, 0xf1, 0xd0, 0xb0, 0xe2,
+  0x62, 0xe1, 0x45, 0xb2, 0x1e, 0xfe, 0x6e, 0x56, 0xed, 0x1b, 0xef, 0x6c, 0xee, 0x7b, 0xbe, 0xa8,
+  0x28, 0x9e, 0x9a, 0x56, 0x8d, 0xce, 0xce, 0xe3, 0xf3, 0xbc, 0x2a, 0x7b, 0x6a, 0x58, 0x95, 0x06,
+  0xc9, 0x2a, 0x93, 0x35, 0xd9, 0x43, 0xb3, 0x8a, 0x0f, 0xe6, 0xde, 0xb9, 0x27, 0xea, 0xb1, 0xdf,
+  0x0d, 0xab, 0xad, 0x26, 0x5e, 0x20, 0xab, 0xe1, 0xef, 0x66, 0xd5, 0x1e, 0xc3, 0x74, 0x9c, 0x07,
+  0x6f, 0x9e, 0x06, 0xd1, 0x5c, 0x54, 0x56, 0xde, 0x34, 0x05, 0x11, 0x9d, 0xbd, 0xf9, 0x16, 0xfe,
+  0xe4, 0x00, 0xc4, 0x73, 0xb3, 0xea, 0x7f, 0x84, 0x2e, 0x26, 0x99, 0xec, 0xb1, 0x78, 0x6a, 0x58,
+  0x95, 0x26, 0xab, 0xd4, 0x0b, 0x41, 0xdb, 0xb8, 0xa7, 0x3f, 0x37, 0xab, 0xfe, 0xad, 0x97, 0x78,
+  0xd3, 0xb9, 0x24, 0x9a, 0x78, 0x6a, 0x5a, 0x35, 0x9b, 0x03, 0x03, 0xfa, 0xab, 0xbc, 0xb2, 0x78,
+  0x6e, 0x58, 0x3d, 0x0e, 0xcf, 0xbd, 0xbc, 0xcf, 0xe2, 0xa9, 0x61, 0xd5, 0x15, 0x2c, 0x08, 0x6f,
+  0x9e, 0xac, 0x16, 0xcb, 0x55, 0x22, 0xeb, 0x2b, 0xaf, 0x9a, 0x01, 0x79, 0xea, 0x45, 0x41, 0x28,
+  0x9b, 0xe7, 0x0f, 0xcd, 0x2a, 0x9e, 0xd2, 0x78, 0x15, 0x8a, 0x7a, 0xec, 0x77, 0xc3, 0x6a, 0xa0,
+  0x48, 0x9c, 0xcd, 0x73, 0xfe, 0x94, 0x8f, 0x0d, 0x2b, 0x07, 0xd1, 0x99, 0xb7, 0x8c, 0x13, 0x2a,
+  0x6b, 0xcb, 0xe7, 0x66, 0xd5, 0x5f, 0x79, 0xc1, 0x92, 0xca, 0x96, 0xf9, 0x43, 0xd3, 0x8a, 0xe9,
+  0xfc, 0x1c, 0x74, 0x8b, 0xbc, 0x2a, 0x7f, 0x6c, 0x58, 0x39, 0x3e, 0xbf, 0x8a, 0x65, 0x4d, 0xfc,
+  0xdd, 0xac, 0xda, 0xeb, 0xd0, 0xf3, 0xa2, 0x89, 0x07, 0xdc, 0x20, 0x07, 0x57, 0x79, 0xd3, 0x0c,
+  0xc4, 0x0f, 0x14, 0x98, 0x09, 0x04, 0x73, 0x24, 0x74, 0x39, 0xeb, 0x5d, 0x3d, 0x98, 0x2c, 0xc4,
+  0xe5, 0x6d, 0xba, 0x79, 0xff, 0xe7, 0x98, 0xa9, 0x5d, 0xc6, 0x8b, 0x1b, 0x00, 0x38, 0xf6, 0x22,
+  0xd8, 0xc5, 0x35, 0x07, 0xf0, 0x92, 0x5e, 0x9d, 0xff, 0xd5, 0xbb, 0x08, 0xce, 0x15, 0x18, 0xf9,
+  0xbb, 0x7a, 0x30, 0x2b, 0xd8, 0x8b, 0xe3, 0x45, 0x89, 0x9b, 0xf7, 0x7d, 0xd8, 0x75, 0x05, 0x3e,
+  0xb2, 0x90, 0xf5, 0x6e, 0x0d, 0x30, 0xdf, 0x24, 0x41, 0x3a, 0xf1, 0x22, 0x0d, 0x8c, 0x7c, 0xb7,
+  0x06, 0x98, 0x07, 0x5e, 0x72, 0x19, 0x44, 0x2a, 0x10, 0xfe, 0x66, 0x0d, 0x10, 0x8f, 0xe3, 0x09,
+  0xc8, 0x49, 0x15, 0x04, 0x7f, 0xb3, 0x06, 0x88, 0xa7, 0x34, 0x9c, 0xc0, 0x66, 0x45, 0xef, 0x4d,
+  0xfe, 0x72, 0x0d, 0x40, 0x2f, 0x68, 0x92, 0xcd, 0x55, 0x20, 0xec, 0xc5, 0x1a, 0x00, 0x4e, 0xaf,
+  0xfc, 0x88, 0x5e, 0xa9, 0x10, 0xf8, 0x9b, 0x5a, 0x10, 0x0f, 0x57, 0x49, 0xbc, 0xa4, 0xa0, 0x0c,
+  0xa4, 0xc0, 0xdd, 0xbe, 0x07, 0xeb, 0x80, 0xf9, 0xa6, 0x31, 0x88, 0x6c, 0x4e, 0x51, 0xb1, 0xd2,
+  0x1e, 0x9b, 0x56, 0xfe, 0x86, 0x86, 0x78, 0xa7, 0x2a, 0xcd, 0xab, 0xcb, 0x17, 0xcd, 0x01, 0x60,
+  0xfa, 0x43, 0xa5, 0x3a, 0x3e, 0x36, 0xae, 0x0c, 0x8b, 0x1e, 0xec, 0x42, 0x0b, 0xe4, 0xe5, 0x8b,
+  0xc6, 0x00, 0x56, 0x53, 0x4c, 0x65, 0x80, 0x96, 0x0f, 0xf3, 0x4d, 0x53, 0x10, 0xc7, 0x98, 0x6e,
+  0x63, 0x0e, 0x5b, 0xbc, 0xa2, 0x13, 0xc5, 0xab, 0xa6, 0x40, 0x40, 0x6d, 0x51, 0xa9, 0xc0, 0x1f,
+  0x9b, 0x56, 0x7e, 0x0c, 0x1d, 0x0e, 0xa2, 0xf3, 0x20, 0xaf, 0x2e, 0x5f, 0x34, 0x05, 0x70, 0x92,
+  0x66, 0x20, 0x68, 0x71, 0x75, 0x33, 0x5e, 0x34, 0x05, 0xf0, 0x6d, 0x40, 0x2f, 0xf2, 0xca, 0xf8,
+  0xd0, 0xb4, 0xe2, 0x13, 0x10, 0x20, 0x71, 0xd1, 0x6f, 0xfe, 0xd8, 0xb8, 0x72, 0x1c, 0xf9, 0x6a,
+  0x65, 0xf6, 0xd8, 0xb4, 0xf2, 0x53, 0xcf, 0x4f, 0xd0, 0xa9, 0xa4, 0x3d, 0x36, 0xae, 0x1c, 0xa7,
+  0xd3, 0xf8, 0xb2, 0xa8, 0xcc, 0x1e, 0x9b, 0x56, 0x7e, 0x9e, 0xe2, 0x56, 0x48, 0x79, 0x68, 0x5a,
+  0xf1, 0x85, 0x07, 0xf2, 0x36, 0xaf, 0xc9, 0x9e, 0x1a, 0x57, 0x4d, 0xbc, 0xb3, 0x55, 0x31, 0x49,
+  0xf9, 0x63, 0xd3, 0xca, 0x2f, 0xe3, 0x45, 0x51, 0x15, 0x1f, 0x9a, 0x56, 0x3c, 0xcd, 0xe2, 0xe9,
+  0xf9, 0x3c, 0x0e, 0x0b, 0xe1, 0x94, 0xbf, 0x69, 0x0a, 0xe2, 0x7b, 0x2f, 0x49, 0xbd, 0x82, 0xd2,
+  0xfc, 0xb1, 0xb6, 0xf2, 0x0b, 0x6f, 0x1a, 0xcc, 0x70, 0x11, 0x5e, 0x4d, 0xcf, 0x61, 0xe9, 0x64,
+  0x76, 0x4a, 0xfd, 0x4d, 0x63, 0x10, 0xc7, 0x73, 0xd0, 0x6f, 0x51, 0xbc, 0x1a, 0x2f, 0x1a, 0x03,
+  0x78, 0x14, 0xfc, 0x35, 0x28, 0x6a, 0xe3, 0x53, 0xe3, 0xaa, 0x7f, 0x58, 0xa9, 0x0d, 0xe3, 0x53,
+  0xe3, 0xaa, 0xb0, 0x13, 0x89, 0xc3, 0x55, 0xb8, 0x2a, 0xaa, 0xcb, 0x37, 0x8d, 0x41, 0xbc, 0x88,
+  0x93, 0xec, 0xcd, 0x53, 0xd4, 0x62, 0x26, 0x57, 0x05, 0x18, 0xf5, 0x6d, 0x63, 0x50, 0xaf, 0xbc,
+  0x79, 0x90, 0x29, 0x54, 0xe0, 0xcf, 0xb5, 0xd5, 0x5f, 0xbf, 0x3a, 0x6e, 0xdd, 0x83, 0x3f, 0xf5,
+  0xcc, 0x92, 0x01, 0x79, 0x9e, 0xbe, 0xfa, 0x6a, 0x08, 0x8c, 0x22, 0x7f, 0x36, 0xad, 0xd4, 0x2b,
+  0x2a, 0xf5, 0xac, 0x4a, 0x77, 0x37, 0xb9, 0x91, 0xb3, 0x30, 0xc8, 0x2a, 0x36, 0x57, 0xe0, 0xa3,
+  0xb3, 0x15, 0x33, 0xf7, 0x3d, 0x11, 0xbf, 0x48, 0xfb, 0x81, 0x77, 0x45, 0xbe, 0x20, 0xe2, 0xc6,
+  0x83, 0x4e, 0x85, 0x09, 0x36, 0xaf, 0x2c, 0x4c, 0xb0, 0xc5, 0x73, 0x1c, 0x4d, 0x71, 0x93, 0x80,
+  0xfe, 0x66, 0x9a, 0x49, 0xc8, 0xed, 0x6c, 0x1e, 0xa4, 0x7d, 0x86, 0x79, 0xa7, 0x75, 0x1d, 0xe3,
+  0xac, 0x84, 0x5f, 0x4b, 0x16, 0x6f, 0xc6, 0xad, 0xa0, 0xe7, 0xa0, 0x7c, 0xd7, 0xcb, 0x97, 0x39,
+  0x28, 0xeb, 0xc7, 0x49, 0xec, 0x65, 0x41, 0x03, 0x9b, 0xc4, 0x14, 0xa4, 0xd7, 0xf1, 0xcf, 0x74,
+  0x5a, 0xaf, 0x20, 0xf9, 0xb0, 0x43, 0x7b, 0x00, 0x9b, 0xb3, 0xb4, 0xbe, 0x68, 0x04, 0xcb, 0xd6,
+  0x83, 0x55, 0xd6, 0x00, 0x28, 0x5b, 0xa1, 0xa3, 0xb3, 0xb0, 0x09, 0x54, 0x8a, 0x22, 0x3a, 0x5d,
+  0xd2, 0xc4, 0x6b, 0x62, 0x21, 0xa2, 0xa8, 0x3f, 0xa4, 0x59, 0x1c, 0x35, 0xa1, 0xc2, 0x0c, 0x26,
+  0xc2, 0xa3, 0x20, 0x6a, 0xd4, 0xb9, 0x19, 0x90, 0xf7, 0x51, 0x42, 0xa3, 0x26, 0x24, 0x03, 0x3e,
+  0xfc, 0x03, 0x4d, 0x9a, 0xd8, 0x86, 0xe6, 0x20, 0x16, 0x1e, 0xaf, 0x60, 0x2b, 0x99, 0x34, 0xc1,
+  0x37, 0x80, 0xce, 0x9d, 0x64, 0xa8, 0x9b, 0xd6, 0x97, 0x3d, 0x83, 0x71, 0x3b, 0x49, 0x9a, 0xf4,
+  0xec, 0xaf, 0x50, 0xf2, 0x8f, 0xde, 0x12, 0x76, 0x0f, 0x69, 0x3d, 0x4f, 0x86, 0x17, 0x38, 0xc7,
+  0xb2, 0x8b, 0x26, 0x28, 0x84, 0x80, 0xee, 0x93, 0x20, 0x9b, 0xaf, 0xbc, 0x46, 0xa3, 0x11, 0xc1,
+  0x40, 0x3f, 0x8b, 0x93, 0x4b, 0x7a, 0xd6, 0xa4, 0xf4, 0x12, 0x98, 0xed, 0x45, 0xdc, 0x88, 0x83,
+  0x96, 0x19, 0x16, 0x4d, 0xb2, 0x15, 0xac, 0xb4, 0x0d, 0xba, 0x88, 0x3e, 0x10, 0x58, 0x5b, 0x9b,
+  0x21, 0x9d, 0xc0, 0x00, 0xbe, 0x04, 0x4d, 0xb7, 0x49, 0xd9, 0x14, 0x58, 0xe8, 0x94, 0x26, 0x93,
+  0x46, 0x65, 0x61, 0xb3, 0x79, 0x1a, 0xc6, 0x17, 0x5e, 0xfd, 0x06, 0x33, 0x0d, 0x79, 0x51, 0xda,
+  0x08, 0x61, 0xdc, 0x09, 0x63, 0xf2, 0xa7, 0x26, 0x84, 0x4b, 0x61, 0xb0, 0x4f, 0x2f, 0xa9, 0xdf,
+  0xa8, 0xec, 0x25, 0x96, 0x85, 0xd5, 0x24, 0xac, 0x5f, 0x4d, 0x32, 0x20, 0xc4, 0xab, 0x55, 0x72,
+  0xee, 0x80, 0x6b, 0x8b, 0x79, 0x25, 0x68, 0x28, 0xbf, 0x3f, 0x53, 0xdc, 0xb7, 0x63, 0xc4, 0x16,
+  0x69, 0x4e, 0x46, 0x65, 0x75, 0x98, 0x62, 0x22, 0xc2, 0x07, 0x2b, 0x9e, 0x04, 0x1e, 0xe4, 0x1e,
+  0x3e, 0x12, 0xf9, 0x6c, 0x2c, 0x0c, 0x95, 0x0e, 0x4a, 0x71, 0x73, 0xb4, 0xe5, 0x9e, 0xd4, 0x1b,
+  0xd0, 0x3e, 0xf3, 0x25, 0xa5, 0xa2, 0xc0, 0x22, 0x88, 0x8e, 0x5a, 0x43, 0xfd, 0x9d, 0x74, 0xfd,
+  0x95, 0xb9, 0x2f, 0x9d, 0x1e, 0xd6, 0xf6, 0x29, 0x9d, 0x82, 0xde, 0x9d, 0x76, 0xac, 0x1e, 0x39,
+  0x7c, 0xcd, 0x65, 0xa4, 0xba, 0xe4, 0xcb, 0x65, 0x41, 0x2c, 0xb1, 0x7e, 0xde, 0x2a, 0xb9, 0xcc,
+  0x46, 0x1c, 0x04, 0xab, 0x2c, 0xf2, 0xb1, 0x49, 0x66, 0x3b, 0x82, 0x25, 0x55, 0xea, 0xa2, 0xe5,
+  0x94, 0x3b, 0x97, 0xee, 0x2f, 0x83, 0x6f, 0xd1, 0xbc, 0xf0, 0xbc, 0x78, 0x45, 0xee, 0xbf, 0x38,
+  0x21, 0xdf, 0xa2, 0x85, 0x41, 0xd7, 0x4d, 0x74, 0x7a, 0x2a, 0x61, 0x70, 0x1b, 0x2a, 0x15, 0x6d,
+  0xd8, 0x1b, 0x3a, 0x0d, 0x2b, 0x0a, 0x28, 0x97, 0xe4, 0x1e, 0xb5, 0xee, 0x3f, 0x78, 0xd0, 0xfb,
+  0xe1, 0xf9, 0xeb, 0x97, 0x3d, 0x40, 0xa7, 0xf7, 0xed, 0xc3, 0x1f, 0x7a, 0x5b, 0xa3, 0xde, 0xf1,
+  0xe3, 0xfb, 0x2f, 0xef, 0x1f, 0xbf, 0x7a, 0xf8, 0xf2, 0x54, 0x56, 0xda, 0x74, 0x06, 0xfa, 0x19,
+  0xce, 0xfd, 0x97, 0x32, 0x1c, 0x20, 0x8b, 0xc9, 0x8c, 0xe2, 0xad, 0x1f, 0x62, 0x20, 0x89, 0xef,
+  0x65, 0x5e, 0xbf, 0x20, 0xaf, 0x47, 0xe6, 0x09, 0x9d, 0xf1, 0x10, 0xba, 0x74, 0xbc, 0xb9, 0x39,
+  0x87, 0xbd, 0x0c, 0xcb, 0x96, 0x29, 0xca, 0x2f, 0xbc, 0x25, 0x0b, 0xa8, 0xc3, 0xab, 0x21, 0xd2,
+  0xcd, 0x34, 0x38, 0x8b, 0xde, 0xac, 0x96, 0x2d, 0x92, 0x79, 0xc9, 0x19, 0xcd, 0x8e, 0x5a, 0x6f,
+  0xd0, 0xb1, 0x7c, 0xae, 0x72, 0x00, 0x2c, 0xb8, 0xc2, 0xed, 0x8d, 0x44, 0x3d, 0xa7, 0x57, 0x04,
+  0xa0, 0x80, 0xac, 0xf7, 0x8a, 0xb4, 0x46, 0x7d, 0xf7, 0x70, 0x72, 0xda, 0x3f, 0x89, 0xa7, 0x2e,
+  0xfe, 0x6e, 0x2a, 0x7d, 0xcc, 0x29, 0xe0, 0x1a, 0x34, 0x6b, 0xd8, 0x98, 0x5f, 0x72, 0xc3, 0x64,
+  0xfd, 0x8a, 0x02, 0xda, 0xb0, 0xe1, 0x47, 0xb2, 0x49, 0xfe, 0x14, 0x2c, 0xe1, 0x2f, 0x2c, 0xc9,
+  0xfd, 0xa2, 0xe4, 0xe6, 0x8d, 0x31, 0xe3, 0x17, 0x84, 0x55, 0x23, 0x67, 0x97, 0xd1, 0xf1, 0x13,
+  0x97, 0x8c, 0x1d, 0xc7, 0x3e, 0x45, 0x0c, 0xe3, 0xe8, 0xcc, 0x85, 0xa2, 0x31, 0x1a, 0x15, 0xcc,
+  0x75, 0x17, 0x63, 0x9a, 0xa2, 0xb3, 0x7c, 0xa8, 0x70, 0x8a, 0x2d, 0xbc, 0x8c, 0x50, 0x7e, 0x75,
+  0x73, 0x3a, 0xc6, 0xdc, 0x5e, 0xac, 0x04, 0x41, 0xda, 0x74, 0x89, 0x86, 0x41, 0x8f, 0x3c, 0x4f,
+  0xbd, 0x73, 0xaf, 0x88, 0x1b, 0xfc, 0xe3, 0x0b, 0xf2, 0x4f, 0xe4, 0x4f, 0x27, 0x2f, 0xac, 0x72,
+  0x07, 0xdb, 0x03, 0xbc, 0xfc, 0xf3, 0xf5, 0x29, 0x7c, 0x07, 0xba, 0x06, 0xd9, 0xca, 0xa7, 0x5d,
+  0x86, 0x3f, 0xfb, 0x09, 0x25, 0xb6, 0xb6, 0xfb, 0xbb, 0x07, 0x5b, 0x4a, 0x0c, 0xe2, 0x70, 0x6b,
+  0xa7, 0xbf, 0x33, 0x18, 0x6d, 0xb9, 0xfb, 0xc4, 0x63, 0x7f, 0x8c, 0x09, 0x2d, 0x62, 0x88, 0x8a,
+  0x64, 0x67, 0xce, 0x10, 0x23, 0x6d, 0xc6, 0x17, 0x29, 0xde, 0x8a, 0xf7, 0xb0, 0x45, 0x09, 0x83,
+  0xe9, 0x39, 0x7e, 0xcc, 0x24, 0x61, 0xda, 0x4a, 0x78, 0x94, 0x1e, 0x1d, 0x93, 0x5f, 0x43, 0x29,
+  0x0b, 0x14, 0xd4, 0xc5, 0xf9, 0xf3, 0xf4, 0x8a, 0x48, 0x18, 0x1b, 0x66, 0xe0, 0x52, 0xd9, 0x84,
+  0x60, 0x69, 0x5d, 0xd5, 0x51, 0x02, 0x49, 0x78, 0xbc, 0x02, 0x0d, 0x7c, 0x41, 0x9e, 0xd2, 0x34,
+  0x65, 0xfb, 0x9c, 0x42, 0x38, 0x3a, 0x18, 0x92, 0x2d, 0xa0, 0xac, 0x82, 0x28, 0x6f, 0x73, 0x5d,
+  0xe9, 0x67, 0x37, 0x33, 0x2f, 0xbc, 0xb7, 0x21, 0x8d, 0xce, 0x58, 0xc4, 0xed, 0x68, 0x50, 0xca,
+  0xa0, 0x0f, 0x9f, 0x81, 0x7c, 0x23, 0x4f, 0x1f, 0x9e, 0x9e, 0xde, 0xff, 0xc3, 0x43, 0xad, 0x94,
+  0x87, 0x49, 0xb1, 0x61, 0x8d, 0xf9, 0xf1, 0x7e, 0xef, 0x4f, 0x83, 0xde, 0x01, 0x19, 0xdf, 0xf9,
+  0xf2, 0xcf, 0xbd, 0x7e, 0xf7, 0xcd, 0x9f, 0xbf, 0xfa, 0xdd, 0x9f, 0x37, 0xbf, 0xfe, 0xcb, 0xef,
+  0x35, 0x14, 0x78, 0x24, 0xf1, 0x73, 0xbc, 0xed, 0x2e, 0xcf, 0x8e, 0x2d, 0xf2, 0x6a, 0xa7, 0x5d,
+  0xc2, 0xd7, 0x40, 0xf8, 0xc1, 0x72, 0xb3, 0x75, 0x89, 0x17, 0xf9, 0x64, 0x4c, 0xee, 0x90, 0x2f,
+  0x81, 0x8d, 0xfa, 0xe4, 0x6b, 0xd2, 0x25, 0x6f, 0xc8, 0x57, 0x04, 0xef, 0x22, 0xff, 0x9a, 0x88,
+  0xfc, 0xf7, 0xee, 0x79, 0x5c, 0x31, 0x31, 0x08, 0xb9, 0xcf, 0x6b, 0x12, 0x34, 0x98, 0x7a, 0x53,
+  0x6c, 0x79, 0x4c, 0xee, 0xff, 0xf2, 0xcf, 0xff, 0xfd, 0x4f, 0x5d, 0x32, 0x80, 0xff, 0x1c, 0xd4,
+  0x37, 0x5f, 0xb9, 0xf2, 0xd9, 0x28, 0x14, 0xd7, 0x13, 0xaa, 0x43, 0x6f, 0x30, 0x7a, 0x19, 0xab,
+  0x97, 0x30, 0x3b, 0x61, 0x89, 0x02, 0xd5, 0x62, 0x39, 0x73, 0x4f, 0x43, 0xea, 0x25, 0xc7, 0x2a,
+  0x17, 0xa8, 0x3c, 0xae, 0x52, 0xe2, 0x18, 0x4b, 0x4a, 0xce, 0xdb, 0xa8, 0x88, 0xbf, 0xbb, 0x05,
+  0x5c, 0x87, 0x4e, 0x5c, 0x53, 0x1a, 0xf9, 0x8d, 0x50, 0x3d, 0x85, 0x82, 0xb5, 0x98, 0x96, 0x8b,
+  0x47, 0x94, 0x06, 0x78, 0xd7, 0x75, 0x4b, 0xce, 0x71, 0xed, 0x52, 0x68, 0x6d, 0x58, 0x12, 0x8d,
+  0x93, 0x52, 0x4c, 0xfd, 0xaa, 0xb1, 0x92, 0xba, 0x8e, 0x4a, 0x29, 0x8b, 0xc9, 0x94, 0x15, 0x89,
+  0xfa, 0xf0, 0x2d, 0x4e, 0x09, 0x2f, 0xc4, 0xfc, 0xda, 0xe7, 0xc0, 0xce, 0xfa, 0x14, 0x67, 0x7c,
+  0x85, 0x57, 0x32, 0xb6, 0xb8, 0x18, 0x51, 0x00, 0x4a, 0x81, 0xd2, 0x22, 0x82, 0x72, 0x42, 0x53,
+  0x23, 0x2c, 0x2d, 0x7c, 0x04, 0xc5, 0x31, 0xc7, 0x64, 0x9a, 0xf6, 0xa1, 0xad, 0xa5, 0x12, 0x34,
+  0xd9, 0x18, 0xe1, 0x57, 0x73, 0x58, 0xec, 0x2f, 0xe3, 0xe8, 0xcb, 0x0c, 0xfe, 0x26, 0xe7, 0x98,
+  0x2e, 0x32, 0xe4, 0xf7, 0x43, 0xf2, 0x0c, 0x91, 0x78, 0x27, 0x65, 0x10, 0x81, 0x5a, 0x40, 0x9e,
+  0x72, 0xf9, 0x0e, 0x2a, 0x5f, 0x84, 0x76, 0x18, 0xd0, 0x51, 0xbe, 0x0f, 0x7a, 0x8f, 0x02, 0xf5,
+  0x7a, 0xcd, 0x20, 0x49, 0xb3, 0x32, 0x4c, 0x9c, 0x52, 0xdd, 0x1d, 0x28, 0x6a, 0x5f, 0xce, 0xd4,
+  0x22, 0x46, 0x4a, 0xf5, 0x99, 0x17, 0xa6, 0xda, 0x28, 0xa9, 0xbd, 0xcc, 0xef, 0x70, 0x12, 0xd5,
+  0x78, 0xa6, 0x7a, 0x91, 0x87, 0x5d, 0x53, 0x6b, 0xcd, 0xc3, 0x09, 0xe2, 0xa4, 0x81, 0x2e, 0xf6,
+  0x8a, 0x73, 0x06, 0xe6, 0x7b, 0x3d, 0xb9, 0xe4, 0x2e, 0x31, 0xcf, 0x21, 0x5c, 0x80, 0x28, 0x81,
+  0xc1, 0x03, 0x41, 0xda, 0x37, 0x14, 0xee, 0x35, 0xcf, 0x40, 0xb0, 0xe2, 0xe3, 0xb7, 0xc8, 0x3d,
+  0xae, 0x4a, 0xc3, 0x83, 0x83, 0x83, 0x4d, 0xf6, 0x55, 0x1b, 0xdb, 0x8d, 0xba, 0x98, 0x76, 0x7e,
+  0x4a, 0x42, 0xcd, 0x3b, 0x69, 0x46, 0x06, 0x63, 0xc4, 0xfb, 0x70, 0xb7, 0x7b, 0xf0, 0xdd, 0x5e,
+  0xd8, 0x1b, 0xf5, 0x47, 0x3b, 0x07, 0x3d, 0xcc, 0x0b, 0xba, 0x35, 0xc5, 0x74, 0xeb, 0xc3, 0x2d,
+  0xf8, 0xbb, 0xb5, 0x37, 0x82, 0xbf, 0xa3, 0x5d, 0xfc, 0xbb, 0x37, 0xda, 0x87, 0xbf, 0xdb, 0xdb,
+  0x78, 0x5c, 0x67, 0xb0, 0xbb, 0x1b, 0xb2, 0xbf, 0x50, 0x6d, 0xb8, 0x35, 0x7c, 0x32, 0x1c, 0xf5,
+  0x0f, 0x76, 0xba, 0xc3, 0xfe, 0xee, 0xd6, 0xf6, 0x93, 0xe1, 0xa0, 0xbf, 0x3f, 0x3c, 0xe8, 0x8e,
+  0xfa, 0x7b, 0x04, 0x01, 0x6d, 0x6d, 0x61, 0xb5, 0xe1, 0x1e, 0xfe, 0xdd, 0x3d, 0xd8, 0xc6, 0x37,
+  0xa3, 0x1d, 0x0e, 0x82, 0x83, 0x7b, 0x72, 0xd0, 0x1d, 0x3c, 0xde, 0x7b, 0xb2, 0xdb, 0x1f, 0x6d,
+  0xef, 0x75, 0x19, 0x16, 0xc7, 0x78, 0xd4, 0x74, 0x07, 0x7e, 0x43, 0xf3, 0x5d, 0x50, 0x1e, 0x18,
+  0xb4, 0x9d, 0x11, 0xfe, 0x1e, 0xee, 0x0f, 0x11, 0xf2, 0x93, 0xad, 0xfe, 0x80, 0xb7, 0xb7, 0xff,
+  0x84, 0xfd, 0xed, 0xe2, 0x0b, 0x8e, 0x52, 0x97, 0xa1, 0x44, 0x8e, 0x65, 0x15, 0x5e, 0x7d, 0x0b,
+  0x00, 0x4a, 0xb0, 0xd0, 0x44, 0x97, 0x35, 0xf7, 0x64, 0xd0, 0xdd, 0xbb, 0x18, 0x85, 0xfc, 0x0d,
+  0xef, 0x3a, 0xf6, 0x7c, 0xd4, 0x65, 0x3d, 0xef, 0x62, 0xcf, 0xb7, 0xba, 0xac, 0xe7, 0x5d, 0x86,
+  0x6a, 0x97, 0x35, 0xc0, 0x5a, 0xdc, 0xee, 0xb2, 0x3e, 0x43, 0x93, 0xdb, 0x40, 0x41, 0xf6, 0xf7,
+  0x09, 0x47, 0x6f, 0xb8, 0xd5, 0xdf, 0x22, 0x53, 0xd6, 0xf1, 0x2e, 0xeb, 0x78, 0x97, 0x75, 0x1c,
+  0x61, 0x02, 0x1c, 0x8e, 0x22, 0xef, 0xf8, 0x5e, 0x77, 0xb8, 0x3b, 0x1f, 0x85, 0xac, 0x61, 0x4e,
+  0xff, 0xa9, 0x24, 0x39, 0x90, 0xbf, 0x2b, 0x49, 0x0e, 0xe4, 0xef, 0x2a, 0xf4, 0x0a, 0x59, 0xff,
+  0xba, 0x72, 0x10, 0xa0, 0xe1, 0x1e, 0x6f, 0x1e, 0x1b, 0xee, 0x72, 0xea, 0x63, 0xfb, 0x9c, 0xe4,
+  0x5b, 0xa0, 0x8a, 0xb1, 0x96, 0x7b, 0x39, 0x16, 0xdb, 0xdb, 0x3d, 0xd1, 0x0f, 0x18, 0xfa, 0x9f,
+  0xc9, 0x53, 0x40, 0x6a, 0x38, 0x85, 0x57, 0xbb, 0x3b, 0x80, 0x58, 0x6f, 0x0b, 0x7e, 0x61, 0x91,
+  0xad, 0xde, 0x56, 0x2a, 0x7e, 0x75, 0xf1, 0x37, 0x80, 0xc6, 0xa7, 0x2e, 0x3c, 0x9d, 0x1e, 0xb0,
+  0xb2, 0xc3, 0x61, 0x17, 0xab, 0x1a, 0x27, 0x13, 0xf4, 0x9d, 0xa5, 0x1e, 0x56, 0xce, 0x85, 0x87,
+  0x31, 0xaf, 0xef, 0xdd, 0xf7, 0x2f, 0xf0, 0xc6, 0x29, 0x5f, 0xd9, 0x31, 0xaa, 0xc5, 0x2c, 0xa9,
+  0xaf, 0x9d, 0x94, 0xb2, 0xd2, 0x28, 0x57, 0x4b, 0x85, 0x4a, 0xc9, 0x64, 0xdc, 0x50, 0x50, 0x2b,
+  0x96, 0x08, 0x11, 0x41, 0xcf, 0x0f, 0xbc, 0xac, 0x72, 0x3d, 0x55, 0xf5, 0x13, 0xf7, 0x1d, 0x11,
+  0xb5, 0xb2, 0x4c, 0xeb, 0xb4, 0x96, 0x34, 0xdf, 0x88, 0xae, 0x17, 0x7b, 0xb6, 0x17, 0x7c, 0x49,
+  0x26, 0xcf, 0x5e, 0xbd, 0x00, 0xba, 0x26, 0x78, 0x25, 0x95, 0xc3, 0x3c, 0xe1, 0x34, 0x50, 0x94,
+  0xa9, 0x8e, 0x85, 0xce, 0x19, 0x65, 0x4b, 0x0e, 0x73, 0x68, 0x7e, 0x47, 0x85, 0xb5, 0xfc, 0xab,
+  0xae, 0x62, 0xb2, 0x5b, 0xbb, 0x10, 0x3f, 0xcf, 0xf7, 0x13, 0x58, 0xe5, 0x2c, 0x3e, 0x72, 0xf5,
+  0x8b, 0x5b, 0x25, 0x3e, 0x7c, 0xcf, 0x46, 0x95, 0x3d, 0x1b, 0xdd, 0x6a, 0xcf, 0x94, 0xb1, 0xe5,
+  0x0b, 0x62, 0x4a, 0xf4, 0xa4, 0xde, 0xd6, 0x69, 0x34, 0xdd, 0x62, 0xa3, 0xdd, 0x07, 0xe0, 0x3a,
+  0xb9, 0xa6, 0x2e, 0x9f, 0x45, 0xfe, 0xfa, 0xd6, 0x3d, 0x16, 0xea, 0x8f, 0xbe, 0xa0, 0xe7, 0x33,
+  0x02, 0xaa, 0x02, 0xf9, 0x9e, 0xd2, 0xf3, 0xb1, 0x39, 0x49, 0x9d, 0x50, 0xb4, 0xeb, 0x4b, 0x1d,
+  0x4d, 0x96, 0x90, 0xbf, 0xfe, 0x44, 0x83, 0x4a, 0xee, 0x14, 0xd0, 0x03, 0xec, 0x9e, 0xcf, 0x10,
+  0x2f, 0x77, 0x31, 0x71, 0xe2, 0xb1, 0xbe, 0xa0, 0xe6, 0xae, 0x3a, 0x55, 0xcb, 0x73, 0x9f, 0x95,
+  0xb8, 0xfc, 0xb5, 0xe3, 0xaa, 0xbd, 0xe9, 0xec, 0x9f, 0x8b, 0x1c, 0x2c, 0xbf, 0x3f, 0x1e, 0x4f,
+  0x29, 0x21, 0xa1, 0xf3, 0x7d, 0xce, 0xbd, 0x1f, 0x66, 0x90, 0xef, 0x8b, 0x2b, 0xc5, 0x89, 0x30,
+  0xe8, 0x7d, 0x42, 0x03, 0x8c, 0x87, 0xa4, 0xa2, 0x6f, 0x50, 0xb3, 0x79, 0xc8, 0x8e, 0x59, 0xf9,
+  0x55, 0x83, 0xdc, 0xb0, 0xb0, 0x36, 0xd0, 0xc7, 0x79, 0x9d, 0xbf, 0xf7, 0x51, 0x16, 0x53, 0x99,
+  0xef, 0x4b, 0x3e, 0xa9, 0xf9, 0x9b, 0xd1, 0xfa, 0xa9, 0x5b, 0x56, 0xc6, 0x31, 0x6b, 0x33, 0xfa,
+  0xf7, 0x3e, 0x94, 0x0f, 0xf8, 0x5e, 0x95, 0x0c, 0x47, 0xbd, 0x39, 0x1a, 0x6d, 0x99, 0x4f, 0xe6,
+  0x13, 0x1a, 0xd6, 0xec, 0x92, 0x86, 0x17, 0xf4, 0x31, 0xa0, 0xc6, 0x6f, 0x7b, 0xa9, 0x1a, 0xde,
+  0x66, 0x65, 0xb5, 0x61, 0x7e, 0x95, 0x57, 0xf9, 0x74, 0x06, 0x5a, 0x7f, 0xa9, 0x6e, 0x75, 0x6d,
+  0xbf, 0x86, 0x30, 0x35, 0x3c, 0x4f, 0x58, 0x83, 0x72, 0x30, 0xd9, 0xe3, 0x2d, 0x2a, 0x2a, 0x5a,
+  0x2b, 0x0e, 0x55, 0xa5, 0xea, 0xbb, 0xa6, 0xac, 0x30, 0xf7, 0x5b, 0xd7, 0x87, 0x79, 0xd5, 0x15,
+  0xfe, 0x85, 0xae, 0x4f, 0xd3, 0x69, 0x12, 0x30, 0xd7, 0x63, 0x77, 0x8a, 0xf6, 0x5f, 0x3f, 0xbe,
+  0x8c, 0xba, 0x11, 0xee, 0x92, 0x53, 0x78, 0xce, 0xba, 0x0b, 0xdb, 0xda, 0x68, 0x29, 0xfe, 0xba,
+  0x5b, 0xcd, 0xa0, 0xd9, 0x2d, 0xab, 0xe1, 0xc2, 0xea, 0xfe, 0xc9, 0xa8, 0xe0, 0x96, 0x42, 0xf7,
+  0xa1, 0x15, 0xb9, 0xd7, 0x29, 0x25, 0x27, 0x0b, 0xc0, 0x24, 0xf0, 0x42, 0xf2, 0x3a, 0x0a, 0xb2,
+  0x94, 0xb4, 0xff, 0xed, 0x5f, 0x1f, 0x75, 0x3e, 0x21, 0xa9, 0x21, 0x98, 0x8b, 0x21, 0x57, 0x25,
+  0x31, 0xea, 0xcb, 0x69, 0xd2, 0xe2, 0x7b, 0xa5, 0xf8, 0xbf, 0x8b, 0x35, 0xfe, 0xf1, 0x6a, 0x11,
+  0xf8, 0x78, 0x66, 0xfc, 0xd3, 0x5a, 0xe7, 0x25, 0x5a, 0x75, 0x6b, 0x7d, 0x75, 0x39, 0x6b, 0xbd,
+  0x97, 0xc5, 0xff, 0x5d, 0x0c, 0x6d, 0x1e, 0x4f, 0x50, 0xc8, 0xdf, 0x4f, 0x6c, 0x94, 0x05, 0x86,
+  0x0a, 0x82, 0x75, 0xe3, 0xdd, 0xb4, 0x86, 0x35, 0xf2, 0x76, 0xc5, 0x4f, 0x5a, 0x1d, 0xf8, 0xb5,
+  0x96, 0x3e, 0xa9, 0x5f, 0x7c, 0x41, 0xbe, 0x61, 0xc7, 0xfb, 0x23, 0x58, 0x9a, 0x7f, 0xb3, 0xeb,
+  0xe0, 0x3d, 0xa5, 0x13, 0x63, 0x31, 0x70, 0xc8, 0x7a, 0x93, 0xfc, 0xed, 0x77, 0x18, 0x24, 0xd5,
+  0xba, 0x37, 0x1c, 0x88, 0x11, 0x72, 0x8f, 0x49, 0x29, 0xbf, 0x0b, 0x64, 0x8a, 0xbb, 0xf6, 0x6c,
+  0x2e, 0x52, 0xaf, 0x60, 0xb6, 0x3e, 0xb2, 0xe8, 0x9a, 0xde, 0xd0, 0xf1, 0xc1, 0x7b, 0x7b, 0xd4,
+  0x1a, 0xee, 0xd8, 0x1f, 0xf8, 0x4c, 0x28, 0x3a, 0x60, 0x97, 0xd0, 0x3b, 0xc8, 0xaf, 0x08, 0xb4,
+  0x4b, 0x89, 0xe8, 0xb0, 0xe1, 0xc0, 0xfe, 0x14, 0x47, 0xac, 0xb3, 0xce, 0x3c, 0x30, 0x06, 0xe5,
+  0xfa, 0x28, 0x6d, 0x8e, 0xc5, 0xa5, 0x7d, 0x47, 0x6e, 0x71, 0x90, 0x47, 0xf0, 0x92, 0xa3, 0x23,
+  0xd2, 0x1b, 0x92, 0xaf, 0xc9, 0x97, 0xcf, 0x67, 0xb3, 0x2f, 0xc9, 0x58, 0xf9, 0xe4, 0xca, 0x56,
+  0x02, 0xf3, 0xb6, 0x18, 0xbd, 0x27, 0xc1, 0x85, 0x16, 0x0c, 0x6c, 0x57, 0x30, 0xb1, 0xdd, 0xfc,
+  0x50, 0xa2, 0xf5, 0x51, 0x18, 0x2c, 0xf3, 0x69, 0xd2, 0x1e, 0xee, 0x0f, 0xfe, 0xed, 0x5f, 0x3f,
+  0x25, 0xbd, 0x68, 0x06, 0xe8, 0x09, 0xec, 0xaa, 0x64, 0x69, 0x6d, 0x31, 0x4d, 0x80, 0x3e, 0x2a,
+  0x4a, 0xff, 0xdd, 0x9b, 0xb7, 0x56, 0x59, 0xbc, 0xf0, 0xb2, 0x60, 0x4a, 0xc4, 0x4d, 0xb7, 0x9f,
+  0xd0, 0xd8, 0x2a, 0xf7, 0xef, 0x36, 0x30, 0x70, 0x35, 0x2b, 0xfd, 0x81, 0x47, 0x4b, 0x49, 0xb7,
+  0x63, 0xdc, 0x1e, 0xdc, 0x2a, 0x0f, 0xb1, 0x30, 0x42, 0xdc, 0x52, 0xe2, 0xa1, 0xbc, 0x0a, 0x7c,
+  0x62, 0x06, 0xf4, 0x9d, 0xd3, 0xab, 0xbe, 0x03, 0x11, 0x63, 0x05, 0xfd, 0x08, 0x5c, 0x23, 0x5c,
+  0xf4, 0x9f, 0x1e, 0xcb, 0xf8, 0x8d, 0xd9, 0xc5, 0xff, 0xb5, 0x59, 0xe5, 0x43, 0x0f, 0x11, 0x1a,
+  0x26, 0x7a, 0x2c, 0x76, 0x88, 0x05, 0x27, 0x7c, 0x3f, 0xa7, 0x11, 0x1b, 0x30, 0xea, 0xdf, 0xee,
+  0x78, 0x99, 0x63, 0x53, 0x84, 0x2d, 0x63, 0xe3, 0x0f, 0x56, 0x09, 0x50, 0x59, 0x30, 0x4a, 0xeb,
+  0xd3, 0xb1, 0x38, 0x35, 0x0b, 0xbe, 0x74, 0x47, 0x35, 0xbb, 0x8c, 0x56, 0x8b, 0xd3, 0xcc, 0x4b,
+  0x32, 0x74, 0x68, 0xc2, 0x6e, 0x04, 0x7f, 0x32, 0xe7, 0xe6, 0xb8, 0x44, 0xbf, 0x32, 0x13, 0x51,
+  0x62, 0x35, 0xc9, 0xbf, 0x05, 0xa0, 0x5c, 0x6b, 0xd9, 0x1f, 0x0f, 0x06, 0x2d, 0x57, 0x1a, 0x32,
+  0xbb, 0x63, 0x0d, 0xb1, 0x7d, 0x18, 0xf9, 0x1c, 0x57, 0xf8, 0x71, 0x6d, 0x4c, 0x25, 0x10, 0x89,
+  0xe7, 0xa0, 0x1a, 0xcf, 0x86, 0x56, 0x40, 0x31, 0x2a, 0xec, 0xb6, 0xe5, 0x56, 0x8e, 0x70, 0xa1,
+  0x1b, 0x59, 0xc3, 0x23, 0x98, 0xab, 0x44, 0xf9, 0x15, 0xf3, 0xfc, 0x1b, 0x53, 0x07, 0x1e, 0xb9,
+  0x38, 0xc8, 0x3d, 0x27, 0x9d, 0x72, 0xa9, 0x56, 0x17, 0xae, 0xd0, 0x84, 0x4b, 0xf4, 0xe0, 0x12,
+  0x2d, 0x58, 0x93, 0x57, 0x6f, 0xca, 0x75, 0x61, 0xd1, 0xdb, 0x6f, 0x4a, 0x0b, 0x88, 0x61, 0xb2,
+  0xbc, 0xaf, 0xe5, 0x1a, 0xb0, 0x9b, 0x78, 0xb5, 0x6a, 0x70, 0x23, 0x25, 0x78, 0xa3, 0x4a, 0xa1,
+  0xfd, 0x15, 0xad, 0xa1, 0xc7, 0xd2, 0x64, 0xfb, 0x5b, 0xdc, 0x07, 0xd6, 0x85, 0xd0, 0x5e, 0x6f,
+  0x91, 0xa9, 0x58, 0x66, 0xf8, 0xfa, 0x59, 0x10, 0xad, 0x74, 0x6d, 0x59, 0x7b, 0x75, 0xa9, 0xd4,
+  0x07, 0x9a, 0x69, 0x04, 0xd2, 0x4d, 0x2a, 0x70, 0xab, 0xd4, 0x0a, 0x0a, 0x3f, 0x69, 0x93, 0xd2,
+  0x9b, 0x25, 0x18, 0x5f, 0x63, 0x25, 0xab, 0x50, 0x25, 0x4b, 0x36, 0xe7, 0xa5, 0x62, 0xff, 0xe3,
+  0x0e, 0xfd, 0x83, 0xc4, 0xe3, 0x3b, 0x87, 0x4f, 0x79, 0xf0, 0x83, 0x54, 0xa2, 0x99, 0x63, 0x59,
+  0x3d, 0xfe, 0x8d, 0x2b, 0x7c, 0x02, 0x2c, 0x70, 0xeb, 0x5a, 0xce, 0x3a, 0x0c, 0xc4, 0xcf, 0xbf,
+  0x49, 0x1a, 0x31, 0x27, 0xf4, 0x3d, 0xe1, 0x41, 0xaf, 0xd4, 0x24, 0x36, 0xca, 0x86, 0xd3, 0x2f,
+  0xf1, 0x63, 0x6b, 0x73, 0xb8, 0xcc, 0xd9, 0x6d, 0x4c, 0xde, 0xb2, 0x62, 0x6a, 0xff, 0x50, 0xea,
+  0x26, 0x71, 0xd8, 0x28, 0xdf, 0xab, 0x6b, 0x8b, 0x75, 0x23, 0x7a, 0x71, 0xed, 0xab, 0x89, 0xe6,
+  0x55, 0x4a, 0x2f, 0xa6, 0x8b, 0xd5, 0xd1, 0xeb, 0x55, 0x49, 0x21, 0x83, 0x5e, 0x65, 0xc5, 0x6e,
+  0x8d, 0x5e, 0x8d, 0xd8, 0xd3, 0x4d, 0x41, 0x27, 0xfd, 0x9e, 0xe0, 0x3b, 0xd8, 0xe5, 0xc8, 0x67,
+  0xc2, 0x5e, 0x90, 0xf6, 0x73, 0x66, 0xeb, 0xf6, 0xc2, 0xce, 0x78, 0x3d, 0xd3, 0x66, 0xb9, 0xc3,
+  0xd8, 0x20, 0x28, 0x6f, 0x78, 0xa3, 0x86, 0x9e, 0x25, 0xa5, 0x1a, 0x91, 0x53, 0xf3, 0x2f, 0xd3,
+  0xfe, 0x59, 0xbf, 0x4b, 0xbe, 0x39, 0x79, 0xf9, 0xea, 0xf1, 0x83, 0xfb, 0x3f, 0x74, 0xc9, 0x77,
+  0xf7, 0x8f, 0xef, 0xbf, 0x3a, 0x79, 0xfe, 0xcc, 0x69, 0x43, 0x95, 0x47, 0x53, 0x46, 0xdb, 0x0e,
+  0xa8, 0xeb, 0x9c, 0x3c, 0x11, 0x34, 0xb9, 0xc9, 0xf9, 0x93, 0xca, 0xd3, 0x27, 0x65, 0x7c, 0x53,
+  0x79, 0x12, 0x85, 0xff, 0xef, 0x16, 0xcf, 0xa3, 0xd4, 0x31, 0xeb, 0xaf, 0xe6, 0x94, 0x10, 0x87,
+  0x0b, 0x22, 0x7e, 0x0a, 0x2d, 0x88, 0x7f, 0x03, 0xaa, 0xa8, 0x38, 0x11, 0xd1, 0x43, 0xa4, 0xed,
+  0x19, 0xcc, 0x16, 0xb7, 0x47, 0x41, 0xb2, 0xb8, 0xf4, 0x12, 0xaa, 0xee, 0xce, 0x66, 0x97, 0xdf,
+  0xf1, 0x63, 0x00, 0xf9, 0xe2, 0x28, 0xff, 0x33, 0x49, 0xd8, 0xbf, 0x4e, 0x48, 0x27, 0x2f, 0xc6,
+  0xa4, 0xc4, 0x78, 0xc1, 0xd6, 0xfc, 0xdc, 0xd4, 0x7b, 0xef, 0x11, 0x9e, 0x14, 0x05, 0xf4, 0xfa,
+  0xfd, 0x7e, 0x99, 0xc5, 0xa0, 0xbe, 0xb9, 0xc7, 0x71, 0x9a, 0xe1, 0xfc, 0xae, 0x6c, 0x74, 0x2e,
+  0x0a, 0xdd, 0x6e, 0xd3, 0xaf, 0x97, 0x28, 0xe5, 0x2b, 0x1b, 0x5e, 0xb1, 0x22, 0x79, 0xb3, 0x4f,
+  0x62, 0xcf, 0xbf, 0x69, 0xab, 0xe8, 0x40, 0x44, 0xbb, 0x5e, 0x55, 0xb3, 0x61, 0x70, 0x41, 0xd1,
+  0xb0, 0xd4, 0xba, 0xd7, 0xbb, 0x7e, 0x43, 0x2c, 0x00, 0x3c, 0xbd, 0x8a, 0xa6, 0x95, 0x4d, 0x61,
+  0xdc, 0x70, 0xe6, 0x65, 0xab, 0xf4, 0x46, 0x6d, 0x09, 0x43, 0x6a, 0x6d, 0xa7, 0x44, 0xb9, 0xba,
+  0xb6, 0xae, 0x23, 0x30, 0x5c, 0xd2, 0x43, 0x33, 0xaf, 0xc0, 0x04, 0x5e, 0x04, 0x59, 0x69, 0x52,
+  0x78, 0xb1, 0x81, 0x3f, 0xf5, 0x2e, 0x68, 0x1e, 0xed, 0x9f, 0xdb, 0x5b, 0xee, 0x6e, 0xa2, 0xb8,
+  0x10, 0x70, 0xf5, 0xa5, 0x35, 0xce, 0x94, 0x99, 0xfc, 0xf0, 0xf4, 0x05, 0x92, 0xfd, 0xd8, 0x4b,
+  0x33, 0x5d, 0x57, 0x5d, 0xb4, 0xee, 0xfd, 0xf2, 0x9f, 0xfe, 0x5f, 0xe9, 0x19, 0x9c, 0xc8, 0x93,
+  0x56, 0x77, 0x8b, 0x73, 0xce, 0xfa, 0xc1, 0xea, 0x33, 0xcc, 0xbf, 0x31, 0xe9, 0x4f, 0xe3, 0xc5,
+  0xe6, 0x62, 0xe6, 0xe1, 0xa5, 0x05, 0x57, 0xbd, 0x18, 0x0f, 0xc2, 0x6e, 0x2a, 0x4d, 0x14, 0x32,
+  0xbf, 0xec, 0x80, 0x75, 0x42, 0xd9, 0x65, 0x24, 0x78, 0xfc, 0x97, 0x26, 0x24, 0x8a, 0xa1, 0x0d,
+  0x9a, 0x24, 0xaa, 0x13, 0xef, 0xde, 0xd3, 0xde, 0x23, 0x0e, 0xbf, 0x38, 0x74, 0x2d, 0xfb, 0x5c,
+  0x90, 0xb2, 0xc8, 0x73, 0xef, 0x5d, 0x00, 0x61, 0xe4, 0x91, 0x4e, 0x35, 0xd9, 0xfd, 0x5d, 0xee,
+  0x0c, 0x97, 0x94, 0x80, 0x95, 0x8c, 0x04, 0xe9, 0x29, 0x2b, 0x4e, 0x8e, 0x08, 0x13, 0xc4, 0x87,
+  0xda, 0xb7, 0xfb, 0x2f, 0x98, 0xed, 0x34, 0xff, 0x26, 0x0f, 0xac, 0x6f, 0x22, 0xf9, 0x41, 0x40,
+  0x07, 0x19, 0x46, 0x0c, 0x71, 0x4b, 0x87, 0x08, 0x19, 0x43, 0x3d, 0x45, 0xf1, 0x1b, 0x8a, 0x1a,
+  0x7e, 0x3c, 0x5d, 0x2d, 0x40, 0xae, 0xf6, 0x41, 0x5a, 0x3e, 0xbc, 0x80, 0x1f, 0x98, 0x88, 0x1f,
+  0x3b, 0xdc, 0x6e, 0x3d, 0x78, 0xfe, 0x54, 0xd8, 0x52, 0x70, 0xea, 0xc2, 0x2a, 0xd9, 0x25, 0xb3,
+  0x55, 0x34, 0x65, 0xc7, 0x90, 0xdb, 0x1d, 0xf2, 0x6e, 0xa3, 0x91, 0x33, 0x92, 0x98, 0x3e, 0x50,
+  0xe9, 0x69, 0x2c, 0x4e, 0x7c, 0x02, 0xd2, 0x1e, 0x62, 0xfc, 0x33, 0x2e, 0x2d, 0xc8, 0x73, 0x4f,
+  0x4e, 0xbe, 0x7b, 0xc8, 0xd0, 0xd5, 0x0e, 0xc1, 0x6e, 0x14, 0xe6, 0xa2, 0xfc, 0x4b, 0x7a, 0x76,
+  0xc2, 0x6a, 0x1c, 0x15, 0x1d, 0x81, 0xb1, 0x7c, 0x18, 0x52, 0xfc, 0xf9, 0xcd, 0xd5, 0x89, 0xdf,
+  0x36, 0x0e, 0xd2, 0x2a, 0x1e, 0xcb, 0x60, 0x46, 0xda, 0x3a, 0x18, 0xb5, 0x53, 0xc4, 0x68, 0xc2,
+  0x41, 0x20, 0x86, 0x6c, 0x29, 0x55, 0xe4, 0x60, 0x4d, 0x28, 0xf4, 0x04, 0x87, 0xaa, 0xcc, 0xcd,
+  0x8a, 0x85, 0xbc, 0x19, 0x1e, 0x2d, 0x38, 0x12, 0x85, 0x8d, 0x89, 0xdd, 0xcf, 0xe2, 0xd7, 0xb8,
+  0xe6, 0x01, 0xdb, 0xd2, 0x76, 0xc7, 0xfc, 0x98, 0x50, 0xa6, 0x97, 0xb5, 0x37, 0x7f, 0xfc, 0x3f,
+  0xdc, 0x0a, 0xd4, 0xe6, 0x59, 0x97, 0xb4, 0x5a, 0x86, 0xab, 0x16, 0x3b, 0x2f, 0x30, 0xbb, 0x73,
+  0x74, 0xc4, 0xdb, 0x37, 0xb1, 0xd7, 0xed, 0x65, 0xbc, 0x8c, 0x0e, 0xe5, 0xbd, 0xf2, 0xf4, 0x5e,
+  0x69, 0x41, 0xbe, 0xc7, 0x77, 0x0a, 0x6b, 0x82, 0xf4, 0xde, 0x7c, 0x0c, 0x3c, 0x90, 0x5f, 0x43,
+  0x20, 0xce, 0x43, 0xdc, 0x22, 0x2f, 0x82, 0x9a, 0x90, 0x66, 0x44, 0x5e, 0xd6, 0x50, 0xcb, 0x1c,
+  0xf9, 0xad, 0x0e, 0x0a, 0xf2, 0x1c, 0x04, 0xc7, 0xec, 0x58, 0xec, 0xe4, 0xab, 0x60, 0x18, 0x17,
+  0x35, 0x74, 0x14, 0xd6, 0xd6, 0x81, 0x38, 0xfa, 0xc5, 0x7d, 0xbb, 0x15, 0x3c, 0x84, 0xe3, 0xa4,
+  0x79, 0x7a, 0x8d, 0x31, 0x12, 0x64, 0xcd, 0x7b, 0x4c, 0xbc, 0x94, 0xe0, 0xfc, 0xdb, 0xd0, 0x55,
+  0x6c, 0x85, 0x1c, 0x7d, 0x94, 0xe8, 0xd0, 0x1f, 0xbe, 0xa7, 0x38, 0xdc, 0x30, 0xc1, 0x31, 0xad,
+  0x9a, 0x1d, 0x3e, 0xc6, 0xc6, 0x83, 0xec, 0xcb, 0x94, 0x1d, 0x2c, 0x5d, 0x78, 0x29, 0x34, 0xaf,
+  0xee, 0x01, 0x2c, 0x7e, 0xd2, 0x9b, 0x91, 0x66, 0x56, 0x68, 0xe9, 0xf7, 0xe2, 0x7f, 0x2d, 0x9b,
+  0xc3, 0x9c, 0x75, 0x80, 0x5d, 0x0f, 0x2b, 0xcb, 0x29, 0x58, 0x60, 0x69, 0x7e, 0x30, 0x27, 0xa2,
+  0x05, 0x19, 0x5a, 0x15, 0x7c, 0x4a, 0x28, 0x88, 0x4c, 0x9b, 0x8c, 0x8c, 0x31, 0x55, 0x32, 0xfa,
+  0x71, 0x96, 0x36, 0x20, 0xa3, 0xd2, 0xa4, 0x09, 0xf2, 0x25, 0x5d, 0xc4, 0xb0, 0x22, 0xaa, 0xd8,
+  0xc6, 0x48, 0x5d, 0x46, 0x57, 0x72, 0x09, 0x6d, 0xa4, 0x28, 0x20, 0xae, 0x08, 0x46, 0x54, 0xf5,
+  0x96, 0xce, 0x49, 0x51, 0x46, 0x5e, 0x8d, 0x04, 0x47, 0x6e, 0x22, 0xd4, 0x91, 0xdb, 0x20, 0x63,
+  0x15, 0xd1, 0x36, 0xec, 0x69, 0xae, 0x4c, 0x6e, 0x50, 0xca, 0x60, 0x73, 0xd9, 0x8f, 0x23, 0x2e,
+  0x52, 0x56, 0x51, 0x08, 0xb3, 0x14, 0x57, 0x27, 0x27, 0x57, 0x63, 0x67, 0xe4, 0xf2, 0xa6, 0xa3,
+  0x98, 0xd0, 0x6c, 0x95, 0x44, 0xa4, 0x25, 0x75, 0x08, 0xd8, 0x1f, 0x50, 0x90, 0x89, 0xb8, 0x0c,
+  0xc2, 0xe2, 0x49, 0xfd, 0x3e, 0x79, 0x42, 0xf9, 0xaa, 0x18, 0x01, 0xcf, 0x2f, 0x60, 0x51, 0x63,
+  0x27, 0xaa, 0x13, 0x50, 0x35, 0x19, 0x93, 0x2e, 0x93, 0x98, 0x9d, 0xab, 0x6e, 0x39, 0x44, 0x91,
+  0x8d, 0x6c, 0x25, 0x92, 0x2c, 0x95, 0x4b, 0xbb, 0xb5, 0x09, 0xd2, 0x60, 0x16, 0x9c, 0xf5, 0xff,
+  0x9a, 0x82, 0x9e, 0xa3, 0xca, 0xde, 0x3e, 0x26, 0xaa, 0x6d, 0xb7, 0x13, 0x9a, 0x2e, 0x41, 0x5e,
+  0xd0, 0x0e, 0x39, 0xba, 0x47, 0xe4, 0x03, 0x2b, 0xdd, 0xee, 0x38, 0x8a, 0x63, 0x4a, 0x18, 0x56,
+  0x54, 0x1f, 0x18, 0x65, 0x41, 0x67, 0x49, 0x63, 0x16, 0xec, 0x37, 0x8e, 0xaa, 0xb7, 0x6c, 0xd9,
+  0x82, 0x5b, 0x16, 0xb7, 0xc7, 0x37, 0x17, 0x52, 0x7f, 0x5b, 0xd1, 0xe4, 0x8a, 0x27, 0xdf, 0x8b,
+  0x41, 0xce, 0xf4, 0xf3, 0x93, 0xf3, 0x9d, 0x3e, 0x3b, 0x3a, 0xdf, 0x97, 0x5a, 0x01, 0xb4, 0x31,
+  0x41, 0x9f, 0xa8, 0x35, 0xe3, 0x24, 0x28, 0x4b, 0x2b, 0xb5, 0x04, 0xa0, 0x92, 0xa3, 0xa3, 0x63,
+  0x97, 0x66, 0x5a, 0x1c, 0x4a, 0x3c, 0x14, 0x7f, 0xbc, 0xb0, 0x4c, 0x13, 0xd8, 0xea, 0x94, 0x35,
+  0x5a, 0xd9, 0x46, 0x3f, 0x4f, 0x33, 0x08, 0x8b, 0x6a, 0xa2, 0xe9, 0x12, 0x35, 0x54, 0xe0, 0x19,
+  0x0c, 0x3a, 0xd7, 0xc4, 0xa9, 0x0c, 0xda, 0x8d, 0xd0, 0x19, 0xdd, 0x2a, 0x3a, 0x23, 0x17, 0x3a,
+  0x65, 0x93, 0xba, 0x82, 0xdc, 0xec, 0xae, 0xc1, 0x4e, 0x2e, 0x8f, 0x19, 0x53, 0xe2, 0x3b, 0xf2,
+  0x4f, 0xff, 0x64, 0xc9, 0x89, 0x06, 0x8b, 0xab, 0x0e, 0x28, 0x17, 0x74, 0x0e, 0x60, 0x7c, 0xf1,
+  0xf5, 0x96, 0x41, 0xed, 0xd2, 0x6d, 0xa7, 0x7a, 0x72, 0xa8, 0x38, 0x26, 0xed, 0xb0, 0x79, 0xab,
+  0x22, 0xf9, 0xe2, 0x8b, 0x46, 0xe5, 0xfa, 0x19, 0x6c, 0x7b, 0x40, 0x48, 0xa0, 0xc2, 0xd4, 0xd2,
+  0x6d, 0x46, 0xf6, 0x4c, 0x94, 0x5d, 0xc8, 0xbb, 0xfe, 0xf4, 0xfe, 0xe9, 0xb7, 0xe6, 0x58, 0xce,
+  0x3d, 0x14, 0x83, 0xd4, 0x47, 0x24, 0x9c, 0xa3, 0xe5, 0x5a, 0xab, 0x1c, 0xb0, 0xed, 0xf5, 0x52,
+  0x87, 0xac, 0xed, 0x20, 0x24, 0x23, 0x34, 0x1b, 0x44, 0x33, 0x35, 0x53, 0x3e, 0x96, 0x35, 0x24,
+  0x63, 0xa9, 0x9a, 0xd6, 0xe1, 0x16, 0x47, 0x9a, 0xa5, 0xc6, 0x6d, 0x89, 0x64, 0x46, 0xeb, 0x34,
+  0xa7, 0x9d, 0x47, 0xe8, 0x48, 0xf5, 0xca, 0xdd, 0x94, 0x5a, 0x96, 0x8b, 0xe5, 0x40, 0x1c, 0xca,
+  0x68, 0xda, 0x9a, 0x9e, 0x0c, 0xaf, 0xac, 0x5f, 0x6c, 0x79, 0xe8, 0x6b, 0x65, 0xb1, 0x4f, 0xc3,
+  0x01, 0xfc, 0xaf, 0x43, 0x36, 0xd9, 0x8f, 0xf5, 0xba, 0xd7, 0xb0, 0x49, 0xa3, 0x34, 0x36, 0xba,
+  0xb3, 0x7e, 0x9b, 0x79, 0x12, 0x59, 0x63, 0xbe, 0xcb, 0xf7, 0x72, 0x7c, 0x4c, 0x35, 0x49, 0x26,
+  0x0a, 0x18, 0x37, 0x6b, 0xc6, 0x0a, 0xaa, 0x2d, 0xeb, 0x1b, 0x6a, 0x68, 0xf1, 0x8c, 0xe3, 0x50,
+  0x54, 0xe2, 0xd3, 0x77, 0x15, 0xf9, 0x74, 0x16, 0xb0, 0x2b, 0x50, 0xbf, 0xb6, 0x4a, 0x8c, 0xa1,
+  0xd7, 0x87, 0xeb, 0x22, 0xc3, 0xc3, 0x37, 0x3a, 0x95, 0x31, 0x08, 0xd7, 0xe8, 0x13, 0x86, 0x29,
+  0x58, 0x8b, 0xea, 0xd7, 0xa4, 0xf5, 0x7c, 0x36, 0xb3, 0x0d, 0xe3, 0xe3, 0xf5, 0x5b, 0x68, 0xd8,
+  0x4f, 0x35, 0x4e, 0x55, 0x99, 0x2d, 0xe4, 0xce, 0x1d, 0x46, 0x3c, 0xe5, 0x73, 0x43, 0x80, 0x4a,
+  0x36, 0x01, 0x83, 0x5d, 0x8a, 0x2f, 0x6b, 0x4d, 0x68, 0xe5, 0x10, 0x7f, 0x19, 0xc0, 0xd1, 0x5a,
+  0x00, 0xad, 0x33, 0x8e, 0xe5, 0x52, 0x42, 0x50, 0xc1, 0xac, 0xd1, 0xb0, 0x21, 0xfd, 0x98, 0x7b,
+  0x6d, 0x2b, 0x5a, 0xf1, 0xb5, 0x9a, 0xc8, 0xa8, 0x6b, 0xec, 0xe4, 0xb7, 0x86, 0xa0, 0xb4, 0x13,
+  0x88, 0x95, 0x12, 0x5a, 0x2d, 0xb9, 0x16, 0xe5, 0xb5, 0x03, 0x45, 0x8d, 0xe8, 0x21, 0x4b, 0x37,
+  0x15, 0xc7, 0xd6, 0x99, 0xf3, 0xda, 0x56, 0xac, 0x2a, 0x6b, 0xf4, 0xc5, 0x71, 0x58, 0xa6, 0x51,
+  0xaf, 0xec, 0x7a, 0xb6, 0xf0, 0xec, 0xf5, 0x7a, 0x79, 0xa0, 0xd9, 0x31, 0xf7, 0xdc, 0xa5, 0xf8,
+  0xd2, 0xa5, 0x55, 0x29, 0x81, 0xc8, 0x61, 0x95, 0x6a, 0xe5, 0x88, 0x58, 0xee, 0xb8, 0xd4, 0x34,
+  0x3d, 0x54, 0xb5, 0x1a, 0xa6, 0xdf, 0x00, 0x9e, 0xd4, 0x6b, 0xaa, 0x21, 0x39, 0x15, 0x3f, 0x93,
+  0x2c, 0x0f, 0x91, 0x2f, 0x81, 0xa9, 0xc9, 0x2c, 0xf4, 0x60, 0x1f, 0x39, 0x4b, 0xe2, 0x05, 0x51,
+  0xb6, 0x72, 0x8e, 0xc6, 0x61, 0x53, 0x55, 0x74, 0xdb, 0xcd, 0xd0, 0x36, 0x5d, 0x98, 0x36, 0x80,
+  0x7a, 0x1b, 0xf0, 0xf7, 0x1a, 0x35, 0xb8, 0xab, 0x6b, 0xbd, 0x3a, 0xc3, 0x43, 0x27, 0xd2, 0x3c,
+  0xe2, 0xb9, 0x12, 0x6d, 0x7f, 0x2d, 0x94, 0xfd, 0x35, 0xd1, 0xf5, 0x9d, 0xa8, 0x5a, 0x46, 0x2a,
+  0x2a, 0x4d, 0x6a, 0x24, 0xcd, 0x60, 0x5c, 0x74, 0xcb, 0x8a, 0xc6, 0x99, 0x8a, 0x84, 0xd2, 0xc6,
+  0xc4, 0x98, 0x70, 0x06, 0xef, 0x69, 0xb5, 0x34, 0xa2, 0x38, 0x14, 0x8e, 0xe5, 0x12, 0xad, 0x30,
+  0xc2, 0x4a, 0x2e, 0x20, 0x71, 0xbc, 0x36, 0x8c, 0xa3, 0x2f, 0x02, 0xc6, 0xa3, 0x80, 0x86, 0x7e,
+  0x2a, 0x1a, 0x6b, 0x3b, 0xf8, 0xed, 0x84, 0x03, 0x43, 0x1b, 0x36, 0x0f, 0x70, 0x46, 0x43, 0x4f,
+  0xcf, 0x67, 0x41, 0xc6, 0x3d, 0xd9, 0x82, 0xf0, 0xac, 0x83, 0xd2, 0x45, 0x81, 0x87, 0xfd, 0x94,
+  0x80, 0xaa, 0x25, 0xbf, 0xcd, 0x58, 0x0b, 0xfa, 0xfe, 0x19, 0x31, 0x3c, 0x76, 0x06, 0x2c, 0x73,
+  0x43, 0x82, 0xa3, 0x67, 0x59, 0xe6, 0x4d, 0xe7, 0x24, 0x14, 0x06, 0xc6, 0x94, 0xb4, 0x17, 0xab,
+  0x6c, 0xe5, 0x85, 0xd0, 0x5d, 0xfa, 0x76, 0x1a, 0xae, 0xd2, 0xe0, 0x82, 0x92, 0xaf, 0x58, 0xcc,
+  0x3e, 0xc7, 0x81, 0x46, 0xd3, 0xab, 0x8e, 0xb5, 0x6d, 0x2a, 0x26, 0x62, 0xa7, 0x64, 0xeb, 0x01,
+  0x04, 0x2f, 0x37, 0x88, 0x97, 0xd0, 0xcd, 0x98, 0xf3, 0xfa, 0xa0, 0x57, 0xd8, 0x46, 0xdb, 0x0e,
+  0x8b, 0x89, 0xc0, 0xd3, 0xc5, 0x37, 0x9d, 0x2a, 0xde, 0x70, 0xec, 0x84, 0x2a, 0xc7, 0xd9, 0x0c,
+  0x93, 0xc0, 0x9c, 0x8c, 0x72, 0x44, 0x4e, 0x66, 0xcf, 0x64, 0xeb, 0x66, 0xd1, 0xf7, 0x9d, 0x1a,
+  0x6e, 0xbd, 0x56, 0x77, 0xcb, 0xfa, 0xd5, 0x29, 0x9d, 0x40, 0x1f, 0xb1, 0xbb, 0xae, 0x19, 0xcf,
+  0x98, 0x9a, 0xbb, 0xa1, 0x34, 0x19, 0xdc, 0x54, 0xd3, 0x50, 0x62, 0xce, 0xab, 0x37, 0x30, 0xb2,
+  0x28, 0xea, 0x5e, 0x4c, 0xc1, 0xcf, 0xf5, 0x7b, 0x87, 0xee, 0x7c, 0x9a, 0x25, 0x72, 0x0a, 0x69,
+  0x15, 0x3b, 0xfd, 0xa5, 0xe7, 0xb3, 0xa7, 0xf6, 0xa8, 0x4b, 0x5a, 0x03, 0x87, 0x35, 0x6b, 0x4c,
+  0x5a, 0xc3, 0xfd, 0x56, 0x87, 0x7c, 0x65, 0x06, 0x09, 0x8f, 0x5b, 0xd6, 0x3b, 0xbd, 0x81, 0xa7,
+  0x41, 0xb4, 0xca, 0xe8, 0xb5, 0x70, 0xe3, 0x55, 0x9b, 0x61, 0x37, 0x18, 0x58, 0xab, 0x61, 0x15,
+  0x7d, 0x65, 0xa4, 0x7c, 0x2d, 0x75, 0xa1, 0xe0, 0x75, 0x68, 0x2b, 0xaa, 0x35, 0xc4, 0x7d, 0x6d,
+  0xca, 0x02, 0xf8, 0xeb, 0xd1, 0x35, 0xaf, 0xf8, 0x41, 0xa8, 0xaa, 0x44, 0xba, 0xd7, 0x28, 0xc8,
+  0x4a, 0x51, 0xbd, 0x0b, 0x72, 0x57, 0xaa, 0x17, 0x19, 0x93, 0x51, 0x63, 0x2d, 0xdd, 0x79, 0xba,
+  0xe0, 0x9a, 0xdb, 0xd3, 0x92, 0x3e, 0xdd, 0xd6, 0xde, 0xd4, 0x09, 0xde, 0xad, 0xea, 0xbe, 0x88,
+  0x97, 0xab, 0x10, 0xf5, 0xba, 0x22, 0xc0, 0x8e, 0x0b, 0x31, 0x4b, 0xe7, 0x2d, 0x6d, 0xcd, 0x15,
+  0x48, 0xab, 0x6f, 0x8b, 0x9c, 0x66, 0xc3, 0x3c, 0x84, 0x8e, 0x7c, 0xf1, 0x85, 0xf1, 0xa6, 0xef,
+  0x00, 0xa9, 0x9b, 0x07, 0x5d, 0xba, 0x9b, 0x19, 0xd0, 0x8d, 0x5a, 0x6f, 0xd3, 0x01, 0xb1, 0x82,
+  0xc1, 0x3b, 0x87, 0x48, 0x21, 0xcc, 0x44, 0xcb, 0xc2, 0x14, 0x60, 0x59, 0xa7, 0x46, 0x93, 0x66,
+  0x63, 0x37, 0xeb, 0x31, 0xe5, 0x60, 0xaa, 0x7a, 0xc9, 0x56, 0xac, 0x3a, 0x38, 0x3c, 0xf8, 0x02,
+  0x65, 0x10, 0xa8, 0x5f, 0x8b, 0xa5, 0x6d, 0x47, 0x15, 0xde, 0x58, 0x56, 0x0c, 0x77, 0xa9, 0x80,
+  0x2e, 0xfa, 0xb8, 0x58, 0xc2, 0x28, 0xfb, 0x58, 0x48, 0x25, 0x70, 0xf2, 0x7b, 0x66, 0xcd, 0xea,
+  0x1a, 0xd5, 0xec, 0x65, 0x8f, 0x35, 0x79, 0x85, 0x1e, 0xd0, 0x23, 0xa5, 0x65, 0x1c, 0x84, 0x47,
+  0xab, 0x30, 0xfc, 0x01, 0x3e, 0xb4, 0x4b, 0x2a, 0x2d, 0x60, 0x66, 0xcd, 0xa1, 0x56, 0x5b, 0xaf,
+  0xf6, 0x14, 0x5f, 0xc3, 0xba, 0xfe, 0x15, 0x19, 0x3a, 0x3c, 0x24, 0x59, 0x2c, 0xa4, 0x93, 0xe3,
+  0x9b, 0x29, 0x9d, 0xdc, 0xcd, 0xfa, 0xcc, 0x91, 0xa3, 0xb7, 0xc9, 0x28, 0xd4, 0x51, 0x80, 0x37,
+  0x84, 0x85, 0xb9, 0xa9, 0x52, 0x0b, 0x1a, 0x4a, 0xf1, 0xf4, 0x3a, 0xe0, 0x16, 0x4c, 0xcc, 0xea,
+  0x00, 0x9d, 0x2e, 0x25, 0x2e, 0x8f, 0xd3, 0xf6, 0x2d, 0x13, 0xa8, 0x7e, 0x0a, 0x09, 0xbb, 0x88,
+  0x5b, 0x4e, 0x13, 0xf2, 0xd3, 0xe7, 0xef, 0x90, 0x15, 0xde, 0xf7, 0x3e, 0x7f, 0xc7, 0x46, 0x17,
+  0x7f, 0x00, 0xbd, 0xdf, 0xff, 0xb4, 0x7e, 0x4b, 0x95, 0x4b, 0x2d, 0x6b, 0x89, 0x11, 0xff, 0xfd,
+  0x18, 0x9a, 0xe2, 0xd4, 0x30, 0x5b, 0x29, 0x71, 0x08, 0xac, 0xdb, 0x49, 0x87, 0xc3, 0x60, 0x5d,
+  0xec, 0x1d, 0xee, 0x62, 0x53, 0x5e, 0x9b, 0x31, 0xd0, 0xdc, 0xa5, 0xf3, 0x1d, 0x9e, 0x20, 0xd6,
+  0x83, 0x47, 0x1d, 0x32, 0x91, 0xd5, 0x10, 0x3e, 0xa0, 0xb5, 0x31, 0xe5, 0x41, 0xce, 0x96, 0xd0,
+  0xb5, 0x40, 0x5f, 0x2b, 0xa6, 0xc7, 0x88, 0x8a, 0x29, 0x3d, 0x37, 0x56, 0x13, 0xb7, 0x73, 0xed,
+  0xc8, 0x9d, 0xf7, 0xd7, 0x11, 0xb3, 0x2c, 0xe2, 0xdc, 0x25, 0x5c, 0x6d, 0x9a, 0x68, 0xa6, 0x53,
+  0x03, 0xc2, 0xc7, 0xea, 0xa2, 0x9b, 0xcb, 0xab, 0xb0, 0x5d, 0x87, 0x1b, 0xb9, 0x71, 0x96, 0xb0,
+  0x91, 0x27, 0x72, 0xe8, 0xc9, 0x17, 0x5c, 0x91, 0x20, 0x6c, 0x81, 0x04, 0x61, 0x53, 0xb7, 0x7c,
+  0x5e, 0x23, 0x98, 0x47, 0x6c, 0xbe, 0x8e, 0x0d, 0x60, 0x7a, 0x80, 0xcf, 0x61, 0x45, 0x05, 0x7d,
+  0xbf, 0x56, 0x51, 0xed, 0xbd, 0xdb, 0x5e, 0x67, 0x2a, 0x29, 0x95, 0x86, 0x36, 0x53, 0x11, 0x77,
+  0xe9, 0x4d, 0xdd, 0x2a, 0x05, 0xc0, 0xd1, 0xdc, 0x0d, 0xa8, 0x76, 0x62, 0x37, 0xbf, 0x0e, 0x05,
+  0xca, 0xc9, 0x58, 0xae, 0x1a, 0x99, 0x3a, 0x7f, 0x31, 0xd5, 0xd4, 0x98, 0x42, 0x5d, 0x71, 0xef,
+  0xac, 0x21, 0x9c, 0xf5, 0xc8, 0xc4, 0xd2, 0x75, 0xc1, 0x6e, 0xb2, 0x8e, 0xd7, 0xd1, 0x6a, 0xd6,
+  0xf3, 0x69, 0x86, 0x29, 0xff, 0x27, 0x49, 0x7c, 0x99, 0xd2, 0x04, 0xc3, 0xb8, 0x40, 0x80, 0xff,
+  0x1c, 0x47, 0x14, 0xfb, 0x11, 0xc5, 0x19, 0x0b, 0x3e, 0x0a, 0x22, 0xd7, 0x96, 0x1c, 0x3b, 0x2a,
+  0x5c, 0x1a, 0x50, 0xe7, 0x4f, 0x50, 0xc7, 0x21, 0x05, 0x93, 0x2b, 0xeb, 0x5d, 0xae, 0xae, 0xfd,
+  0x0c, 0x7c, 0x75, 0x12, 0x65, 0x61, 0x1f, 0xd7, 0x1d, 0x5c, 0x38, 0x1e, 0xb1, 0x13, 0x03, 0xa0,
+  0x35, 0x24, 0x34, 0x8d, 0xc3, 0x0b, 0xea, 0xf3, 0xf3, 0x30, 0x4c, 0xa5, 0x10, 0x4d, 0xd8, 0xb9,
+  0x64, 0x1c, 0x1e, 0x7c, 0xd6, 0xf2, 0xcf, 0xb6, 0xc7, 0xbe, 0x32, 0x62, 0xc5, 0x19, 0xb5, 0x22,
+  0x9b, 0x75, 0xec, 0xf8, 0x58, 0x79, 0x3d, 0xbc, 0xe2, 0xa7, 0x1f, 0x45, 0x8c, 0xf3, 0xe7, 0xef,
+  0xb2, 0x9f, 0xdf, 0xb7, 0xfe, 0xf2, 0x93, 0x5d, 0xab, 0xe3, 0x20, 0x47, 0x95, 0x7b, 0x29, 0x6f,
+  0xbf, 0x58, 0x4b, 0x7e, 0xb6, 0x69, 0x50, 0x22, 0x0b, 0xd7, 0x05, 0x6d, 0x2f, 0xf8, 0x66, 0x2c,
+  0x08, 0x36, 0x35, 0xf5, 0xf0, 0xfe, 0xaa, 0x36, 0x75, 0x75, 0xe5, 0x66, 0xad, 0xbd, 0xbf, 0x91,
+  0x1a, 0xe3, 0x68, 0x42, 0xe3, 0xce, 0xaa, 0xa8, 0x54, 0x35, 0x08, 0x8b, 0xf5, 0xaf, 0xdd, 0xa6,
+  0x49, 0xe2, 0xb0, 0xb1, 0x21, 0xeb, 0xc6, 0x21, 0xed, 0xc3, 0x57, 0x8c, 0xa7, 0x79, 0xe4, 0x05,
+  0x21, 0xbf, 0xd5, 0x8b, 0xc5, 0x89, 0xf1, 0x59, 0x32, 0x06, 0x39, 0x85, 0xb5, 0x0d, 0xd9, 0x32,
+  0x8f, 0x2f, 0x79, 0x38, 0xdb, 0xd3, 0xd8, 0xf7, 0xc2, 0xb6, 0xb5, 0xa0, 0xad, 0x96, 0x78, 0x86,
+  0x50, 0x2b, 0xf2, 0xcb, 0xff, 0xf5, 0xff, 0xfc, 0xef, 0xff, 0xef, 0xbf, 0x12, 0x67, 0x2b, 0xc2,
+  0x0d, 0xdf, 0x47, 0xa1, 0x88, 0x06, 0x3c, 0x03, 0x9a, 0x8c, 0xf9, 0xf4, 0x96, 0xcb, 0x24, 0x5e,
+  0x26, 0x01, 0xee, 0x8a, 0xc4, 0x41, 0x1f, 0x0c, 0x9a, 0x66, 0x80, 0x58, 0x27, 0x8c, 0xdb, 0xe2,
+  0x30, 0x18, 0xf1, 0x25, 0xc5, 0xcf, 0xdf, 0xb0, 0xd2, 0xe6, 0x26, 0x46, 0x96, 0x00, 0x41, 0x93,
+  0x50, 0x77, 0x11, 0x3e, 0xbd, 0x19, 0xf0, 0xa7, 0x29, 0xc6, 0xa6, 0x23, 0x2d, 0xfb, 0x22, 0x6f,
+  0x28, 0xf7, 0xf1, 0xe1, 0x1e, 0xe1, 0x49, 0x7c, 0x29, 0x75, 0x82, 0xda, 0x98, 0x1c, 0x09, 0xac,
+  0x1f, 0x44, 0xd3, 0x70, 0xe5, 0xc3, 0x0e, 0xa0, 0xc5, 0xa9, 0x00, 0x8d, 0xb1, 0xc8, 0x3e, 0xdc,
+  0xdd, 0xda, 0xbe, 0x07, 0x47, 0xb5, 0x59, 0x4e, 0xcb, 0xcb, 0x24, 0x00, 0x9a, 0x70, 0x30, 0x0d,
+  0x2b, 0x27, 0xbc, 0xdb, 0x86, 0x34, 0xb0, 0x27, 0x02, 0x8d, 0xd2, 0x55, 0x52, 0x4d, 0xa4, 0x12,
+  0xee, 0x96, 0x35, 0xcb, 0x07, 0xa0, 0x2c, 0x9c, 0xba, 0x2c, 0xe4, 0x6b, 0x9e, 0x2d, 0xc2, 0x3c,
+  0xa0, 0x8f, 0x5f, 0x77, 0x42, 0x58, 0x6c, 0x03, 0x48, 0xf6, 0x96, 0xa3, 0xfa, 0x24, 0xf6, 0xaf,
+  0xcc, 0x60, 0xb3, 0x90, 0xc7, 0x53, 0x17, 0x51, 0x9d, 0xf9, 0x9a, 0xe7, 0xe1, 0xf9, 0x97, 0x62,
+  0x55, 0xe6, 0x47, 0x40, 0x8e, 0x19, 0x4d, 0xdb, 0x14, 0xd7, 0x70, 0x95, 0x38, 0xec, 0x45, 0x7f,
+  0x99, 0xb0, 0xff, 0x3e, 0xa0, 0x33, 0x6f, 0x15, 0x66, 0x6a, 0xf7, 0x94, 0xe3, 0x0c, 0x46, 0x8c,
+  0x1c, 0x67, 0x29, 0x3c, 0x22, 0x52, 0x19, 0xc5, 0xcf, 0xda, 0xc5, 0x55, 0xc4, 0x0e, 0xd5, 0xc6,
+  0xba, 0xb0, 0xce, 0x78, 0xc2, 0x34, 0xf0, 0x48, 0x3c, 0xb6, 0xf1, 0x7d, 0xc7, 0x6a, 0x49, 0x0f,
+  0xaf, 0x39, 0x22, 0x4b, 0x2f, 0x49, 0x29, 0xac, 0x55, 0x6d, 0x09, 0x06, 0xdb, 0xb6, 0x22, 0x76,
+  0x3a, 0xc2, 0x78, 0x60, 0xb6, 0x6d, 0x46, 0xce, 0x1c, 0x69, 0x77, 0x6a, 0x39, 0x21, 0x5b, 0xa1,
+  0x39, 0x36, 0xec, 0xbc, 0x42, 0x6a, 0xa3, 0xd2, 0xd5, 0x7b, 0xd0, 0x29, 0xab, 0x65, 0x36, 0xd3,
+  0x35, 0x71, 0x55, 0x49, 0xc3, 0xce, 0x20, 0x30, 0x67, 0xea, 0xab, 0x98, 0xdd, 0xd1, 0x74, 0x64,
+  0x04, 0x99, 0xe9, 0xe7, 0x35, 0x4e, 0x66, 0x2c, 0xdc, 0x16, 0x6f, 0x2a, 0x84, 0xaa, 0xb3, 0x4c,
+  0x8d, 0x10, 0xc7, 0x7b, 0x08, 0x41, 0xa1, 0x8a, 0x57, 0xa0, 0x44, 0xf9, 0x5d, 0x92, 0x9e, 0x07,
+  0x4b, 0x82, 0xf7, 0x43, 0xe1, 0xe0, 0x07, 0xd9, 0x86, 0xe1, 0x66, 0x52, 0x5a, 0x3c, 0xe2, 0x31,
+  0x72, 0xb8, 0x7b, 0x51, 0xa2, 0xd7, 0xf4, 0x19, 0x98, 0x77, 0xd1, 0x87, 0x49, 0x90, 0xd1, 0x9a,
+  0x28, 0x40, 0xc7, 0x44, 0xd4, 0x69, 0x64, 0xd7, 0xee, 0x6a, 0x64, 0xd0, 0x8e, 0x34, 0x6c, 0xb8,
+  0x42, 0x96, 0xc4, 0xac, 0x66, 0xb2, 0x0a, 0xb5, 0x2d, 0xe1, 0xeb, 0xc0, 0xb8, 0x65, 0x54, 0xaf,
+  0x50, 0x1e, 0x7b, 0xf2, 0x1e, 0x14, 0xee, 0xe2, 0x73, 0x0f, 0x97, 0x82, 0xa2, 0x9a, 0x55, 0x50,
+  0xd5, 0xaf, 0xd7, 0x0e, 0xed, 0x29, 0x2a, 0x97, 0x31, 0x89, 0xda, 0xaa, 0x1a, 0xe1, 0xd3, 0xa8,
+  0x59, 0x77, 0x48, 0xd0, 0xd7, 0xa4, 0x85, 0x27, 0xc2, 0xc6, 0xb0, 0x12, 0xac, 0xd7, 0xbe, 0x15,
+  0x6e, 0xd3, 0x08, 0x89, 0x8a, 0x20, 0x9d, 0x6b, 0x63, 0xa2, 0xc7, 0xe3, 0x34, 0x42, 0xa3, 0x2c,
+  0x84, 0xe7, 0x86, 0x38, 0x64, 0x74, 0x9d, 0xe6, 0xb3, 0x5b, 0xeb, 0x7d, 0x1e, 0x7c, 0xd3, 0xb8,
+  0x75, 0x47, 0xb8, 0xce, 0xb5, 0x31, 0xb0, 0xa3, 0x73, 0x1a, 0xa1, 0x51, 0x15, 0xd4, 0x53, 0x86,
+  0xcb, 0x46, 0x49, 0x24, 0x8d, 0xea, 0x4c, 0xb0, 0x82, 0x67, 0x8e, 0x1d, 0x91, 0x3b, 0x6b, 0xc5,
+  0xd2, 0x48, 0xb4, 0xcc, 0xc5, 0x64, 0xaa, 0x86, 0x2d, 0xac, 0xd5, 0x8a, 0x5f, 0xda, 0x82, 0xda,
+  0xc3, 0xa7, 0x2c, 0x16, 0x20, 0x8f, 0x04, 0xc0, 0x08, 0xdd, 0x36, 0xc8, 0xe1, 0x49, 0x9c, 0xcd,
+  0x89, 0xa4, 0x54, 0x1a, 0x2f, 0x28, 0x8c, 0x67, 0x17, 0xe4, 0x38, 0x5d, 0xb2, 0x5e, 0xe3, 0x59,
+  0x18, 0xd0, 0x32, 0x63, 0xd0, 0xa9, 0x94, 0x50, 0x01, 0xc3, 0xfd, 0x2e, 0xb1, 0x05, 0xe1, 0xed,
+  0xea, 0x45, 0xa7, 0x42, 0x08, 0x3b, 0x28, 0xd4, 0x15, 0x21, 0x27, 0x9a, 0x7e, 0xa4, 0xd7, 0xf2,
+  0xad, 0x1a, 0xfc, 0xbc, 0xfa, 0x1a, 0xe2, 0x5f, 0xd3, 0xbd, 0x9c, 0x68, 0x94, 0xc5, 0x2b, 0x1c,
+  0x17, 0x6c, 0xc5, 0x43, 0x63, 0xc6, 0xb2, 0x79, 0xb5, 0x4a, 0x39, 0xf6, 0x7a, 0xcb, 0x7e, 0x55,
+  0xab, 0x4e, 0x9e, 0x68, 0xdc, 0xee, 0x7b, 0x53, 0xfb, 0x91, 0x3e, 0xe5, 0x9a, 0x50, 0x2d, 0xcb,
+  0xef, 0xce, 0xdc, 0x4b, 0x98, 0xf0, 0x6d, 0x5b, 0x49, 0x03, 0x96, 0x83, 0x7c, 0xc8, 0x34, 0x86,
+  0x35, 0x1c, 0xcd, 0x1c, 0xdc, 0x60, 0x7f, 0xbc, 0x35, 0x68, 0x69, 0x2c, 0xfa, 0x02, 0x75, 0x26,
+  0xe6, 0x83, 0x60, 0x79, 0x12, 0xb8, 0x19, 0x7c, 0xc3, 0x08, 0x82, 0x60, 0xd8, 0x19, 0x87, 0x35,
+  0x19, 0x2a, 0x3f, 0xa6, 0xd2, 0x97, 0xdf, 0x25, 0xa9, 0x70, 0x9d, 0xff, 0x05, 0x31, 0x13, 0x75,
+  0x34, 0xca, 0xf6, 0x61, 0xe9, 0x0a, 0x80, 0x93, 0xc6, 0x86, 0xce, 0xdf, 0x5f, 0x78, 0xcb, 0x76,
+  0xfb, 0x2d, 0xdb, 0x21, 0xe6, 0x2a, 0xdc, 0xdb, 0x2e, 0xa8, 0x68, 0x9d, 0x6a, 0x7e, 0xcc, 0x03,
+  0x09, 0x5a, 0xa2, 0x75, 0xe6, 0xfa, 0xae, 0xaf, 0xc2, 0x3d, 0x1f, 0xad, 0x02, 0x65, 0xc7, 0x49,
+  0xca, 0xbc, 0xef, 0x40, 0x48, 0x67, 0xcf, 0x29, 0xf7, 0xb4, 0xc3, 0xf6, 0x94, 0xb9, 0xb6, 0x45,
+  0xaf, 0xa1, 0xf4, 0x87, 0xed, 0xb3, 0x70, 0xf0, 0xb7, 0x58, 0xbb, 0xf5, 0xfd, 0xcd, 0xfd, 0xee,
+  0x2d, 0x89, 0xa8, 0xb3, 0xaf, 0xa5, 0x4b, 0x83, 0xee, 0x29, 0xee, 0x36, 0x14, 0x8d, 0xb6, 0x73,
+  0x79, 0xfd, 0x25, 0xd1, 0x11, 0xc3, 0xd9, 0x78, 0x71, 0xac, 0x8c, 0xff, 0xbc, 0xf6, 0x32, 0xa9,
+  0x9d, 0x60, 0x68, 0x84, 0x8b, 0xfb, 0xcc, 0xc3, 0x86, 0xe1, 0xbd, 0xcf, 0xcf, 0x36, 0x6c, 0x18,
+  0x51, 0x10, 0x0b, 0x9a, 0x25, 0xc1, 0xb4, 0x7a, 0x01, 0x7d, 0xf6, 0xf0, 0xfb, 0xb1, 0xea, 0x9b,
+  0xc7, 0x6d, 0x1d, 0xdb, 0x9b, 0xa9, 0x2b, 0x6a, 0xc5, 0xca, 0x6f, 0xb8, 0xb5, 0x1b, 0x2e, 0xfc,
+  0xa6, 0x33, 0xbc, 0xac, 0x6b, 0x4c, 0x68, 0x9a, 0xdd, 0x32, 0x05, 0x68, 0x13, 0xda, 0xd7, 0xd9,
+  0xc2, 0xaf, 0x17, 0x7c, 0x70, 0x53, 0x74, 0x61, 0x0c, 0x98, 0x8b, 0xdc, 0x13, 0xb9, 0x33, 0xf9,
+  0x71, 0x7a, 0xbe, 0x1b, 0xf1, 0xc2, 0x84, 0x7a, 0xfe, 0x15, 0x6c, 0xad, 0x22, 0x1f, 0xad, 0x24,
+  0x93, 0xab, 0x62, 0xdf, 0x1c, 0xb0, 0xed, 0x1c, 0x7e, 0xbb, 0x80, 0x82, 0xe4, 0x4b, 0x4c, 0x17,
+  0xf2, 0x25, 0xf1, 0x32, 0x18, 0xee, 0x89, 0x2a, 0x7e, 0x01, 0xfe, 0x97, 0x9a, 0x47, 0xf1, 0x4b,
+  0xd6, 0xd4, 0x97, 0x9a, 0x8b, 0xf0, 0x4b, 0xd6, 0x1c, 0x66, 0x7b, 0x81, 0xfd, 0x10, 0x34, 0xe4,
+  0xc9, 0x44, 0xce, 0x18, 0x85, 0xa8, 0xed, 0xa1, 0xc2, 0x34, 0x46, 0x1b, 0x56, 0x78, 0xc5, 0xb6,
+  0x8f, 0x29, 0x34, 0xca, 0xd3, 0x0b, 0xe7, 0x37, 0x9d, 0xb3, 0xf7, 0x3c, 0xc9, 0xd2, 0x25, 0x66,
+  0x89, 0xe5, 0x26, 0x88, 0x4c, 0x75, 0xce, 0x08, 0x0b, 0x40, 0x10, 0x79, 0xe1, 0xb1, 0xe6, 0x1e,
+  0x52, 0xd6, 0xa3, 0x8d, 0x0a, 0x2b, 0xb0, 0xe9, 0x33, 0x54, 0xcb, 0x5e, 0xf0, 0x6c, 0x06, 0x25,
+  0x1e, 0xae, 0x6b, 0xf8, 0xb6, 0x8c, 0x6d, 0xbd, 0xde, 0x74, 0xd7, 0xd5, 0x0b, 0x7d, 0x70, 0x71,
+  0x82, 0x3d, 0x7c, 0xf6, 0x00, 0x27, 0x19, 0x9b, 0x4f, 0xd6, 0xa9, 0x77, 0x60, 0xad, 0x54, 0x58,
+  0x41, 0x5e, 0xbf, 0x7c, 0x72, 0x4a, 0xbd, 0x64, 0x3a, 0x7f, 0xc1, 0xde, 0xb6, 0x75, 0x34, 0x48,
+  0x5b, 0x56, 0x09, 0x12, 0x12, 0xcf, 0x0a, 0xcc, 0x80, 0x30, 0x49, 0x80, 0x5e, 0x78, 0x7d, 0x91,
+  0xe1, 0xa0, 0xfb, 0x98, 0x7a, 0x27, 0xf2, 0xdb, 0x58, 0xeb, 0xc7, 0xc1, 0x5f, 0xba, 0xac, 0xfa,
+  0x8f, 0xc3, 0xbf, 0x94, 0x6e, 0x93, 0xf3, 0xbc, 0x0e, 0xc8, 0x26, 0xb8, 0x1f, 0xd6, 0x1d, 0x27,
+  0x22, 0x01, 0x81, 0xb0, 0x0e, 0x38, 0x95, 0xe1, 0x8f, 0x99, 0xe1, 0x41, 0x9a, 0x96, 0x5d, 0xaf,
+  0x37, 0x1a, 0x7a, 0x3d, 0x1b, 0x73, 0x45, 0x49, 0xad, 0x3f, 0xa7, 0x5f, 0xb1, 0x02, 0xc4, 0x2c,
+  0xc1, 0xcf, 0x1e, 0x1a, 0x8b, 0xf9, 0x6a, 0x92, 0xf2, 0xc0, 0x88, 0x01, 0x2c, 0xd5, 0xa3, 0x41,
+  0xe9, 0x38, 0x30, 0xbd, 0x11, 0xaf, 0x83, 0x66, 0x07, 0x8b, 0x53, 0x96, 0xb3, 0x46, 0xb3, 0xfd,
+  0xd8, 0x19, 0x45, 0xca, 0xdc, 0x3c, 0x32, 0x52, 0x9f, 0x27, 0xbe, 0x79, 0x29, 0x4e, 0x3c, 0xa3,
+  0xbd, 0xe8, 0xd2, 0x0b, 0xb2, 0xfc, 0xd8, 0xb4, 0xb7, 0x7c, 0xc3, 0x9b, 0xd1, 0x75, 0x78, 0xbd,
+  0xb6, 0x30, 0xda, 0xf1, 0x9a, 0x26, 0x48, 0x71, 0x88, 0x5a, 0xad, 0xad, 0x60, 0xa9, 0x82, 0xe8,
+  0xe3, 0x7b, 0x55, 0xed, 0x97, 0x6e, 0x0c, 0xb4, 0xf2, 0xda, 0xca, 0x92, 0x62, 0xe3, 0x7f, 0x88,
+  0xff, 0xe1, 0x38, 0xe3, 0xae, 0x0f, 0x08, 0xc4, 0x91, 0x16, 0x66, 0xfe, 0x58, 0xd7, 0x66, 0x30,
+  0x49, 0x00, 0x93, 0x9e, 0xfc, 0x9b, 0x6a, 0x7f, 0x07, 0x19, 0xd6, 0xe6, 0x19, 0xd1, 0xbc, 0x34,
+  0x05, 0x2e, 0x65, 0xfe, 0x35, 0x7e, 0x03, 0x37, 0x92, 0xbc, 0xe3, 0x1a, 0x97, 0xf2, 0x93, 0xdc,
+  0x35, 0xfe, 0x04, 0xdb, 0x9b, 0xa0, 0xef, 0x27, 0x7e, 0xf9, 0x9f, 0xff, 0x92, 0x67, 0xe1, 0xe1,
+  0xe7, 0xe6, 0x41, 0x72, 0xb2, 0x0b, 0xc7, 0x31, 0x1d, 0xf0, 0xd5, 0x1d, 0x99, 0x8d, 0xc8, 0x0e,
+  0xac, 0x6c, 0xbd, 0xa4, 0x93, 0x38, 0xc6, 0x8a, 0xea, 0x65, 0xe2, 0x51, 0x7c, 0x89, 0x59, 0x9b,
+  0xca, 0x6b, 0xfd, 0x80, 0xea, 0xba, 0x28, 0x7c, 0x19, 0x84, 0xa1, 0x7a, 0xdd, 0xf8, 0x15, 0x7e,
+  0x63, 0x77, 0x8e, 0xf7, 0x4b, 0x6a, 0x9f, 0xc0, 0x0a, 0x85, 0x12, 0xeb, 0x24, 0xbf, 0x57, 0x95,
+  0x03, 0x41, 0x61, 0xe3, 0x61, 0xc6, 0x04, 0x8e, 0x8b, 0x92, 0xc5, 0x66, 0x06, 0xfb, 0x58, 0x5c,
+  0xd2, 0xf8, 0x25, 0xea, 0xc6, 0x86, 0x09, 0x17, 0xcd, 0x2e, 0x8e, 0x15, 0x52, 0x91, 0xa4, 0xcb,
+  0x00, 0x50, 0x49, 0x4a, 0x76, 0x47, 0xf6, 0x06, 0xb1, 0x92, 0xf4, 0xca, 0xe0, 0x71, 0x9e, 0x45,
+  0xb4, 0x5f, 0x24, 0xf1, 0x22, 0x00, 0x39, 0xd0, 0x16, 0x9e, 0x4d, 0xd4, 0xa1, 0x37, 0x34, 0xbf,
+  0x33, 0xae, 0x8a, 0xf1, 0x2a, 0x93, 0x05, 0xba, 0x05, 0x1f, 0x7f, 0xcd, 0x8e, 0x59, 0xc2, 0xaa,
+  0x3e, 0xe8, 0xb8, 0xf5, 0x0f, 0x31, 0x9b, 0x70, 0x10, 0x81, 0x25, 0x55, 0x44, 0x41, 0x19, 0x9b,
+  0xc7, 0x3e, 0xe8, 0x03, 0x2f, 0x9e, 0x9f, 0xbe, 0xd2, 0x48, 0x80, 0x56, 0xfe, 0xb1, 0x90, 0xd8,
+  0xdd, 0x0d, 0xb7, 0x23, 0xcc, 0x91, 0xbc, 0xe0, 0x9d, 0xed, 0x01, 0xce, 0xf3, 0x19, 0xc4, 0xe7,
+  0xb6, 0x23, 0x44, 0xe4, 0x6a, 0x30, 0x72, 0x1e, 0x08, 0xc8, 0xf8, 0xe0, 0x0c, 0x63, 0xc7, 0xe8,
+  0x19, 0x4c, 0xf6, 0x89, 0x94, 0x63, 0xb3, 0xcf, 0xe5, 0xe0, 0xfd, 0x89, 0x1f, 0xd7, 0x13, 0xd3,
+  0xec, 0xf3, 0x77, 0x79, 0x1b, 0x7c, 0x76, 0xbe, 0x1f, 0xc3, 0x3b, 0x6c, 0x81, 0x4f, 0xe3, 0xf7,
+  0x3f, 0x75, 0x6d, 0x5f, 0xac, 0xe5, 0x7f, 0xec, 0x54, 0x9d, 0x83, 0x77, 0xf7, 0xe5, 0xb0, 0xd4,
+  0x8f, 0x58, 0xd9, 0xc9, 0xb2, 0xcc, 0x4d, 0x37, 0x74, 0xc3, 0xad, 0x91, 0x05, 0x42, 0xe1, 0xb9,
+  0x76, 0xc9, 0x28, 0x34, 0x72, 0xb4, 0xd8, 0xa9, 0x22, 0x22, 0x74, 0xc2, 0x1e, 0x96, 0x43, 0x33,
+  0x73, 0x12, 0x88, 0x14, 0x5f, 0x37, 0x87, 0x54, 0xe2, 0xea, 0x1a, 0x0e, 0x06, 0x17, 0xf3, 0x2a,
+  0x30, 0xcc, 0xe5, 0xd5, 0xb4, 0x56, 0x8d, 0x60, 0x55, 0xc4, 0xeb, 0x7d, 0x90, 0x4f, 0x3e, 0xf4,
+  0x80, 0xc9, 0x52, 0x10, 0x7f, 0xb0, 0xe4, 0x44, 0x2c, 0x27, 0xc9, 0x34, 0x8c, 0x41, 0xa2, 0x60,
+  0x5c, 0x0a, 0xc9, 0xbc, 0x09, 0x48, 0xdf, 0x19, 0xac, 0x0d, 0x15, 0xb2, 0xd3, 0x21, 0x41, 0xe7,
+  0x5e, 0x0a, 0x3c, 0x80, 0x72, 0x18, 0xb5, 0x67, 0x50, 0x9c, 0x00, 0x16, 0x03, 0xcd, 0x85, 0x2a,
+  0xf7, 0x70, 0xd6, 0x8a, 0x55, 0x01, 0x98, 0xaf, 0xfc, 0xa6, 0x00, 0xc5, 0xe7, 0xe9, 0x2a, 0x49,
+  0x30, 0x00, 0xaa, 0x10, 0xbb, 0xa6, 0x24, 0x15, 0x32, 0x08, 0x79, 0x98, 0x0b, 0xd4, 0x2c, 0x5e,
+  0x3a, 0x04, 0x6a, 0xd9, 0x8c, 0xeb, 0xf2, 0x33, 0xe4, 0x87, 0x4e, 0xb9, 0xd1, 0xc8, 0x63, 0x5a,
+  0xeb, 0x57, 0x6f, 0x34, 0x64, 0x4c, 0x52, 0xa0, 0x7b, 0xd7, 0x34, 0x00, 0xe5, 0xfb, 0x2c, 0x1c,
+  0xd1, 0x63, 0xd5, 0xf3, 0xee, 0x58, 0x35, 0xf3, 0x31, 0x7c, 0xa0, 0xac, 0x73, 0x7c, 0x98, 0x5c,
+  0xf9, 0x69, 0xc7, 0xe5, 0x50, 0x71, 0x48, 0x71, 0xdb, 0x13, 0x50, 0xdf, 0x45, 0x71, 0x4e, 0xef,
+  0xba, 0x18, 0x65, 0x65, 0x8a, 0x5b, 0x10, 0xf8, 0x9c, 0x6f, 0x87, 0xf1, 0x94, 0x87, 0x11, 0x60,
+  0x76, 0x3c, 0x60, 0x7b, 0xed, 0x59, 0x1a, 0x82, 0x3e, 0x6b, 0x75, 0x40, 0x93, 0xef, 0x74, 0x2b,
+  0xa9, 0x06, 0x34, 0xda, 0xe2, 0xeb, 0xd4, 0x70, 0xa7, 0x36, 0x7e, 0xfa, 0x9a, 0xd1, 0x17, 0xb6,
+  0xd4, 0x2c, 0x15, 0x78, 0x68, 0x64, 0x56, 0xc2, 0x0e, 0x14, 0x27, 0x7e, 0x11, 0x4d, 0xc1, 0x56,
+  0xce, 0x56, 0xc7, 0x1d, 0x4f, 0x8e, 0x1a, 0xe0, 0xa5, 0x97, 0x44, 0xa0, 0x00, 0xbe, 0x5d, 0xf2,
+  0x29, 0x05, 0xb3, 0x43, 0x2a, 0x2d, 0x85, 0xda, 0x26, 0xd2, 0xb2, 0xf1, 0x51, 0xee, 0xdb, 0xcc,
+  0x77, 0x3b, 0xfc, 0xd9, 0x58, 0x5f, 0xab, 0x50, 0xce, 0xc8, 0x6d, 0x30, 0xd2, 0xc7, 0x59, 0x2b,
+  0xfe, 0x43, 0xc8, 0x96, 0x0a, 0xd9, 0x9b, 0x08, 0xd5, 0x3a, 0xad, 0xa2, 0x51, 0x78, 0x4f, 0x89,
+  0x74, 0xde, 0xa8, 0x8a, 0x93, 0x62, 0x49, 0x3f, 0xd9, 0x6f, 0x77, 0x70, 0x14, 0x6e, 0x2f, 0x67,
+  0x49, 0x00, 0x7b, 0xfc, 0xf0, 0x4a, 0x6e, 0xfc, 0xcd, 0x18, 0x47, 0x19, 0x0d, 0x75, 0x1a, 0xa3,
+  0x5a, 0x8b, 0x1c, 0x7e, 0x89, 0x54, 0xbb, 0x4c, 0x62, 0xfc, 0x39, 0x0f, 0xf0, 0xd4, 0x30, 0x97,
+  0x0e, 0x8c, 0xa8, 0x7a, 0x90, 0x94, 0x1d, 0x61, 0x74, 0x6d, 0xe1, 0x50, 0x87, 0x67, 0x81, 0xe9,
+  0xb1, 0x17, 0xe1, 0x16, 0x4f, 0xd9, 0xe8, 0x14, 0x73, 0x92, 0x31, 0xcb, 0x49, 0x8a, 0x39, 0xde,
+  0x96, 0x18, 0x08, 0x05, 0x8d, 0x82, 0xf0, 0x47, 0x26, 0xcb, 0xb9, 0xeb, 0xeb, 0xea, 0x70, 0xe5,
+  0xda, 0x39, 0xf2, 0xd3, 0xe7, 0xef, 0x0c, 0x5c, 0xdf, 0x17, 0xeb, 0x53, 0x06, 0x1d, 0x4d, 0x51,
+  0x47, 0x56, 0xe8, 0x60, 0x2b, 0xc9, 0x0e, 0x96, 0x73, 0x9d, 0xe2, 0xc4, 0x4d, 0x14, 0x4b, 0x5a,
+  0x87, 0x81, 0xa3, 0x1e, 0x0f, 0x05, 0xe2, 0xc1, 0x66, 0x5d, 0x32, 0xf1, 0x52, 0xde, 0x37, 0xae,
+  0xa8, 0x8b, 0x14, 0xcd, 0xff, 0x11, 0x75, 0xf6, 0xf7, 0x10, 0x75, 0x96, 0x73, 0x64, 0x11, 0x00,
+  0x66, 0xac, 0x76, 0x82, 0xfe, 0x2a, 0xb2, 0x38, 0xd7, 0x17, 0xf8, 0xb1, 0xca, 0x5c, 0x97, 0x16,
+  0x30, 0x4c, 0x63, 0xdd, 0x1d, 0x56, 0x59, 0xef, 0xbe, 0x05, 0x6f, 0x9a, 0x50, 0x98, 0x1c, 0x02,
+  0x24, 0xfa, 0x77, 0x2e, 0xf4, 0x65, 0x97, 0x55, 0xe8, 0x07, 0xe8, 0x91, 0xd4, 0xda, 0x72, 0x94,
+  0x41, 0x4d, 0xf6, 0xf1, 0xab, 0xa7, 0x4f, 0xa0, 0xe8, 0x4f, 0x32, 0xab, 0xb0, 0x91, 0xad, 0x17,
+  0x0b, 0x8a, 0xf3, 0x92, 0xad, 0x92, 0xe4, 0xe6, 0x5c, 0x23, 0xd6, 0x12, 0xfa, 0x96, 0x41, 0x7a,
+  0xc5, 0x2e, 0x28, 0xf9, 0xfc, 0x9d, 0x9c, 0x95, 0xae, 0xfc, 0xcb, 0x6c, 0x7e, 0x1f, 0x6e, 0x94,
+  0x6d, 0x66, 0xb8, 0x0d, 0xf6, 0x18, 0x84, 0xa2, 0xdf, 0xe6, 0xe4, 0xaa, 0x34, 0x68, 0x34, 0x19,
+  0x06, 0x86, 0x55, 0x47, 0x23, 0xc7, 0xc2, 0x0e, 0x34, 0x2f, 0xdb, 0x9a, 0x7d, 0xa6, 0x40, 0x42,
+  0x07, 0x23, 0xa7, 0x86, 0xa5, 0x10, 0xe8, 0x36, 0x2a, 0x33, 0xe7, 0x60, 0xc1, 0x84, 0x7c, 0x68,
+  0x2c, 0x6d, 0x62, 0x16, 0xd2, 0xb7, 0x4d, 0x63, 0x1a, 0x19, 0x88, 0x1e, 0x06, 0x77, 0xb5, 0x2a,
+  0xf8, 0xd9, 0x16, 0xb2, 0xa2, 0xd3, 0x5d, 0xce, 0xea, 0xbc, 0x23, 0x52, 0x1f, 0x75, 0xb2, 0x39,
+  0x12, 0xae, 0x21, 0xab, 0x73, 0x1a, 0x1f, 0xea, 0xdd, 0xc4, 0x97, 0xd5, 0x64, 0xbf, 0x3d, 0xa2,
+  0xab, 0x7d, 0xfa, 0x5a, 0x0e, 0x00, 0xee, 0x53, 0x84, 0x9e, 0xa6, 0xda, 0x8b, 0x45, 0xe2, 0xd2,
+  0x84, 0x49, 0x8d, 0x4d, 0x21, 0xa4, 0x84, 0xd8, 0x4f, 0xf9, 0xf1, 0x01, 0xd8, 0x4e, 0x44, 0x67,
+  0x2c, 0xe1, 0x28, 0xf5, 0x15, 0xcf, 0x95, 0x21, 0x6a, 0xed, 0x55, 0xd8, 0xd6, 0x6f, 0x4d, 0x51,
+  0x69, 0xd7, 0xf9, 0xc6, 0x9b, 0x9e, 0xaf, 0x96, 0x44, 0xe0, 0xe1, 0xd7, 0x57, 0xc8, 0x35, 0x47,
+  0x45, 0xb0, 0x9a, 0x99, 0x46, 0xab, 0xd7, 0xa5, 0x9a, 0x55, 0xe9, 0x7d, 0x29, 0x57, 0x39, 0xe4,
+  0x6d, 0xcc, 0x8f, 0x3a, 0xc0, 0xf0, 0xbe, 0x7b, 0xef, 0x64, 0xa3, 0x22, 0x59, 0x76, 0x13, 0x4e,
+  0x92, 0xd2, 0xc8, 0x29, 0x3b, 0xc5, 0xc7, 0x8e, 0xa5, 0xc8, 0xb1, 0x54, 0xd4, 0x59, 0x54, 0xd5,
+  0x46, 0xa2, 0x20, 0x6d, 0x41, 0x87, 0xba, 0x3a, 0x05, 0x0d, 0x60, 0x86, 0x54, 0x9e, 0x58, 0x50,
+  0x58, 0x0d, 0x21, 0x96, 0xb5, 0x96, 0xcc, 0x22, 0x6c, 0x32, 0x3f, 0x43, 0x6f, 0x20, 0x66, 0xd7,
+  0xd5, 0x33, 0xcd, 0x9b, 0x65, 0x2d, 0x31, 0x11, 0x44, 0x61, 0x10, 0xd1, 0x9e, 0x9d, 0xd2, 0xb4,
+  0x28, 0x0d, 0xf0, 0xce, 0x82, 0x88, 0xd9, 0x81, 0x60, 0x94, 0xc9, 0xa0, 0xbf, 0xc3, 0xfe, 0x43,
+  0x06, 0xf6, 0x0a, 0x21, 0xa8, 0xa9, 0xc9, 0x5c, 0x24, 0x84, 0x4b, 0x6e, 0x61, 0x03, 0x7a, 0xe6,
+  0x73, 0x31, 0xee, 0xec, 0x2d, 0xd3, 0x52, 0x38, 0x57, 0x90, 0x17, 0xe8, 0xa6, 0x3a, 0xd4, 0x2a,
+  0xc6, 0xc0, 0xba, 0x01, 0xec, 0x21, 0x8a, 0x4a, 0x71, 0x74, 0xcc, 0xde, 0x40, 0x3d, 0xb1, 0x31,
+  0xcb, 0xf7, 0xef, 0x9c, 0x7a, 0x6d, 0x35, 0x32, 0x63, 0x1d, 0x5a, 0x08, 0x63, 0x27, 0x54, 0x39,
+  0xac, 0xe5, 0x62, 0x95, 0xfd, 0x7f, 0x3b, 0x6c, 0xac, 0x60, 0xfd, 0xa1, 0xf9, 0x58, 0x6d, 0xea,
+  0xd7, 0x66, 0x64, 0xfc, 0x87, 0x31, 0xf3, 0x47, 0x60, 0x64, 0xbe, 0x22, 0x70, 0xc1, 0xbc, 0x0e,
+  0x2f, 0x4b, 0x8a, 0xb1, 0x8a, 0xdc, 0x3a, 0xf6, 0xe1, 0xb8, 0xd8, 0x25, 0xe4, 0x0d, 0xc6, 0xbd,
+  0x81, 0x48, 0xc4, 0xaa, 0x5f, 0x7c, 0xc1, 0x90, 0x5e, 0x7a, 0xb8, 0xcb, 0x7f, 0xc6, 0x8c, 0xf1,
+  0xfa, 0x73, 0x9f, 0xe3, 0x60, 0x53, 0xfc, 0x7d, 0x19, 0xb2, 0xda, 0x8a, 0xb3, 0x2e, 0xb6, 0x15,
+  0x9c, 0x7f, 0xeb, 0xe8, 0x5a, 0x03, 0xa9, 0xa1, 0x6b, 0xd9, 0xc6, 0x78, 0xcf, 0x70, 0x0f, 0x3f,
+  0x61, 0x75, 0xfa, 0x7d, 0xcd, 0xa2, 0x56, 0xbd, 0x20, 0xd7, 0xf9, 0x44, 0xa4, 0xa3, 0x4c, 0xee,
+  0xa7, 0xba, 0xe4, 0x9d, 0xe1, 0x21, 0xbb, 0x7d, 0x07, 0x98, 0xe9, 0xc8, 0x6a, 0x09, 0xaf, 0x15,
+  0xe7, 0x4c, 0x66, 0x56, 0xe2, 0x5b, 0xbe, 0xd6, 0x07, 0xf0, 0x3d, 0x95, 0x24, 0x12, 0x77, 0x1d,
+  0x34, 0xfb, 0x9f, 0xff, 0x42, 0x0c, 0x05, 0xea, 0x0e, 0x51, 0x8d, 0xd8, 0x68, 0xf6, 0x2a, 0x31,
+  0x71, 0x5a, 0xc6, 0x41, 0x6b, 0x0d, 0xea, 0x32, 0x93, 0x70, 0x05, 0xba, 0xeb, 0x1c, 0xb9, 0x93,
+  0x62, 0xa5, 0xc2, 0x9a, 0x54, 0x6f, 0x19, 0xf9, 0xe5, 0xff, 0xfe, 0x2f, 0xca, 0xa9, 0xba, 0x5c,
+  0x77, 0x65, 0x14, 0xf8, 0x20, 0x46, 0x11, 0x69, 0x0d, 0x61, 0xf7, 0xab, 0x68, 0x84, 0x26, 0x68,
+  0x1b, 0x58, 0xe1, 0xc5, 0xe9, 0xcc, 0x17, 0xcd, 0x69, 0xd6, 0xbf, 0x7d, 0xfb, 0x48, 0xdd, 0x1e,
+  0xbf, 0x6a, 0x57, 0x3f, 0x0f, 0x7c, 0x8d, 0x9c, 0xf6, 0x65, 0x1a, 0x37, 0xd9, 0xd0, 0x97, 0xed,
+  0xe7, 0x1b, 0x58, 0x8b, 0xcb, 0x76, 0x78, 0x9c, 0x1e, 0xee, 0x4d, 0x9e, 0x43, 0x31, 0x57, 0x6f,
+  0xf3, 0x50, 0x3b, 0x61, 0x65, 0x4f, 0x57, 0xae, 0x27, 0xcb, 0xc4, 0x51, 0x92, 0xc3, 0x0d, 0x3d,
+  0x37, 0x85, 0xa5, 0xde, 0x54, 0x01, 0x99, 0x9a, 0xfa, 0x0d, 0x87, 0xea, 0x3a, 0x01, 0x8f, 0x8b,
+  0x63, 0xcd, 0x8d, 0x26, 0x41, 0xfa, 0x1c, 0x7a, 0x8a, 0xa7, 0xe7, 0x38, 0x94, 0x82, 0x1e, 0xfc,
+  0x05, 0x3f, 0xcb, 0xa4, 0x52, 0x42, 0x14, 0x84, 0x29, 0x7c, 0x5f, 0x06, 0xf2, 0xb5, 0x5b, 0xda,
+  0x15, 0x6f, 0xad, 0xae, 0x00, 0xab, 0x9f, 0xa8, 0x63, 0x8a, 0x82, 0xa3, 0x1a, 0xbf, 0xa6, 0x0d,
+  0x2a, 0xdd, 0xb1, 0x6a, 0x71, 0xef, 0x0c, 0x7b, 0x69, 0x86, 0xdb, 0x70, 0x68, 0xba, 0x03, 0x36,
+  0x7f, 0x3d, 0x4d, 0x80, 0x60, 0x8f, 0xf9, 0xeb, 0xaf, 0x40, 0x47, 0x7a, 0xdb, 0x3a, 0x74, 0xd4,
+  0xb6, 0x29, 0x96, 0x25, 0x5e, 0x94, 0x06, 0x48, 0x2b, 0xd0, 0x66, 0x54, 0xca, 0xf1, 0xe8, 0xc6,
+  0xc4, 0xca, 0x20, 0x50, 0x82, 0x08, 0x0b, 0xfa, 0xb7, 0x33, 0xd0, 0xb3, 0xa2, 0x9c, 0xcf, 0x6a,
+  0x1a, 0x16, 0xed, 0x95, 0xcc, 0x36, 0xa7, 0x41, 0xe6, 0x66, 0x34, 0x01, 0xe9, 0xf3, 0x28, 0x4e,
+  0xa6, 0xb8, 0x37, 0x9f, 0x85, 0x78, 0x69, 0x6a, 0x4c, 0x16, 0xde, 0x39, 0x25, 0xec, 0x10, 0x1a,
+  0x9a, 0xa0, 0xc5, 0x71, 0x7f, 0x0c, 0x40, 0x02, 0x09, 0xcf, 0xef, 0x6e, 0x11, 0x8d, 0x88, 0x70,
+  0xbb, 0xa2, 0x0f, 0xcc, 0xa0, 0x1e, 0x93, 0x81, 0x02, 0xff, 0x22, 0x0e, 0xfc, 0x1c, 0x97, 0x78,
+  0x36, 0x03, 0x3e, 0xe0, 0xb8, 0x1c, 0xd6, 0x77, 0xa1, 0x35, 0xd0, 0x90, 0x55, 0x2f, 0x01, 0xca,
+  0x91, 0x97, 0xd7, 0x60, 0x8e, 0xf1, 0x0c, 0x21, 0xb2, 0x2c, 0x9a, 0x8f, 0x51, 0x6e, 0xb1, 0xac,
+  0x91, 0x12, 0x53, 0x3c, 0x74, 0x02, 0x23, 0xb3, 0x51, 0x70, 0x97, 0xc5, 0xf6, 0x88, 0x83, 0x17,
+  0x44, 0xa9, 0x64, 0x7c, 0x63, 0xca, 0xd4, 0x8f, 0x76, 0x2e, 0x21, 0xdc, 0xb3, 0xf9, 0x7e, 0x08,
+  0x6b, 0x67, 0xdf, 0xbc, 0x23, 0xb1, 0xd3, 0x07, 0x12, 0x3e, 0xf4, 0x70, 0x45, 0xe3, 0x62, 0xdf,
+  0x58, 0xd4, 0x4c, 0x49, 0xc1, 0x0b, 0xf5, 0x23, 0x50, 0x9c, 0x85, 0xc8, 0x3c, 0x0d, 0x58, 0x76,
+  0x11, 0x65, 0x51, 0x11, 0x65, 0xca, 0xe5, 0x82, 0xed, 0x97, 0x33, 0x64, 0x82, 0x80, 0x50, 0x2f,
+  0x13, 0xf2, 0xc6, 0xd6, 0x94, 0x0a, 0xeb, 0xca, 0x85, 0x0d, 0xd3, 0x71, 0x6b, 0x8b, 0x86, 0xeb,
+  0x4d, 0x04, 0x27, 0x80, 0x5b, 0x90, 0x0f, 0x6b, 0x49, 0x88, 0x5b, 0x90, 0x11, 0x66, 0x40, 0x92,
+  0xd3, 0x78, 0x7f, 0x33, 0x49, 0x51, 0x35, 0x97, 0x71, 0x26, 0xce, 0x14, 0x31, 0xd2, 0x48, 0x56,
+  0x0e, 0x8c, 0x06, 0xf4, 0x3b, 0x81, 0x54, 0xf3, 0xe1, 0x43, 0x79, 0x26, 0x96, 0x4d, 0x1c, 0xee,
+  0x22, 0xc2, 0x39, 0xbe, 0xb1, 0x4e, 0x13, 0x0a, 0x50, 0xb6, 0xf5, 0xc9, 0xcf, 0x70, 0x3c, 0x00,
+  0x5d, 0x15, 0xc6, 0x93, 0x0a, 0xcd, 0x14, 0xe3, 0x9d, 0x57, 0x61, 0x78, 0x68, 0xfb, 0x2b, 0x68,
+  0x56, 0x1c, 0xfc, 0x78, 0x12, 0x80, 0xce, 0x70, 0xa1, 0xeb, 0x22, 0x18, 0x18, 0x8b, 0x27, 0x73,
+  0x43, 0x71, 0x77, 0x10, 0xe8, 0xc4, 0xf1, 0x8a, 0xa7, 0x49, 0x41, 0xb8, 0xfc, 0x96, 0x26, 0xfa,
+  0x16, 0x06, 0x36, 0xd5, 0x77, 0x52, 0x65, 0xa8, 0x18, 0x8b, 0x1f, 0x66, 0x4f, 0x95, 0xea, 0x73,
+  0x79, 0x9d, 0xd2, 0xd8, 0x69, 0x3c, 0x92, 0xcd, 0xb6, 0x17, 0x02, 0x21, 0xc7, 0x7d, 0x7b, 0x36,
+  0x29, 0x2a, 0xdd, 0xf9, 0x79, 0x38, 0x21, 0xcd, 0xde, 0xa8, 0x87, 0x8c, 0x0d, 0xbe, 0x2b, 0x0f,
+  0x2d, 0x24, 0x20, 0xa0, 0x3d, 0x9f, 0x5d, 0x6d, 0x6b, 0xce, 0x9f, 0x96, 0x30, 0x17, 0xf4, 0x5e,
+  0x5d, 0x2d, 0x69, 0x6b, 0x8c, 0x37, 0x17, 0x2d, 0x41, 0x7e, 0xb1, 0xdd, 0xc2, 0xe6, 0xdb, 0xde,
+  0xe5, 0xe5, 0x65, 0x8f, 0xdd, 0x2e, 0xbc, 0x4a, 0x42, 0x1a, 0x4d, 0x63, 0xdf, 0x3a, 0xe8, 0x06,
+  0x20, 0xfe, 0xb1, 0x77, 0x1a, 0xaf, 0x80, 0x2b, 0xb1, 0xfa, 0xeb, 0x13, 0xe3, 0xfb, 0x7b, 0xfd,
+  0x91, 0x47, 0x39, 0xb6, 0x44, 0x56, 0x16, 0xe0, 0x7f, 0x0e, 0xf5, 0xf5, 0xcb, 0x93, 0xe3, 0x78,
+  0xb1, 0xc4, 0xb9, 0x97, 0xb1, 0xf1, 0xee, 0x96, 0xed, 0x4c, 0xd4, 0x4d, 0xa0, 0xbc, 0xbd, 0xc9,
+  0x71, 0x71, 0x93, 0xb2, 0x85, 0xe1, 0xf4, 0x7c, 0xcf, 0x53, 0x2d, 0xca, 0x85, 0x2c, 0x94, 0x47,
+  0x2a, 0xf8, 0xae, 0xa5, 0xe0, 0x94, 0xf7, 0x6c, 0x6b, 0xc4, 0x0b, 0xc3, 0x8f, 0x45, 0x4a, 0x7c,
+  0x31, 0x5a, 0xe5, 0x1e, 0x36, 0x9a, 0x3d, 0x2a, 0x0e, 0x55, 0x9b, 0xec, 0xaa, 0x8e, 0x1e, 0x9e,
+  0xbd, 0x6e, 0x1c, 0x10, 0x5a, 0x8c, 0xd9, 0x75, 0x46, 0x49, 0x27, 0xbc, 0x45, 0x76, 0xc4, 0x92,
+  0x7c, 0x4d, 0x86, 0x46, 0x10, 0x6b, 0xa5, 0x23, 0x11, 0x78, 0x34, 0x3f, 0xb6, 0x5d, 0xd5, 0x4b,
+  0x7e, 0xb8, 0x7b, 0xce, 0xcf, 0x97, 0xfd, 0x66, 0xfb, 0x7a, 0xaa, 0x9e, 0x0d, 0xaf, 0xea, 0xae,
+  0xef, 0x5d, 0xc5, 0xb3, 0x4b, 0x76, 0xe6, 0xfc, 0xb7, 0xde, 0xdb, 0x8c, 0x56, 0x75, 0x14, 0x77,
+  0xc3, 0x3e, 0x3b, 0xdc, 0xfe, 0xdb, 0xed, 0xe7, 0x71, 0x7e, 0xda, 0xbc, 0xaa, 0xa7, 0xec, 0x4c,
+  0xfa, 0x1b, 0xd4, 0xf8, 0x7e, 0xf3, 0x83, 0x2a, 0x4f, 0xf8, 0x57, 0x75, 0x77, 0x9e, 0xe7, 0x0d,
+  0xf8, 0xed, 0xf6, 0xf5, 0x89, 0xb8, 0xad, 0xa8, 0xaa, 0x9f, 0xf9, 0x4d, 0x47, 0x9f, 0x44, 0x3f,
+  0x6b, 0x57, 0xbe, 0x06, 0xa3, 0x6b, 0x1f, 0x51, 0xad, 0xea, 0xbf, 0x38, 0x48, 0xea, 0x43, 0xe9,
+  0xdf, 0xf2, 0x50, 0x7f, 0xaf, 0x9c, 0x87, 0xad, 0xea, 0xee, 0x8a, 0x1f, 0xb1, 0xfd, 0x6d, 0x75,
+  0x54, 0x9c, 0x17, 0x2c, 0xbf, 0x8d, 0x02, 0x7a, 0x86, 0xd1, 0xad, 0xed, 0x28, 0x16, 0xe6, 0xdf,
+  0x8e, 0x72, 0x48, 0x57, 0x13, 0x75, 0xee, 0x2b, 0x28, 0xaa, 0xc4, 0x1e, 0xd6, 0x78, 0x83, 0x8d,
+  0xbe, 0x11, 0xad, 0x7d, 0xe2, 0xd4, 0x33, 0x74, 0xbc, 0xf2, 0x13, 0x63, 0x85, 0x65, 0x99, 0x1d,
+  0x67, 0x74, 0x52, 0x86, 0x59, 0xae, 0x55, 0xbd, 0xde, 0x39, 0x38, 0xca, 0x8d, 0x21, 0x2c, 0xa8,
+  0x51, 0xde, 0x34, 0xcc, 0xaf, 0x49, 0x98, 0x9d, 0xb1, 0x80, 0xc1, 0xcb, 0x00, 0xf6, 0x51, 0xab,
+  0x25, 0x01, 0xc0, 0xd4, 0x67, 0x89, 0xde, 0x30, 0x7e, 0x42, 0x1d, 0x33, 0x73, 0xbc, 0x2a, 0xee,
+  0x0c, 0x01, 0xa0, 0xb6, 0x61, 0x91, 0x56, 0x9a, 0x76, 0xdd, 0x1d, 0xb4, 0x9c, 0xaa, 0x98, 0x5b,
+  0x56, 0x7a, 0x6a, 0xcd, 0x3d, 0x8c, 0xbc, 0x66, 0x45, 0x9e, 0x77, 0xe7, 0xa7, 0x2c, 0x5d, 0x97,
+  0x41, 0x50, 0x3d, 0x27, 0x39, 0xa0, 0xdb, 0x77, 0xb7, 0xaf, 0x37, 0xf2, 0x80, 0x02, 0x1b, 0xc3,
+  0x6b, 0x8a, 0x87, 0x84, 0x71, 0x3e, 0xe7, 0x77, 0xaa, 0x04, 0x29, 0x11, 0x79, 0xca, 0x79, 0xae,
+  0x12, 0xf2, 0xfc, 0xa5, 0x38, 0xdc, 0xd9, 0x71, 0x67, 0x77, 0xd1, 0x02, 0x66, 0xb0, 0xfd, 0xc6,
+  0x37, 0xfe, 0x54, 0x14, 0x76, 0xdd, 0x9e, 0x53, 0x51, 0x7c, 0x68, 0x66, 0x85, 0x59, 0x78, 0xd1,
+  0xca, 0x0b, 0x5d, 0xd8, 0xf9, 0x4d, 0x31, 0xf3, 0x9b, 0x63, 0x55, 0x73, 0x9d, 0x0f, 0xd0, 0xfb,
+  0x19, 0xa6, 0xf2, 0x64, 0x7c, 0xab, 0x5f, 0x4e, 0xa0, 0x0c, 0x29, 0x69, 0x8b, 0x3d, 0x11, 0xbb,
+  0x0a, 0x80, 0xc4, 0x09, 0x69, 0xf5, 0x86, 0x2d, 0xc2, 0x0f, 0xab, 0x76, 0x34, 0x97, 0xa6, 0x3f,
+  0x41, 0x93, 0x06, 0x6f, 0xb8, 0x00, 0xa6, 0xf3, 0x97, 0xbc, 0xc8, 0x6f, 0xc2, 0x31, 0xe7, 0x60,
+  0x5a, 0xf6, 0x45, 0xd9, 0xfe, 0x44, 0x8f, 0x02, 0xe5, 0xc5, 0x63, 0x40, 0xa1, 0xc3, 0xdb, 0xe9,
+  0x69, 0x97, 0x28, 0x31, 0x93, 0x0b, 0x7b, 0x9f, 0xa7, 0xbc, 0xf0, 0x27, 0x2c, 0xe7, 0x85, 0xcb,
+  0x2d, 0x9e, 0x27, 0x3b, 0x29, 0xb0, 0x7c, 0x8e, 0x4e, 0x6e, 0x03, 0xb9, 0x68, 0xb5, 0x98, 0xd0,
+  0x84, 0xdd, 0x2a, 0x38, 0x61, 0x99, 0x61, 0x7b, 0x28, 0x6d, 0x8c, 0x9c, 0x77, 0xcc, 0x46, 0x82,
+  0x04, 0xe6, 0x5e, 0x24, 0x7e, 0xb8, 0x3d, 0x5e, 0xd0, 0x9c, 0x73, 0xd9, 0xe9, 0x03, 0x60, 0x5f,
+  0x0c, 0xb8, 0xbd, 0xe0, 0xc7, 0xa7, 0xe5, 0x27, 0x3f, 0xa6, 0x29, 0x3b, 0x5e, 0xca, 0x82, 0xa7,
+  0x08, 0x73, 0x1e, 0x4a, 0x3f, 0x0a, 0x74, 0x55, 0x9d, 0x4d, 0xca, 0x4d, 0xb0, 0x77, 0x64, 0xb2,
+  0x1e, 0x74, 0xc2, 0xe7, 0x1c, 0x85, 0x81, 0x54, 0xe4, 0x8e, 0xd1, 0x27, 0x1d, 0xcf, 0xe7, 0x11,
+  0xe1, 0x19, 0x7a, 0xbb, 0x64, 0x09, 0x72, 0x39, 0x40, 0xbb, 0xa3, 0x14, 0x46, 0x78, 0xea, 0xd5,
+  0x92, 0x44, 0xac, 0xe5, 0x6b, 0xa4, 0xf9, 0x15, 0xf9, 0xf4, 0x3c, 0x66, 0x37, 0x55, 0x13, 0xfb,
+  0x1e, 0xea, 0xa7, 0x29, 0x4b, 0x84, 0x1b, 0x56, 0x34, 0x4f, 0xeb, 0x62, 0xfc, 0xc1, 0x02, 0x30,
+  0x08, 0xa6, 0xe4, 0xf5, 0xc9, 0x18, 0xd8, 0x0d, 0x65, 0x67, 0x2e, 0x68, 0xf1, 0xa6, 0x74, 0x66,
+  0x27, 0xf5, 0x0f, 0x91, 0x7b, 0x52, 0xee, 0xbd, 0x45, 0x97, 0x5d, 0x4a, 0x2e, 0x29, 0xc6, 0x8f,
+  0x7d, 0x99, 0x11, 0x34, 0xb1, 0x31, 0xaf, 0x1e, 0x2c, 0x4c, 0x09, 0x6d, 0xb2, 0xde, 0xe6, 0xb9,
+  0x2f, 0xf2, 0xdb, 0xd8, 0x9e, 0xc4, 0x67, 0x80, 0x41, 0xb1, 0xb6, 0xe2, 0x1c, 0xc2, 0x34, 0x19,
+  0x8f, 0x24, 0x25, 0x40, 0x32, 0x71, 0x39, 0xb5, 0x29, 0x46, 0xac, 0xc8, 0x37, 0x4d, 0xd2, 0x25,
+  0x9d, 0x06, 0x33, 0xa8, 0xaf, 0x65, 0x8f, 0xd3, 0x77, 0x22, 0xce, 0xb4, 0xc6, 0x42, 0xf2, 0xa9,
+  0x44, 0x6e, 0x9c, 0x39, 0x5d, 0xe3, 0x1c, 0x6a, 0xde, 0x77, 0xd7, 0x38, 0xdb, 0xfc, 0x0d, 0xa1,
+  0x88, 0x84, 0x41, 0xd7, 0x83, 0xe2, 0x4e, 0xb4, 0x51, 0x01, 0x4b, 0x1d, 0xc8, 0x87, 0x68, 0xf4,
+  0x63, 0xb7, 0x72, 0x29, 0x43, 0x84, 0x69, 0x0a, 0x94, 0x81, 0xb1, 0x46, 0x6c, 0xb1, 0xc0, 0x69,
+  0x0a, 0x05, 0x1f, 0x9e, 0xbe, 0xa8, 0x1a, 0x26, 0x39, 0x40, 0x95, 0xdb, 0x46, 0x51, 0xf6, 0x0d,
+  0xcd, 0xf3, 0x5b, 0x7d, 0x72, 0xea, 0x13, 0x5f, 0xe0, 0xa1, 0xcb, 0x43, 0x7e, 0xdc, 0x85, 0x9d,
+  0xbb, 0x1e, 0xf0, 0x03, 0xda, 0xe8, 0x46, 0x6f, 0xaa, 0x85, 0xbb, 0x12, 0x7b, 0x57, 0x59, 0x49,
+  0x44, 0xe1, 0x82, 0x48, 0x7f, 0x37, 0xc4, 0xb1, 0x12, 0x7d, 0x54, 0x0a, 0x93, 0x0d, 0x67, 0xe6,
+  0xba, 0x52, 0xa9, 0xa3, 0x92, 0xdc, 0x79, 0xfd, 0xd7, 0x3a, 0x02, 0xc3, 0x48, 0x11, 0x76, 0xbd,
+  0x29, 0xaa, 0xa5, 0x05, 0xbb, 0x36, 0x08, 0x2d, 0xb9, 0x53, 0x93, 0xf9, 0x6d, 0xe4, 0xb5, 0x05,
+  0x90, 0x4f, 0x44, 0x54, 0x8b, 0xc3, 0xef, 0x1e, 0xe5, 0xca, 0xce, 0x11, 0x8c, 0xb0, 0xb5, 0x3b,
+  0x40, 0xad, 0xe3, 0x82, 0x2d, 0xfc, 0xe8, 0x83, 0xc0, 0xd5, 0x94, 0x3f, 0x29, 0xe9, 0xe0, 0x45,
+  0x7c, 0x4f, 0xab, 0x65, 0xe7, 0xc1, 0xc0, 0x58, 0x4a, 0x71, 0xb3, 0xc9, 0x45, 0x47, 0x64, 0xf8,
+  0x38, 0xdc, 0xa8, 0x38, 0xb7, 0x72, 0x27, 0x35, 0x4f, 0x95, 0xa4, 0x2e, 0x8d, 0x07, 0x71, 0x69,
+  0x35, 0x2b, 0x89, 0x51, 0x17, 0x56, 0x49, 0xfe, 0xad, 0xa7, 0x9e, 0x6b, 0xed, 0xb8, 0x62, 0x96,
+  0xf4, 0x3e, 0x89, 0x97, 0x8a, 0xee, 0xf6, 0xde, 0x4a, 0xbe, 0x8b, 0x16, 0x6e, 0x7e, 0x5d, 0x13,
+  0x90, 0x33, 0xf4, 0xb2, 0x2e, 0x86, 0x91, 0x77, 0x89, 0xb8, 0x9e, 0xc2, 0x41, 0x5c, 0x28, 0xd3,
+  0xb9, 0xc6, 0xe5, 0xe4, 0x00, 0x31, 0x33, 0x29, 0x19, 0xa2, 0xb7, 0xf6, 0x5a, 0xd7, 0x8f, 0x23,
+  0x92, 0xf6, 0xe8, 0xd5, 0x04, 0xe3, 0x9d, 0xd1, 0xb8, 0x57, 0x16, 0x3d, 0xaa, 0x87, 0x57, 0xb6,
+  0x24, 0xff, 0x81, 0x3c, 0x41, 0x41, 0xc2, 0x33, 0x1e, 0x61, 0x9c, 0xa5, 0xfc, 0x40, 0x1e, 0x01,
+  0x4a, 0xbe, 0x0d, 0x47, 0x61, 0x77, 0xf3, 0xf2, 0xf8, 0x3c, 0x00, 0xb5, 0x38, 0x16, 0x81, 0x18,
+  0xc9, 0x1a, 0x5a, 0xcc, 0x8c, 0x32, 0x4c, 0x66, 0xba, 0x17, 0x74, 0x5e, 0x74, 0x70, 0x8e, 0xf0,
+  0xc3, 0x90, 0xcb, 0xd5, 0x04, 0xa4, 0x24, 0x39, 0x79, 0x61, 0x3b, 0xa3, 0x97, 0x98, 0xb8, 0xc5,
+  0xcc, 0x03, 0x33, 0xcf, 0xb2, 0x65, 0x3a, 0xde, 0xdc, 0xf4, 0x96, 0x41, 0x3f, 0x58, 0x06, 0xb3,
+  0xab, 0x7e, 0x9c, 0x9c, 0x7d, 0x3d, 0x63, 0x97, 0x01, 0x1c, 0xa1, 0xb3, 0xa5, 0x65, 0x31, 0xfc,
+  0x1d, 0x0e, 0x89, 0x85, 0xdc, 0x59, 0x21, 0x76, 0x0c, 0x06, 0xe1, 0x47, 0xae, 0x38, 0xb5, 0x44,
+  0x69, 0x9e, 0x19, 0xc2, 0x91, 0x6b, 0xe6, 0x1d, 0x94, 0x20, 0xef, 0x73, 0xbc, 0x44, 0x71, 0x47,
+  0x6e, 0x19, 0xde, 0xb4, 0xa3, 0x4d, 0xd0, 0x70, 0x4f, 0x5e, 0x14, 0x51, 0x7d, 0x93, 0x2b, 0xc2,
+  0xb0, 0x30, 0x6e, 0x84, 0x03, 0x42, 0x8d, 0x3a, 0x04, 0x93, 0x5c, 0x91, 0xc7, 0xa0, 0x2e, 0xd2,
+  0xe4, 0x15, 0xbb, 0xee, 0x88, 0xfc, 0x81, 0xc6, 0x50, 0xfb, 0x32, 0xc8, 0xe6, 0xe4, 0x8f, 0xa7,
+  0xcf, 0x9f, 0x91, 0x78, 0x95, 0x2d, 0x57, 0x99, 0x85, 0x26, 0x8c, 0x8d, 0x83, 0x7e, 0xda, 0xa4,
+  0xfb, 0x49, 0x25, 0xe6, 0x9c, 0xb5, 0xc1, 0xaf, 0x54, 0xea, 0x83, 0xee, 0xb1, 0x09, 0x00, 0x82,
+  0xe5, 0xe6, 0xd7, 0x7f, 0x3b, 0xfa, 0xfc, 0x9d, 0xc3, 0x1e, 0x08, 0x1d, 0x7b, 0xff, 0x05, 0x6f,
+  0x9a, 0x91, 0xfd, 0xa7, 0xd2, 0x3c, 0x95, 0x8c, 0x0e, 0x02, 0x1b, 0x1c, 0x83, 0x8d, 0xca, 0x90,
+  0x47, 0xad, 0xab, 0x39, 0x89, 0x70, 0x5c, 0x24, 0x88, 0xd2, 0x81, 0xf1, 0xd5, 0xe4, 0x3f, 0xb2,
+  0xb4, 0x1c, 0x17, 0x9d, 0xb0, 0x5b, 0x1d, 0x02, 0x13, 0x26, 0x81, 0xcd, 0x10, 0xdb, 0x09, 0x15,
+  0x32, 0xd9, 0xc8, 0xa8, 0x2c, 0x41, 0xc3, 0xe4, 0x2f, 0xee, 0x9e, 0xcf, 0x82, 0x6c, 0xe5, 0x53,
+  0xbb, 0xfd, 0x90, 0x65, 0xff, 0xe6, 0x85, 0xe2, 0xe8, 0xac, 0xa4, 0xd4, 0x14, 0x93, 0xa4, 0x1e,
+  0x15, 0x4d, 0x8a, 0xfb, 0x3f, 0x30, 0x15, 0xaa, 0x43, 0x9e, 0x67, 0xe2, 0x82, 0x32, 0xbd, 0x34,
+  0x7b, 0xed, 0x28, 0x3e, 0xe5, 0x72, 0xc6, 0x01, 0x9e, 0x7f, 0x70, 0x54, 0x09, 0x45, 0x6a, 0x33,
+  0x86, 0x16, 0x48, 0x08, 0xde, 0x22, 0xfc, 0x90, 0xb0, 0x1c, 0x52, 0xc3, 0x0a, 0xc7, 0xb8, 0x83,
+  0xf4, 0xc1, 0x8d, 0x1f, 0x93, 0x88, 0xd6, 0x98, 0xc2, 0x8e, 0x29, 0x45, 0x4d, 0x42, 0x92, 0x6e,
+  0x33, 0x27, 0x8f, 0xc1, 0xf2, 0xb9, 0x30, 0xb7, 0x24, 0xb9, 0xbe, 0x0f, 0x93, 0x26, 0xb4, 0x30,
+  0x3e, 0x6b, 0x7f, 0x99, 0x23, 0xc7, 0x38, 0x1c, 0xed, 0x41, 0x81, 0xa7, 0xcd, 0x98, 0x3e, 0xbf,
+  0x2d, 0x6a, 0xfc, 0xa5, 0x0d, 0x4c, 0xcd, 0xec, 0x54, 0x99, 0xd7, 0x49, 0x63, 0x4b, 0xe0, 0xad,
+  0x30, 0x6f, 0x94, 0x4b, 0x0e, 0x47, 0x68, 0xa9, 0x17, 0xc2, 0x74, 0x32, 0x12, 0x29, 0x15, 0xc6,
+  0xbe, 0xb3, 0x15, 0x5a, 0x38, 0x98, 0x08, 0xcc, 0x61, 0xad, 0x18, 0x95, 0x34, 0xd4, 0xff, 0x1c,
+  0xfd, 0x39, 0x72, 0x64, 0x38, 0x7a, 0x11, 0xa7, 0x2c, 0x7c, 0x08, 0xd0, 0x5f, 0xa5, 0x34, 0x1d,
+  0x3b, 0x0b, 0xc1, 0xd6, 0xf1, 0xf9, 0xcb, 0x53, 0xc2, 0xe2, 0xdc, 0x99, 0xf1, 0x2a, 0xca, 0x63,
+  0xb9, 0xda, 0x38, 0xb2, 0x7c, 0x7f, 0xda, 0x4b, 0x03, 0x9f, 0x76, 0x4a, 0x00, 0x3c, 0xa3, 0xd9,
+  0x65, 0x9c, 0x9c, 0x13, 0x18, 0x40, 0x58, 0xb6, 0x40, 0xd5, 0x4c, 0x90, 0x3b, 0x42, 0xd8, 0x03,
+  0x67, 0x25, 0x98, 0xc9, 0x53, 0xf5, 0xdc, 0x22, 0x10, 0x62, 0x2b, 0x98, 0x33, 0x8e, 0xe9, 0xa9,
+  0xd3, 0x38, 0x4e, 0xfc, 0x20, 0xc2, 0xcb, 0x9a, 0x31, 0x80, 0x43, 0x4a, 0x1f, 0x5c, 0x28, 0x85,
+  0xfd, 0x7f, 0xe1, 0x2d, 0x51, 0x9e, 0x6f, 0x82, 0xa6, 0xe3, 0x97, 0x67, 0xa0, 0x75, 0xef, 0x93,
+  0x9f, 0x17, 0xeb, 0x2d, 0xbb, 0x8e, 0xf8, 0x5b, 0x7a, 0x25, 0xae, 0x8b, 0x7d, 0xfd, 0x8f, 0x8a,
+  0xd6, 0xca, 0xd9, 0x1e, 0xf3, 0xc2, 0xbf, 0x79, 0xf2, 0xf0, 0xd9, 0x1f, 0x5e, 0x3d, 0x06, 0xe6,
+  0xdf, 0x1a, 0x1d, 0x5a, 0x5f, 0x71, 0x19, 0xfd, 0x7d, 0x0b, 0xf3, 0xa8, 0x01, 0xcc, 0xb6, 0x52,
+  0xde, 0x08, 0xe2, 0x94, 0x59, 0xed, 0xd7, 0xbe, 0x60, 0xbc, 0xb0, 0x58, 0x29, 0xc9, 0xe9, 0xad,
+  0x64, 0x15, 0xa2, 0x73, 0x86, 0x6d, 0x97, 0xf7, 0x8b, 0x27, 0x93, 0x10, 0x06, 0x32, 0x76, 0x10,
+  0xa8, 0xe8, 0xa6, 0x7a, 0xe9, 0xb2, 0xd0, 0x3a, 0xbe, 0xf8, 0xc2, 0x48, 0xc1, 0x2f, 0x14, 0x44,
+  0x66, 0x54, 0x6a, 0x69, 0xd6, 0x2f, 0xa3, 0x26, 0xcf, 0xa3, 0x7f, 0x98, 0xe7, 0xc0, 0xc2, 0xc4,
+  0xfc, 0x79, 0x59, 0x1d, 0x7b, 0x55, 0x6b, 0xb0, 0x62, 0x90, 0x2c, 0xb0, 0xaa, 0xbe, 0xe7, 0xa4,
+  0x82, 0x7b, 0xa8, 0x1f, 0xf0, 0x8b, 0x88, 0xd8, 0x6d, 0x01, 0x2c, 0x28, 0x86, 0xb3, 0x37, 0xd3,
+  0x7e, 0x0a, 0x12, 0xe4, 0xad, 0x95, 0x5f, 0xca, 0x66, 0x46, 0xb4, 0xe4, 0x55, 0x50, 0x6a, 0xa6,
+  0xb8, 0x10, 0x4a, 0xe8, 0x47, 0x16, 0xf2, 0x8c, 0x68, 0x8e, 0xc4, 0xc9, 0x8e, 0x70, 0x23, 0x81,
+  0xb6, 0xc8, 0xf5, 0xf6, 0x80, 0xdd, 0x34, 0xb0, 0x89, 0x21, 0xf4, 0xe9, 0xd2, 0x9b, 0x52, 0x6e,
+  0xad, 0x9b, 0x01, 0xf3, 0x60, 0x64, 0x13, 0x68, 0x78, 0x84, 0x2e, 0x96, 0x20, 0x8d, 0x1b, 0xf5,
+  0xe4, 0x9c, 0x5e, 0x89, 0x1d, 0xab, 0xe5, 0x6a, 0x30, 0x94, 0xfd, 0x36, 0xed, 0xe3, 0x4d, 0x0a,
+  0x0c, 0xef, 0xbc, 0x6d, 0x54, 0xd5, 0x89, 0xf2, 0x81, 0xe3, 0x06, 0xbc, 0xa0, 0xdd, 0x87, 0xe4,
+  0xec, 0x7a, 0xc9, 0x39, 0xc8, 0x2a, 0x12, 0x72, 0x52, 0xb9, 0x03, 0x3a, 0x75, 0x52, 0x3d, 0x42,
+  0x6a, 0xc8, 0x40, 0xb7, 0x31, 0x1f, 0x64, 0xc6, 0x76, 0x4c, 0x90, 0x50, 0x3f, 0xc8, 0xf4, 0xa4,
+  0xea, 0x15, 0x14, 0x62, 0x84, 0x75, 0x8c, 0xb5, 0x63, 0x86, 0xc8, 0x1b, 0x23, 0x3a, 0x55, 0x9c,
+  0x6a, 0x23, 0xfb, 0x4d, 0x08, 0x52, 0x3c, 0xc7, 0x55, 0x86, 0xea, 0x33, 0x6c, 0xa1, 0x11, 0xc6,
+  0xa5, 0x7e, 0xe0, 0x47, 0xbf, 0xfc, 0xf3, 0xff, 0x99, 0x89, 0x9e, 0x14, 0x73, 0xb8, 0x51, 0x17,
+  0x26, 0x21, 0x0b, 0x58, 0x69, 0xd8, 0x83, 0x96, 0xc3, 0x90, 0xad, 0x4e, 0x2e, 0x55, 0x0e, 0x58,
+  0x83, 0x74, 0x27, 0xb7, 0xe4, 0x9b, 0x11, 0x8d, 0xe5, 0x32, 0x21, 0xa1, 0x9a, 0x40, 0x28, 0x09,
+  0x3e, 0x74, 0xcd, 0x6f, 0xac, 0x5d, 0xcc, 0x62, 0x5c, 0x19, 0x81, 0x30, 0xc0, 0x8c, 0xee, 0x86,
+  0x5d, 0x1c, 0xa5, 0xcf, 0xb9, 0x72, 0x31, 0x83, 0x2d, 0x71, 0x73, 0xed, 0x24, 0xf4, 0xa2, 0x73,
+  0xf3, 0x50, 0x4a, 0xfd, 0xf5, 0xe5, 0xef, 0x1b, 0x70, 0xed, 0x6b, 0x34, 0x0f, 0x53, 0xf2, 0x2a,
+  0x61, 0x4b, 0xb8, 0x6a, 0x53, 0x41, 0x31, 0xbf, 0x62, 0x5f, 0x4f, 0x29, 0x08, 0x6c, 0xb6, 0x5d,
+  0x1d, 0x1c, 0x5a, 0x1f, 0xd1, 0x74, 0x91, 0xa8, 0x50, 0x1f, 0xa1, 0x4e, 0x23, 0x3e, 0x72, 0x7f,
+  0x88, 0xc3, 0x16, 0xc8, 0x14, 0x1f, 0xde, 0x76, 0xdb, 0x65, 0xe4, 0xe2, 0xd5, 0x5b, 0xee, 0xe3,
+  0x4a, 0x15, 0x91, 0x6a, 0xd5, 0x27, 0x83, 0xe4, 0xed, 0xc0, 0xde, 0x25, 0x10, 0x90, 0xf7, 0x89,
+  0x21, 0x38, 0x0b, 0x92, 0xc5, 0xa5, 0x97, 0x50, 0xe3, 0x94, 0x8d, 0xde, 0x77, 0xa6, 0x95, 0xf2,
+  0x97, 0x6f, 0x64, 0x6d, 0x90, 0x44, 0x03, 0xeb, 0x5e, 0xaa, 0xd7, 0xec, 0x78, 0x8e, 0xa4, 0x80,
+  0x74, 0x4b, 0x28, 0x0e, 0x03, 0xc7, 0x61, 0x1e, 0x4e, 0x0a, 0x19, 0xf4, 0xd6, 0x29, 0x83, 0x29,
+  0x11, 0x25, 0x17, 0xe8, 0x86, 0x60, 0x9e, 0x4e, 0xf2, 0xfa, 0xc4, 0x91, 0x27, 0x44, 0x7c, 0xaf,
+  0xbc, 0xdb, 0xb0, 0x35, 0xbb, 0xfc, 0x8e, 0x17, 0x6b, 0x39, 0x72, 0x85, 0xe4, 0x10, 0xec, 0x30,
+  0xe1, 0xfc, 0x93, 0xb9, 0x87, 0xbf, 0xc0, 0x4d, 0x0f, 0xa3, 0x93, 0x28, 0x52, 0x75, 0xe6, 0x8b,
+  0x65, 0xd5, 0x7a, 0x2d, 0x78, 0x08, 0x99, 0xaf, 0xdd, 0xfc, 0x04, 0x55, 0x75, 0x0a, 0x53, 0xc1,
+  0x3d, 0x52, 0xc3, 0x75, 0xba, 0x29, 0x98, 0x7d, 0x23, 0xe7, 0x02, 0xd4, 0x67, 0x51, 0xf3, 0x9b,
+  0x80, 0xf2, 0x48, 0xa9, 0x4c, 0x8b, 0x20, 0xb8, 0xa3, 0x48, 0x6a, 0x63, 0x59, 0x11, 0xed, 0x2e,
+  0x18, 0xb2, 0x4e, 0x99, 0x23, 0x1d, 0x2e, 0x31, 0x4e, 0x80, 0x5a, 0x09, 0xcc, 0x72, 0xed, 0x53,
+  0xd1, 0x71, 0xe5, 0x2d, 0x8f, 0x64, 0xcd, 0xcb, 0xdb, 0xa1, 0xac, 0x1a, 0x87, 0x7e, 0xf5, 0x95,
+  0x9d, 0x1e, 0xb5, 0x94, 0xab, 0x30, 0x2e, 0x53, 0x4d, 0xa1, 0xa4, 0x52, 0x86, 0xdf, 0x52, 0x98,
+  0x93, 0xe6, 0x97, 0xff, 0xfc, 0xdf, 0x48, 0x6b, 0x84, 0xb7, 0x2b, 0xa7, 0x64, 0xb0, 0x3d, 0x1e,
+  0x1c, 0x8c, 0xb7, 0x86, 0x78, 0xd3, 0xc4, 0x90, 0x5d, 0xb8, 0x3c, 0xd8, 0x1a, 0x0f, 0x76, 0xc6,
+  0xc3, 0x11, 0xbc, 0x41, 0x07, 0x67, 0xfe, 0x68, 0xcd, 0x77, 0x06, 0x54, 0x4c, 0x78, 0x01, 0xda,
+  0x36, 0x34, 0xb2, 0x46, 0x40, 0x4a, 0x83, 0xda, 0xd9, 0x9f, 0x85, 0xa0, 0x7a, 0xcb, 0xa2, 0x64,
+  0x93, 0xec, 0xef, 0x6e, 0x6b, 0x67, 0xec, 0xe4, 0x97, 0xdf, 0x1d, 0xf1, 0x4f, 0xa6, 0xc7, 0x78,
+  0x5e, 0x06, 0x68, 0x6b, 0x57, 0x83, 0x23, 0xfc, 0xcb, 0x7a, 0xe9, 0xbc, 0xf8, 0xef, 0x78, 0x71,
+  0xa8, 0xb6, 0x6b, 0x57, 0x4a, 0xd9, 0x08, 0xc9, 0x82, 0xbb, 0x03, 0xcb, 0xd2, 0x87, 0xbd, 0x7d,
+  0xc1, 0x2f, 0x9a, 0xf8, 0xe9, 0xf3, 0x77, 0xc2, 0xca, 0x39, 0xb7, 0x6f, 0x8d, 0xc6, 0xcb, 0x8e,
+  0xc5, 0xd7, 0x45, 0xe5, 0xd7, 0xd4, 0xf1, 0xf5, 0x27, 0xdd, 0x4f, 0xcc, 0x68, 0x78, 0x0f, 0x0d,
+  0x56, 0xc2, 0x16, 0xf9, 0x13, 0xbb, 0xaa, 0x39, 0x7d, 0xcf, 0xa9, 0xfb, 0xf9, 0x3b, 0x89, 0x94,
+  0xb3, 0x22, 0x73, 0x75, 0x17, 0x55, 0xf9, 0x20, 0xbb, 0xeb, 0x88, 0x32, 0xf2, 0x93, 0x8b, 0x95,
+  0x84, 0xd4, 0xc2, 0x09, 0xc4, 0x8e, 0x4d, 0xe3, 0x94, 0x99, 0x26, 0x30, 0xc1, 0xdc, 0x69, 0x48,
+  0x0c, 0x76, 0x6d, 0x62, 0x83, 0x5f, 0xa9, 0x55, 0x30, 0x01, 0x92, 0x2a, 0x90, 0x8c, 0x4b, 0x18,
+  0x72, 0xfe, 0xd3, 0xe6, 0x4d, 0xa9, 0x13, 0x13, 0xa3, 0xe5, 0x65, 0xa6, 0x34, 0x6e, 0x62, 0xd0,
+  0xbc, 0x97, 0xcf, 0x23, 0xca, 0xd2, 0x7f, 0xf4, 0xc2, 0x00, 0x93, 0x79, 0x6c, 0xb2, 0x4b, 0xdf,
+  0x52, 0x99, 0xdd, 0x8a, 0x9f, 0x0e, 0x66, 0xf9, 0xac, 0x53, 0xb2, 0x8c, 0x43, 0x76, 0xdc, 0x45,
+  0xee, 0x65, 0x53, 0x66, 0x0a, 0x2b, 0xa2, 0xd9, 0xd1, 0xd9, 0x86, 0xb5, 0x79, 0xe0, 0x37, 0xea,
+  0x19, 0xc2, 0xdd, 0x8a, 0x47, 0x80, 0x08, 0xee, 0xb0, 0x41, 0x05, 0xdf, 0x94, 0x2b, 0x2a, 0x4a,
+  0xb9, 0xbe, 0x2b, 0x9c, 0x18, 0xba, 0xde, 0x0e, 0xfc, 0x2e, 0x23, 0xf5, 0x9a, 0x31, 0x2e, 0x81,
+  0x6f, 0x44, 0xb3, 0xa0, 0x25, 0x9a, 0x9a, 0xf2, 0x1d, 0x9f, 0xca, 0xbd, 0x58, 0xa2, 0xe7, 0x48,
+  0x36, 0xd6, 0x9b, 0xd4, 0x12, 0x86, 0x77, 0x2e, 0x61, 0x8f, 0x1c, 0x5f, 0xf6, 0x95, 0xce, 0x76,
+  0xec, 0xd8, 0x7c, 0xa9, 0x15, 0xd8, 0x66, 0xf5, 0xf2, 0x88, 0x84, 0x94, 0x53, 0x8e, 0x67, 0x7d,
+  0x57, 0xc0, 0x83, 0x26, 0xc1, 0xc7, 0x45, 0xb3, 0xda, 0xf0, 0xd2, 0x0e, 0xa5, 0x55, 0x68, 0x1d,
+  0x8e, 0x8d, 0x89, 0x61, 0xb0, 0x43, 0x2b, 0x66, 0x9f, 0x05, 0x4c, 0xc0, 0x16, 0x85, 0x29, 0x1b,
+  0x87, 0x1b, 0x37, 0xd3, 0x1c, 0x6a, 0xd5, 0x00, 0x39, 0xc2, 0xca, 0xaa, 0xdd, 0x75, 0xac, 0xb8,
+  0x7a, 0x9d, 0xaa, 0x25, 0xf6, 0x7d, 0x23, 0x92, 0x60, 0x10, 0x86, 0x9b, 0x20, 0x39, 0x42, 0x38,
+  0x01, 0x9e, 0xf2, 0x62, 0x36, 0x5d, 0xfa, 0x78, 0x8f, 0xc2, 0xda, 0xad, 0x46, 0xd9, 0xb2, 0x6a,
+  0x14, 0x98, 0x4d, 0x8c, 0x25, 0xe1, 0xd0, 0xd5, 0x16, 0xd8, 0xcd, 0xc0, 0x9e, 0xf6, 0xc4, 0x37,
+  0x2e, 0x4e, 0x83, 0x86, 0xae, 0xa2, 0x29, 0x06, 0xa5, 0x91, 0xd6, 0x29, 0xff, 0x85, 0x07, 0xef,
+  0xed, 0x22, 0xcc, 0x9e, 0x7e, 0xca, 0x7e, 0x18, 0x5f, 0x73, 0x6b, 0x3b, 0x37, 0x87, 0x75, 0x65,
+  0xea, 0x53, 0x74, 0x91, 0x68, 0xa7, 0x2b, 0x9c, 0x43, 0x06, 0xdd, 0xe1, 0x99, 0xda, 0x5b, 0xc2,
+  0x9e, 0x97, 0xfe, 0xe8, 0xa0, 0x14, 0x13, 0x32, 0x7f, 0x61, 0xd6, 0xcb, 0x5e, 0x6b, 0x6d, 0x92,
+  0x09, 0x73, 0x54, 0x15, 0xd9, 0x2e, 0x6b, 0x39, 0x97, 0xcf, 0xd2, 0xbe, 0x77, 0x01, 0xbd, 0xc4,
+  0x0d, 0x85, 0xa9, 0xfb, 0x69, 0x63, 0xfe, 0x7d, 0xde, 0x62, 0xeb, 0x59, 0x9c, 0x91, 0xbc, 0x52,
+  0xcb, 0x3a, 0xbc, 0x6d, 0xa6, 0x53, 0x54, 0x15, 0x41, 0xdc, 0x49, 0x64, 0x3c, 0x85, 0xd4, 0x25,
+  0xc8, 0x9b, 0xc5, 0x12, 0x8f, 0x71, 0xfd, 0xdb, 0xbf, 0xb6, 0x4c, 0xb4, 0x2e, 0xfb, 0x32, 0xb0,
+  0x9a, 0xdc, 0x83, 0x8d, 0x48, 0x87, 0x57, 0xfa, 0x0a, 0xb4, 0xce, 0x2e, 0xb3, 0xb5, 0x2b, 0xdf,
+  0x01, 0xc0, 0xef, 0x1c, 0xf5, 0xfd, 0x22, 0xae, 0xd7, 0x51, 0x5b, 0xf9, 0x7a, 0xb8, 0x51, 0xdb,
+  0x63, 0x26, 0x63, 0x0f, 0x4b, 0x0f, 0x7f, 0x29, 0x11, 0x61, 0x3c, 0xe6, 0xc7, 0x67, 0xdb, 0xcb,
+  0x4b, 0x8c, 0x9f, 0xe1, 0x49, 0xf2, 0xc9, 0x63, 0x0c, 0x75, 0xba, 0x9f, 0x62, 0x30, 0x11, 0x46,
+  0xed, 0x8c, 0x61, 0x89, 0x0a, 0xf1, 0x30, 0x6b, 0x90, 0x75, 0x55, 0x48, 0xab, 0x28, 0x44, 0x28,
+  0xec, 0x72, 0x10, 0x76, 0xb1, 0x21, 0x46, 0x44, 0x4d, 0x28, 0x0b, 0x82, 0x4a, 0xbc, 0x33, 0x84,
+  0xcc, 0xda, 0xc2, 0x0c, 0x06, 0xf5, 0x4c, 0xa2, 0x1d, 0x78, 0x2a, 0xe5, 0x93, 0x49, 0x2d, 0x9f,
+  0x08, 0xa9, 0xcb, 0x11, 0x3a, 0x5a, 0xe7, 0x56, 0x46, 0x8b, 0xdb, 0x04, 0x10, 0xe0, 0xfa, 0x1c,
+  0x0a, 0x0f, 0xf8, 0x12, 0x80, 0x98, 0x4a, 0xc2, 0x0b, 0x75, 0x1c, 0xac, 0xc4, 0xbf, 0xe4, 0xdb,
+  0xe6, 0x49, 0x7f, 0xe2, 0x88, 0x9f, 0x53, 0x86, 0xb1, 0xf8, 0xfc, 0x1d, 0x56, 0x01, 0x32, 0xa8,
+  0x55, 0x08, 0x8f, 0x55, 0xfb, 0x5a, 0xc4, 0xec, 0x8d, 0xb5, 0x8f, 0xb5, 0xd1, 0xac, 0xfc, 0x52,
+  0xb1, 0x00, 0x77, 0xc6, 0x85, 0xbd, 0xd5, 0x5c, 0x13, 0x5d, 0x67, 0xf4, 0x22, 0xff, 0x58, 0xbd,
+  0xbe, 0xc3, 0x75, 0xf4, 0xfd, 0xda, 0xf7, 0x7f, 0xb0, 0xcc, 0x44, 0x32, 0x95, 0x27, 0x87, 0x63,
+  0xdd, 0xe6, 0x71, 0xf3, 0xfb, 0x5d, 0x9c, 0x75, 0xdc, 0xf7, 0x78, 0xd8, 0xb7, 0x78, 0xb8, 0xee,
+  0xf0, 0x70, 0x87, 0x04, 0xb1, 0x4e, 0xbe, 0x11, 0xdd, 0xb9, 0x46, 0xc8, 0xcb, 0xc6, 0xad, 0x9e,
+  0xd6, 0xab, 0x3a, 0xab, 0xe7, 0x8a, 0x93, 0x11, 0x78, 0x97, 0x9d, 0x57, 0x90, 0xb9, 0x24, 0x6b,
+  0xef, 0x2b, 0xc8, 0xed, 0x1f, 0x28, 0x85, 0x9c, 0xf6, 0x0f, 0x59, 0xe8, 0xdd, 0x4d, 0xaf, 0xe8,
+  0xde, 0x70, 0xa4, 0x24, 0x96, 0x89, 0x61, 0x53, 0x9c, 0x9d, 0xce, 0x24, 0xcd, 0xcf, 0x40, 0x8e,
+  0x09, 0xbb, 0x07, 0x0a, 0x2a, 0xe6, 0x32, 0xe2, 0x63, 0x97, 0xe7, 0xa9, 0x6b, 0x35, 0xcb, 0x3a,
+  0x52, 0x92, 0x88, 0xc5, 0x48, 0xd8, 0xd1, 0x25, 0xa3, 0xc1, 0xad, 0x25, 0x60, 0xe1, 0xc6, 0x04,
+  0x79, 0x5b, 0xaf, 0x8e, 0xf6, 0xad, 0x5d, 0x7d, 0x5e, 0x92, 0xfb, 0x57, 0x8d, 0xac, 0xc7, 0x9b,
+  0xff, 0x04, 0xb1, 0x24, 0x5d, 0x79, 0x8e, 0xe5, 0x62, 0x8b, 0x71, 0xdb, 0x54, 0xdc, 0xb2, 0xa9,
+  0x58, 0xa1, 0xef, 0xa3, 0x35, 0xa3, 0x5c, 0x6e, 0xfd, 0x3d, 0xce, 0xdb, 0x0f, 0x36, 0x33, 0x9b,
+  0x8a, 0x75, 0xa7, 0x17, 0xea, 0x16, 0xa7, 0xf6, 0xb1, 0xc6, 0xed, 0xd2, 0xc4, 0x5d, 0xa4, 0xfd,
+  0x17, 0xb6, 0x4c, 0xbc, 0xe1, 0x3c, 0x11, 0xf9, 0xc1, 0xb9, 0xdb, 0xfe, 0x93, 0x9f, 0xcf, 0xb9,
+  0x01, 0xfe, 0xd7, 0x9a, 0xd0, 0xc2, 0x1f, 0xf4, 0x09, 0xce, 0xe8, 0xea, 0xe0, 0xc9, 0xf6, 0xab,
+  0xb9, 0x72, 0xb3, 0xb7, 0xd8, 0x64, 0xae, 0x13, 0x52, 0x69, 0x2b, 0x33, 0xfc, 0x76, 0x71, 0x56,
+  0xea, 0x9a, 0x2e, 0x68, 0xc7, 0x85, 0xc4, 0x55, 0x90, 0x5c, 0xf7, 0x0f, 0x1f, 0xda, 0x87, 0x1a,
+  0xb4, 0x33, 0x1f, 0xcd, 0xef, 0x19, 0x3e, 0xbc, 0xf1, 0xf5, 0xb2, 0x87, 0x37, 0xba, 0x4d, 0xf6,
+  0xb0, 0xea, 0x78, 0x46, 0x0d, 0x10, 0x35, 0x70, 0xf4, 0xd0, 0x0a, 0xfb, 0xc4, 0x1c, 0x90, 0x0d,
+  0xe9, 0x0a, 0x3b, 0x40, 0x3d, 0x34, 0x86, 0x29, 0xf7, 0xea, 0x48, 0x63, 0xb0, 0x8d, 0x3a, 0x5e,
+  0xe2, 0xd4, 0x85, 0x42, 0x4a, 0xc7, 0xf9, 0x29, 0x79, 0x0d, 0x1e, 0xbb, 0x41, 0x80, 0x73, 0x81,
+  0x0c, 0x5d, 0x50, 0x60, 0x6b, 0xb1, 0x01, 0x87, 0xd6, 0xa5, 0x6f, 0x2c, 0x5b, 0xaf, 0x87, 0x4e,
+  0x3a, 0xdc, 0x3c, 0xf1, 0xe4, 0xbb, 0xaa, 0x7b, 0xb1, 0x83, 0x67, 0xa2, 0xf8, 0xfd, 0x8f, 0xdc,
+  0xb5, 0x07, 0xa5, 0x44, 0x93, 0x78, 0xb8, 0xe4, 0x6a, 0x89, 0xe8, 0xf2, 0x34, 0x14, 0xa0, 0xa9,
+  0xf5, 0xad, 0xac, 0x54, 0x00, 0xe2, 0x05, 0xc8, 0x75, 0xd3, 0xe6, 0xa8, 0x7a, 0x0f, 0xb5, 0xe8,
+  0xd2, 0xb6, 0xa3, 0x3f, 0x3c, 0xa0, 0x81, 0x5f, 0x1d, 0xed, 0xfc, 0xc8, 0x9c, 0xbc, 0xf6, 0x5d,
+  0xa3, 0xc3, 0xbe, 0x9c, 0xb0, 0xe4, 0x3e, 0x9e, 0xee, 0x92, 0xd4, 0xcd, 0xd3, 0xd2, 0x63, 0xeb,
+  0x1c, 0xbb, 0x29, 0xd5, 0x2e, 0x20, 0xc5, 0xbb, 0xb0, 0x29, 0xcd, 0xf0, 0x0a, 0x88, 0xbf, 0xad,
+  0x82, 0x84, 0x0d, 0x2b, 0x2c, 0x76, 0xcc, 0xb3, 0xbf, 0x44, 0xe9, 0xcf, 0xc2, 0x33, 0x78, 0xc0,
+  0x06, 0x8e, 0x1b, 0x8c, 0x15, 0xbb, 0x31, 0x62, 0x82, 0x0e, 0x12, 0x4e, 0x44, 0x68, 0x0f, 0x5d,
+  0x70, 0xda, 0x86, 0x55, 0xba, 0x8f, 0x79, 0x5a, 0x18, 0xbe, 0x73, 0x85, 0xa1, 0x62, 0xd4, 0x6f,
+  0xa3, 0xd3, 0x15, 0xc7, 0x99, 0x59, 0x84, 0x79, 0x3a, 0x32, 0x76, 0x26, 0x0d, 0x61, 0x8b, 0x67,
+  0x90, 0xbd, 0x2b, 0xe0, 0x16, 0x0c, 0x5a, 0xca, 0xe3, 0x34, 0x75, 0xa6, 0x52, 0x09, 0x6e, 0x38,
+  0xf2, 0x0b, 0xf6, 0x52, 0x4e, 0xd1, 0x59, 0x17, 0x50, 0xa9, 0xc5, 0x2a, 0xa2, 0x47, 0xb1, 0x31,
+  0x3e, 0x07, 0x3a, 0x62, 0x2e, 0xd8, 0x19, 0xdb, 0xac, 0x14, 0xde, 0xb6, 0x1b, 0xb9, 0xa4, 0x35,
+  0x0b, 0xab, 0x26, 0xcd, 0x19, 0x09, 0xe2, 0x8c, 0x0b, 0x0e, 0xf9, 0xca, 0x26, 0x39, 0x40, 0xd0,
+  0x13, 0x0f, 0x50, 0x85, 0x97, 0x68, 0xdb, 0xcf, 0x8f, 0x01, 0xa6, 0x01, 0xf2, 0x42, 0x90, 0x7d,
+  0xc9, 0xcf, 0x50, 0xc1, 0xc8, 0xf4, 0x7c, 0x8a, 0x39, 0x51, 0x91, 0xa0, 0x85, 0xcd, 0x5d, 0x9b,
+  0x9b, 0x0e, 0xd4, 0x4d, 0x56, 0x1c, 0x15, 0xac, 0xf8, 0x40, 0x82, 0x23, 0x22, 0xd2, 0x39, 0x67,
+  0xc7, 0xfb, 0xfc, 0x30, 0x17, 0xbb, 0xc2, 0xc6, 0x71, 0x7d, 0x67, 0x90, 0xde, 0x2f, 0xc8, 0x25,
+  0xca, 0x1e, 0x39, 0xc7, 0x15, 0x66, 0x8a, 0xca, 0x08, 0xcc, 0x5b, 0xce, 0x66, 0x40, 0x90, 0xf2,
+  0x03, 0x65, 0xe2, 0xd8, 0x18, 0x90, 0x55, 0x56, 0xb9, 0xff, 0xec, 0x81, 0x14, 0x02, 0x4b, 0x5e,
+  0xcb, 0x6a, 0xfd, 0x58, 0xbd, 0x69, 0x3c, 0x6f, 0xdf, 0x20, 0x45, 0xc9, 0xcd, 0xf5, 0x41, 0x6a,
+  0xd6, 0x73, 0xf5, 0x06, 0xc4, 0x9e, 0xb3, 0x99, 0x43, 0xc3, 0x6e, 0x24, 0xec, 0x22, 0x21, 0x2e,
+  0xc2, 0x16, 0xa9, 0x85, 0x63, 0xa5, 0xfc, 0x5c, 0x73, 0x7e, 0xc0, 0x8b, 0x7b, 0x2e, 0xf0, 0x86,
+  0xfb, 0xa5, 0x9c, 0x31, 0xaa, 0x10, 0x10, 0xf2, 0x55, 0x1e, 0x27, 0x7b, 0x78, 0x0b, 0x07, 0x61,
+  0x15, 0x60, 0x1d, 0x33, 0x8c, 0xfa, 0x25, 0x68, 0xf4, 0xf9, 0x7d, 0x30, 0x8a, 0xd9, 0x65, 0x2a,
+  0xf8, 0x86, 0xab, 0xb7, 0x6d, 0xf3, 0x8c, 0x64, 0xbe, 0xb2, 0x4d, 0xaa, 0x11, 0x2c, 0x5d, 0xd0,
+  0x0a, 0x00, 0xdf, 0xf1, 0x34, 0x8e, 0x08, 0xe8, 0x6b, 0xf6, 0x1f, 0xa1, 0x52, 0x8f, 0x45, 0x02,
+  0x25, 0xbb, 0x06, 0x1e, 0x70, 0xd4, 0x95, 0x75, 0x06, 0xe4, 0x8e, 0x38, 0xef, 0x60, 0xa8, 0x6b,
+  0x5f, 0x93, 0x3b, 0xae, 0xbb, 0x7c, 0x84, 0xff, 0x8e, 0x55, 0xed, 0x94, 0x1d, 0xd0, 0xb4, 0x6f,
+  0xcb, 0xb0, 0xaa, 0x8a, 0x53, 0x09, 0x43, 0xfb, 0xba, 0xad, 0x8e, 0xf1, 0x66, 0x6c, 0xc9, 0x33,
+  0x6d, 0x2d, 0x85, 0x41, 0x44, 0x15, 0x42, 0x4c, 0x69, 0xe3, 0x16, 0xaa, 0x35, 0xb8, 0x56, 0xcb,
+  0xf5, 0x94, 0x0f, 0xbc, 0x76, 0x06, 0xc5, 0xd5, 0x22, 0x5b, 0xfc, 0x27, 0x78, 0xce, 0xd2, 0x2d,
+  0xcb, 0xbe, 0x79, 0x79, 0xf2, 0x87, 0xc7, 0xaf, 0x9e, 0x3d, 0x3c, 0x3d, 0x25, 0xa7, 0x4f, 0x4e,
+  0x1e, 0x3c, 0x7c, 0x39, 0x26, 0xb2, 0x2a, 0xf0, 0xd8, 0xc3, 0x93, 0x57, 0x8f, 0x1f, 0xbe, 0x34,
+  0x0e, 0x88, 0xf6, 0xcd, 0x5b, 0xe2, 0x0b, 0x56, 0xd0, 0xf9, 0x50, 0xfb, 0xa4, 0x61, 0x6a, 0xcc,
+  0xe0, 0xd2, 0xac, 0x54, 0xaf, 0xee, 0xbf, 0x7c, 0xb5, 0x89, 0x67, 0x93, 0x5e, 0x9d, 0x3c, 0x7d,
+  0x48, 0x1e, 0x9d, 0x3c, 0x7c, 0xf2, 0xe0, 0xb4, 0x40, 0xf0, 0xf9, 0xb3, 0x27, 0x3f, 0x20, 0x0e,
+  0x86, 0x3c, 0x46, 0xa5, 0x42, 0x08, 0xa2, 0x36, 0x4a, 0x21, 0x14, 0xbd, 0xfc, 0xe2, 0x80, 0x4e,
+  0xbf, 0x44, 0x0e, 0xa1, 0x7e, 0xa7, 0x28, 0xa4, 0x35, 0x52, 0x48, 0x74, 0x9b, 0xe9, 0x95, 0x56,
+  0x8f, 0xd9, 0x5b, 0xa3, 0xb3, 0x56, 0x23, 0x2e, 0x07, 0x9b, 0x80, 0x0a, 0xda, 0xa6, 0x05, 0x13,
+  0xde, 0xad, 0x03, 0x71, 0x43, 0x4b, 0x0a, 0x96, 0x1f, 0x61, 0x3d, 0x99, 0x3d, 0x93, 0xcc, 0xd6,
+  0x76, 0x27, 0x09, 0x98, 0xc1, 0x46, 0x3c, 0x9b, 0x6b, 0xe7, 0x82, 0xf9, 0x7d, 0xde, 0xb2, 0xf1,
+  0xae, 0xd8, 0x5d, 0x7d, 0x91, 0x1f, 0xcf, 0x45, 0x05, 0xa3, 0x5c, 0x3a, 0xce, 0x42, 0xef, 0xcc,
+  0x6d, 0xce, 0x70, 0x22, 0x65, 0x6f, 0x60, 0x60, 0x7e, 0x34, 0xd6, 0x8c, 0xab, 0xf6, 0x09, 0xb5,
+  0xe2, 0xac, 0x12, 0x00, 0x9b, 0x70, 0xb7, 0x21, 0xb2, 0xef, 0x88, 0x0e, 0x09, 0x95, 0x5c, 0xfc,
+  0x12, 0xe0, 0x1d, 0x5a, 0xb9, 0x52, 0x47, 0x5d, 0x8f, 0x79, 0x5d, 0xf9, 0xc6, 0x12, 0xfe, 0xb8,
+  0x12, 0xe7, 0x5a, 0xb5, 0x28, 0xd4, 0x25, 0x40, 0x7f, 0xb6, 0x07, 0xc6, 0x43, 0x0d, 0x72, 0xf4,
+  0xb8, 0xcf, 0xa4, 0x24, 0x64, 0x2a, 0x5f, 0x63, 0xca, 0x9a, 0x22, 0xc4, 0xf8, 0xec, 0xbe, 0x84,
+  0x14, 0x30, 0x92, 0xed, 0x09, 0x77, 0xbc, 0x38, 0xc4, 0xad, 0x3b, 0xfe, 0xd6, 0xc9, 0xe8, 0x51,
+  0x97, 0x38, 0x4e, 0x5a, 0x94, 0x5c, 0x77, 0x93, 0xbf, 0xe3, 0x8b, 0x5f, 0x1e, 0x93, 0x0b, 0x3b,
+  0x75, 0x23, 0xf7, 0x9b, 0x9e, 0xa0, 0xa3, 0xe4, 0x4a, 0x3f, 0xea, 0xbe, 0x4f, 0x56, 0x09, 0xe3,
+  0xcf, 0x89, 0xec, 0x64, 0x0d, 0x3e, 0x0f, 0xc6, 0x8e, 0x0b, 0xda, 0xec, 0x6b, 0xf4, 0x2a, 0xac,
+  0x12, 0xef, 0xf5, 0xa1, 0xf7, 0xf0, 0x9a, 0x7b, 0x9e, 0xa1, 0x99, 0xeb, 0x9d, 0xb9, 0xd8, 0x08,
+  0xf8, 0xcd, 0xc6, 0x5a, 0x10, 0x9b, 0x1c, 0xbe, 0x52, 0xdd, 0xdc, 0x8a, 0xa7, 0x17, 0x81, 0x05,
+  0xb6, 0xc3, 0xeb, 0xc1, 0xf3, 0xa7, 0xc2, 0x5a, 0xf8, 0x04, 0x76, 0x33, 0xec, 0x0c, 0x71, 0xdb,
+  0x99, 0xae, 0x94, 0xef, 0x26, 0xab, 0x27, 0x53, 0x43, 0x83, 0xc4, 0xaf, 0x22, 0x19, 0xcc, 0x08,
+  0x5b, 0xd6, 0x19, 0x2b, 0xcc, 0x99, 0xbd, 0xad, 0x08, 0x2e, 0x2f, 0xb1, 0xe1, 0xe8, 0x87, 0x44,
+  0xca, 0xc1, 0xe4, 0xf9, 0x0d, 0xea, 0xe1, 0xe8, 0x0b, 0x0c, 0x27, 0x5b, 0x47, 0x90, 0xef, 0x66,
+  0x90, 0xe5, 0x82, 0x05, 0xe0, 0xb8, 0x3c, 0xba, 0x01, 0x34, 0xc5, 0xaf, 0x5b, 0x78, 0x27, 0xaf,
+  0xc3, 0x64, 0xf2, 0x4c, 0xc4, 0x0b, 0x4d, 0xfb, 0x96, 0xc2, 0x25, 0x58, 0x3a, 0x23, 0x5d, 0xb9,
+  0x35, 0xb9, 0xdc, 0x96, 0x8c, 0x27, 0xf5, 0x9c, 0xd6, 0xcf, 0xba, 0x8c, 0x36, 0x79, 0x7a, 0x45,
+  0x57, 0xe0, 0xa7, 0x33, 0xf4, 0x27, 0x58, 0xb2, 0xb8, 0x84, 0x5f, 0xfe, 0xf9, 0x7f, 0xb4, 0x6a,
+  0xad, 0xb2, 0x1f, 0x0d, 0x29, 0x07, 0x3a, 0xf6, 0xae, 0xf4, 0x71, 0x9c, 0x66, 0x18, 0x83, 0xe2,
+  0x24, 0xfc, 0x5c, 0x7c, 0xbc, 0x16, 0xf9, 0xb1, 0xf2, 0x35, 0xfb, 0x2a, 0xdb, 0x5d, 0xb7, 0xc7,
+  0x58, 0xef, 0x83, 0x0f, 0xc4, 0x75, 0x91, 0x73, 0x0e, 0x87, 0x35, 0x30, 0x22, 0x74, 0x20, 0x0d,
+  0xfc, 0xda, 0x33, 0x48, 0x58, 0xc8, 0x4c, 0x40, 0x1f, 0xe2, 0xd2, 0x55, 0x53, 0x07, 0x67, 0xa6,
+  0x59, 0x2f, 0x9d, 0x7a, 0xd1, 0x37, 0xd5, 0x87, 0x95, 0x45, 0x11, 0xb3, 0xa6, 0x07, 0x2b, 0xea,
+  0x65, 0x4d, 0x55, 0x59, 0xa6, 0xa5, 0xc5, 0xd7, 0xbf, 0x8e, 0x70, 0x21, 0xe3, 0x16, 0x30, 0x2c,
+  0x20, 0x12, 0x4f, 0x17, 0x8b, 0x9d, 0x72, 0xd5, 0x10, 0xca, 0x9d, 0x07, 0x49, 0xbc, 0x64, 0x99,
+  0x1f, 0xb4, 0x73, 0x4d, 0x02, 0x74, 0x85, 0xed, 0x28, 0x2f, 0xc2, 0xed, 0x45, 0xf1, 0xd2, 0x13,
+  0x27, 0x36, 0x5b, 0xc3, 0x56, 0x69, 0x29, 0x50, 0xc5, 0xd2, 0x38, 0x61, 0xb7, 0xf2, 0xc4, 0x78,
+  0x0e, 0x29, 0x69, 0x39, 0x43, 0x1a, 0xe6, 0xf1, 0xe5, 0xe6, 0xe3, 0xc0, 0xe7, 0x41, 0x9c, 0xbe,
+  0x40, 0x90, 0x8d, 0x82, 0xd9, 0x07, 0x6e, 0x6f, 0x42, 0xda, 0xb7, 0xa9, 0x19, 0xf9, 0x07, 0x2f,
+  0xf0, 0xe2, 0xfa, 0x78, 0xf9, 0x02, 0x20, 0x78, 0x67, 0x22, 0xd1, 0x80, 0x2e, 0xb3, 0x43, 0x96,
+  0xd1, 0x1c, 0x2f, 0x5d, 0x01, 0x15, 0xb1, 0x1f, 0xd2, 0xe8, 0x0c, 0x74, 0xfe, 0x7b, 0x18, 0xe9,
+  0xa3, 0xb2, 0x30, 0x2b, 0x55, 0x75, 0xab, 0x9e, 0xab, 0xc0, 0x51, 0x6e, 0xa9, 0xc3, 0xd0, 0x0e,
+  0x7e, 0xde, 0x7f, 0x5c, 0x7e, 0xff, 0x5e, 0x91, 0x25, 0x41, 0x92, 0xac, 0xb8, 0xce, 0xa7, 0xe8,
+  0xa5, 0x3a, 0xd2, 0xc7, 0xec, 0x32, 0xde, 0x9c, 0x3c, 0xd2, 0x06, 0xca, 0x2a, 0xa5, 0x78, 0xbc,
+  0xf7, 0x4a, 0x57, 0x54, 0x0a, 0x78, 0xce, 0x23, 0x50, 0x77, 0x68, 0x5f, 0x9c, 0x6a, 0x5e, 0xe0,
+  0x4c, 0xc6, 0xdb, 0xdc, 0x3e, 0x2b, 0x58, 0x8c, 0xa9, 0xda, 0x8e, 0x12, 0x7c, 0xba, 0xd4, 0x93,
+  0xcb, 0x61, 0x46, 0x34, 0xcf, 0xc0, 0x8b, 0xa9, 0xa0, 0xe0, 0x69, 0x24, 0x8c, 0x68, 0x1b, 0x39,
+  0xa4, 0x87, 0x7d, 0x34, 0x32, 0xe3, 0x1d, 0x3a, 0xaa, 0x2a, 0xe7, 0xe2, 0x5d, 0x5d, 0x93, 0x93,
+  0x0d, 0x95, 0x16, 0xa8, 0xec, 0x80, 0x8a, 0xc1, 0xa8, 0x2f, 0xe2, 0x6f, 0x50, 0x20, 0x05, 0xd1,
+  0x0a, 0xb3, 0x58, 0x3f, 0x80, 0x2d, 0xf6, 0xfd, 0x28, 0x58, 0x30, 0x7e, 0xd3, 0x33, 0x6e, 0xc5,
+  0x3c, 0x17, 0x8d, 0x7a, 0xa6, 0x25, 0xd7, 0xbe, 0xe2, 0x3c, 0xe8, 0xbe, 0x36, 0x04, 0x5f, 0x81,
+  0xd3, 0xce, 0x7f, 0xff, 0x0e, 0x0f, 0x6b, 0x7f, 0x45, 0xb4, 0x3c, 0x5b, 0xb2, 0xa3, 0xec, 0xee,
+  0x41, 0x71, 0x65, 0x62, 0xab, 0x9f, 0x1f, 0xd6, 0x94, 0x75, 0xf5, 0x18, 0xfd, 0xfd, 0x9d, 0x81,
+  0xb1, 0xa2, 0x6d, 0xf5, 0xc9, 0x03, 0x96, 0x54, 0x83, 0xcd, 0xc7, 0x84, 0xe2, 0x2c, 0x46, 0xfb,
+  0xcc, 0x0b, 0x1e, 0x62, 0x9c, 0xa7, 0x53, 0x32, 0xba, 0x04, 0x3a, 0x3f, 0xba, 0xc4, 0x65, 0x29,
+  0x39, 0x9c, 0x76, 0x7f, 0xcc, 0xd4, 0x07, 0x12, 0x40, 0xe2, 0xc8, 0x6b, 0xb0, 0x89, 0x7d, 0x6a,
+  0x75, 0x1c, 0x97, 0x94, 0x27, 0xc5, 0xa1, 0x77, 0x36, 0xf9, 0x46, 0x83, 0x91, 0x7d, 0x8a, 0x04,
+  0xa3, 0x9e, 0x4f, 0x5f, 0x30, 0x8f, 0x4c, 0x86, 0xc1, 0x94, 0x93, 0x55, 0x7a, 0xd5, 0x27, 0xdf,
+  0x63, 0x03, 0x43, 0x11, 0x56, 0x8f, 0x9d, 0x8c, 0x18, 0x4e, 0x20, 0x33, 0x82, 0xa8, 0x6f, 0x40,
+  0xe0, 0xd8, 0xe0, 0x66, 0x0a, 0xc4, 0xca, 0x22, 0x48, 0x29, 0x73, 0xaf, 0xc7, 0xe1, 0x05, 0x9f,
+  0x53, 0x8a, 0x5f, 0x54, 0xbc, 0x16, 0xa7, 0x1e, 0x4a, 0x2e, 0x7c, 0x16, 0xf0, 0x74, 0x5a, 0xd9,
+  0x17, 0xc5, 0x36, 0xe8, 0xed, 0xc0, 0x7d, 0xe5, 0x3a, 0xe2, 0xca, 0x0e, 0x27, 0xa7, 0x39, 0x29,
+  0x13, 0x77, 0x22, 0x86, 0x9c, 0xf3, 0xd5, 0x7b, 0x31, 0x5b, 0x66, 0xee, 0x7f, 0xe1, 0x33, 0x90,
+  0x30, 0x41, 0x2c, 0xc8, 0xdf, 0xa5, 0xe2, 0x93, 0xff, 0x2f, 0x2f, 0x96, 0x5f, 0xe4, 0x00, 0x6f,
+  0x4a, 0x2e, 0x3e, 0x2f, 0xf6, 0x24, 0x17, 0xeb, 0x5c, 0x40, 0x5b, 0x98, 0x89, 0x2e, 0xf4, 0x3b,
+  0xe0, 0x50, 0x4a, 0xf5, 0xf8, 0xa5, 0x68, 0xad, 0xb2, 0x0a, 0xea, 0x24, 0x01, 0xcc, 0xfa, 0x58,
+  0xa7, 0xac, 0xac, 0x22, 0x4a, 0x4b, 0x7b, 0x40, 0x0a, 0x7d, 0x23, 0x8f, 0xa0, 0xa8, 0x82, 0xdb,
+  0x50, 0x6e, 0x96, 0x84, 0xfd, 0x6a, 0x30, 0xd4, 0xcb, 0xe6, 0x00, 0x5d, 0x07, 0x8d, 0xde, 0x3b,
+  0xde, 0x99, 0xfa, 0x80, 0x5d, 0xc2, 0x8d, 0xa0, 0x7d, 0x53, 0x5e, 0xe9, 0xd9, 0xc6, 0xe2, 0xbc,
+  0x7f, 0xeb, 0x59, 0x5c, 0x30, 0xe6, 0x0c, 0xd3, 0x25, 0xf4, 0xed, 0xb1, 0x7c, 0x5f, 0x7e, 0x5d,
+  0x72, 0x69, 0x42, 0x02, 0xfb, 0x9a, 0xf4, 0xa9, 0xbc, 0x0e, 0xcc, 0x1d, 0x77, 0x21, 0xf0, 0x11,
+  0x17, 0x73, 0x29, 0x47, 0x29, 0x60, 0x79, 0x35, 0x2f, 0xe6, 0x7a, 0xef, 0x4c, 0xdd, 0x02, 0x42,
+  0x65, 0xbb, 0x4f, 0x5e, 0xae, 0xb8, 0x55, 0x41, 0x1c, 0xbc, 0x40, 0x7b, 0x52, 0x50, 0x88, 0xc4,
+  0xb2, 0x69, 0xae, 0x02, 0xd9, 0xe9, 0x93, 0x47, 0x41, 0x04, 0x0b, 0xc0, 0x71, 0x48, 0xbd, 0x68,
+  0xb5, 0x24, 0x6d, 0x80, 0x29, 0x1c, 0x4b, 0xf7, 0x1f, 0xbd, 0x7a, 0xf8, 0x32, 0x87, 0x8d, 0x66,
+  0xdd, 0x78, 0xb1, 0xc4, 0x33, 0xc8, 0x21, 0x9e, 0xde, 0x8f, 0x82, 0x74, 0x0e, 0x3b, 0x48, 0xdd,
+  0xd8, 0x99, 0xaf, 0x20, 0xca, 0xda, 0xd2, 0xa9, 0x5c, 0x05, 0x0d, 0x15, 0xcf, 0xb9, 0x7c, 0x20,
+  0x39, 0x0b, 0xad, 0x8d, 0xff, 0xb8, 0xbb, 0xc9, 0xc3, 0x98, 0xd1, 0x3e, 0x74, 0x77, 0x13, 0xcd,
+  0x4d, 0xf7, 0x36, 0xee, 0x6e, 0xce, 0xb3, 0x45, 0x78, 0x6f, 0xe3, 0xff, 0x07, 0x33, 0xb9, 0xb7,
+  0x4d, 0x21, 0xa2, 0x01, 0x00,
+};
+const size_t INDEX_HTML_GZ_LEN = sizeof(index_html_gz);
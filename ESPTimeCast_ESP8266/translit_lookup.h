@@ -0,0 +1,122 @@
+#ifndef TRANSLIT_LOOKUP_H
+#define TRANSLIT_LOOKUP_H
+
+// Transliteration of weather description characters to what the font can show.
+// One entry per Unicode code point, already upper case. Must stay sorted by
+// code point: normalizeWeatherDescription() binary searches it.
+typedef struct {
+    uint16_t codepoint;
+    const char* ascii;
+} TranslitMapping;
+
+const TranslitMapping translit_mappings[] = {
+    { 0x00DF, "SS" },  // ß
+    { 0x00E0, "A" },   // à
+    { 0x00E1, "A" },   // á
+    { 0x00E2, "A" },   // â
+    { 0x00E3, "A" },   // ã
+    { 0x00E4, "A" },   // ä
+    { 0x00E5, "A" },   // å
+    { 0x00E6, "AE" },  // æ
+    { 0x00E7, "C" },   // ç
+    { 0x00E8, "E" },   // è
+    { 0x00E9, "E" },   // é
+    { 0x00EA, "E" },   // ê
+    { 0x00EB, "E" },   // ë
+    { 0x00EC, "I" },   // ì
+    { 0x00ED, "I" },   // í
+    { 0x00EE, "I" },   // î
+    { 0x00EF, "I" },   // ï
+    { 0x00F1, "N" },   // ñ
+    { 0x00F2, "O" },   // ò
+    { 0x00F3, "O" },   // ó
+    { 0x00F4, "O" },   // ô
+    { 0x00F5, "O" },   // õ
+    { 0x00F6, "O" },   // ö
+    { 0x00F8, "O" },   // ø
+    { 0x00F9, "U" },   // ù
+    { 0x00FA, "U" },   // ú
+    { 0x00FB, "U" },   // û
+    { 0x00FC, "U" },   // ü
+    { 0x00FD, "Y" },   // ý
+    { 0x00FF, "Y" },   // ÿ
+    { 0x0101, "A" },   // ā
+    { 0x0103, "A" },   // ă
+    { 0x0105, "A" },   // ą
+    { 0x0107, "C" },   // ć
+    { 0x010D, "C" },   // č
+    { 0x010F, "D" },   // ď
+    { 0x0113, "E" },   // ē
+    { 0x0117, "E" },   // ė
+    { 0x0119, "E" },   // ę
+    { 0x011F, "G" },   // ğ
+    { 0x0123, "G" },   // ģ
+    { 0x0125, "H" },   // ĥ
+    { 0x012B, "I" },   // ī
+    { 0x012F, "I" },   // į
+    { 0x0135, "J" },   // ĵ
+    { 0x0137, "K" },   // ķ
+    { 0x013E, "L" },   // ľ
+    { 0x0142, "L" },   // ł
+    { 0x0144, "N" },   // ń
+    { 0x0146, "N" },   // ņ
+    { 0x014D, "O" },   // ō
+    { 0x0151, "O" },   // ő
+    { 0x0153, "OE" },  // œ
+    { 0x0155, "R" },   // ŕ
+    { 0x015B, "S" },   // ś
+    { 0x015D, "S" },   // ŝ
+    { 0x0161, "S" },   // š
+    { 0x0165, "T" },   // ť
+    { 0x016B, "U" },   // ū
+    { 0x016F, "U" },   // ů
+    { 0x0171, "U" },   // ű
+    { 0x0175, "W" },   // ŵ
+    { 0x0177, "Y" },   // ŷ
+    { 0x017A, "Z" },   // ź
+    { 0x017C, "Z" },   // ż
+    { 0x017E, "Z" },   // ž
+    { 0x0219, "S" },   // ș
+    { 0x021B, "T" },   // ț
+    { 0x0430, "A" },   // а
+    { 0x0431, "B" },   // б
+    { 0x0432, "V" },   // в
+    { 0x0433, "G" },   // г
+    { 0x0434, "D" },   // д
+    { 0x0435, "E" },   // е
+    { 0x0436, "Z" },   // ж
+    { 0x0437, "Z" },   // з
+    { 0x0438, "I" },   // и
+    { 0x0439, "J" },   // й
+    { 0x043A, "K" },   // к
+    { 0x043B, "L" },   // л
+    { 0x043C, "M" },   // м
+    { 0x043D, "N" },   // н
+    { 0x043E, "O" },   // о
+    { 0x043F, "P" },   // п
+    { 0x0440, "R" },   // р
+    { 0x0441, "S" },   // с
+    { 0x0442, "T" },   // т
+    { 0x0443, "U" },   // у
+    { 0x0444, "F" },   // ф
+    { 0x0445, "H" },   // х
+    { 0x0446, "C" },   // ц
+    { 0x0447, "C" },   // ч
+    { 0x0448, "S" },   // ш
+    { 0x0449, "SH" },  // щ
+    { 0x044B, "Y" },   // ы
+    { 0x044D, "E" },   // э
+    { 0x044E, "YU" },  // ю
+    { 0x044F, "YA" },  // я
+    { 0x0451, "E" },   // ё
+    { 0x0452, "DJ" },  // ђ
+    { 0x0458, "J" },   // ј
+    { 0x0459, "LJ" },  // љ
+    { 0x045A, "NJ" },  // њ
+    { 0x045B, "C" },   // ћ
+    { 0x045F, "DZ" }   // џ
+};
+
+const size_t TRANSLIT_MAPPING_COUNT = sizeof(translit_mappings) / sizeof(translit_mappings[0]);
+
+#endif // TRANSLIT_LOOKUP_H
\ No newline at end of file
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Builds index_html_gz.h, the gzip-compressed web UI, from index_html.h.
+
+Run from the repository root after every change to index_html.h:
+
+    python3 tools/gen_index_html_gz.py
+
+The output goes into both sketch folders. It records the FNV-1a hash of the
+page it was built from, and the sketches static_assert that it matches
+INDEX_HTML_HASH, so a stale header fails the build instead of serving an old
+UI.
+"""
+
+import gzip
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, "ESPTimeCast_ESP32", "index_html.h")
+TARGETS = [
+    os.path.join(ROOT, "ESPTimeCast_ESP32", "index_html_gz.h"),
+    os.path.join(ROOT, "ESPTimeCast_ESP8266", "index_html_gz.h"),
+]
+
+
+def fnv1a32(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        text = f.read()
+    m = re.search(rb'index_html\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral"', text, re.S)
+    if not m:
+        sys.exit("index_html raw literal not found in " + SOURCE)
+    page = m.group(1)
+
+    # mtime=0 keeps the output byte-identical between runs
+    packed = gzip.compress(page, compresslevel=9, mtime=0)
+
+    lines = [
+        "#pragma once",
+        "// index_html_gz.h",
+        "// Generated by tools/gen_index_html_gz.py from index_html.h, do not edit.",
+        "",
+        "#define INDEX_HTML_GZ_SOURCE_HASH 0x%08xu  // INDEX_HTML_HASH of the page it was built from" % fnv1a32(page),
+        "",
+        "const uint8_t index_html_gz[] PROGMEM = {",
+    ]
+    for i in range(0, len(packed), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in packed[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("const size_t INDEX_HTML_GZ_LEN = sizeof(index_html_gz);")
+
+    for target in TARGETS:
+        with open(target, "w", newline="\n") as f:
+            f.write("\n".join(lines) + "\n")
+
+    print("index_html: %d bytes, gzip: %d bytes (%.1f%%), hash %08x"
+          % (len(page), len(packed), 100.0 * len(packed) / len(page), fnv1a32(page)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,216 @@
+// Host benchmarks for the sketch's hot paths, against the implementations
+// they replaced. Timings are host wall clock, so only the ratios carry over
+// to the ESP8266.
+//
+//   build/esptimecast_bench [-n iterations]
+#include "sketch.cpp"
+
+#include "host.h"
+
+#include <chrono>
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double nsPerCall(BenchClock::time_point start, unsigned long calls) {
+  return std::chrono::duration<double, std::nano>(BenchClock::now() - start).count() / calls;
+}
+
+// Keeps the optimiser from dropping the work
+static volatile size_t benchSink;
+
+
+// -----------------------------------------------------------------------------
+// Weather description normalisation
+// -----------------------------------------------------------------------------
+// "light rain" and a few other common descriptions in OpenWeather's languages
+static const char *const DESCRIPTIONS[] = {
+  "light rain",                 // en
+  "leichter Regen",             // de
+  "légère pluie",               // fr
+  "lluvia ligera",              // es
+  "pioggia leggera",            // it
+  "chuva leve",                 // pt
+  "lichte regen",               // nl
+  "lätt regn",                  // sv
+  "kevyt sade",                 // fi
+  "słabe opady deszczu",        // pl
+  "slabý déšť",                 // cs
+  "slabý dážď",                 // sk
+  "enyhe eső",                  // hu
+  "ploaie ușoară",              // ro
+  "hafif yağmur",               // tr
+  "neliels lietus",             // lv
+  "nedidelis lietus",           // lt
+  "slaba kiša",                 // hr
+  "rahel dež",                  // sl
+  "небольшой дождь",            // ru
+  "облачно с прояснениями",     // ru
+  "легкий дощ",                 // uk
+  "слаба киша",                 // sr
+  "пасмурно",                   // ru
+};
+static const size_t DESCRIPTION_COUNT = sizeof(DESCRIPTIONS) / sizeof(DESCRIPTIONS[0]);
+
+// The replaced implementation: one String::replace() over the whole text per
+// mapped character, then upper-casing and filtering into a new String
+static String normalizeWithReplace(String str) {
+  for (size_t i = 0; i < TRANSLIT_MAPPING_COUNT; i++) {
+    uint16_t cp = translit_mappings[i].codepoint;
+    char utf8[4];
+    if (cp < 0x800) {
+      utf8[0] = 0xC0 | (cp >> 6);
+      utf8[1] = 0x80 | (cp & 0x3F);
+      utf8[2] = '\0';
+    } else {
+      utf8[0] = 0xE0 | (cp >> 12);
+      utf8[1] = 0x80 | ((cp >> 6) & 0x3F);
+      utf8[2] = 0x80 | (cp & 0x3F);
+      utf8[3] = '\0';
+    }
+    str.replace(utf8, translit_mappings[i].ascii);
+  }
+  str.toUpperCase();
+
+  String result = "";
+  for (unsigned int i = 0; i < str.length(); i++) {
+    char c = str.charAt(i);
+    if ((c >= 'A' && c <= 'Z') || c == ' ') result += c;
+  }
+  return result;
+}
+
+static void benchNormalizeWeatherDescription(unsigned long iterations) {
+  // Same table, so both must agree
+  int mismatches = 0;
+  for (const char *d : DESCRIPTIONS) {
+    char out[64];
+    normalizeWeatherDescription(d, out, sizeof(out));
+    if (normalizeWithReplace(d) != out) {
+      printf("  mismatch: \"%s\" -> \"%s\" vs \"%s\"\n", d, out, normalizeWithReplace(d).c_str());
+      mismatches++;
+    }
+  }
+
+  auto start = BenchClock::now();
+  for (unsigned long i = 0; i < iterations; i++) {
+    char out[64];
+    normalizeWeatherDescription(DESCRIPTIONS[i % DESCRIPTION_COUNT], out, sizeof(out));
+    benchSink = benchSink + out[0];
+  }
+  double singlePass = nsPerCall(start, iterations);
+
+  start = BenchClock::now();
+  for (unsigned long i = 0; i < iterations; i++) {
+    benchSink = benchSink + normalizeWithReplace(DESCRIPTIONS[i % DESCRIPTION_COUNT]).length();
+  }
+  double replaceChain = nsPerCall(start, iterations);
+
+  printf("normalizeWeatherDescription (%zu descriptions, %lu calls)\n", DESCRIPTION_COUNT, iterations);
+  printf("  single pass     %10.0f ns/call\n", singlePass);
+  printf("  replace chain   %10.0f ns/call  (%.1fx)\n", replaceChain, replaceChain / singlePass);
+  if (mismatches) printf("  %d outputs differ\n", mismatches);
+}
+
+
+// -----------------------------------------------------------------------------
+// Config load at boot
+// -----------------------------------------------------------------------------
+static size_t benchFileSize(const char *path) {
+  File f = LittleFS.open(path, "r");
+  return f ? f.size() : 0;
+}
+
+static double timeLoadConfig(unsigned long calls) {
+  auto start = BenchClock::now();
+  for (unsigned long i = 0; i < calls; i++) {
+    loadConfig();
+    if (hostSerialOutput.size() > (1 << 16)) hostSerialOutput.clear();
+  }
+  return nsPerCall(start, calls);
+}
+
+// loadConfig() from the snapshot alone and with a journal close to its
+// compaction size on top, then the snapshot read against the pretty-printed
+// config.json parse it replaced, on the same settings
+static void benchLoadConfig(unsigned long iterations) {
+  unsigned long calls = iterations / 100 ? iterations / 100 : 1;
+  hostFsWipe();
+  configSetDefaults(config);
+  configSetStr(CFG_SSID, "home");
+  configSetStr(CFG_OPENWEATHER_CITY, "Berlin");
+  configSetStr(CFG_TIME_ZONE, "Europe/Berlin");
+  saveConfig();
+  double snapshotOnly = timeLoadConfig(calls);
+
+  int records = 0;
+  while (benchFileSize(CONFIG_JOURNAL_PATH) + 64 < CONFIG_JOURNAL_COMPACT_BYTES) {
+    configSetInt(CFG_BRIGHTNESS, records % 16);
+    flushConfig();
+    records++;
+  }
+  size_t journalBytes = benchFileSize(CONFIG_JOURNAL_PATH);
+  double withJournal = timeLoadConfig(calls);
+
+  char label[64];
+  printf("loadConfig (%lu calls)\n", calls);
+  snprintf(label, sizeof(label), "snapshot, %zu bytes", benchFileSize(CONFIG_SNAPSHOT_PATH));
+  printf("  %-40s %10.0f ns/call\n", label, snapshotOnly);
+  snprintf(label, sizeof(label), "+ journal, %d records in %zu bytes", records, journalBytes);
+  printf("  %-40s %10.0f ns/call\n", label, withJournal);
+
+  saveConfig();
+  DynamicJsonDocument doc(2048);
+  configToJson(config, doc);
+  String json;
+  serializeJsonPretty(doc, json);
+  Config scratch;
+  int mismatches = 0;
+  auto start = BenchClock::now();
+  for (unsigned long i = 0; i < calls; i++) {
+    bool partial;
+    configSetDefaults(scratch);
+    mismatches += !readConfigSnapshot(CONFIG_SNAPSHOT_PATH, scratch, partial) || memcmp(&config, &scratch, sizeof(Config)) != 0;
+  }
+  double snapshotRead = nsPerCall(start, calls);
+
+  File f = LittleFS.open("/config.json", "w");
+  f.print(json);
+  f.close();
+  start = BenchClock::now();
+  for (unsigned long i = 0; i < calls; i++) {
+    mismatches += !loadConfigJson(scratch) || memcmp(&config, &scratch, sizeof(Config)) != 0;
+    if (hostSerialOutput.size() > (1 << 16)) hostSerialOutput.clear();
+  }
+  double jsonParse = nsPerCall(start, calls);
+  LittleFS.remove("/config.json");
+
+  printf("config read at boot (%lu calls)\n", calls);
+  snprintf(label, sizeof(label), "readConfigSnapshot, %zu bytes", benchFileSize(CONFIG_SNAPSHOT_PATH));
+  printf("  %-40s %10.0f ns/call\n", label, snapshotRead);
+  snprintf(label, sizeof(label), "loadConfigJson, %u bytes", json.length());
+  printf("  %-40s %10.0f ns/call  (%.1fx)\n", label, jsonParse, jsonParse / snapshotRead);
+  if (mismatches) printf("  %d loads differ from the saved config\n", mismatches);
+}
+
+
+int main(int argc, char **argv) {
+  unsigned long iterations = 100000;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], nullptr, 10);
+    } else {
+      fprintf(stderr, "usage: %s [-n iterations]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (iterations == 0) iterations = 1;
+
+  if (!LittleFS.begin()) {
+    fprintf(stderr, "cannot create the LittleFS directory\n");
+    return 1;
+  }
+
+  benchNormalizeWeatherDescription(iterations);
+  benchLoadConfig(iterations);
+  return 0;
+}
@@ -0,0 +1,251 @@
+// Runtime behind the shims: virtual clock, LittleFS on a host directory,
+// Serial capture, the network responder and the display log
+#include <dirent.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "host.h"
+
+#include <FS.h>
+#include <ESP8266WiFi.h>
+#include <ESP8266mDNS.h>
+#include <ESPAsyncTCP.h>
+#include <coredecls.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+FS LittleFS;
+ESP8266WiFiClass WiFi;
+MDNSResponder MDNS;
+
+bool hostSerialEcho = false;
+std::string hostSerialOutput;
+unsigned long hostConnectCostMs = 0;
+unsigned long hostTlsHandshakeCostMs = 0;
+unsigned long hostTlsResumeCostMs = 0;
+std::vector<HostDisplayEvent> hostDisplayLog;
+
+static unsigned long long nowUs = 0;
+static double cpuScale = 0;
+static bool cpuCharging = false;
+static unsigned long long cpuMarkNs = 0;
+static double cpuOwedUs = 0;  // charged but below a whole microsecond
+static time_t epoch = 1767225600;  // 2026-01-01 00:00:00 UTC
+static bool ntpReachable = true;
+static bool timeSynced = false;
+static void (*timeSyncCallback)() = nullptr;
+static std::string fsRoot;
+static bool fsRootIsTemp = false;
+static HostHttpResponder httpResponder;
+
+// --- Clock ---
+static unsigned long long threadCpuNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Moves the clock by the CPU time used since the last call, scaled
+static void chargeCpu() {
+  if (!cpuCharging) return;
+  unsigned long long ns = threadCpuNs();
+  cpuOwedUs += (ns - cpuMarkNs) * cpuScale / 1000.0;
+  cpuMarkNs = ns;
+  unsigned long long whole = (unsigned long long)cpuOwedUs;
+  nowUs += whole;
+  cpuOwedUs -= whole;
+}
+
+void hostSetCpuScale(double scale) { cpuScale = scale; }
+
+void hostCpuBegin() {
+  cpuCharging = cpuScale > 0;
+  cpuMarkNs = threadCpuNs();
+}
+
+void hostCpuEnd() {
+  chargeCpu();
+  cpuCharging = false;
+}
+
+unsigned long millis() {
+  chargeCpu();
+  return nowUs / 1000;
+}
+unsigned long micros() {
+  chargeCpu();
+  return nowUs;
+}
+// Both let the TCP stack run, as on the ESP8266
+void delay(unsigned long ms) {
+  chargeCpu();
+  nowUs += ms * 1000ULL;
+  hostPumpAsyncClients();
+}
+void yield() { hostPumpAsyncClients(); }
+void hostAdvanceMs(unsigned long ms) { delay(ms); }
+void hostAdvanceUs(unsigned long long us) {
+  chargeCpu();
+  nowUs += us;
+}
+unsigned long long hostNowUs() {
+  chargeCpu();
+  return nowUs;
+}
+
+long random(long howbig) { return howbig > 0 ? rand() % howbig : 0; }
+long random(long howsmall, long howbig) { return howsmall + random(howbig - howsmall); }
+
+void hostSetEpoch(time_t e) { epoch = e; }
+void hostSetNtpReachable(bool reachable) { ntpReachable = reachable; }
+
+time_t hostTime(time_t *t) {
+  chargeCpu();
+  time_t now = (time_t)(nowUs / 1000000);
+  if (timeSynced) now += epoch;
+  if (t) *t = now;
+  return now;
+}
+
+void settimeofday_cb(void (*cb)()) { timeSyncCallback = cb; }
+
+void configTime(int, int, const char *, const char *, const char *) {
+  setenv("TZ", "UTC0", 1);  // like the core, configTime() resets the zone
+  tzset();
+  if (!ntpReachable) return;
+  timeSynced = true;
+  if (timeSyncCallback) timeSyncCallback();
+}
+
+void EspClass::restart() { throw HostRestart(); }
+
+// --- Serial ---
+size_t Print::printf(const char *fmt, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  if (n < 0) return 0;
+  if ((size_t)n < sizeof(buf)) return write((const uint8_t *)buf, n);
+
+  std::string big(n + 1, '\0');
+  va_start(args, fmt);
+  vsnprintf(&big[0], big.size(), fmt, args);
+  va_end(args);
+  return write((const uint8_t *)big.data(), n);
+}
+
+size_t HardwareSerial::write(uint8_t c) { return write(&c, 1); }
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t size) {
+  hostSerialOutput.append((const char *)buf, size);
+  if (hostSerialEcho) fwrite(buf, 1, size, stdout);
+  return size;
+}
+
+// --- Filesystem ---
+static void removeTempRoot() {
+  if (!fsRootIsTemp) return;
+  hostFsWipe();
+  rmdir(fsRoot.c_str());
+}
+
+void hostSetFsRoot(const std::string &dir) {
+  fsRoot = dir;
+  fsRootIsTemp = false;
+}
+
+const std::string &hostFsRoot() { return fsRoot; }
+
+void hostFsWipe() {
+  DIR *dir = opendir(fsRoot.c_str());
+  if (!dir) return;
+  while (struct dirent *e = readdir(dir)) {
+    if (e->d_name[0] == '.') continue;
+    unlink((fsRoot + "/" + e->d_name).c_str());
+  }
+  closedir(dir);
+}
+
+static std::string hostPath(const char *path) {
+  return fsRoot + (path[0] == '/' ? "" : "/") + path;
+}
+
+bool FS::begin() {
+  if (!fsRoot.empty()) return mkdir(fsRoot.c_str(), 0755) == 0 || errno == EEXIST;
+  char dir[] = "/tmp/esptimecast-fs-XXXXXX";
+  if (!mkdtemp(dir)) return false;
+  fsRoot = dir;
+  fsRootIsTemp = true;
+  atexit(removeTempRoot);
+  return true;
+}
+
+File FS::open(const char *path, const char *mode) {
+  std::string m = mode;
+  const char *fmode = m == "r" ? "rb" : m == "w" ? "wb" : m == "a" ? "ab" : m == "r+" ? "r+b" : m == "w+" ? "w+b" : "a+b";
+  FILE *fp = fopen(hostPath(path).c_str(), fmode);
+  return fp ? File(fp, path) : File();
+}
+
+bool FS::exists(const char *path) {
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char *path) { return unlink(hostPath(path).c_str()) == 0; }
+
+bool FS::rename(const char *from, const char *to) {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool FS::info(FSInfo &info) {
+  info = FSInfo{ 1024 * 1024, 0, 4096, 256, 5, 32 };
+  DIR *dir = opendir(fsRoot.c_str());
+  if (!dir) return false;
+  while (struct dirent *e = readdir(dir)) {
+    struct stat st;
+    if (e->d_name[0] != '.' && stat((fsRoot + "/" + e->d_name).c_str(), &st) == 0) info.usedBytes += st.st_size;
+  }
+  closedir(dir);
+  return true;
+}
+
+size_t File::size() const {
+  if (!fp_) return 0;
+  fflush(fp_.get());
+  struct stat st;
+  return fstat(fileno(fp_.get()), &st) == 0 ? st.st_size : 0;
+}
+
+// --- Network ---
+void hostSetHttpResponder(HostHttpResponder responder) { httpResponder = responder; }
+
+void hostUseEsp8266NetworkCosts() {
+  hostConnectCostMs = HOST_ESP8266_CONNECT_MS;
+  hostTlsHandshakeCostMs = HOST_ESP8266_TLS_HANDSHAKE_MS;
+  hostTlsResumeCostMs = HOST_ESP8266_TLS_RESUME_MS;
+}
+
+bool hostHttpReachable(const char *host, uint16_t port) {
+  delay(hostConnectCostMs);
+  return hostHttpListening(host, port);
+}
+
+bool hostHttpListening(const char *, uint16_t) { return (bool)httpResponder; }
+
+// The responder stands in for the server, so its time is not charged
+std::string hostHttpRespond(const char *host, uint16_t port, const std::string &request) {
+  chargeCpu();
+  std::string response = httpResponder ? httpResponder(host, port, request) : std::string();
+  cpuMarkNs = threadCpuNs();
+  return response;
+}
+
+// --- Display ---
+void hostDisplayEvent(const char *kind, const char *text) {
+  hostDisplayLog.push_back(HostDisplayEvent{ millis(), kind, text });
+}
@@ -0,0 +1,69 @@
+// Controls for the host build of the sketch (see README.md in this folder).
+// The shims in shim/ call into host.cpp; tests and the simulator drive the
+// same state through the functions below.
+#pragma once
+
+#include <Arduino.h>
+
+#include <string>
+#include <vector>
+
+// Clock. Virtual: it starts at 0 and moves when the sketch calls delay(),
+// when the driver calls hostAdvanceMs(), and by the network costs below, so
+// a loop pass "takes" the time the sketch spends blocked.
+void hostAdvanceMs(unsigned long ms);
+void hostAdvanceUs(unsigned long long us);
+unsigned long long hostNowUs();
+
+// CPU work can be charged too: between hostCpuBegin() and hostCpuEnd() the
+// clock also moves by the host CPU time used, times scale. 0, the default,
+// charges nothing and keeps runs exact; drivers bracket the sketch's own
+// work (setup(), loop(), handlers) so their bookkeeping is not charged.
+void hostSetCpuScale(double scale);
+void hostCpuBegin();
+void hostCpuEnd();
+
+// Wall clock once configTime() has synced: epoch at virtual time 0. Until
+// the sync time() returns seconds since boot, as the ESP8266 core does.
+void hostSetEpoch(time_t epoch);
+void hostSetNtpReachable(bool reachable);
+
+// Filesystem root for LittleFS. LittleFS.begin() creates a temporary one if
+// none was set; hostFsWipe() empties it.
+void hostSetFsRoot(const std::string &dir);
+const std::string &hostFsRoot();
+void hostFsWipe();
+
+// Serial output is kept in hostSerialOutput, and echoed to stdout if set
+extern bool hostSerialEcho;
+extern std::string hostSerialOutput;
+
+// Network: responder for plain and TLS clients, by host name. Returns the
+// raw HTTP response; an unset responder makes every connect() fail.
+typedef std::function<std::string(const char *host, uint16_t port, const std::string &request)> HostHttpResponder;
+void hostSetHttpResponder(HostHttpResponder responder);
+extern unsigned long hostConnectCostMs;       // virtual time each connect() blocks for (DNS, TCP)
+extern unsigned long hostTlsHandshakeCostMs;  // and on top, a TLS client's full handshake
+extern unsigned long hostTlsResumeCostMs;     // or resuming the session it was given
+
+// Rough ESP8266 figures for the above: an 80 MHz core next to a desktop one,
+// a DNS lookup and TCP handshake to a server on the internet, and a BearSSL
+// handshake with and without a cached session. They show where the sketch
+// blocks, not how long it takes on a given network.
+const double HOST_ESP8266_CPU_SCALE = 100;
+const unsigned long HOST_ESP8266_CONNECT_MS = 60;
+const unsigned long HOST_ESP8266_TLS_HANDSHAKE_MS = 1200;
+const unsigned long HOST_ESP8266_TLS_RESUME_MS = 120;
+void hostUseEsp8266NetworkCosts();
+
+// Display: everything sent to the matrix, oldest first
+struct HostDisplayEvent {
+  unsigned long ms;
+  std::string kind;  // print, scroll, text, clear, intensity, shutdown
+  std::string text;
+};
+extern std::vector<HostDisplayEvent> hostDisplayLog;
+
+// ESP.restart() throws this; the sketch's globals cannot be reinitialised,
+// so callers treat it as the end of the run
+struct HostRestart {};
@@ -0,0 +1,893 @@
+// Host tests for the parts of the ESP8266 sketch that need no hardware:
+// transliteration, the config field table, the config snapshot and journal,
+// the request rate limiter and /metrics rendering, then the booted clock
+// against its loop pass budget, scraped, and under a request flood.
+// "make test" runs them.
+#include "sketch.cpp"
+
+#include "host.h"
+
+#include <map>
+
+static int checks = 0;
+static int failures = 0;
+
+#define CHECK(cond)                                                       \
+  do {                                                                    \
+    checks++;                                                             \
+    if (!(cond)) {                                                        \
+      failures++;                                                         \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+    }                                                                     \
+  } while (0)
+
+#define CHECK_STR(actual, expected)                                                              \
+  do {                                                                                           \
+    checks++;                                                                                    \
+    if (strcmp((actual), (expected)) != 0) {                                                     \
+      failures++;                                                                                \
+      printf("%s:%d: %s is \"%s\", expected \"%s\"\n", __FILE__, __LINE__, #actual, (actual), \
+             (expected));                                                                        \
+    }                                                                                            \
+  } while (0)
+
+static std::string normalized(const char *in, size_t outSize = 64) {
+  char out[64];
+  normalizeWeatherDescription(in, out, outSize);
+  return out;
+}
+
+static size_t fileSize(const char *path) {
+  File f = LittleFS.open(path, "r");
+  return f ? f.size() : 0;
+}
+
+// Flips one bit of a file on the host filesystem
+static void corruptFile(const char *path, size_t offset) {
+  std::string hostPath = hostFsRoot() + path;
+  FILE *fp = fopen(hostPath.c_str(), "r+b");
+  fseek(fp, offset, SEEK_SET);
+  int c = fgetc(fp);
+  fseek(fp, offset, SEEK_SET);
+  fputc(c ^ 0x01, fp);
+  fclose(fp);
+}
+
+static void resetConfigStore() {
+  hostFsWipe();
+  configSetDefaults(config);
+  configDirty = 0;
+  configFlushPending = false;
+}
+
+// Same bytes, padding included: every Config here starts from
+// configSetDefaults(), which clears the whole struct
+static bool sameConfig(const Config &a, const Config &b) {
+  return memcmp(&a, &b, sizeof(Config)) == 0;
+}
+
+
+// -----------------------------------------------------------------------------
+// Transliteration
+// -----------------------------------------------------------------------------
+static void testTransliterateCodepoint() {
+  CHECK_STR(transliterateCodepoint(0x00E9), "E");    // é
+  CHECK_STR(transliterateCodepoint(0x00DF), "SS");   // ß
+  CHECK_STR(transliterateCodepoint(0x0449), "SH");   // щ
+  CHECK(transliterateCodepoint(0x4E91) == nullptr);  // 云, not in the font
+  CHECK(transliterateCodepoint(0) == nullptr);
+
+  // The binary search needs the table sorted and free of duplicates
+  for (size_t i = 1; i < TRANSLIT_MAPPING_COUNT; i++) {
+    CHECK(translit_mappings[i - 1].codepoint < translit_mappings[i].codepoint);
+  }
+  for (size_t i = 0; i < TRANSLIT_MAPPING_COUNT; i++) {
+    CHECK_STR(transliterateCodepoint(translit_mappings[i].codepoint), translit_mappings[i].ascii);
+  }
+}
+
+static void testNormalizeWeatherDescription() {
+  CHECK(normalized("light rain") == "LIGHT RAIN");
+  CHECK(normalized("ciel dégagé") == "CIEL DEGAGE");
+  CHECK(normalized("Schneeschauer, stärker") == "SCHNEESCHAUER STARKER");
+  CHECK(normalized("небольшой дождь") == "NEBOLSOJ DOZD");
+  CHECK(normalized("30% облачность") == " OBLACNOST");
+  CHECK(normalized("") == "");
+
+  // Broken UTF-8: stray continuation bytes are dropped, a truncated
+  // sequence resyncs on the next lead byte
+  CHECK(normalized("a\x80" "b") == "AB");
+  CHECK(normalized("x\xC3") == "X");
+  CHECK(normalized("\xD0" "abc") == "ABC");
+
+  // Output is bounded and a digraph is never cut in half
+  CHECK(normalized("abcdefgh", 5) == "ABCD");
+  CHECK(normalized("abcщ", 5) == "ABC");
+  CHECK(normalized("abщ", 5) == "ABSH");
+  char out[1] = { 'x' };
+  normalizeWeatherDescription("abc", out, 1);
+  CHECK(out[0] == '\0');
+}
+
+
+// -----------------------------------------------------------------------------
+// Config field table
+// -----------------------------------------------------------------------------
+static void testConfigFieldTable() {
+  for (int i = 0; i < CONFIG_FIELD_COUNT; i++) {
+    const ConfigField &f = configFields[i];
+    CHECK(f.offset + f.size <= sizeof(Config));
+    if (f.type == CFG_TYPE_STR) CHECK(f.size > 1);
+    if (f.type == CFG_TYPE_BOOL) CHECK(f.size == sizeof(bool));
+    if (f.type == CFG_TYPE_INT) CHECK(f.size == sizeof(int));
+    if (f.type == CFG_TYPE_TIME) CHECK(f.size == sizeof(time_t));
+
+    // Fields never overlap, and every path leads back to its field
+    for (int j = 0; j < i; j++) {
+      const ConfigField &g = configFields[j];
+      CHECK(f.offset >= g.offset + g.size || g.offset >= f.offset + f.size);
+    }
+    char path[48];
+    configFieldPath(i, path, sizeof(path));
+    CHECK(configFindFieldPath(path) == i);
+    if (!f.group) CHECK(configFindField(f.key) == i);
+  }
+
+  CHECK(configFindField("ssid") == CFG_SSID);
+  CHECK(configFindField("brightness") == CFG_BRIGHTNESS);
+  CHECK(configFindField("label") == -1);  // nested, only reachable by path
+  CHECK(configFindField("nope") == -1);
+  CHECK(configFindFieldPath("countdown.label") == CFG_COUNTDOWN_LABEL);
+  CHECK(configFindFieldPath("countdown.nope") == -1);
+}
+
+static void testConfigSetFromString() {
+  configSetDefaults(config);
+  configDirty = 0;
+
+  CHECK(configSetFromString(CFG_SHOW_DATE, "on"));
+  CHECK(config.showDate);
+  CHECK(!configSetFromString(CFG_SHOW_DATE, "true"));  // unchanged
+  CHECK(configSetFromString(CFG_SHOW_DATE, "0"));
+  CHECK(!config.showDate);
+
+  CHECK(configSetFromString(CFG_BRIGHTNESS, "12"));
+  CHECK(config.brightness == 12);
+  CHECK(configSetFromString(CFG_DIM_BRIGHTNESS, "Off"));
+  CHECK(config.dimBrightness == -1);
+
+  CHECK(configSetFromString(CFG_COUNTDOWN_TARGET, "4102444800"));  // past 2038
+  CHECK(config.countdownTargetTimestamp == (time_t)4102444800LL);
+
+  CHECK(configSetFromString(CFG_OPENWEATHER_CITY, "Ljubljana"));
+  CHECK_STR(config.openWeatherCity, "Ljubljana");
+  CHECK(!configSetFromString(CFG_OPENWEATHER_CITY, "Ljubljana"));
+
+  // Too long for the field: truncated, still terminated
+  std::string longLabel(200, 'x');
+  CHECK(configSetFromString(CFG_COUNTDOWN_LABEL, longLabel.c_str()));
+  CHECK(strlen(config.countdownLabel) == sizeof(config.countdownLabel) - 1);
+
+  CHECK(configDirty == ((1ULL << CFG_SHOW_DATE) | (1ULL << CFG_BRIGHTNESS) | (1ULL << CFG_DIM_BRIGHTNESS)
+                        | (1ULL << CFG_COUNTDOWN_TARGET) | (1ULL << CFG_OPENWEATHER_CITY) | (1ULL << CFG_COUNTDOWN_LABEL)));
+  configSetDefaults(config);
+  configDirty = 0;
+}
+
+static void testConfigStoreFromString() {
+  Config c;
+  configSetDefaults(c);
+
+  CHECK(configStoreFromString(c, CFG_SHOW_DATE, "on"));
+  CHECK(c.showDate);
+  CHECK(!configStoreFromString(c, CFG_SHOW_DATE, "true"));  // unchanged
+  CHECK(configStoreFromString(c, CFG_SHOW_DATE, "0"));
+  CHECK(!c.showDate);
+
+  CHECK(configStoreFromString(c, CFG_BRIGHTNESS, "12"));
+  CHECK(c.brightness == 12);
+  CHECK(configStoreFromString(c, CFG_DIM_BRIGHTNESS, "Off"));
+  CHECK(c.dimBrightness == -1);
+
+  CHECK(configStoreFromString(c, CFG_COUNTDOWN_TARGET, "4102444800"));  // past 2038
+  CHECK(c.countdownTargetTimestamp == (time_t)4102444800LL);
+
+  CHECK(configStoreFromString(c, CFG_OPENWEATHER_CITY, "Ljubljana"));
+  CHECK_STR(c.openWeatherCity, "Ljubljana");
+  CHECK(!configStoreFromString(c, CFG_OPENWEATHER_CITY, "Ljubljana"));
+
+  // Too long for the field: truncated, still terminated
+  std::string longLabel(200, 'x');
+  CHECK(configStoreFromString(c, CFG_COUNTDOWN_LABEL, longLabel.c_str()));
+  CHECK(strlen(c.countdownLabel) == sizeof(c.countdownLabel) - 1);
+  CHECK(!configStoreFromString(c, CFG_COUNTDOWN_LABEL, longLabel.c_str()));
+}
+
+static void testConfigDiff() {
+  Config a, b;
+  configSetDefaults(a);
+  configSetDefaults(b);
+  CHECK(configDiff(a, b) == 0);
+
+  configStoreInt(b, CFG_BRIGHTNESS, 3);
+  configStoreStr(b, CFG_COUNTDOWN_LABEL, "Launch");
+  CHECK(configDiff(a, b) == (CFG_BIT(CFG_BRIGHTNESS) | CFG_BIT(CFG_COUNTDOWN_LABEL)));
+
+  // Bytes after a string's terminator are not part of the value
+  configSetDefaults(b);
+  b.openWeatherCity[10] = 'z';
+  CHECK(configDiff(a, b) == 0);
+}
+
+// Every field survives configToJson() -> configFromJson()
+static void testConfigJsonRoundTrip() {
+  Config c;
+  configSetDefaults(c);
+  strlcpy(c.openWeatherCity, "São Paulo", sizeof(c.openWeatherCity));
+  c.dimBrightness = -1;
+  c.flipDisplay = true;
+  c.countdownTargetTimestamp = 1767225600;
+  strlcpy(c.countdownLabel, "Launch", sizeof(c.countdownLabel));
+
+  DynamicJsonDocument doc(2048);
+  configToJson(c, doc);
+  CHECK(!doc.overflowed());
+  Config copy;
+  configSetDefaults(copy);
+  CHECK(configFromJson(doc.as<JsonObjectConst>(), copy) == 0);
+  CHECK(memcmp(&c, &copy, sizeof(Config)) == 0);
+}
+
+// Files written before the typed config kept some flags and numbers as strings
+static void testConfigFromLegacyJson() {
+  DynamicJsonDocument doc(512);
+  deserializeJson(doc, "{\"showDate\":\"on\",\"brightness\":\"12\",\"dimBrightness\":\"Off\","
+                       "\"flipDisplay\":1,\"countdown\":{\"label\":\"Launch\"}}");
+  Config c;
+  configSetDefaults(c);
+  CHECK(configFromJson(doc.as<JsonObjectConst>(), c) == CONFIG_FIELD_COUNT - 5);
+  CHECK(c.showDate);
+  CHECK(c.brightness == 12);
+  CHECK(c.dimBrightness == -1);
+  CHECK(c.flipDisplay);
+  CHECK_STR(c.countdownLabel, "Launch");
+  CHECK_STR(c.weatherUnits, "metric");  // missing, keeps its default
+}
+
+static void testConfigIntInRange() {
+  CHECK(configIntInRange(CFG_BRIGHTNESS, 0));
+  CHECK(configIntInRange(CFG_BRIGHTNESS, 15));
+  CHECK(!configIntInRange(CFG_BRIGHTNESS, 16));
+  CHECK(configIntInRange(CFG_DIM_BRIGHTNESS, -1));
+  CHECK(!configIntInRange(CFG_DIM_BRIGHTNESS, -2));
+  CHECK(!configIntInRange(CFG_DIM_START_HOUR, 24));
+  CHECK(!configIntInRange(CFG_SUNSET_MINUTE, 60));
+  CHECK(!configIntInRange(CFG_CLOCK_DURATION, 999));
+  CHECK(configIntInRange(CFG_CLOCK_DURATION, 1000));
+}
+
+
+// -----------------------------------------------------------------------------
+// Config snapshot and journal
+// -----------------------------------------------------------------------------
+// Changes the journal tests write, and the config they should come back as
+static Config journaledConfig() {
+  configSetStr(CFG_OPENWEATHER_CITY, "Ljubljana");
+  configSetInt(CFG_BRIGHTNESS, 12);
+  configSetBool(CFG_SHOW_DATE, true);
+  configSetTime(CFG_COUNTDOWN_TARGET, (time_t)1767225600);
+  configSetStr(CFG_COUNTDOWN_LABEL, "New Year");
+  return config;
+}
+
+// What boot reads back: the snapshot, then the journal on top
+static bool reload(int &applied) {
+  bool partial = false;
+  configSetDefaults(config);
+  if (!readConfigSnapshot(CONFIG_SNAPSHOT_PATH, config, partial)) return false;
+  bool clean = replayConfigJournal(applied);
+  configDirty = 0;  // as loadConfig() does: what was replayed is on flash
+  return clean;
+}
+
+static void testSnapshotRoundTrip() {
+  resetConfigStore();
+  configSetStr(CFG_SSID, "home");
+  configSetInt(CFG_CLOCK_DURATION, 15000);
+  Config expected = config;
+  CHECK(saveConfig());
+  CHECK(fileSize(CONFIG_SNAPSHOT_PATH) == sizeof(ConfigSnapshotHeader) + sizeof(Config));
+  CHECK(!LittleFS.exists(CONFIG_JOURNAL_PATH));
+
+  bool partial = true;
+  configSetDefaults(config);
+  CHECK(readConfigSnapshot(CONFIG_SNAPSHOT_PATH, config, partial));
+  CHECK(!partial);
+  CHECK(sameConfig(config, expected));
+
+  // A second save keeps the first snapshot as the backup
+  CHECK(saveConfig());
+  CHECK(LittleFS.exists("/config.bak"));
+  CHECK(!LittleFS.exists("/config.tmp"));
+
+  // Any damaged byte is caught by the CRC and leaves the defaults
+  corruptFile(CONFIG_SNAPSHOT_PATH, sizeof(ConfigSnapshotHeader) + 5);
+  Config defaults;
+  configSetDefaults(defaults);
+  CHECK(!readConfigSnapshot(CONFIG_SNAPSHOT_PATH, config, partial));
+  CHECK(sameConfig(config, defaults));
+  CHECK(!readConfigSnapshot("/missing.bin", config, partial));
+}
+
+static void testJournalReplay() {
+  resetConfigStore();
+  CHECK(saveConfig());
+  Config expected = journaledConfig();
+  CHECK(configDirty != 0);
+  CHECK(flushConfig());
+  CHECK(configDirty == 0);
+  CHECK(LittleFS.exists(CONFIG_JOURNAL_PATH));
+
+  int applied = 0;
+  CHECK(reload(applied));
+  CHECK(applied == 5);
+  CHECK(sameConfig(config, expected));
+
+  // Nothing dirty, nothing written
+  size_t before = fileSize(CONFIG_JOURNAL_PATH);
+  CHECK(flushConfig());
+  CHECK(fileSize(CONFIG_JOURNAL_PATH) == before);
+}
+
+static void testJournalTornTail() {
+  resetConfigStore();
+  CHECK(saveConfig());
+  Config expected = journaledConfig();
+  CHECK(flushConfig());
+
+  // Power lost in the middle of the next append
+  File f = LittleFS.open(CONFIG_JOURNAL_PATH, "a");
+  const uint8_t partialRecord[] = { CONFIG_JOURNAL_MAGIC, 10, 0 };
+  f.write(partialRecord, sizeof(partialRecord));
+  f.close();
+
+  int applied = 0;
+  CHECK(!reload(applied));
+  CHECK(applied == 5);
+  CHECK(sameConfig(config, expected));
+}
+
+static void testJournalCorruptRecord() {
+  resetConfigStore();
+  CHECK(saveConfig());
+  journaledConfig();
+  CHECK(flushConfig());
+
+  // A flipped bit in the third record: the first two still apply
+  File f = LittleFS.open(CONFIG_JOURNAL_PATH, "r");
+  size_t offset = 0;
+  for (int record = 0; record < 2; record++) {
+    ConfigJournalHeader h;
+    f.seek(offset);
+    f.read((uint8_t *)&h, sizeof(h));
+    offset += sizeof(h) + h.keyLen + h.valueLen + sizeof(uint32_t);
+  }
+  f.close();
+  corruptFile(CONFIG_JOURNAL_PATH, offset + sizeof(ConfigJournalHeader) + 1);
+
+  int applied = 0;
+  CHECK(!reload(applied));
+  CHECK(applied == 2);
+  CHECK(strcmp(config.openWeatherCity, "Ljubljana") == 0);
+  CHECK(config.brightness == 12);
+  CHECK(!config.showDate);
+}
+
+static void testJournalCompaction() {
+  resetConfigStore();
+  CHECK(saveConfig());
+  bool compacted = false;
+  for (int i = 0; i < 200; i++) {
+    configSetInt(CFG_BRIGHTNESS, i % 16);
+    configSetStr(CFG_CUSTOM_MESSAGE, i % 2 ? "ODD" : "EVEN");
+    CHECK(flushConfig());
+    CHECK(fileSize(CONFIG_JOURNAL_PATH) <= CONFIG_JOURNAL_COMPACT_BYTES);
+    compacted |= !LittleFS.exists(CONFIG_JOURNAL_PATH);
+  }
+  CHECK(compacted);
+
+  Config expected = config;
+  int applied = 0;
+  CHECK(reload(applied));
+  CHECK(sameConfig(config, expected));
+}
+
+// Boot path: loadConfig() finds snapshot and journal and ends up with the
+// same runtime settings
+static void testLoadConfig() {
+  resetConfigStore();
+  CHECK(saveConfig());
+  Config expected = journaledConfig();
+  CHECK(flushConfig());
+
+  loadConfig();
+  CHECK(sameConfig(config, expected));
+  CHECK(brightness == 12);
+  CHECK(strcmp(openWeatherCity, "Ljubljana") == 0);
+  CHECK(strcmp(countdownLabel, "New Year") == 0);
+
+  // An interrupted compaction is finished from /config.tmp
+  CHECK(saveConfig());
+  LittleFS.rename(CONFIG_SNAPSHOT_PATH, "/config.tmp");
+  loadConfig();
+  CHECK(LittleFS.exists(CONFIG_SNAPSHOT_PATH));
+  CHECK(sameConfig(config, expected));
+
+  // A config.json from before the snapshot is read once, then replaced by it
+  resetConfigStore();
+  {
+    DynamicJsonDocument doc(2048);
+    configToJson(expected, doc);
+    File f = LittleFS.open("/config.json", "w");
+    serializeJson(doc, f);
+    f.close();
+  }
+  loadConfig();
+  CHECK(sameConfig(config, expected));
+  CHECK(LittleFS.exists(CONFIG_SNAPSHOT_PATH));
+  CHECK(!LittleFS.exists("/config.json"));
+
+  // No files at all: defaults, written out as the first snapshot
+  resetConfigStore();
+  loadConfig();
+  Config defaults;
+  configSetDefaults(defaults);
+  CHECK(sameConfig(config, defaults));
+  CHECK(LittleFS.exists(CONFIG_SNAPSHOT_PATH));
+}
+
+
+// -----------------------------------------------------------------------------
+// Request rate limiting
+// -----------------------------------------------------------------------------
+static void resetRateBuckets() {
+  memset(rateBuckets, 0, sizeof(rateBuckets));
+}
+
+static int takeTokens(uint32_t ip, int attempts) {
+  int taken = 0;
+  for (int i = 0; i < attempts; i++) taken += takeRateToken(ip);
+  return taken;
+}
+
+static void testRateBucket() {
+  resetRateBuckets();
+  const uint32_t a = IPAddress(192, 168, 1, 10);
+  const uint32_t b = IPAddress(192, 168, 1, 11);
+
+  // A burst, then one token per refill period
+  CHECK(takeTokens(a, 50) == RATE_LIMIT_BURST);
+  CHECK(takeTokens(b, 50) == RATE_LIMIT_BURST);  // buckets are per client
+  hostAdvanceMs(RATE_LIMIT_REFILL_MS - 1);
+  CHECK(takeTokens(a, 5) == 0);
+  hostAdvanceMs(1);
+  CHECK(takeTokens(a, 5) == 1);
+  hostAdvanceMs(3 * RATE_LIMIT_REFILL_MS + RATE_LIMIT_REFILL_MS / 2);
+  CHECK(takeTokens(a, 5) == 3);
+  hostAdvanceMs(RATE_LIMIT_REFILL_MS / 2);  // the part period carried over
+  CHECK(takeTokens(a, 5) == 1);
+
+  // Refill stops at the burst size
+  hostAdvanceMs(100 * RATE_LIMIT_REFILL_MS);
+  CHECK(takeTokens(a, 50) == RATE_LIMIT_BURST);
+}
+
+static void testRateBucketEviction() {
+  resetRateBuckets();
+  for (uint32_t i = 1; i <= RATE_LIMIT_CLIENTS; i++) {
+    CHECK(takeTokens(i, RATE_LIMIT_BURST + 1) == RATE_LIMIT_BURST);
+    hostAdvanceMs(1);
+  }
+  // A new client takes over the slot refilled longest ago, with a full bucket
+  CHECK(takeTokens(100, RATE_LIMIT_BURST + 1) == RATE_LIMIT_BURST);
+  bool firstEvicted = true;
+  for (uint8_t i = 0; i < RATE_LIMIT_CLIENTS; i++) firstEvicted &= rateBuckets[i].ip != 1;
+  CHECK(firstEvicted);
+  // The others are still empty
+  CHECK(takeTokens(2, 1) == 0);
+}
+
+
+// -----------------------------------------------------------------------------
+// Metrics
+// -----------------------------------------------------------------------------
+static void testRenderMetrics() {
+  hostSerialOutput.clear();
+  size_t len = renderMetrics();
+  CHECK(len > 0);
+  CHECK(len < METRICS_BUFFER_SIZE);
+  CHECK(len == strlen(metricsBuffer));
+  CHECK(hostSerialOutput.find("[METRICS]") == std::string::npos);  // nothing left out
+  CHECK(strstr(metricsBuffer, "esptimecast_build_info{version=\"" FIRMWARE_VERSION "\"} 1\n"));
+  for (int s = 0; s < LOOP_SECTION_COUNT; s++) {
+    char sample[96];
+    snprintf(sample, sizeof(sample), "esptimecast_loop_max_latency_us{section=\"%s\"}", LOOP_SECTION_NAMES[s]);
+    CHECK(strstr(metricsBuffer, sample));
+  }
+
+  // Text format: every family is a # TYPE line followed by its samples, and
+  // no family appears twice
+  std::vector<std::string> families;
+  std::string family;
+  int samplesInFamily = 0;
+  const char *p = metricsBuffer;
+  while (*p) {
+    const char *eol = strchr(p, '\n');
+    CHECK(eol);
+    if (!eol) break;
+    std::string line(p, eol);
+    p = eol + 1;
+    if (line.compare(0, 7, "# TYPE ") == 0) {
+      if (!family.empty()) CHECK(samplesInFamily > 0);
+      family = line.substr(7, line.find(' ', 7) - 7);
+      std::string type = line.substr(8 + family.size());
+      CHECK(type == "counter" || type == "gauge");
+      CHECK(std::find(families.begin(), families.end(), family) == families.end());
+      families.push_back(family);
+      samplesInFamily = 0;
+      continue;
+    }
+    CHECK(!family.empty());
+    CHECK(line.compare(0, family.size(), family) == 0);
+    char next = line[family.size()];
+    CHECK(next == ' ' || next == '{');
+    samplesInFamily++;
+  }
+  CHECK(samplesInFamily > 0);
+}
+
+// A family that does not fit is dropped whole
+static void testMetricsFamilyOverflow() {
+  MetricsWriter w = { METRICS_BUFFER_SIZE - 60, 0, 0 };
+  memset(metricsBuffer, 'x', w.len);
+  metricsBuffer[w.len] = '\0';
+  metricsBeginFamily(w, "esptimecast_test", "gauge");
+  metricsAppend(w, "esptimecast_test{label=\"%s\"} 1\n", "long enough to overflow the buffer");
+  metricsEndFamily(w);
+  CHECK(w.len == METRICS_BUFFER_SIZE - 60);
+  CHECK(w.dropped == 1);
+  CHECK(strlen(metricsBuffer) == w.len);
+
+  metricsSingle(w, "esptimecast_t", "gauge", 7);
+  CHECK(w.dropped == 1);
+  CHECK(strcmp(metricsBuffer + METRICS_BUFFER_SIZE - 60, "# TYPE esptimecast_t gauge\nesptimecast_t 7\n") == 0);
+}
+
+
+// -----------------------------------------------------------------------------
+// The running clock. setup() can only run once per process, so these tests
+// come last and share one boot.
+// -----------------------------------------------------------------------------
+static const time_t BOOT_EPOCH = 1767225600;  // 2026-01-01 00:00:00 UTC
+
+static const char *const NIGHTSCOUT_URL = "https://ns.example.com/api/v1/entries.json?count=1";
+
+static std::map<std::string, unsigned> repliesByHost;
+
+static std::string cannedResponse(const char *host, uint16_t, const std::string &) {
+  repliesByHost[host]++;
+  if (strcmp(host, "api.openweathermap.org") == 0) {
+    return "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\n\r\n"
+           "{\"weather\":[{\"main\":\"Clouds\",\"description\":\"broken clouds\"}],\"main\":{\"temp\":3.5,\"humidity\":81}}";
+  }
+  if (strcmp(host, "ns.example.com") == 0) {
+    return "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\n\r\n"
+           "[{\"sgv\":112,\"direction\":\"Flat\",\"dateString\":\"2026-01-01T00:00:00.000Z\"}]";
+  }
+  return "HTTP/1.0 404 Not Found\r\n\r\n";
+}
+
+// Boots the sketch with every display mode configured: weather with its
+// description, Nightscout, the date, a countdown and a custom message
+static void bootClock() {
+  static bool booted = false;
+  if (booted) return;
+  booted = true;
+  resetConfigStore();
+  configSetStr(CFG_SSID, "test");
+  configSetStr(CFG_PASSWORD, "password");
+  configSetStr(CFG_OPENWEATHER_API_KEY, "0123456789abcdef0123456789abcdef");
+  configSetStr(CFG_OPENWEATHER_CITY, "Berlin");
+  configSetStr(CFG_OPENWEATHER_COUNTRY, "DE");
+  configSetStr(CFG_TIME_ZONE, "Europe/Berlin");
+  configSetStr(CFG_NTP_SERVER2, NIGHTSCOUT_URL);
+  configSetBool(CFG_SHOW_DATE, true);
+  configSetBool(CFG_SHOW_WEATHER_DESCRIPTION, true);
+  configSetBool(CFG_COUNTDOWN_ENABLED, true);
+  configSetTime(CFG_COUNTDOWN_TARGET, BOOT_EPOCH + 24 * 3600);
+  configSetStr(CFG_COUNTDOWN_LABEL, "LAUNCH");
+  configSetStr(CFG_CUSTOM_MESSAGE, "HELLO");
+  saveConfig();
+
+  hostSetEpoch(BOOT_EPOCH - hostNowUs() / 1000000);
+  hostSetHttpResponder(cannedResponse);
+  setup();
+}
+
+static bool modeShown[DISPLAY_MODE_COUNT];
+static unsigned handshakesWhileMoving = 0;   // TLS connects made while the display was animating
+static unsigned overrunsWithoutHandshake = 0;  // passes over budget that made no TLS connect
+
+// One loop() pass; true if it made a TLS connect
+static bool loopPass() {
+  uint32_t handshakes = nightscoutTls.handshakes;
+  uint32_t overruns = loopPassStats.overruns;
+  loop();
+  bool handshook = nightscoutTls.handshakes != handshakes;
+  if (handshook && !displayIsStatic()) handshakesWhileMoving++;
+  if (!handshook && loopPassStats.overruns != overruns) overrunsWithoutHandshake++;
+  if (displayMode >= 0 && displayMode < DISPLAY_MODE_COUNT) modeShown[displayMode] = true;
+  return handshook;
+}
+
+// Runs loop() for ms of virtual time, step ms apart
+static void runLoop(unsigned long ms, unsigned long step = 10) {
+  unsigned long long endUs = hostNowUs() + ms * 1000ULL;
+  while (hostNowUs() < endUs) {
+    loopPass();
+    hostAdvanceMs(step);
+    if (hostDisplayLog.size() > 10000) hostDisplayLog.clear();
+    if (hostSerialOutput.size() > (1 << 16)) hostSerialOutput.clear();
+  }
+}
+
+static const LoopTask *loopTask(const char *name) {
+  for (const LoopTask &t : loopTasks) {
+    if (strcmp(t.name, name) == 0) return &t;
+  }
+  return nullptr;
+}
+
+// An hour through the whole rotation with ESP8266 connect and handshake
+// costs all the way. The weather fetch connects in the background and
+// arrives whole; the Nightscout handshake still blocks, so those passes go
+// over budget and the meter must say so, but only while nothing on the
+// display is moving. Every other pass and every other task stays within
+// its budget.
+static void testLoopPassBudget() {
+  bootClock();
+  hostUseEsp8266NetworkCosts();
+  runLoop(60 * 60 * 1000UL);
+  hostConnectCostMs = hostTlsHandshakeCostMs = hostTlsResumeCostMs = 0;
+
+  CHECK(loopSectionStats[SECTION_LOOP_PASS].count > 100000);
+  CHECK(repliesByHost["api.openweathermap.org"] >= 12);
+  CHECK(weatherFetchStats.count >= 12);
+  CHECK(weatherFetchStats.failures == 0);
+  CHECK(weatherFetchStats.lastMs >= HOST_ESP8266_CONNECT_MS);  // the connect took its time, just not the loop's
+  CHECK(repliesByHost["ns.example.com"] > 0);
+  CHECK(nightscoutFetchStats.failures == 0);
+  CHECK(nightscoutTls.handshakes > 0);
+  CHECK(handshakesWhileMoving == 0);
+  for (const LoopTask &t : loopTasks) {
+    if (strcmp(t.name, "nightscout_tls") != 0) CHECK(t.overruns == 0);
+  }
+  CHECK(overrunsWithoutHandshake == 0);
+  CHECK(loopPassStats.overruns <= loopTask("nightscout_tls")->overruns);
+  CHECK(loopPassStats.overruns <= nightscoutTls.handshakes);
+  CHECK(loopPassStats.overruns > 0);
+  CHECK(loopPassStats.worstUs >= HOST_ESP8266_TLS_RESUME_MS * 1000);
+  CHECK_STR(loopPassStats.worstTask, "nightscout_tls");
+  for (int m = 0; m < DISPLAY_MODE_COUNT; m++) CHECK(modeShown[m]);
+}
+
+
+// Value of a sample in the last renderMetrics() output, -1 if it is missing
+static double metricValue(const char *sample) {
+  std::string prefix = std::string(sample) + " ";
+  const char *p = metricsBuffer;
+  while (p && *p) {
+    if (strncmp(p, prefix.c_str(), prefix.size()) == 0) return atof(p + prefix.size());
+    p = strchr(p, '\n');
+    if (p) p++;
+  }
+  return -1;
+}
+
+// A scrape after the clock has been running reports what it did
+static void testMetricsScrape() {
+  bootClock();
+  runLoop(11 * 60 * 1000UL);  // two weather refreshes at least
+  renderMetrics();
+
+  CHECK(metricValue("esptimecast_fetch_total{source=\"weather\"}") >= 2);
+  CHECK(metricValue("esptimecast_fetch_total{source=\"weather\"}") == weatherFetchStats.count);
+  CHECK(metricValue("esptimecast_fetch_failures_total{source=\"weather\"}") == weatherFetchStats.failures);
+  CHECK(metricValue("esptimecast_fetch_failures_total{source=\"weather\"}") == 0);
+  CHECK(metricValue("esptimecast_fetch_total{source=\"nightscout\"}") == nightscoutFetchStats.count);
+  CHECK(metricValue("esptimecast_fetch_failures_total{source=\"nightscout\"}") == 0);
+  CHECK(metricValue("esptimecast_loop_iterations_total") == loopSectionStats[SECTION_LOOP_PASS].count);
+  CHECK(metricValue("esptimecast_display_mode_seconds_total{mode=\"clock\"}") > 0);
+  CHECK(metricValue("esptimecast_wifi_rssi_dbm") != -1);
+}
+
+// /settings answers from its own handler: a body over the limit, broken
+// JSON and a good PATCH, each from a client of its own
+static void testSettingsHandler() {
+  bootClock();
+  auto settings = [](uint8_t client, WebRequestMethodComposite method, const std::string &body) {
+    AsyncWebServerRequest r(IPAddress(10, 0, 1, client), method, "/settings", body, "application/json");
+    server.hostDispatch(&r);
+    r.hostDisconnect();
+    return r.sentCode;
+  };
+  CHECK(settings(1, HTTP_POST, "{\"brightness\":\"" + std::string(SettingsWebHandler::MAX_CONTENT_LENGTH, '9') + "\"}") == 413);
+  CHECK(settings(2, HTTP_POST, "{\"brightness\":") == 400);
+  CHECK(settings(3, HTTP_PATCH, "{\"brightness\":5}") == 200);
+  CHECK(settings(4, HTTP_GET, "{\"brightness\":6}") != 200);  // not a method /settings takes
+  runLoop(50);  // the change is applied from the loop
+  CHECK(brightness == 5);
+  for (uint8_t i = 0; i < REQUESTS_IN_FLIGHT_MAX; i++) CHECK(requestsInFlight[i] == nullptr);
+}
+
+// A request flood through the real handlers, interleaved with the loop:
+// rejections are counted, no more than REQUESTS_IN_FLIGHT_MAX are ever
+// admitted at once, the loop passes stay within budget, and the display
+// never waits longer than a scroll step between passes. The handlers' CPU
+// time is charged to the clock at ESP8266 speed, between the passes, where
+// the async server runs them, and the network has its ESP8266 costs; a
+// pass that made a Nightscout handshake is held to the rules of
+// testLoopPassBudget instead.
+static void testRequestFlood() {
+  bootClock();
+  struct OpenRequest {
+    std::unique_ptr<AsyncWebServerRequest> request;
+    unsigned long closesAt;
+  };
+  std::vector<OpenRequest> open;
+  unsigned long rejectedRateBefore = requestsRejectedRate;
+  unsigned long rejectedBusyBefore = requestsRejectedBusy;
+  unsigned overrunsWithoutHandshakeBefore = overrunsWithoutHandshake;
+  size_t frames = 0;
+  int admitted = 0, rejected = 0, answered = 0, settingsRejected = 0, settingsBuffered = 0;
+  size_t mostOpen = 0;
+  unsigned long long lastPassUs = hostNowUs(), longestGapUs = 0;
+  bool handshook = false;  // the last pass held the display for a TLS connect, on a still frame
+  const int clients = RATE_LIMIT_CLIENTS / 2;  // each keeps its bucket
+  hostSetCpuScale(HOST_ESP8266_CPU_SCALE);
+  hostUseEsp8266NetworkCosts();
+
+  for (int pass = 0; pass < 6000; pass++) {
+    for (int i = 0; i < 5; i++) {
+      IPAddress ip(10, 0, 0, 1 + (pass * 5 + i) % clients);
+      std::unique_ptr<AsyncWebServerRequest> r;
+      if (i == 4) {
+        r.reset(new AsyncWebServerRequest(ip, HTTP_POST, "/settings", "{\"brightness\":8}", "application/json"));
+      } else {
+        r.reset(new AsyncWebServerRequest(ip, HTTP_POST, "/set_brightness", "value=8", "application/x-www-form-urlencoded"));
+      }
+      hostCpuBegin();
+      server.hostDispatch(r.get());
+      hostCpuEnd();
+      if (r->sentCode == 429) {
+        rejected++;
+        if (i == 4) {
+          settingsRejected++;
+          settingsBuffered += r->_tempObject != nullptr;  // admission comes before the body
+        }
+        r->hostDisconnect();
+      } else {
+        admitted++;
+        answered += r->sentCode == 200;
+        open.push_back(OpenRequest{ std::move(r), millis() + (pass % 100 < 10 ? 200 : 0) });  // now and then a slow reader
+      }
+    }
+    mostOpen = std::max(mostOpen, open.size());
+
+    if (!handshook) longestGapUs = std::max(longestGapUs, hostNowUs() - lastPassUs);
+    lastPassUs = hostNowUs();
+    size_t logged = hostDisplayLog.size();
+    handshook = loopPass();
+    frames += hostDisplayLog.size() - logged;
+    hostAdvanceMs(10);
+
+    for (size_t i = 0; i < open.size();) {
+      if ((long)(millis() - open[i].closesAt) >= 0) {
+        open[i].request->hostDisconnect();
+        open.erase(open.begin() + i);
+      } else {
+        i++;
+      }
+    }
+  }
+  for (OpenRequest &o : open) o.request->hostDisconnect();
+  hostSetCpuScale(0);
+  hostConnectCostMs = hostTlsHandshakeCostMs = hostTlsResumeCostMs = 0;
+
+  CHECK(admitted > 0);
+  CHECK(admitted + rejected == 30000);
+  CHECK(answered == admitted);
+  CHECK(settingsRejected > 0);
+  CHECK(settingsBuffered == 0);
+  CHECK(requestsRejectedRate > rejectedRateBefore);
+  CHECK(requestsRejectedBusy > rejectedBusyBefore);
+  CHECK((requestsRejectedRate - rejectedRateBefore) + (requestsRejectedBusy - rejectedBusyBefore) == (unsigned long)rejected);
+  CHECK(mostOpen <= REQUESTS_IN_FLIGHT_MAX);
+  for (uint8_t i = 0; i < REQUESTS_IN_FLIGHT_MAX; i++) CHECK(requestsInFlight[i] == nullptr);
+  CHECK(overrunsWithoutHandshake == overrunsWithoutHandshakeBefore);
+  CHECK(handshakesWhileMoving == 0);
+  CHECK(longestGapUs <= GENERAL_SCROLL_SPEED * 1000UL);
+  CHECK(frames > 0);  // the display kept updating
+  CHECK(brightness == 8);
+}
+
+// A weather host that does not answer fails the fetch once the connect
+// gives up, without holding up a loop pass
+static void testWeatherConnectRefused() {
+  bootClock();
+  runLoop(1000);
+  uint32_t failuresBefore = weatherFetchStats.failures;
+  uint32_t overrunsBefore = loopTask("weather")->overruns;
+  hostSetHttpResponder(nullptr);
+  hostConnectCostMs = HOST_ESP8266_CONNECT_MS;
+  shouldFetchWeatherNow = true;
+  runLoop(20);
+  CHECK(weatherFetchState == WEATHER_FETCH_CONNECTING);
+  runLoop(1000);
+  hostConnectCostMs = 0;
+  hostSetHttpResponder(cannedResponse);
+
+  CHECK(weatherFetchState == WEATHER_FETCH_IDLE);
+  CHECK(weatherFetchStats.failures == failuresBefore + 1);
+  CHECK(loopTask("weather")->overruns == overrunsBefore);
+  CHECK(hostSerialOutput.find("reason: connection refused") != std::string::npos);
+}
+
+
+struct TestCase {
+  const char *name;
+  void (*run)();
+};
+
+static const TestCase tests[] = {
+  { "transliterateCodepoint", testTransliterateCodepoint },
+  { "normalizeWeatherDescription", testNormalizeWeatherDescription },
+  { "configFieldTable", testConfigFieldTable },
+  { "configSetFromString", testConfigSetFromString },
+  { "configStoreFromString", testConfigStoreFromString },
+  { "configDiff", testConfigDiff },
+  { "configJsonRoundTrip", testConfigJsonRoundTrip },
+  { "configFromLegacyJson", testConfigFromLegacyJson },
+  { "configIntInRange", testConfigIntInRange },
+  { "snapshotRoundTrip", testSnapshotRoundTrip },
+  { "journalReplay", testJournalReplay },
+  { "journalTornTail", testJournalTornTail },
+  { "journalCorruptRecord", testJournalCorruptRecord },
+  { "journalCompaction", testJournalCompaction },
+  { "loadConfig", testLoadConfig },
+  { "rateBucket", testRateBucket },
+  { "rateBucketEviction", testRateBucketEviction },
+  { "renderMetrics", testRenderMetrics },
+  { "metricsFamilyOverflow", testMetricsFamilyOverflow },
+  { "loopPassBudget", testLoopPassBudget },
+  { "metricsScrape", testMetricsScrape },
+  { "settingsHandler", testSettingsHandler },
+  { "requestFlood", testRequestFlood },
+  { "weatherConnectRefused", testWeatherConnectRefused },
+};
+
+int main(int argc, char **argv) {
+  hostSerialEcho = argc > 1 && strcmp(argv[1], "-v") == 0;
+  if (!LittleFS.begin()) {
+    printf("cannot create the LittleFS directory\n");
+    return 1;
+  }
+
+  for (const TestCase &t : tests) {
+    int failuresBefore = failures;
+    t.run();
+    printf("%s %s\n", failures == failuresBefore ? "ok  " : "FAIL", t.name);
+  }
+  printf("%d checks, %d failed\n", checks, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Turns a sketch into a C++ translation unit the way the Arduino builder does.
+
+    python3 ino2cpp.py ../../ESPTimeCast_ESP8266/ESPTimeCast_ESP8266.ino > sketch.cpp
+
+A prototype for every top-level function goes in right before the first
+function definition, so the sketch can call functions defined further down.
+#line directives keep compiler messages pointing into the .ino.
+"""
+
+import os
+import re
+import sys
+
+# One-line function header at file scope: "type name(params) {"
+FUNCTION = re.compile(
+    r"^((?:static\s+|inline\s+)?(?:const\s+)?(?:unsigned\s+|signed\s+)?"
+    r"[A-Za-z_][\w:<>]*(?:\s*[*&]+)?\s+[*&]*)([A-Za-z_]\w*)\s*\(([^;{}]*)\)\s*\{\s*$"
+)
+KEYWORDS = ("if", "for", "while", "switch", "return", "else")
+
+
+def strip_code(line):
+    """The line without string/char literals and // comments, for brace counting."""
+    line = re.sub(r'"(\\.|[^"\\])*"', '""', line)
+    line = re.sub(r"'(\\.|[^'\\])'", "''", line)
+    return line.split("//")[0]
+
+
+def main():
+    path = sys.argv[1]
+    with open(path, encoding="utf-8") as f:
+        lines = f.read().replace("\r\n", "\n").split("\n")
+
+    prototypes = []
+    first = None
+    depth = 0
+    in_raw_string = False
+    for i, line in enumerate(lines):
+        if in_raw_string:
+            in_raw_string = ')rawliteral"' not in line
+            continue
+        if depth == 0:
+            m = FUNCTION.match(line)
+            if m and m.group(2) not in KEYWORDS and not m.group(1).strip().startswith(KEYWORDS):
+                if first is None:
+                    first = i
+                params = re.sub(r"\s*=\s*[^,)]+", "", m.group(3))  # defaults stay on the definition
+                prototypes.append(m.group(1) + m.group(2) + "(" + params + ");")
+        if 'R"rawliteral(' in line and ')rawliteral"' not in line:
+            in_raw_string = True
+            continue
+        code = strip_code(line)
+        depth += code.count("{") - code.count("}")
+
+    name = os.path.abspath(path)
+    out = ['#line 1 "%s"' % name]
+    out += lines[:first]
+    out += prototypes
+    out.append('#line %d "%s"' % (first + 1, name))
+    out += lines[first:]
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,346 @@
+// Host shim of the ESP8266 Arduino core: just enough of String, Print, Serial
+// and the timing calls for the sketch to build and run on Linux. Time is
+// virtual (see host.h); only delay() moves it forward.
+#pragma once
+
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <strings.h>
+#include <sys/time.h>
+#include <time.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper *>(p))
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define HEX 16
+#define DEC 10
+
+class __FlashStringHelper;
+
+inline size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+inline char *strncpy_P(char *dst, const char *src, size_t n) { return strncpy(dst, src, n); }
+inline size_t strlen_P(const char *s) { return strlen(s); }
+inline int strcmp_P(const char *a, const char *b) { return strcmp(a, b); }
+inline void *memcpy_P(void *dst, const void *src, size_t n) { return memcpy(dst, src, n); }
+inline int strncmp_P(const char *a, const char *b, size_t n) { return strncmp(a, b, n); }
+inline uint8_t pgm_read_byte(const void *p) { return *(const uint8_t *)p; }
+inline uint8_t pgm_read_byte_near(const void *p) { return *(const uint8_t *)p; }
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_float(p) (*(const float *)(p))
+#define pgm_read_ptr(p) (*(void *const *)(p))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+// The sketch reads the wall clock through time(); route it to the virtual
+// clock. Every system header that declares time() is already included above.
+time_t hostTime(time_t *t);
+#define time(t) hostTime(t)
+void configTime(int timezone, int daylightOffsetSec, const char *server1, const char *server2 = nullptr,
+                const char *server3 = nullptr);
+
+template<class T, class L, class H>
+T constrain(T x, L lo, H hi) {
+  return x < lo ? lo : (x > hi ? hi : x);
+}
+using std::max;
+using std::min;
+inline bool isDigit(char c) { return isdigit((unsigned char)c); }
+
+class String {
+ public:
+  String() {}
+  String(const char *s) : s_(s ? s : "") {}
+  String(const __FlashStringHelper *s) : s_(reinterpret_cast<const char *>(s)) {}
+  String(const std::string &s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  String(int v, unsigned char base = 10) { fromInteger(v, base); }
+  String(unsigned v, unsigned char base = 10) { fromInteger(v, base); }
+  String(long v, unsigned char base = 10) { fromInteger(v, base); }
+  String(unsigned long v, unsigned char base = 10) { fromInteger(v, base); }
+  String(long long v, unsigned char base = 10) { fromInteger(v, base); }
+  String(unsigned long long v, unsigned char base = 10) { fromInteger(v, base); }
+  String(float v, unsigned char decimals = 2) { fromDouble(v, decimals); }
+  String(double v, unsigned char decimals = 2) { fromDouble(v, decimals); }
+
+  unsigned length() const { return s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  const char *c_str() const { return s_.c_str(); }
+  bool reserve(unsigned n) {
+    s_.reserve(n);
+    return true;
+  }
+
+  char operator[](unsigned i) const { return i < s_.size() ? s_[i] : '\0'; }
+  char &operator[](unsigned i) { return s_[i]; }
+  char charAt(unsigned i) const { return (*this)[i]; }
+  void setCharAt(unsigned i, char c) {
+    if (i < s_.size()) s_[i] = c;
+  }
+
+  String &operator+=(const String &o) { s_ += o.s_; return *this; }
+  String &operator+=(const char *o) { s_ += o ? o : ""; return *this; }
+  String &operator+=(const __FlashStringHelper *o) { return *this += reinterpret_cast<const char *>(o); }
+  String &operator+=(char c) { s_ += c; return *this; }
+  String &operator+=(int v) { return *this += String(v); }
+  String &operator+=(unsigned v) { return *this += String(v); }
+  String &operator+=(long v) { return *this += String(v); }
+  String &operator+=(unsigned long v) { return *this += String(v); }
+  bool concat(const String &o) { s_ += o.s_; return true; }
+  bool concat(const char *o) { s_ += o ? o : ""; return true; }
+  bool concat(const char *o, unsigned n) { s_.append(o, n); return true; }
+  bool concat(char c) { s_ += c; return true; }
+
+  bool equals(const String &o) const { return s_ == o.s_; }
+  bool equalsIgnoreCase(const String &o) const {
+    return s_.size() == o.s_.size() && strcasecmp(s_.c_str(), o.s_.c_str()) == 0;
+  }
+  bool operator==(const String &o) const { return s_ == o.s_; }
+  bool operator==(const char *o) const { return s_ == (o ? o : ""); }
+  bool operator!=(const String &o) const { return s_ != o.s_; }
+  bool operator!=(const char *o) const { return !(*this == o); }
+  bool operator<(const String &o) const { return s_ < o.s_; }
+  int compareTo(const String &o) const { return s_.compare(o.s_); }
+  bool startsWith(const String &p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool endsWith(const String &p) const {
+    return p.s_.size() <= s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+
+  int indexOf(char c, unsigned from = 0) const { return found(s_.find(c, from)); }
+  int indexOf(const String &p, unsigned from = 0) const { return found(s_.find(p.s_, from)); }
+  int lastIndexOf(char c) const { return found(s_.rfind(c)); }
+  int lastIndexOf(const String &p) const { return found(s_.rfind(p.s_)); }
+  String substring(unsigned from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned from, unsigned to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from, to - from));
+  }
+
+  void remove(unsigned index) {
+    if (index < s_.size()) s_.erase(index);
+  }
+  void remove(unsigned index, unsigned count) {
+    if (index < s_.size()) s_.erase(index, count);
+  }
+  void replace(char from, char to) { std::replace(s_.begin(), s_.end(), from, to); }
+  void replace(const String &from, const String &to) {
+    if (from.s_.empty()) return;
+    for (size_t pos = 0; (pos = s_.find(from.s_, pos)) != std::string::npos; pos += to.s_.size()) {
+      s_.replace(pos, from.s_.size(), to.s_);
+    }
+  }
+  void toLowerCase() {
+    for (char &c : s_) c = tolower((unsigned char)c);
+  }
+  void toUpperCase() {
+    for (char &c : s_) c = toupper((unsigned char)c);
+  }
+  void trim() {
+    size_t a = s_.find_first_not_of(" \t\r\n\f\v");
+    if (a == std::string::npos) {
+      s_.clear();
+      return;
+    }
+    s_ = s_.substr(a, s_.find_last_not_of(" \t\r\n\f\v") - a + 1);
+  }
+
+  long toInt() const { return atol(s_.c_str()); }
+  float toFloat() const { return atof(s_.c_str()); }
+  void toCharArray(char *buf, unsigned size) const { strlcpy(buf, s_.c_str(), size); }
+  void getBytes(unsigned char *buf, unsigned size) const { strlcpy((char *)buf, s_.c_str(), size); }
+
+  friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+
+ private:
+  std::string s_;
+
+  static int found(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+  template<class T>
+  void fromInteger(T v, unsigned char base) {
+    if (base == 10) {
+      s_ = std::to_string(v);
+      return;
+    }
+    char buf[72];
+    char *p = buf + sizeof(buf) - 1;
+    *p = '\0';
+    unsigned long long u = v;
+    do {
+      *--p = "0123456789abcdef"[u % base];
+      u /= base;
+    } while (u);
+    s_ = p;
+  }
+  void fromDouble(double v, unsigned char decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+    s_ = buf;
+  }
+};
+
+// The core's type for concatenations; libraries name it in overloads
+class StringSumHelper : public String {
+ public:
+  using String::String;
+  StringSumHelper(const String &s) : String(s) {}
+};
+
+inline String operator+(const String &a, const char *b) { return a + String(b); }
+inline String operator+(const char *a, const String &b) { return String(a) + b; }
+inline String operator+(const __FlashStringHelper *a, const String &b) { return String(a) + b; }
+inline String operator+(const String &a, char b) { return a + String(b); }
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buf, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buf++);
+    return n;
+  }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t write(const char *buf, size_t size) { return write((const uint8_t *)buf, size); }
+  virtual void flush() {}
+
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const __FlashStringHelper *s) { return print(reinterpret_cast<const char *>(s)); }
+  size_t print(const String &s) { return write(s.c_str(), s.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned v, int base = DEC) { return print(String(v, base)); }
+  size_t print(long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(long long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned long long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+  size_t print(float v, int decimals = 2) { return print(String(v, decimals)); }
+  size_t print(uint8_t v, int base = DEC) { return print((unsigned)v, base); }
+  template<class T, class = typename std::enable_if<std::is_class<T>::value>::type>
+  size_t print(const T &v) { return print(v.toString()); }  // IPAddress
+
+  size_t println() { return write("\r\n"); }
+  template<class T>
+  size_t println(const T &v) { return print(v) + println(); }
+  template<class T>
+  size_t println(const T &v, int format) { return print(v, format) + println(); }
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() { return -1; }
+  void setTimeout(unsigned long ms) { timeoutMs_ = ms; }
+  size_t readBytes(char *buf, size_t size) {
+    size_t n = 0;
+    for (int c; n < size && (c = read()) >= 0;) buf[n++] = (char)c;
+    return n;
+  }
+  size_t readBytes(uint8_t *buf, size_t size) { return readBytes((char *)buf, size); }
+  String readString() {
+    String s;
+    for (int c; (c = read()) >= 0;) s += (char)c;
+    return s;
+  }
+  String readStringUntil(char end) {
+    String s;
+    for (int c; (c = read()) >= 0 && c != end;) s += (char)c;
+    return s;
+  }
+  long parseInt() {
+    int c = peek();
+    while (c >= 0 && c != '-' && !isdigit(c)) {
+      read();
+      c = peek();
+    }
+    bool negative = c == '-';
+    if (negative) read();
+    long v = 0;
+    while ((c = peek()) >= 0 && isdigit(c)) {
+      v = v * 10 + (c - '0');
+      read();
+    }
+    return negative ? -v : v;
+  }
+
+ protected:
+  unsigned long timeoutMs_ = 1000;
+};
+
+// Serial output is dropped unless host tests turn it on (hostSerialEcho)
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+class IPAddress {
+ public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr_(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  IPAddress(uint32_t addr) : addr_(addr) {}
+  operator uint32_t() const { return addr_; }
+  uint8_t operator[](int i) const { return addr_ >> (8 * i); }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(buf);
+  }
+
+ private:
+  uint32_t addr_ = 0;
+};
+
+class EspClass {
+ public:
+  void restart();
+  uint32_t getFreeHeap() { return 40000; }
+  uint32_t getMaxFreeBlockSize() { return 30000; }
+  uint8_t getHeapFragmentation() { return 10; }
+  uint32_t getChipId() { return 0x00c0ffee; }
+};
+extern EspClass ESP;
@@ -0,0 +1,47 @@
+// Host shim of the JSON handler that comes with ESPAsyncWebServer: buffers
+// the body (up to the max content length), parses it with ArduinoJson, then
+// calls back with the document
+#pragma once
+
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+typedef std::function<void(AsyncWebServerRequest *, JsonVariant &)> ArJsonRequestHandlerFunction;
+
+class AsyncCallbackJsonWebHandler : public AsyncWebHandler {
+ public:
+  AsyncCallbackJsonWebHandler(const String &uri, ArJsonRequestHandlerFunction onRequest = nullptr, size_t maxJsonBufferSize = 1024)
+    : uri_(uri), onRequest_(onRequest), maxJsonBufferSize_(maxJsonBufferSize) {}
+  void setMethod(WebRequestMethodComposite method) { method_ = method; }
+  void setMaxContentLength(int maxContentLength) { maxContentLength_ = maxContentLength; }
+  void onRequest(ArJsonRequestHandlerFunction fn) { onRequest_ = fn; }
+
+  bool canHandle(AsyncWebServerRequest *request) const override {
+    return onRequest_ && (request->method() & method_) && request->url() == uri_
+           && request->contentType() == "application/json";
+  }
+  void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) override {
+    if (total > maxContentLength_) return;
+    if (index == 0) request->_tempObject = calloc(total + 1, 1);
+    if (request->_tempObject) memcpy((uint8_t *)request->_tempObject + index, data, len);
+  }
+  void handleRequest(AsyncWebServerRequest *request) override {
+    if (request->_tempObject) {
+      DynamicJsonDocument doc(maxJsonBufferSize_);
+      if (!deserializeJson(doc, (const char *)request->_tempObject)) {
+        JsonVariant json = doc.as<JsonVariant>();
+        onRequest_(request, json);
+        return;
+      }
+    }
+    request->send(request->contentLength() > maxContentLength_ ? 413 : 400);
+  }
+  bool isRequestHandlerTrivial() const override { return false; }
+
+ private:
+  String uri_;
+  ArJsonRequestHandlerFunction onRequest_;
+  size_t maxJsonBufferSize_;
+  WebRequestMethodComposite method_ = HTTP_POST | HTTP_PUT | HTTP_PATCH;
+  size_t maxContentLength_ = 16384;
+};
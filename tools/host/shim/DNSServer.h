@@ -0,0 +1,9 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+class DNSServer {
+ public:
+  bool start(uint16_t, const char *, IPAddress) { return true; }
+  void processNextRequest() {}
+};
@@ -0,0 +1,63 @@
+// Host shim of ESP8266HTTPClient. GET() runs the whole exchange over the
+// client it was given: connect (with its connect and handshake costs, see
+// host.h) unless the client is still connected, send, and read the
+// response to the end.
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+#define HTTP_CODE_OK 200
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+
+class HTTPClient {
+ public:
+  bool begin(WiFiClient &client, const String &url) {
+    client_ = &client;
+    url_ = url.c_str();
+    return true;
+  }
+  void setTimeout(uint16_t) {}
+  void setReuse(bool) {}
+  void useHTTP10(bool = true) {}
+
+  int GET() {
+    body_.clear();
+    // scheme://host[:port]/path
+    size_t hostStart = url_.find("://");
+    if (!client_ || hostStart == std::string::npos) return HTTPC_ERROR_CONNECTION_REFUSED;
+    hostStart += 3;
+    size_t pathStart = url_.find('/', hostStart);
+    if (pathStart == std::string::npos) pathStart = url_.size();
+    std::string host = url_.substr(hostStart, pathStart - hostStart);
+    uint16_t port = url_.compare(0, 8, "https://") == 0 ? 443 : 80;
+    size_t colon = host.find(':');
+    if (colon != std::string::npos) {
+      port = atoi(host.c_str() + colon + 1);
+      host.resize(colon);
+    }
+    std::string path = pathStart < url_.size() ? url_.substr(pathStart) : "/";
+
+    if (!client_->connected() && !client_->connect(host.c_str(), port)) return HTTPC_ERROR_CONNECTION_REFUSED;
+    std::string request = "GET " + path + " HTTP/1.0\r\nHost: " + host + "\r\n\r\n";
+    client_->write((const uint8_t *)request.data(), request.size());
+    std::string response;
+    while (client_->available() > 0) response += (char)client_->read();
+
+    size_t bodyStart = response.find("\r\n\r\n");
+    size_t space = response.find(' ');
+    if (bodyStart == std::string::npos || space == std::string::npos || space > bodyStart) return HTTPC_ERROR_CONNECTION_LOST;
+    body_ = response.substr(bodyStart + 4);
+    return atoi(response.c_str() + space + 1);
+  }
+  int getSize() { return body_.size(); }
+  String getString() { return String(body_.c_str()); }
+  WiFiClient &getStream() { return *client_; }
+  void end() {}
+  static String errorToString(int error) { return String("error ") + String(error); }
+
+ private:
+  WiFiClient *client_ = nullptr;
+  std::string url_;
+  std::string body_;
+};
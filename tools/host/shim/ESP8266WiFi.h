@@ -0,0 +1,146 @@
+// Host shim of the ESP8266 WiFi stack. The station is "connected" from
+// WiFi.begin() on; TCP clients talk to the responder installed with
+// hostSetHttpResponder() (see host.h) instead of a network.
+#pragma once
+
+#include <Arduino.h>
+
+enum wl_status_t { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_CONNECT_FAILED = 4, WL_DISCONNECTED = 6 };
+enum WiFiMode_t { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 };
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+#define ENC_TYPE_NONE 7
+
+// Whole response for one request, or an empty string when the host is
+// unreachable. The connection closes once the response has been read.
+// hostHttpReachable() blocks for the connect cost, as WiFiClient::connect()
+// does; hostHttpListening() only answers.
+bool hostHttpReachable(const char *host, uint16_t port);
+bool hostHttpListening(const char *host, uint16_t port);
+std::string hostHttpRespond(const char *host, uint16_t port, const std::string &request);
+
+class Client : public Stream {
+ public:
+  virtual int connect(const char *host, uint16_t port) = 0;
+  virtual uint8_t connected() = 0;
+  virtual void stop() = 0;
+  virtual int read(uint8_t *buf, size_t size) = 0;
+  using Stream::read;
+};
+
+class WiFiClient : public Client {
+ public:
+  int connect(const char *host, uint16_t port) override {
+    stop();
+    if (!hostHttpReachable(host, port)) return 0;
+    host_ = host;
+    port_ = port;
+    open_ = true;
+    return 1;
+  }
+  uint8_t connected() override {
+    answer();
+    return open_ && (!answered_ || readPos_ < response_.size());
+  }
+  void stop() override {
+    open_ = answered_ = false;
+    request_.clear();
+    response_.clear();
+    readPos_ = 0;
+  }
+  void setNoDelay(bool) {}
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buf, size_t size) override {
+    if (!open_) return 0;
+    request_.append((const char *)buf, size);
+    return size;
+  }
+  using Print::write;
+
+  int available() override {
+    answer();
+    return response_.size() - readPos_;
+  }
+  int read() override { return available() > 0 ? (uint8_t)response_[readPos_++] : -1; }
+  int read(uint8_t *buf, size_t size) override {
+    size_t n = std::min(size, (size_t)available());
+    memcpy(buf, response_.data() + readPos_, n);
+    readPos_ += n;
+    return n;
+  }
+  int peek() override { return available() > 0 ? (uint8_t)response_[readPos_] : -1; }
+
+ private:
+  std::string host_;
+  uint16_t port_ = 0;
+  bool open_ = false;
+  bool answered_ = false;
+  std::string request_;
+  std::string response_;
+  size_t readPos_ = 0;
+
+  // The server answers once the request headers are complete
+  void answer() {
+    if (!open_ || answered_ || request_.find("\r\n\r\n") == std::string::npos) return;
+    response_ = hostHttpRespond(host_.c_str(), port_, request_);
+    answered_ = true;
+  }
+};
+
+struct WiFiEventHandlerOpaque;
+typedef std::shared_ptr<WiFiEventHandlerOpaque> WiFiEventHandler;
+struct WiFiEventStationModeConnected {};
+struct WiFiEventStationModeDisconnected {
+  int reason;
+};
+struct WiFiEventStationModeGotIP {
+  IPAddress ip;
+};
+
+class ESP8266WiFiClass {
+ public:
+  wl_status_t status() { return status_; }
+  bool isConnected() { return status_ == WL_CONNECTED; }
+  WiFiMode_t getMode() { return mode_; }
+  bool mode(WiFiMode_t m) {
+    mode_ = m;
+    return true;
+  }
+  void persistent(bool) {}
+  void setAutoReconnect(bool) {}
+  bool hostname(const String &) { return true; }
+  void begin(const char *, const char *) { status_ = WL_CONNECTED; }
+  bool disconnect(bool = false) {
+    status_ = WL_DISCONNECTED;
+    return true;
+  }
+  IPAddress localIP() { return status_ == WL_CONNECTED ? IPAddress(192, 168, 1, 50) : IPAddress(); }
+  String SSID() { return String("host"); }
+  int32_t RSSI() { return -55; }
+
+  bool softAP(const char *, const char * = nullptr) { return true; }
+  bool softAPConfig(IPAddress ip, IPAddress, IPAddress) {
+    apIP_ = ip;
+    return true;
+  }
+  IPAddress softAPIP() { return apIP_; }
+
+  int8_t scanNetworks(bool = false) { return 0; }
+  int8_t scanComplete() { return WIFI_SCAN_FAILED; }
+  void scanDelete() {}
+  String SSID(uint8_t) { return String(); }
+  int32_t RSSI(uint8_t) { return 0; }
+  uint8_t encryptionType(uint8_t) { return ENC_TYPE_NONE; }
+  int32_t channel(uint8_t) { return 0; }
+
+  WiFiEventHandler onStationModeConnected(std::function<void(const WiFiEventStationModeConnected &)>) { return nullptr; }
+  WiFiEventHandler onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected &)>) { return nullptr; }
+  WiFiEventHandler onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP &)>) { return nullptr; }
+
+ private:
+  wl_status_t status_ = WL_IDLE_STATUS;
+  WiFiMode_t mode_ = WIFI_OFF;
+  IPAddress apIP_;
+};
+extern ESP8266WiFiClass WiFi;
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+class MDNSResponder {
+ public:
+  bool begin(const char *) { return true; }
+  void end() {}
+  void addService(const char *, const char *, uint16_t) {}
+  void update() {}
+};
+extern MDNSResponder MDNS;
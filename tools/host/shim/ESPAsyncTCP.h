@@ -0,0 +1,157 @@
+// Host shim of ESPAsyncTCP. Like the real library, connect() only starts
+// the connection and everything after it happens between loop passes:
+// hostPumpAsyncClients(), which delay() and yield() call, completes the
+// connect once hostConnectCostMs of virtual time has passed, asks the
+// responder (see host.h) once the request headers are complete, hands the
+// response over one TCP segment per pump and then closes, firing the
+// callbacks as it goes.
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+#include <algorithm>
+#include <vector>
+
+class AsyncClient;
+typedef std::function<void(void *, AsyncClient *)> AcConnectHandler;
+typedef std::function<void(void *, AsyncClient *, void *data, size_t len)> AcDataHandler;
+typedef std::function<void(void *, AsyncClient *, int8_t error)> AcErrorHandler;
+
+unsigned long long hostNowUs();
+extern unsigned long hostConnectCostMs;
+
+// Every live client, for the pump
+inline std::vector<AsyncClient *> &hostAsyncClients() {
+  static std::vector<AsyncClient *> clients;
+  return clients;
+}
+
+class AsyncClient {
+ public:
+  static const size_t SEGMENT_SIZE = 1460;  // one TCP segment per pump
+  static const int8_t ERR_DNS_FAILED = -55;  // what the library reports when the lookup fails
+
+  explicit AsyncClient(IPAddress remote = IPAddress()) : remote_(remote) { hostAsyncClients().push_back(this); }
+  ~AsyncClient() {
+    std::vector<AsyncClient *> &clients = hostAsyncClients();
+    clients.erase(std::remove(clients.begin(), clients.end(), this), clients.end());
+  }
+  AsyncClient(const AsyncClient &) = delete;
+  AsyncClient &operator=(const AsyncClient &) = delete;
+
+  IPAddress remoteIP() { return remote_; }
+
+  // Starts the lookup and the TCP handshake; false if a connection is
+  // already open
+  bool connect(const char *host, uint16_t port) {
+    if (state_ != CLOSED) return false;
+    host_ = host;
+    port_ = port;
+    request_.clear();
+    response_.clear();
+    readPos_ = 0;
+    answered_ = false;
+    connectAtUs_ = hostNowUs() + hostConnectCostMs * 1000ULL;
+    state_ = CONNECTING;
+    return true;
+  }
+  bool connecting() { return state_ == CONNECTING; }
+  bool connected() { return state_ == CONNECTED; }
+  bool disconnected() { return state_ == CLOSED; }
+
+  size_t space() { return connected() ? 2 * SEGMENT_SIZE : 0; }
+  size_t write(const char *data) { return write(data, strlen(data)); }
+  size_t write(const char *data, size_t size) {
+    if (!connected() || size > space()) return 0;
+    request_.append(data, size);
+    return size;
+  }
+
+  // Closing fires onDisconnect(), as the library does
+  void close(bool = false) {
+    if (state_ == CLOSED) return;
+    state_ = CLOSED;
+    if (onDisconnect_) onDisconnect_(onDisconnectArg_, this);
+  }
+  void stop() { close(false); }
+
+  void onConnect(AcConnectHandler cb, void *arg = nullptr) {
+    onConnect_ = cb;
+    onConnectArg_ = arg;
+  }
+  void onDisconnect(AcConnectHandler cb, void *arg = nullptr) {
+    onDisconnect_ = cb;
+    onDisconnectArg_ = arg;
+  }
+  void onData(AcDataHandler cb, void *arg = nullptr) {
+    onData_ = cb;
+    onDataArg_ = arg;
+  }
+  void onError(AcErrorHandler cb, void *arg = nullptr) {
+    onError_ = cb;
+    onErrorArg_ = arg;
+  }
+
+  // One step of the TCP stack for this connection
+  void hostPump() {
+    if (state_ == CONNECTING) {
+      if (hostNowUs() < connectAtUs_) return;
+      if (!hostHttpListening(host_.c_str(), port_)) {
+        if (onError_) onError_(onErrorArg_, this, ERR_DNS_FAILED);
+        close(true);
+        return;
+      }
+      state_ = CONNECTED;
+      if (onConnect_) onConnect_(onConnectArg_, this);
+      return;
+    }
+    if (state_ != CONNECTED) return;
+    if (!answered_) {
+      // The server answers once the request headers are complete
+      if (request_.find("\r\n\r\n") == std::string::npos) return;
+      response_ = hostHttpRespond(host_.c_str(), port_, request_);
+      answered_ = true;
+    }
+    if (readPos_ < response_.size()) {
+      size_t n = std::min(SEGMENT_SIZE, response_.size() - readPos_);
+      std::string segment = response_.substr(readPos_, n);
+      readPos_ += n;
+      if (onData_) onData_(onDataArg_, this, &segment[0], n);
+      return;
+    }
+    close(true);  // HTTP/1.0: the server closes once it has sent everything
+  }
+
+ private:
+  enum State { CLOSED, CONNECTING, CONNECTED };
+  IPAddress remote_;
+  State state_ = CLOSED;
+  std::string host_;
+  uint16_t port_ = 0;
+  unsigned long long connectAtUs_ = 0;
+  std::string request_;
+  std::string response_;
+  size_t readPos_ = 0;
+  bool answered_ = false;
+  AcConnectHandler onConnect_, onDisconnect_;
+  AcDataHandler onData_;
+  AcErrorHandler onError_;
+  void *onConnectArg_ = nullptr;
+  void *onDisconnectArg_ = nullptr;
+  void *onDataArg_ = nullptr;
+  void *onErrorArg_ = nullptr;
+};
+
+// Runs the TCP stack: one step for every client. Not reentrant: a callback
+// that calls delay() does not pump again.
+inline void hostPumpAsyncClients() {
+  static bool pumping = false;
+  if (pumping) return;
+  pumping = true;
+  std::vector<AsyncClient *> clients = hostAsyncClients();  // callbacks may add or remove clients
+  for (AsyncClient *c : clients) {
+    std::vector<AsyncClient *> &live = hostAsyncClients();
+    if (std::find(live.begin(), live.end(), c) != live.end()) c->hostPump();
+  }
+  pumping = false;
+}
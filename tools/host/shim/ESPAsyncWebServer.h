@@ -0,0 +1,327 @@
+// Host shim of ESPAsyncWebServer. Nothing listens: hostDispatch() hands a
+// request the driver built to the registered handlers the way the server
+// does once the headers are in (filter() and canHandle() pick the handler,
+// a form body becomes POST parameters, any other body goes to handleBody()
+// in one piece, then handleRequest() runs). onNotFound() takes the rest.
+// Responses keep their status and body on the request for the driver.
+#pragma once
+
+#include <ESPAsyncTCP.h>
+#include <FS.h>
+
+#include <map>
+
+enum WebRequestMethod {
+  HTTP_GET = 1,
+  HTTP_POST = 2,
+  HTTP_DELETE = 4,
+  HTTP_PUT = 8,
+  HTTP_PATCH = 16,
+  HTTP_HEAD = 32,
+  HTTP_OPTIONS = 64,
+  HTTP_ANY = 127
+};
+typedef int WebRequestMethodComposite;
+
+class AsyncWebParameter {
+ public:
+  AsyncWebParameter(const String &name, const String &value, bool post) : name_(name), value_(value), post_(post) {}
+  const String &name() const { return name_; }
+  const String &value() const { return value_; }
+  bool isPost() const { return post_; }
+  bool isFile() const { return false; }
+
+ private:
+  String name_;
+  String value_;
+  bool post_;
+};
+
+typedef std::function<size_t(uint8_t *, size_t, size_t)> AwsResponseFiller;
+typedef std::function<void(void)> ArDisconnectHandler;
+
+class AsyncWebServerResponse {
+ public:
+  explicit AsyncWebServerResponse(int code = 200, const std::string &body = std::string()) : code_(code), body_(body) {}
+  virtual ~AsyncWebServerResponse() {}
+  void addHeader(const String &, const String &) {}
+  void setCode(int code) { code_ = code; }
+  void setContentLength(size_t) {}
+  int code() const { return code_; }
+  // The whole body, as the client would receive it
+  virtual std::string body() { return body_; }
+
+ protected:
+  int code_;
+  std::string body_;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+ public:
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buf, size_t size) override {
+    body_.append((const char *)buf, size);
+    return size;
+  }
+  using Print::write;
+};
+
+// Chunked and callback responses: the filler runs until it has no more
+class AsyncFillerResponse : public AsyncWebServerResponse {
+ public:
+  explicit AsyncFillerResponse(AwsResponseFiller filler) : filler_(filler) {}
+  std::string body() override {
+    std::string out;
+    uint8_t buf[1024];
+    while (size_t n = filler_(buf, sizeof(buf), out.size())) out.append((const char *)buf, n);
+    return out;
+  }
+
+ private:
+  AwsResponseFiller filler_;
+};
+
+class AsyncWebServerRequest {
+ public:
+  void *_tempObject = nullptr;
+  int sentCode = 0;      // status of the last response sent, 0 if none
+  std::string sentBody;  // and its body
+
+  explicit AsyncWebServerRequest(IPAddress remote = IPAddress(), WebRequestMethodComposite method = HTTP_GET,
+                                 const String &url = String("/"), const std::string &body = std::string(),
+                                 const String &contentType = String())
+    : client_(remote), method_(method), body_(body), contentType_(contentType) {
+    std::string u = url.c_str();
+    size_t query = u.find('?');
+    url_ = u.substr(0, query).c_str();
+    if (query != std::string::npos) addParams(u.substr(query + 1), false);
+    if (contentType_ == "application/x-www-form-urlencoded") addParams(body_, true);
+  }
+  ~AsyncWebServerRequest() { free(_tempObject); }
+
+  // The connection closed: runs the onDisconnect() handlers, once
+  void hostDisconnect() {
+    std::vector<ArDisconnectHandler> handlers;
+    handlers.swap(disconnectHandlers_);
+    for (ArDisconnectHandler &h : handlers) h();
+  }
+  const std::string &hostBody() const { return body_; }
+  bool hostFormBody() const { return contentType_ == "application/x-www-form-urlencoded"; }
+
+  AsyncClient *client() { return &client_; }
+  const String &url() const { return url_; }
+  WebRequestMethodComposite method() const { return method_; }
+  const String &contentType() const { return contentType_; }
+  size_t contentLength() const { return body_.size(); }
+  bool hasHeader(const char *name) const { return headers_.count(name) > 0; }
+  String header(const char *name) const {
+    auto h = headers_.find(name);
+    return h == headers_.end() ? String() : String(h->second.c_str());
+  }
+  void hostSetHeader(const char *name, const char *value) { headers_[name] = value; }
+
+  bool hasParam(const String &name, bool post = false, bool = false) const { return getParam(name, post) != nullptr; }
+  const AsyncWebParameter *getParam(const String &name, bool post = false, bool = false) const {
+    for (const AsyncWebParameter &p : params_) {
+      if (p.name() == name && p.isPost() == post) return &p;
+    }
+    return nullptr;
+  }
+  const AsyncWebParameter *getParam(size_t i) const { return i < params_.size() ? &params_[i] : nullptr; }
+  size_t params() const { return params_.size(); }
+  void onDisconnect(ArDisconnectHandler handler) { disconnectHandlers_.push_back(handler); }
+
+  void send(int code, const String & = String(), const String &content = String()) {
+    sentCode = code;
+    sentBody = content.c_str();
+  }
+  void send(AsyncWebServerResponse *response) {
+    sentCode = response->code();
+    sentBody = response->body();
+    delete response;
+  }
+  void send(FS &, const String &, const String & = String(), bool = false) { sentCode = 200; }
+  void send_P(int code, const String &, const uint8_t *content, size_t len) {
+    sentCode = code;
+    sentBody.assign((const char *)content, len);
+  }
+  void send_P(int code, const String &, const char *content) {
+    sentCode = code;
+    sentBody = content;
+  }
+  void redirect(const String &) { sentCode = 302; }
+  AsyncWebServerResponse *beginResponse(int code, const String & = String(), const String &content = String()) {
+    return new AsyncWebServerResponse(code, content.c_str());
+  }
+  AsyncWebServerResponse *beginResponse(FS &, const String &, const String & = String(), bool = false) {
+    return new AsyncWebServerResponse();
+  }
+  AsyncWebServerResponse *beginResponse(const String &, size_t, AwsResponseFiller filler) { return new AsyncFillerResponse(filler); }
+  AsyncWebServerResponse *beginResponse_P(int code, const String &, const uint8_t *content, size_t len) {
+    return new AsyncWebServerResponse(code, std::string((const char *)content, len));
+  }
+  AsyncWebServerResponse *beginResponse_P(int code, const String &, const char *content) {
+    return new AsyncWebServerResponse(code, content);
+  }
+  AsyncWebServerResponse *beginChunkedResponse(const String &, AwsResponseFiller filler) { return new AsyncFillerResponse(filler); }
+  AsyncResponseStream *beginResponseStream(const String &, size_t = 1460) { return new AsyncResponseStream(); }
+
+ private:
+  AsyncClient client_;
+  WebRequestMethodComposite method_;
+  String url_;
+  std::string body_;
+  String contentType_;
+  std::map<std::string, std::string> headers_;
+  std::vector<AsyncWebParameter> params_;
+  std::vector<ArDisconnectHandler> disconnectHandlers_;
+
+  // "a=1&b=2", percent-decoded
+  void addParams(const std::string &query, bool post) {
+    size_t start = 0;
+    while (start < query.size()) {
+      size_t end = query.find('&', start);
+      if (end == std::string::npos) end = query.size();
+      std::string pair = query.substr(start, end - start);
+      size_t eq = pair.find('=');
+      std::string name = decode(pair.substr(0, eq));
+      std::string value = eq == std::string::npos ? std::string() : decode(pair.substr(eq + 1));
+      if (!name.empty()) params_.push_back(AsyncWebParameter(name.c_str(), value.c_str(), post));
+      start = end + 1;
+    }
+  }
+  static std::string decode(const std::string &s) {
+    std::string out;
+    for (size_t i = 0; i < s.size(); i++) {
+      if (s[i] == '+') {
+        out += ' ';
+      } else if (s[i] == '%' && i + 2 < s.size()) {
+        out += (char)strtol(s.substr(i + 1, 2).c_str(), nullptr, 16);
+        i += 2;
+      } else {
+        out += s[i];
+      }
+    }
+    return out;
+  }
+};
+
+typedef std::function<void(AsyncWebServerRequest *)> ArRequestHandlerFunction;
+typedef std::function<bool(AsyncWebServerRequest *)> ArRequestFilterFunction;
+typedef std::function<void(AsyncWebServerRequest *, const String &, size_t, uint8_t *, size_t, bool)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *, uint8_t *, size_t, size_t, size_t)> ArBodyHandlerFunction;
+
+class AsyncWebHandler {
+ public:
+  virtual ~AsyncWebHandler() {}
+  AsyncWebHandler &setFilter(ArRequestFilterFunction fn) {
+    filter_ = fn;
+    return *this;
+  }
+  bool filter(AsyncWebServerRequest *request) { return !filter_ || filter_(request); }
+  virtual bool canHandle(AsyncWebServerRequest *) const { return false; }
+  virtual void handleRequest(AsyncWebServerRequest *) {}
+  virtual void handleBody(AsyncWebServerRequest *, uint8_t *, size_t, size_t, size_t) {}
+  virtual bool isRequestHandlerTrivial() const { return true; }
+
+ private:
+  ArRequestFilterFunction filter_;
+};
+
+// server.on(): exact paths, or a prefix ending in '*'
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+ public:
+  AsyncCallbackWebHandler(const String &uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                          ArBodyHandlerFunction onBody)
+    : uri_(uri), method_(method), onRequest_(onRequest), onBody_(onBody) {}
+  bool canHandle(AsyncWebServerRequest *request) const override {
+    if (!(request->method() & method_)) return false;
+    std::string uri = uri_.c_str();
+    if (!uri.empty() && uri.back() == '*') return strncmp(request->url().c_str(), uri.c_str(), uri.size() - 1) == 0;
+    return request->url() == uri_;
+  }
+  void handleRequest(AsyncWebServerRequest *request) override {
+    if (onRequest_) onRequest_(request);
+    else request->send(500);
+  }
+  void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) override {
+    if (onBody_) onBody_(request, data, len, index, total);
+  }
+  bool isRequestHandlerTrivial() const override { return !onBody_; }
+
+ private:
+  String uri_;
+  WebRequestMethodComposite method_;
+  ArRequestHandlerFunction onRequest_;
+  ArBodyHandlerFunction onBody_;
+};
+
+class AsyncEventSourceClient {
+ public:
+  void send(const char *, const char * = nullptr, uint32_t = 0, uint32_t = 0) {}
+  uint32_t lastId() const { return 0; }
+  bool connected() const { return false; }
+  void close() {}
+  AsyncClient *client() { return &client_; }
+
+ private:
+  AsyncClient client_;
+};
+typedef std::function<void(AsyncEventSourceClient *)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler {
+ public:
+  explicit AsyncEventSource(const String &) {}
+  void onConnect(ArEventHandlerFunction) {}
+  void send(const char *, const char * = nullptr, uint32_t = 0, uint32_t = 0) {}
+  size_t count() const { return 0; }
+  size_t avgPacketsWaiting() const { return 0; }
+};
+
+class AsyncWebServer {
+ public:
+  explicit AsyncWebServer(uint16_t) {}
+  void begin() {}
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest) {
+    return on(uri, method, onRequest, nullptr, nullptr);
+  }
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                              ArUploadHandlerFunction onUpload) {
+    return on(uri, method, onRequest, onUpload, nullptr);
+  }
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                              ArUploadHandlerFunction, ArBodyHandlerFunction onBody) {
+    AsyncCallbackWebHandler *handler = new AsyncCallbackWebHandler(uri, method, onRequest, onBody);
+    handlers_.push_back(handler);
+    return *handler;
+  }
+  void onNotFound(ArRequestHandlerFunction fn) { notFound_ = fn; }
+  AsyncWebHandler &addHandler(AsyncWebHandler *handler) {
+    handlers_.push_back(handler);
+    return *handler;
+  }
+
+  void hostDispatch(AsyncWebServerRequest *request) {
+    AsyncWebHandler *handler = nullptr;
+    for (AsyncWebHandler *h : handlers_) {
+      if (h->filter(request) && h->canHandle(request)) {
+        handler = h;
+        break;
+      }
+    }
+    if (!handler) {
+      if (notFound_) notFound_(request);
+      else request->send(404);
+      return;
+    }
+    std::string body = request->hostBody();
+    if (!body.empty() && !request->hostFormBody() && !handler->isRequestHandlerTrivial()) {
+      handler->handleBody(request, (uint8_t *)&body[0], body.size(), 0, body.size());
+    }
+    handler->handleRequest(request);
+  }
+
+ private:
+  std::vector<AsyncWebHandler *> handlers_;
+  ArRequestHandlerFunction notFound_;
+};
@@ -0,0 +1,78 @@
+// Host shim of the Arduino FS API, backed by a directory on the host
+// (hostFsRoot(), see host.h). Paths are the sketch's absolute LittleFS paths.
+#pragma once
+
+#include <Arduino.h>
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+ public:
+  File() {}
+  File(FILE *fp, const char *name) : fp_(fp, fclose), name_(name) {}
+
+  explicit operator bool() const { return fp_ != nullptr; }
+  const char *name() const { return name_.c_str(); }
+  void close() { fp_.reset(); }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buf, size_t size) override { return fp_ ? fwrite(buf, 1, size, fp_.get()) : 0; }
+  using Print::write;
+  void flush() override {
+    if (fp_) fflush(fp_.get());
+  }
+
+  int available() override {
+    if (!fp_) return 0;
+    long remaining = (long)size() - (long)position();
+    return remaining > 0 ? (int)remaining : 0;
+  }
+  int read() override { return fp_ ? fgetc(fp_.get()) : -1; }
+  int peek() override {
+    if (!fp_) return -1;
+    int c = fgetc(fp_.get());
+    if (c >= 0) ungetc(c, fp_.get());
+    return c;
+  }
+  size_t read(uint8_t *buf, size_t size) { return fp_ ? fread(buf, 1, size, fp_.get()) : 0; }
+
+  bool seek(uint32_t pos, SeekMode mode = SeekSet) {
+    return fp_ && fseek(fp_.get(), pos, mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END) == 0;
+  }
+  size_t position() const { return fp_ ? (size_t)ftell(fp_.get()) : 0; }
+  size_t size() const;
+
+ private:
+  std::shared_ptr<FILE> fp_;
+  std::string name_;
+};
+
+struct FSInfo {
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+class FS {
+ public:
+  bool begin();
+  void end() {}
+  File open(const char *path, const char *mode = "r");
+  File open(const String &path, const char *mode = "r") { return open(path.c_str(), mode); }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to);
+  bool info(FSInfo &info);
+};
+
+namespace fs {
+typedef ::FS FS;
+typedef ::File File;
+}
+
+extern FS LittleFS;
@@ -0,0 +1,10 @@
+// Host shim of MD_MAX72XX: only the types the sketch and its font refer to
+#pragma once
+
+#include <Arduino.h>
+
+class MD_MAX72XX {
+ public:
+  enum moduleType_t { PAROLA_HW, GENERIC_HW, ICSTATION_HW, FC16_HW };
+  typedef const uint8_t fontType_t;
+};
@@ -0,0 +1,53 @@
+// Host shim of MD_Parola. Nothing is drawn: every print, scroll and clear is
+// passed to hostDisplayEvent() (see host.h), and animations take the virtual
+// time a real 4-module matrix would need for them.
+#pragma once
+
+#include <Arduino.h>
+#include <MD_MAX72xx.h>
+
+enum textPosition_t { PA_LEFT, PA_CENTER, PA_RIGHT };
+enum textEffect_t { PA_NO_EFFECT, PA_PRINT, PA_SCROLL_UP, PA_SCROLL_DOWN, PA_SCROLL_LEFT, PA_SCROLL_RIGHT };
+enum zoneEffect_t { PA_FLIP_UD, PA_FLIP_LR };
+
+void hostDisplayEvent(const char *kind, const char *text);
+
+class MD_Parola {
+ public:
+  MD_Parola(MD_MAX72XX::moduleType_t, uint8_t, uint8_t, uint8_t, uint8_t numDevices) : columns_(numDevices * 8) {}
+
+  void begin() {}
+  void setFont(MD_MAX72XX::fontType_t *) {}
+  void setIntensity(uint8_t intensity) { hostDisplayEvent("intensity", String(intensity).c_str()); }
+  void displayShutdown(bool off) { hostDisplayEvent("shutdown", off ? "1" : "0"); }
+  void setCharSpacing(uint8_t) {}
+  void setTextAlignment(textPosition_t) {}
+  void setZoneEffect(uint8_t, bool, zoneEffect_t) {}
+  void setInvert(bool) {}
+
+  void displayClear() {
+    animEndMs_ = millis();
+    hostDisplayEvent("clear", "");
+  }
+  void print(const char *text) {
+    animEndMs_ = millis();
+    hostDisplayEvent("print", text);
+  }
+
+  // A scroll moves the text in and all the way out: its width plus the
+  // width of the display, one column per speed ms (6 columns a character)
+  void displayScroll(const char *text, textPosition_t, textEffect_t, uint16_t speed) {
+    animEndMs_ = millis() + (unsigned long)(strlen(text) * 6 + columns_) * speed;
+    hostDisplayEvent("scroll", text);
+  }
+  void displayText(const char *text, textPosition_t, uint16_t speed, uint16_t pause, textEffect_t, textEffect_t) {
+    animEndMs_ = millis() + (unsigned long)columns_ * speed + pause;
+    hostDisplayEvent("text", text);
+  }
+  bool displayAnimate() { return millis() >= animEndMs_; }
+  bool getZoneStatus(uint8_t) { return millis() >= animEndMs_; }
+
+ private:
+  unsigned columns_;
+  unsigned long animEndMs_ = 0;
+};
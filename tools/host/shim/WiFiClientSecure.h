@@ -0,0 +1,38 @@
+// Host shim of the BearSSL client: a plain WiFiClient whose connect() also
+// takes the handshake time (hostTlsHandshakeCostMs, see host.h), or the
+// shorter resume time when it was given a session from an earlier handshake
+// with the same server. The other TLS knobs are accepted and ignored.
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+extern unsigned long hostTlsHandshakeCostMs;
+extern unsigned long hostTlsResumeCostMs;
+
+namespace BearSSL {
+class Session {
+ private:
+  friend class WiFiClientSecure;
+  std::string host_;  // server of the handshake it was saved from, if any
+};
+
+class WiFiClientSecure : public ::WiFiClient {
+ public:
+  void setInsecure() {}
+  void setBufferSizes(int, int) {}
+  void setSession(Session *session) { session_ = session; }
+
+  int connect(const char *host, uint16_t port) override {
+    if (!::WiFiClient::connect(host, port)) return 0;
+    bool resume = session_ && session_->host_ == host;
+    delay(resume ? hostTlsResumeCostMs : hostTlsHandshakeCostMs);
+    if (session_) session_->host_ = host;
+    return 1;
+  }
+
+ private:
+  Session *session_ = nullptr;
+};
+}
+
+using BearSSL::WiFiClientSecure;
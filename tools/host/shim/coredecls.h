@@ -0,0 +1,4 @@
+// Host shim: the callback runs whenever configTime() "syncs" (see host.h)
+#pragma once
+
+void settimeofday_cb(void (*cb)());
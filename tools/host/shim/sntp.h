@@ -0,0 +1,3 @@
+#pragma once
+
+inline void sntp_stop() {}
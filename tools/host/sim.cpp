@@ -0,0 +1,192 @@
+// Replays hours of the clock on the virtual clock in a few seconds: display
+// rotation, dimming, the countdown running out, the weather refreshes and
+// Nightscout polls. Prints what reached the display (-f) and where loop()
+// spent its time.
+//
+//   build/esptimecast_sim [-H hours] [-s step_ms] [-c cpu_scale] [-n] [-f] [-v]
+//
+// The loop runs back to back; between passes the clock moves step_ms, plus
+// whatever the pass itself took. That is the time it blocked (delay(), and
+// the ESP8266 connect and TLS handshake costs from host.h unless -n), plus
+// the host CPU time it used times cpu_scale (HOST_ESP8266_CPU_SCALE unless
+// -c says otherwise; -c 0 leaves CPU work out and makes runs repeatable).
+// The scaled CPU time is an estimate: host noise is scaled with it, so read
+// the averages and the section shares rather than single maxima.
+// OpenWeather and Nightscout get canned replies.
+#include "sketch.cpp"
+
+#include "host.h"
+
+#include <chrono>
+#include <map>
+
+static const time_t SIM_EPOCH = 1767225600;  // 2026-01-01 00:00:00 UTC, 01:00 in Berlin
+static const time_t SIM_COUNTDOWN_AT = SIM_EPOCH + 14 * 3600 + 30 * 60;
+
+static std::map<std::string, unsigned> requestsByHost;
+
+static std::string simResponse(const char *host, uint16_t, const std::string &) {
+  requestsByHost[host]++;
+  if (strcmp(host, "api.openweathermap.org") == 0) {
+    return "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\n\r\n"
+           "{\"weather\":[{\"main\":\"Clouds\",\"description\":\"broken clouds\"}],"
+           "\"main\":{\"temp\":3.5,\"humidity\":81},\"sys\":{\"sunrise\":1767250800,\"sunset\":1767281400}}";
+  }
+  if (strcmp(host, "ns.example.com") == 0) {
+    return "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\n\r\n"
+           "[{\"sgv\":112,\"direction\":\"Flat\",\"dateString\":\"2026-01-01T00:00:00.000Z\"}]";
+  }
+  return "HTTP/1.0 404 Not Found\r\n\r\n";
+}
+
+// The settings a configured clock boots with, saved as its snapshot
+static void seedConfig() {
+  configSetDefaults(config);
+  configSetStr(CFG_SSID, "sim");
+  configSetStr(CFG_PASSWORD, "password");
+  configSetStr(CFG_OPENWEATHER_API_KEY, "0123456789abcdef0123456789abcdef");
+  configSetStr(CFG_OPENWEATHER_CITY, "Berlin");
+  configSetStr(CFG_OPENWEATHER_COUNTRY, "DE");
+  configSetStr(CFG_TIME_ZONE, "Europe/Berlin");
+  configSetStr(CFG_NTP_SERVER2, "https://ns.example.com/api/v1/entries.json?count=1");
+  configSetBool(CFG_SHOW_DATE, true);
+  configSetBool(CFG_SHOW_WEATHER_DESCRIPTION, true);
+  configSetBool(CFG_DIMMING_ENABLED, true);
+  configSetInt(CFG_DIM_START_HOUR, 22);
+  configSetInt(CFG_DIM_END_HOUR, 7);
+  configSetBool(CFG_COUNTDOWN_ENABLED, true);
+  configSetTime(CFG_COUNTDOWN_TARGET, SIM_COUNTDOWN_AT);
+  configSetStr(CFG_COUNTDOWN_LABEL, "LAUNCH");
+  configSetStr(CFG_CUSTOM_MESSAGE, "HELLO");
+  saveConfig();
+}
+
+// Local wall-clock time of a virtual millis() value, once NTP has synced
+static std::string wallClock(unsigned long ms) {
+  time_t t = SIM_EPOCH + ms / 1000;
+  struct tm tm;
+  localtime_r(&t, &tm);
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%02d:%02d:%02d.%03lu", tm.tm_hour, tm.tm_min, tm.tm_sec, ms % 1000);
+  return buf;
+}
+
+// Display text with the custom font's glyph codes escaped
+static std::string printable(const std::string &text) {
+  std::string out;
+  for (unsigned char c : text) {
+    if (c >= 0x20 && c < 0x7f) {
+      out += (char)c;
+    } else {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\x%02x", c);
+      out += buf;
+    }
+  }
+  return out;
+}
+
+int main(int argc, char **argv) {
+  double hours = 24;
+  unsigned long stepMs = 10;
+  bool showFrames = false;
+  double cpuScale = HOST_ESP8266_CPU_SCALE;
+  bool networkCosts = true;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-H") == 0 && i + 1 < argc) {
+      hours = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      stepMs = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      cpuScale = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-n") == 0) {
+      networkCosts = false;
+    } else if (strcmp(argv[i], "-f") == 0) {
+      showFrames = true;
+    } else if (strcmp(argv[i], "-v") == 0) {
+      hostSerialEcho = true;
+    } else {
+      fprintf(stderr, "usage: %s [-H hours] [-s step_ms] [-c cpu_scale] [-n] [-f] [-v]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  hostSetEpoch(SIM_EPOCH);
+  hostSetHttpResponder(simResponse);
+  if (!LittleFS.begin()) {
+    fprintf(stderr, "cannot create the LittleFS directory\n");
+    return 1;
+  }
+  seedConfig();
+  if (networkCosts) hostUseEsp8266NetworkCosts();
+  hostSetCpuScale(cpuScale);
+
+  auto started = std::chrono::steady_clock::now();
+  unsigned long long endUs = (unsigned long long)(hours * 3600e6);
+  unsigned long passes = 0;
+  unsigned long long slowestHostNs = 0;
+  size_t framesShown = 0;
+  unsigned long countdownFinishedAt = 0;
+  try {
+    hostCpuBegin();
+    setup();
+    hostCpuEnd();
+    while (hostNowUs() < endUs) {
+      auto passStart = std::chrono::steady_clock::now();
+      hostCpuBegin();
+      loop();
+      hostCpuEnd();
+      unsigned long long hostNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - passStart).count();
+      if (hostNs > slowestHostNs) slowestHostNs = hostNs;
+      passes++;
+
+      if (countdownFinished && !countdownFinishedAt) countdownFinishedAt = millis();
+      if (showFrames) {
+        for (; framesShown < hostDisplayLog.size(); framesShown++) {
+          const HostDisplayEvent &e = hostDisplayLog[framesShown];
+          printf("%s %-9s %s\n", wallClock(e.ms).c_str(), e.kind.c_str(), printable(e.text).c_str());
+        }
+      } else if (hostDisplayLog.size() > 100000) {
+        hostDisplayLog.clear();  // only the counts below are reported
+      }
+      if (hostSerialOutput.size() > (1 << 20)) hostSerialOutput.clear();
+      hostAdvanceMs(stepMs);
+    }
+  } catch (const HostRestart &) {
+    printf("\nsketch restarted at %s, stopping\n", wallClock(millis()).c_str());
+  }
+  double hostSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+  printf("\n== run\n");
+  printf("simulated %.2f h in %.2f s, %lu loop passes (step %lu ms)\n", millis() / 3600e3, hostSeconds, passes, stepMs);
+  printf("slowest pass on this host: %llu us of CPU\n", slowestHostNs / 1000);
+
+  printf("\n== loop passes (virtual time: blocking waits, %s, CPU x %g)\n",
+         networkCosts ? "ESP8266 connect and handshake costs" : "no network costs", cpuScale);
+  printf("budget %lu us, %lu over budget, worst %lu us (heaviest tick '%s', %lu us)\n", LOOP_PASS_BUDGET_US,
+         (unsigned long)loopPassStats.overruns, (unsigned long)loopPassStats.worstUs, loopPassStats.worstTask,
+         (unsigned long)loopPassStats.worstTaskUs);
+  printf("%-20s %10s %10s %10s %10s\n", "section", "count", "avg_us", "max_us", "total_ms");
+  for (int s = 0; s < LOOP_SECTION_COUNT; s++) {
+    const LoopSectionStats &st = loopSectionStats[s];
+    if (st.count == 0) continue;
+    printf("%-20s %10lu %10llu %10lu %10llu\n", LOOP_SECTION_NAMES[s], (unsigned long)st.count,
+           (unsigned long long)st.totalUs / st.count, (unsigned long)st.maxUs, (unsigned long long)st.totalUs / 1000);
+  }
+
+  printf("\n== display\n");
+  for (int m = 0; m < DISPLAY_MODE_COUNT; m++) {
+    printf("%-12s %8.1f min\n", displayModes[m].key, modeDwellMs[m] / 60000.0);
+  }
+  printf("spi transactions %lu, skipped as unchanged %lu\n", displaySpiTransactions, displaySpiSkipped);
+  printf("countdown (%s) finished at %s\n", wallClock((SIM_COUNTDOWN_AT - SIM_EPOCH) * 1000).c_str(),
+         countdownFinishedAt ? wallClock(countdownFinishedAt).c_str() : "never");
+
+  printf("\n== fetches\n");
+  printf("weather %lu (%lu failed), nightscout %lu (%lu failed)\n", (unsigned long)weatherFetchStats.count,
+         (unsigned long)weatherFetchStats.failures, (unsigned long)nightscoutFetchStats.count,
+         (unsigned long)nightscoutFetchStats.failures);
+  for (const auto &r : requestsByHost) printf("requests to %s: %u\n", r.first.c_str(), r.second);
+  printf("config writes %lu, LittleFS bytes written %lu\n", configWrites, fsBytesWritten);
+  return 0;
+}